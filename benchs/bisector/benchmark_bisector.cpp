@@ -0,0 +1,150 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_bisector.cpp
+// Author      : Bertrand Neveu, Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+//
+// Benchmark of the smear-based bisectors on optimization problems.
+//
+// For each problem, the extended system (objective + constraints) is built
+// as in the optimizer and the smear bisectors (SmearMax, SmearSum,
+// SmearSumRelative and SmearMaxRelative) choose the variable to bisect in N
+// boxes obtained by bisecting the initial box of the problem at random.
+// The time spent by each bisector is reported.
+//
+// Usage: benchmark_bisector [N] [file1.bch file2.bch ...]
+//        (N = number of boxes per problem, default 1000;
+//         default problems: all the files of benchs/optim/easy and
+//         benchs/optim/medium, the program must then be run from the root
+//         of the repository)
+//============================================================================
+
+#include "ibex.h"
+#include <cstdlib>
+#include <chrono>
+#include <algorithm>
+#include <dirent.h>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+const char* default_dirs[] = {
+		"benchs/optim/easy",
+		"benchs/optim/medium"
+};
+
+const char* bsc_names[] = { "SmearMax", "SmearSum", "SmearSumRel", "SmearMaxRel" };
+
+const int nb_bsc = 4;
+
+double now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void list_dir(const string& dirname, vector<string>& files) {
+	DIR* dir=opendir(dirname.c_str());
+	if (!dir) {
+		cerr << "Warning: cannot open directory '" << dirname << "'" << endl;
+		return;
+	}
+	vector<string> names;
+	struct dirent* ent;
+	while ((ent=readdir(dir))!=NULL) {
+		string name(ent->d_name);
+		if (name.size()>4 && name.compare(name.size()-4,4,".bch")==0)
+			names.push_back(dirname+"/"+name);
+	}
+	closedir(dir);
+	sort(names.begin(),names.end());
+	files.insert(files.end(),names.begin(),names.end());
+}
+
+void bench(const string& filename, int n, double* total) {
+	System sys(filename.c_str());
+	if (!sys.goal) return; // not an optimization problem
+
+	ExtendedSystem ext(sys, 1e-08);
+	int goal_var=ext.goal_var();
+
+	SmearMax         bsc0(ext, 1e-08);
+	SmearSum         bsc1(ext, 1e-08);
+	SmearSumRelative bsc2(ext, 1e-08);
+	SmearMaxRelative bsc3(ext, 1e-08);
+	Bsc* bsc[nb_bsc] = { &bsc0, &bsc1, &bsc2, &bsc3 };
+
+	// generate the boxes
+	RNG::srand(1);
+	vector<IntervalVector> boxes;
+	for (int i=0; i<n; i++) {
+		IntervalVector box(sys.box);
+		// a few random bisections
+		for (int k=0; k<5; k++) {
+			int v=RNG::rand()%sys.nb_var;
+			if (!box[v].is_bisectable() || box[v].is_unbounded()) continue;
+			pair<IntervalVector,IntervalVector> p=box.bisect(v);
+			box = RNG::rand(0,1)<0.5 ? p.first : p.second;
+		}
+		IntervalVector ext_box(ext.nb_var);
+		ext.write_ext_box(box, ext_box);
+		// the goal variable is bounded by the objective (as
+		// after a contraction in the optimizer)
+		ext_box[goal_var] = sys.goal->eval(box);
+		boxes.push_back(ext_box);
+	}
+
+	cout << filename << " (" << sys.nb_var << " vars, " << sys.nb_ctr << " ctrs)" << endl;
+
+	for (int b=0; b<nb_bsc; b++) {
+		double t=now();
+		int nb_split=0;
+		for (int i=0; i<n; i++) {
+			Cell cell(boxes[i]);
+			bsc[b]->add_property(boxes[i], cell.prop);
+			try {
+				bsc[b]->choose_var(cell);
+				nb_split++;
+			} catch(NoBisectableVariableException&) { }
+		}
+		t=now()-t;
+		total[b]+=t;
+		cout << "   " << bsc_names[b] << "\t: " << t << "s (" << nb_split << " bisections)" << endl;
+	}
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 1000;
+
+	vector<string> files;
+	if (argc>2)
+		for (int i=2; i<argc; i++) files.push_back(argv[i]);
+	else
+		for (unsigned int i=0; i<sizeof(default_dirs)/sizeof(const char*); i++)
+			list_dir(default_dirs[i],files);
+
+	double total[nb_bsc] = { 0, 0, 0, 0 };
+
+	for (vector<string>::const_iterator it=files.begin(); it!=files.end(); ++it) {
+		try {
+			bench(*it,n,total);
+		} catch(UnknownFileException& e) {
+			cerr << "Error: cannot read file '" << e.filename << "'" << endl;
+			return 1;
+		} catch(SyntaxError& e) {
+			cerr << "Warning: cannot load '" << *it << "'" << endl;
+		}
+	}
+
+	cout << "total:" << endl;
+	for (int b=0; b<nb_bsc; b++)
+		cout << "   " << bsc_names[b] << "\t: " << total[b] << "s" << endl;
+
+	return 0;
+}
@@ -0,0 +1,158 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_qinter.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+//
+// Benchmark of the q-intersection contractor on a robust localization
+// problem: P range measurements from random beacons to the point (3,4),
+// with 10% outliers, and q=0.85*P.
+//
+//  - qinter  : time of the exact grid algorithm (if P<=200)
+//              and of the projection algorithm on the boxes
+//              obtained by the sub-contractors on the initial box.
+//  - threads : time of one contraction of CtcQInter with 1 and T threads.
+//
+// CtcQInter is limited to 10^4 cells for the grid algorithm (max_grid_cells).
+//  - paving  : a bisection tree of depth D where every node is contracted
+//              by CtcQInter, with and without the set of discarded
+//              sub-contractors inherited by the sub-nodes (BxpQInter).
+//
+// Usage: benchmark_qinter [P] [T] [D]
+//        (P = number of measurements, default: 10^4;
+//         T = number of threads, default: 4;
+//         D = depth of the bisection tree, default: 6)
+//============================================================================
+
+#include "ibex.h"
+#include "ibex_QInter.h"
+#include "ibex_BxpQInter.h"
+#include <cstdlib>
+#include <chrono>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+double now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// number of calls to the sub-contractors
+long nb_calls=0;
+
+class CountCtc : public Ctc {
+public:
+	CountCtc(Ctc& c) : Ctc(c.nb_var), c(c) { }
+
+	virtual void contract(IntervalVector& box) {
+		nb_calls++;
+		c.contract(box);
+	}
+
+	Ctc& c;
+};
+
+void pave(CtcQInter& ctc, IntervalVector box, const BoxProperties& parent, int depth, int& leaves) {
+	BoxProperties prop(box, parent);
+	ContractContext context(prop);
+	ctc.contract(box, context);
+	if (box.is_empty()) return;
+	if (depth==0) {
+		leaves++;
+		return;
+	}
+	pair<IntervalVector,IntervalVector> p=box.bisect(box.extr_diam_index(false));
+	pave(ctc, p.first, prop, depth-1, leaves);
+	pave(ctc, p.second, prop, depth-1, leaves);
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int P = argc>1 ? atoi(argv[1]) : 10000;
+	int T = argc>2 ? atoi(argv[2]) : 4;
+	int D = argc>3 ? atoi(argv[3]) : 6;
+	int q = (int) (0.85*P);
+
+	RNG::srand(1);
+
+	Array<Function> f(P);
+	Array<Ctc> c(P);
+	Array<Ctc> count(P);
+
+	for (int i=0; i<P; i++) {
+		Variable x(2);
+		double bx=RNG::rand(0,10);
+		double by=RNG::rand(0,10);
+		double d=::sqrt(::pow(bx-3,2)+::pow(by-4,2));
+		if (i%10==0) d=RNG::rand(0,10); // outlier
+		f.set_ref(i,*new Function(x,sqrt(sqr(x[0]-bx)+sqr(x[1]-by))-(d+Interval(-0.1,0.1))));
+		c.set_ref(i,*new CtcFwdBwd(f[i]));
+		count.set_ref(i,*new CountCtc(c[i]));
+	}
+
+	IntervalVector init_box(2,Interval(0,10));
+
+	cout << "P=" << P << " q=" << q << endl;
+
+	// ============= q-intersection algorithms ===========
+	Array<IntervalVector> boxes(P);
+	for (int i=0; i<P; i++) {
+		IntervalVector* b=new IntervalVector(init_box);
+		c[i].contract(*b);
+		boxes.set_ref(i,*b);
+	}
+
+	double t=now();
+	IntervalVector res=qinter_projf(boxes,q);
+	cout << "qinter  : projection=" << now()-t << "s " << res << endl;
+
+	if (P<=200) {
+		t=now();
+		res=qinter(boxes,q);
+		cout << "          grid=" << now()-t << "s " << res << endl;
+	} else
+		cout << "          grid=(skipped)" << endl;
+
+	for (int i=0; i<P; i++)
+		delete &boxes[i];
+
+	// ================ threads ============================
+	for (int nb_threads=1; nb_threads<=T; nb_threads*=T) {
+		CtcQInter ctc(c,q,nb_threads);
+		ctc.max_grid_cells=1e4;
+		IntervalVector box(init_box);
+		t=now();
+		ctc.contract(box);
+		cout << "threads : " << nb_threads << " thread(s)=" << now()-t << "s " << box << endl;
+		if (T==1) break;
+	}
+
+	// ================ paving =============================
+	for (int incremental=0; incremental<=1; incremental++) {
+		CtcQInter ctc(count,q);
+		ctc.max_grid_cells=1e4;
+		BoxProperties root(init_box);
+		if (incremental) ctc.add_property(init_box,root);
+		int leaves=0;
+		nb_calls=0;
+		t=now();
+		pave(ctc, init_box, root, D, leaves);
+		cout << "paving  : " << (incremental? "with BxpQInter   " : "without BxpQInter")
+			 << " time=" << now()-t << "s leaves=" << leaves << " sub-contractions=" << nb_calls << endl;
+	}
+
+	for (int i=0; i<P; i++) {
+		delete &count[i];
+		delete &c[i];
+		delete &f[i];
+	}
+
+	return 0;
+}
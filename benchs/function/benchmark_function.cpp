@@ -0,0 +1,176 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_function.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+//
+// Micro-benchmark of the forward/backward algorithms on functions with
+// many nodes (the time is dominated by the accesses to the node domains,
+// see ExprDomain). The program only uses the public interface of the
+// library so that it can be compiled against different versions.
+//
+// The heap is fragmented before the functions are built, as after a long
+// run of a solver (otherwise, the blocks allocated one after the other
+// for the nodes are likely to be contiguous anyway).
+//
+// Usage: benchmark_function [N]  (N = number of variables, default 200)
+//
+// Functions (R^N->R):
+//   scalar    - sum of N scalar terms (Broyden tridiagonal), ~12N nodes.
+//   vector    - same terms with a vector variable (indexed symbols).
+//
+// Workloads (per function):
+//   domain    - construction of the node domains (ExprDomain).
+//   eval      - forward evaluation (Function::eval).
+//   hc4       - forward-backward contraction (Function::backward).
+//   gradient  - gradient by automatic differentiation (Function::gradient).
+//   inhc4     - inner forward-backward (Function::ibwd).
+//============================================================================
+
+#include "ibex.h"
+#include <cstdlib>
+#include <chrono>
+#include <vector>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+double now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+IntervalVector rand_vec(int n, double lb, double ub) {
+	IntervalVector v(n);
+	for (int i=0; i<n; i++) {
+		double a=RNG::rand(lb,ub);
+		double b=RNG::rand(lb,ub);
+		v[i] = a<b ? Interval(a,b) : Interval(b,a);
+	}
+	return v;
+}
+
+// prevents the compiler from discarding the computations
+double sink=0;
+
+// allocate many small blocks and release half of them at random
+void fragment_heap(vector<char*>& blocks) {
+	for (int i=0; i<1000000; i++)
+		blocks.push_back(new char[8+RNG::rand()%120]);
+	for (size_t i=0; i<blocks.size(); i++)
+		if (RNG::rand()%2) {
+			delete[] blocks[i];
+			blocks[i]=NULL;
+		}
+}
+
+// term i of the Broyden tridiagonal function
+const ExprNode& term(const ExprNode& xm, const ExprNode& xi, const ExprNode& xp) {
+	return sqr((3-2*xi)*xi - xm - 2*xp + 1);
+}
+
+// sum of the terms (balanced tree)
+const ExprNode& sum(const Array<const ExprNode>& terms, int i, int j) {
+	if (i==j) return terms[i];
+	else return sum(terms,i,(i+j)/2) + sum(terms,(i+j)/2+1,j);
+}
+
+Function* scalar_function(int n) {
+	Array<const ExprSymbol> x(n);
+	for (int i=0; i<n; i++)
+		x.set_ref(i, ExprSymbol::new_());
+	Array<const ExprNode> terms(n);
+	for (int i=0; i<n; i++)
+		terms.set_ref(i, term(i>0 ? (const ExprNode&) x[i-1] : ExprConstant::new_scalar(0), x[i],
+				i<n-1 ? (const ExprNode&) x[i+1] : ExprConstant::new_scalar(0)));
+	return new Function(x, sum(terms,0,n-1));
+}
+
+Function* vector_function(int n) {
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(n));
+	Array<const ExprNode> terms(n);
+	for (int i=0; i<n; i++)
+		terms.set_ref(i, term(i>0 ? (const ExprNode&) x[i-1] : ExprConstant::new_scalar(0), x[i],
+				i<n-1 ? (const ExprNode&) x[i+1] : ExprConstant::new_scalar(0)));
+	return new Function(x, sum(terms,0,n-1));
+}
+
+void run(const char* name, Function& f) {
+	int n=f.nb_var();
+	int N=20000000/f.nb_nodes()+1;
+
+	IntervalVector box=rand_vec(n,-1,1);
+
+	double t=now();
+	for (int k=0; k<N/100+1; k++) {
+		ExprDomain d(f);
+		sink+=d.top->i().ub();
+	}
+	double t_domain=now()-t;
+
+	t=now();
+	for (int k=0; k<N; k++)
+		sink+=f.eval(box).ub();
+	double t_eval=now()-t;
+
+	t=now();
+	for (int k=0; k<N; k++) {
+		IntervalVector x(box);
+		f.backward(Interval(0,1),x);
+		sink+=x[0].ub();
+	}
+	double t_hc4=now()-t;
+
+	t=now();
+	for (int k=0; k<N; k++) {
+		IntervalVector g(n);
+		f.gradient(box,g);
+		sink+=g[0].ub();
+	}
+	double t_grad=now()-t;
+
+	IntervalVector xin=box.mid();
+	t=now();
+	for (int k=0; k<N; k++) {
+		IntervalVector x(box);
+		f.ibwd(Interval(-1e8,1e8),x,xin);
+		sink+=x[0].ub();
+	}
+	double t_inhc4=now()-t;
+
+	cout << name << " (" << f.nb_nodes() << " nodes, " << N << " calls)" << endl;
+	cout << "  domain  : " << t_domain << "s" << endl;
+	cout << "  eval    : " << t_eval   << "s" << endl;
+	cout << "  hc4     : " << t_hc4    << "s" << endl;
+	cout << "  gradient: " << t_grad   << "s" << endl;
+	cout << "  inhc4   : " << t_inhc4  << "s" << endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 200;
+
+	RNG::srand(1);
+
+	vector<char*> blocks;
+	fragment_heap(blocks);
+
+	Function* f=scalar_function(n);
+	run("scalar", *f);
+	delete f;
+
+	f=vector_function(n);
+	run("vector", *f);
+	delete f;
+
+	for (size_t i=0; i<blocks.size(); i++)
+		delete[] blocks[i];
+
+	return sink==0.123456789; // (never)
+}
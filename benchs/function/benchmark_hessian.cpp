@@ -0,0 +1,174 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_hessian.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+//
+// Micro-benchmark of the Hessian matrix calculation by automatic
+// differentiation (forward-over-reverse, see Hessian) versus the
+// Jacobian matrix of the symbolic gradient (Function::DIFF), which
+// is how the Kuhn-Tucker contractors used to calculate it.
+//
+// Usage: benchmark_hessian [N]  (N = number of variables, default 50)
+//
+// Functions (R^N->R):
+//   broyden   - sum of the squares of the Broyden tridiagonal terms.
+//   chain     - sum of the cosines of the partial sums x[0]+...+x[i]
+//               (dense Hessian, with shared subexpressions).
+//
+// For each function:
+//   build     - time to build the symbolic gradient (symbolic only).
+//   nodes     - number of nodes of f and of its symbolic gradient.
+//               The AD needs two more domains per node of f (and no
+//               other function).
+//   memory    - growth of the resident set size (in KB) on the first
+//               Hessian calculation (AD) and on the building of the
+//               symbolic gradient (symbolic). Linux only (/proc).
+//   hessian   - full Hessian matrix.
+//   hvp       - Hessian-vector product (AD) / one column of the
+//               Jacobian of the symbolic gradient.
+//============================================================================
+
+#include "ibex.h"
+#include <cstdlib>
+#include <chrono>
+#include <fstream>
+#include <unistd.h>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+double now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+IntervalVector rand_vec(int n, double lb, double ub) {
+	IntervalVector v(n);
+	for (int i=0; i<n; i++) {
+		double a=RNG::rand(lb,ub);
+		double b=RNG::rand(lb,ub);
+		v[i] = a<b ? Interval(a,b) : Interval(b,a);
+	}
+	return v;
+}
+
+// resident set size, in KB (0 if unknown)
+long rss() {
+	ifstream statm("/proc/self/statm");
+	long size=0, resident=0;
+	statm >> size >> resident;
+	return resident*(sysconf(_SC_PAGESIZE)/1024);
+}
+
+// prevents the compiler from discarding the computations
+double sink=0;
+
+// sum of the terms (balanced tree)
+const ExprNode& sum(const Array<const ExprNode>& terms, int i, int j) {
+	if (i==j) return terms[i];
+	else return sum(terms,i,(i+j)/2) + sum(terms,(i+j)/2+1,j);
+}
+
+Function* broyden(int n) {
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(n));
+	Array<const ExprNode> terms(n);
+	for (int i=0; i<n; i++) {
+		const ExprNode* e=&((3-2*x[i])*x[i]+1);
+		if (i>0)   e=&(*e - x[i-1]);
+		if (i<n-1) e=&(*e - 2*x[i+1]);
+		terms.set_ref(i,sqr(*e));
+	}
+	return new Function(x, sum(terms,0,n-1));
+}
+
+Function* chain(int n) {
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(n));
+	Array<const ExprNode> terms(n);
+	const ExprNode* phi=&x[0];
+	terms.set_ref(0,cos(*phi));
+	for (int i=1; i<n; i++) {
+		phi=&(*phi + x[i]);
+		terms.set_ref(i,cos(*phi));
+	}
+	return new Function(x, sum(terms,0,n-1));
+}
+
+void run(const char* name, Function& f) {
+	int n=f.nb_var();
+	int N=200000/(f.nb_nodes()*n/10+1)+1;
+
+	IntervalVector box=rand_vec(n,-1,1);
+	IntervalMatrix H(n,n);
+	IntervalVector u(n,1.0);
+	IntervalVector Hu(n);
+
+	long m=rss();
+	f.hessian(box,H);
+	long m_ad=rss()-m;
+
+	m=rss();
+	double t=now();
+	Function df(f,Function::DIFF);
+	double t_build=now()-t;
+	df.jacobian(box,H);
+	long m_sym=rss()-m;
+
+	t=now();
+	for (int k=0; k<N; k++) {
+		df.jacobian(box,H);
+		sink+=H[0][0].ub();
+	}
+	double t_sym=now()-t;
+
+	t=now();
+	for (int k=0; k<N; k++) {
+		f.hessian(box,H);
+		sink+=H[0][0].ub();
+	}
+	double t_ad=now()-t;
+
+	t=now();
+	for (int k=0; k<10*N; k++) {
+		df.jacobian(box,H,0);
+		sink+=H[0][0].ub();
+	}
+	double t_sym_col=now()-t;
+
+	t=now();
+	for (int k=0; k<10*N; k++) {
+		f.hessian_vector(box,u,Hu);
+		sink+=Hu[0].ub();
+	}
+	double t_hvp=now()-t;
+
+	cout << name << " (" << N << " calls)" << endl;
+	cout << "  build   : symbolic=" << t_build << "s" << endl;
+	cout << "  nodes   : f=" << f.nb_nodes() << " symbolic gradient=" << df.nb_nodes() << endl;
+	cout << "  memory  : symbolic=" << m_sym << "KB  AD=" << m_ad << "KB" << endl;
+	cout << "  hessian : symbolic=" << t_sym << "s  AD=" << t_ad << "s" << endl;
+	cout << "  hvp     : symbolic=" << t_sym_col << "s  AD=" << t_hvp << "s" << endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 50;
+
+	RNG::srand(1);
+
+	Function* f=broyden(n);
+	run("broyden", *f);
+	delete f;
+
+	f=chain(n);
+	run("chain", *f);
+	delete f;
+
+	return sink==0.123456789; // (never)
+}
@@ -0,0 +1,140 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_jacobian.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+//
+// Micro-benchmark of the Jacobian matrix calculation in reverse mode
+// (one backward sweep per row) and forward mode (one forward sweep per
+// color of the compressed Jacobian, see CompressedJacobian).
+//
+// Usage: benchmark_jacobian [N]  (N = number of variables, default 200)
+//
+// Functions (R^N->R^N):
+//   broyden   - Broyden tridiagonal function (3 colors).
+//   chain     - planar kinematic chain: the ith row is the position of
+//               the end of the ith link (lower triangular, with shared
+//               subexpressions).
+//
+// Workloads (per function and mode):
+//   dense     - full Jacobian matrix (Function::jacobian).
+//   sparse    - sparse Jacobian matrix (with the pattern of the function).
+//   column    - all the columns one by one, as in the Hansen matrix.
+//============================================================================
+
+#include "ibex.h"
+#include <cstdlib>
+#include <chrono>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+double now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+IntervalVector rand_vec(int n, double lb, double ub) {
+	IntervalVector v(n);
+	for (int i=0; i<n; i++) {
+		double a=RNG::rand(lb,ub);
+		double b=RNG::rand(lb,ub);
+		v[i] = a<b ? Interval(a,b) : Interval(b,a);
+	}
+	return v;
+}
+
+// prevents the compiler from discarding the computations
+double sink=0;
+
+Function* broyden(int n) {
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(n));
+	Array<const ExprNode> f(n);
+	for (int i=0; i<n; i++) {
+		const ExprNode* e=&((3-2*x[i])*x[i]+1);
+		if (i>0)   e=&(*e - x[i-1]);
+		if (i<n-1) e=&(*e - 2*x[i+1]);
+		f.set_ref(i,*e);
+	}
+	return new Function(x, ExprVector::new_col(f));
+}
+
+Function* chain(int n) {
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(n));
+	Array<const ExprNode> f(n);
+	const ExprNode* phi=&x[0];
+	const ExprNode* p=&cos(*phi);
+	f.set_ref(0,*p);
+	for (int i=1; i<n; i++) {
+		phi=&(*phi + x[i]);
+		p=&(*p + cos(*phi));
+		f.set_ref(i,*p);
+	}
+	return new Function(x, ExprVector::new_col(f));
+}
+
+void run(const char* name, Function& f, Gradient::JacobianMode mode) {
+	int n=f.nb_var();
+	int N=2000000/(f.nb_nodes()*n/10+1)+1;
+
+	IntervalVector box=rand_vec(n,-1,1);
+	IntervalMatrix J(n,n);
+	SparseIntervalMatrix SJ=f.jacobian_pattern();
+
+	f.deriv_calculator().jacobian_mode=mode;
+
+	double t=now();
+	for (int k=0; k<N; k++) {
+		f.jacobian(box,J);
+		sink+=J[0][0].ub();
+	}
+	double t_dense=now()-t;
+
+	t=now();
+	for (int k=0; k<N; k++) {
+		f.jacobian(box,SJ);
+		sink+=SJ[0].ub();
+	}
+	double t_sparse=now()-t;
+
+	t=now();
+	for (int k=0; k<N/10+1; k++) {
+		for (int j=0; j<n; j++)
+			f.jacobian(box,J,j);
+		sink+=J[0][0].ub();
+	}
+	double t_column=now()-t;
+
+	cout << name << " - " << (mode==Gradient::FORWARD_MODE? "forward" : mode==Gradient::REVERSE_MODE? "reverse" : "auto")
+		 << " (" << f.nb_nodes() << " nodes, " << N << " calls)" << endl;
+	cout << "  dense   : " << t_dense  << "s" << endl;
+	cout << "  sparse  : " << t_sparse << "s" << endl;
+	cout << "  column  : " << t_column << "s" << endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 200;
+
+	RNG::srand(1);
+
+	Function* f=broyden(n);
+	run("broyden", *f, Gradient::REVERSE_MODE);
+	run("broyden", *f, Gradient::FORWARD_MODE);
+	run("broyden", *f, Gradient::AUTO_MODE);
+	delete f;
+
+	f=chain(n);
+	run("chain", *f, Gradient::REVERSE_MODE);
+	run("chain", *f, Gradient::FORWARD_MODE);
+	run("chain", *f, Gradient::AUTO_MODE);
+	delete f;
+
+	return sink==0.123456789; // (never)
+}
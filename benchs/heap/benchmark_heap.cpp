@@ -0,0 +1,116 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_heap.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+//
+// Micro-benchmark of the heaps used by the cell buffers of the optimizer
+// (Heap for CellHeap/CellBeamSearch, DoubleHeap for CellDoubleHeap).
+//
+// Only the public interface of the heaps is used, so that the same program
+// can be compiled against different versions of the library to compare
+// implementations.
+//
+// Usage: benchmark_heap [N]  (N = number of elements, default 100000)
+//
+// Workloads:
+//   push/pop  - N pushes followed by N pops.
+//   b&b       - branch & bound-like: pop one element, push two "children"
+//               with a greater cost, and contract the heap from time to time
+//               with a decreasing upper bound.
+//============================================================================
+
+#include "ibex.h"
+#include <cstdlib>
+#include <chrono>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+// an element with two costs (like the lower bound and the upper bound
+// of the objective in a cell)
+struct Elt {
+	Elt(double lb, double ub) : lb(lb), ub(ub) { }
+	double lb;
+	double ub;
+	char padding[64]; // a cell is a big object
+};
+
+struct CostLB : public CostFunc<Elt> {
+	double cost(const Elt& e) const { return e.lb; }
+};
+
+struct CostUB : public CostFunc<Elt> {
+	double cost(const Elt& e) const { return e.ub; }
+};
+
+double now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double rand01() {
+	return RNG::rand(0,1);
+}
+
+template<class H>
+double push_pop(H& h, int n) {
+	RNG::srand(1);
+	double t=now();
+	for (int i=0; i<n; i++) {
+		double lb=rand01();
+		h.push(new Elt(lb,lb+rand01()));
+	}
+	while (!h.empty())
+		delete h.pop();
+	return now()-t;
+}
+
+template<class H>
+double branch_and_bound(H& h, int n) {
+	RNG::srand(1);
+	double t=now();
+	double loup=POS_INFINITY;
+	h.push(new Elt(0,1));
+	for (int i=0; i<n && !h.empty(); i++) {
+		Elt* e=h.pop();
+		for (int j=0; j<2; j++) {
+			double lb=e->lb+0.1*rand01();
+			double ub=lb+rand01();
+			if (ub<loup) loup=ub+0.5; // a bit pessimistic
+			h.push(new Elt(lb,ub));
+		}
+		delete e;
+		if (i%1000==0) h.contract(loup);
+	}
+	h.flush();
+	return now()-t;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 100000;
+
+	CostLB cost1;
+	CostUB cost2;
+
+	{
+		Heap<Elt> h(cost1);
+		cout << "Heap        push/pop: " << push_pop(h,n) << "s" << endl;
+		cout << "Heap        b&b     : " << branch_and_bound(h,n) << "s" << endl;
+	}
+
+	{
+		DoubleHeap<Elt> h(cost1,false,cost2,true,50);
+		cout << "DoubleHeap  push/pop: " << push_pop(h,n) << "s" << endl;
+		cout << "DoubleHeap  b&b     : " << branch_and_bound(h,n) << "s" << endl;
+	}
+
+	return 0;
+}
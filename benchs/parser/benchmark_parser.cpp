@@ -0,0 +1,139 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_parser.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+//
+// Benchmark of the parallel loading of Minibex files.
+//
+// All the systems are first loaded sequentially, then loaded again by T
+// threads (each thread picks the next file to load in a shared queue).
+// The total times and the speedup are reported, and the systems obtained in
+// parallel are checked against the sequential ones (number of variables
+// and constraints).
+//
+// Usage: benchmark_parser [T] [file1.bch file2.bch ...]
+//        (T = number of threads, default: number of cores;
+//         default systems: all the files of benchs/optim/easy and
+//         benchs/optim/medium, the program must then be run from the root
+//         of the repository)
+//============================================================================
+
+#include "ibex.h"
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <dirent.h>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+const char* default_dirs[] = {
+		"benchs/optim/easy",
+		"benchs/optim/medium"
+};
+
+double now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void list_dir(const string& dirname, vector<string>& files) {
+	DIR* dir=opendir(dirname.c_str());
+	if (!dir) {
+		cerr << "Warning: cannot open directory '" << dirname << "'" << endl;
+		return;
+	}
+	vector<string> names;
+	struct dirent* ent;
+	while ((ent=readdir(dir))!=NULL) {
+		string name(ent->d_name);
+		if (name.size()>4 && name.compare(name.size()-4,4,".bch")==0)
+			names.push_back(dirname+"/"+name);
+	}
+	closedir(dir);
+	sort(names.begin(),names.end());
+	files.insert(files.end(),names.begin(),names.end());
+}
+
+// load a system and return its signature (-1 if it cannot be loaded)
+pair<int,int> load(const string& filename) {
+	try {
+		System sys(filename.c_str());
+		return make_pair(sys.nb_var,sys.nb_ctr);
+	} catch(SyntaxError& e) {
+		return make_pair(-1,-1);
+	} catch(UnknownFileException& e) {
+		return make_pair(-1,-1);
+	}
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int nb_threads = argc>1 ? atoi(argv[1]) : (int) thread::hardware_concurrency();
+	if (nb_threads<1) nb_threads=1;
+
+	vector<string> files;
+	if (argc>2)
+		for (int i=2; i<argc; i++) files.push_back(argv[i]);
+	else
+		for (unsigned int i=0; i<sizeof(default_dirs)/sizeof(const char*); i++)
+			list_dir(default_dirs[i],files);
+
+	if (files.empty()) {
+		cerr << "Error: no system to load" << endl;
+		return 1;
+	}
+
+	int n=(int) files.size();
+
+	// ----------------- sequential loading -----------------
+	vector<pair<int,int> > seq(n);
+	double t=now();
+	for (int i=0; i<n; i++)
+		seq[i]=load(files[i]);
+	double t_seq=now()-t;
+
+	// ------------------ parallel loading ------------------
+	vector<pair<int,int> > par(n);
+	atomic<int> next(0);
+	t=now();
+	vector<thread> threads;
+	for (int k=0; k<nb_threads; k++) {
+		threads.push_back(thread([&]() {
+			int i;
+			while ((i=next++)<n)
+				par[i]=load(files[i]);
+		}));
+	}
+	for (int k=0; k<nb_threads; k++) threads[k].join();
+	double t_par=now()-t;
+
+	int nb_failed=0;
+	int nb_diff=0;
+	for (int i=0; i<n; i++) {
+		if (seq[i].first==-1) {
+			cerr << "Warning: cannot load '" << files[i] << "'" << endl;
+			nb_failed++;
+		}
+		if (seq[i]!=par[i]) {
+			cerr << "Error: '" << files[i] << "' differs when loaded in parallel" << endl;
+			nb_diff++;
+		}
+	}
+
+	cout << n << " systems (" << nb_failed << " not loaded)" << endl;
+	cout << "   sequential        : " << t_seq << "s" << endl;
+	cout << "   parallel (" << nb_threads << " thr.) : " << t_par << "s" << endl;
+	cout << "   speedup           : " << t_seq/t_par << endl;
+
+	return nb_diff==0 ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_propag.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+//
+// Benchmark of the propagation loop (CtcPropag) on large systems.
+//
+// For each system, a HC4 contractor is built and called N times on boxes
+// obtained by bisecting the initial box of the system at random, so that
+// the propagation runs on a realistic variety of boxes. The time spent in
+// the constructor (building the constraint network) is reported separately.
+//
+// Usage: benchmark_propag [N] [file1.bch file2.bch ...]
+//        (N = number of contractions per system, default 100;
+//         default systems: the largest instances of benchs/solver, the
+//         program must then be run from the root of the repository)
+//============================================================================
+
+#include "ibex.h"
+#include <cstdlib>
+#include <chrono>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+const char* default_systems[] = {
+		"polynom/BroydenBanded-1000.bch",
+		"polynom/BroydenTri-1000.bch",
+		"polynom/DiscreteBoundary-1000.bch",
+		"polynom/ExtendedFreud-1000.bch",
+		"non-polynom/Trigo1-1000sp.bch"
+};
+
+double now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void bench(const string& filename, int n) {
+	System sys(filename.c_str());
+
+	double t=now();
+	CtcHC4 hc4(sys, 0.01, true);
+	double t_build=now()-t;
+
+	RNG::srand(1);
+
+	int nb_empty=0;
+	double t_contract=0;
+
+	for (int i=0; i<n; i++) {
+		IntervalVector box(sys.box);
+		// a few random bisections
+		for (int k=0; k<5; k++) {
+			int v=RNG::rand()%sys.nb_var;
+			if (!box[v].is_bisectable() || box[v].is_unbounded()) continue;
+			pair<IntervalVector,IntervalVector> p=box.bisect(v);
+			box = RNG::rand(0,1)<0.5 ? p.first : p.second;
+		}
+		t=now();
+		hc4.contract(box);
+		t_contract+=now()-t;
+		if (box.is_empty()) nb_empty++;
+	}
+
+	cout << filename << " (" << sys.nb_var << " vars, " << sys.nb_ctr << " ctrs)" << endl;
+	cout << "   build   : " << t_build << "s" << endl;
+	cout << "   contract: " << t_contract << "s (" << n << " calls, " << nb_empty << " empty)" << endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 100;
+
+	try {
+		if (argc>2)
+			for (int i=2; i<argc; i++)
+				bench(argv[i],n);
+		else
+			for (unsigned int i=0; i<sizeof(default_systems)/sizeof(const char*); i++)
+				bench(string("benchs/solver/")+default_systems[i],n);
+	} catch(UnknownFileException& e) {
+		cerr << "Error: cannot read file '" << e.filename << "'" << endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,150 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_set.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+//
+// Benchmark of the flat representation of sets (SetFlat).
+//
+// A paving of the ring {(x,y), 0<=x^2+y^2<=1} is built with a precision
+// eps and saved in both formats (Set::save and SetFlat::save). Then:
+//  - the loading times of the two formats are compared;
+//  - the throughput of point queries (Set::is_superset with a degenerated
+//    box, SetFlat::contains one point at a time, SetFlat::contains by batch)
+//    and small box queries (Set::is_superset, SetFlat::is_superset by batch)
+//    are compared, and the results are checked to be identical.
+//
+// Usage: benchmark_set [eps] [Q]
+//        (eps = precision of the paving, default: 1e-4;
+//         Q = number of queries, default: 10^6)
+//============================================================================
+
+#include "ibex.h"
+#include "ibex_SetFlat.h"
+#include <cstdlib>
+#include <chrono>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+const char* TREE_FILE="benchmark_set.tree";
+const char* FLAT_FILE="benchmark_set.flat";
+
+double now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double random(double lb, double ub) {
+	return lb + (ub-lb)*((double) rand())/RAND_MAX;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	double eps = argc>1 ? atof(argv[1]) : 1e-4;
+	int Q = argc>2 ? atoi(argv[2]) : 1000000;
+
+	// ================= build the paving =================
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y));
+	SepFwdBwd sep(f,Interval(0,1));
+
+	double t=now();
+	Set set(2);
+	sep.contract(set,eps);
+	double t_build=now()-t;
+
+	SetFlat flat(set);
+
+	cout << "number of nodes:  " << flat.nb_nodes() << endl;
+	cout << "build time:       " << t_build << "s" << endl;
+
+	set.save(TREE_FILE);
+	flat.save(FLAT_FILE);
+
+	// ================= load =================
+	t=now();
+	Set set2(TREE_FILE);
+	double t_load_tree=now()-t;
+
+	t=now();
+	SetFlat flat2(FLAT_FILE);
+	double t_load_flat=now()-t;
+
+	cout << "load (Set):       " << t_load_tree << "s" << endl;
+	cout << "load (SetFlat):   " << t_load_flat << "s" << endl;
+
+	// ================= point queries =================
+	srand(1);
+	Matrix points(Q,2);
+	for (int k=0; k<Q; k++) {
+		points[k][0]=random(-1.5,1.5);
+		points[k][1]=random(-1.5,1.5);
+	}
+
+	BoolInterval* res_tree=new BoolInterval[Q];
+	BoolInterval* res_flat=new BoolInterval[Q];
+	BoolInterval* res_batch=new BoolInterval[Q];
+
+	t=now();
+	for (int k=0; k<Q; k++)
+		res_tree[k]=set2.is_superset(IntervalVector(points[k]));
+	double t_tree=now()-t;
+
+	t=now();
+	for (int k=0; k<Q; k++)
+		res_flat[k]=flat2.contains(points[k]);
+	double t_flat=now()-t;
+
+	t=now();
+	flat2.contains(points,res_batch);
+	double t_batch=now()-t;
+
+	bool ok=true;
+	for (int k=0; k<Q; k++)
+		ok &= res_flat[k]==res_tree[k] && res_batch[k]==res_tree[k];
+
+	cout << "points (Set):           " << Q/t_tree << " queries/s" << endl;
+	cout << "points (SetFlat):       " << Q/t_flat << " queries/s" << endl;
+	cout << "points (SetFlat batch): " << Q/t_batch << " queries/s" << endl;
+
+	// ================= box queries =================
+	IntervalMatrix boxes(Q,2);
+	for (int k=0; k<Q; k++) {
+		double r=random(0,10*eps);
+		boxes[k][0]=Interval(points[k][0]-r,points[k][0]+r);
+		boxes[k][1]=Interval(points[k][1]-r,points[k][1]+r);
+	}
+
+	t=now();
+	for (int k=0; k<Q; k++)
+		res_tree[k]=set2.is_superset(boxes[k]);
+	t_tree=now()-t;
+
+	t=now();
+	flat2.is_superset(boxes,res_batch);
+	t_batch=now()-t;
+
+	for (int k=0; k<Q; k++)
+		ok &= res_batch[k]==res_tree[k];
+
+	cout << "boxes (Set):            " << Q/t_tree << " queries/s" << endl;
+	cout << "boxes (SetFlat batch):  " << Q/t_batch << " queries/s" << endl;
+
+	cout << (ok ? "results: identical" : "results: DIFFERENT") << endl;
+
+	delete[] res_tree;
+	delete[] res_flat;
+	delete[] res_batch;
+
+	remove(TREE_FILE);
+	remove(FLAT_FILE);
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_boxbatch.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+//
+// Micro-benchmark of the whole-box operations on a list of boxes stored
+// as IntervalVector objects and as a BoxBatch (structure of arrays).
+//
+// Usage: benchmark_boxbatch [N] [P]  (N = dimension, default 10,
+//                                     P = number of boxes, default 10000)
+//
+// Workloads:
+//   subset    - inclusion test of every box in a given box.
+//   inter     - intersection of every box with a given box.
+//   hull      - hull of all the boxes.
+//   max_diam  - maximal diameter of every box.
+//   mid       - midpoint of every box.
+//   find      - search of the box containing a point.
+//============================================================================
+
+#include "ibex.h"
+#include <cstdlib>
+#include <chrono>
+#include <vector>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+double now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+IntervalVector rand_box(int n) {
+	IntervalVector b(n);
+	for (int i=0; i<n; i++) {
+		double c=RNG::rand(-10,10);
+		b[i]=Interval(c,c+RNG::rand(0,10));
+	}
+	return b;
+}
+
+// prevents the compiler from discarding the computations
+double sink=0;
+
+int K; // number of repetitions
+
+void run(const char* name, const vector<IntervalVector>& boxes, const BoxBatch& batch, const IntervalVector& y) {
+	int p=batch.size();
+	int n=batch.nb_var();
+	double t_vec=0, t_batch=0;
+
+	if (string(name)=="subset") {
+		BoxBatch by(n); by.push_back(y);
+		double t=now();
+		for (int k=0; k<K; k++) for (int i=0; i<p; i++) sink+=boxes[i].is_subset(y);
+		t_vec=now()-t; t=now();
+		for (int k=0; k<K; k++) for (int i=0; i<p; i++) sink+=batch.is_subset(i,by,0);
+		t_batch=now()-t;
+	} else if (string(name)=="inter") {
+		vector<IntervalVector> boxes2(boxes);
+		BoxBatch batch2(batch);
+		double t=now();
+		for (int k=0; k<K; k++) for (int i=0; i<p; i++) boxes2[i]&=y;
+		t_vec=now()-t; t=now();
+		for (int k=0; k<K; k++) batch2.inter(y);
+		t_batch=now()-t;
+	} else if (string(name)=="hull") {
+		double t=now();
+		for (int k=0; k<K; k++) {
+			IntervalVector h=IntervalVector::empty(n);
+			for (int i=0; i<p; i++) h|=boxes[i];
+			sink+=h[0].ub();
+		}
+		t_vec=now()-t; t=now();
+		for (int k=0; k<K; k++) sink+=batch.hull()[0].ub();
+		t_batch=now()-t;
+	} else if (string(name)=="max_diam") {
+		double t=now();
+		for (int k=0; k<K; k++) for (int i=0; i<p; i++) sink+=boxes[i].max_diam();
+		t_vec=now()-t; t=now();
+		for (int k=0; k<K; k++) for (int i=0; i<p; i++) sink+=batch.max_diam(i);
+		t_batch=now()-t;
+	} else if (string(name)=="mid") {
+		double t=now();
+		for (int k=0; k<K; k++) for (int i=0; i<p; i++) sink+=boxes[i].mid()[0];
+		t_vec=now()-t; t=now();
+		for (int k=0; k<K; k++) for (int i=0; i<p; i++) sink+=batch.mid(i)[0];
+		t_batch=now()-t;
+	} else if (string(name)=="find") {
+		Vector pt=boxes[p-1].mid();
+		double t=now();
+		for (int k=0; k<K; k++) for (int i=0; i<p; i++) if (boxes[i].contains(pt)) { sink+=i; break; }
+		t_vec=now()-t; t=now();
+		for (int k=0; k<K; k++) sink+=batch.find(pt);
+		t_batch=now()-t;
+	}
+
+	cout << name << "\tIntervalVector: " << t_vec << "s\tBoxBatch: " << t_batch << "s\t(x" << t_vec/t_batch << ")" << endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 10;
+	int p = argc>2 ? atoi(argv[2]) : 10000;
+	K = 10000000/(n*p)+1;
+
+	RNG::srand(1);
+
+	vector<IntervalVector> boxes;
+	BoxBatch batch(n);
+	for (int i=0; i<p; i++) {
+		boxes.push_back(rand_box(n));
+		batch.push_back(boxes.back());
+	}
+	IntervalVector y(n,Interval(-15,15));
+
+	const char* workloads[] = { "subset", "inter", "hull", "max_diam", "mid", "find" };
+	for (int w=0; w<6; w++)
+		run(workloads[w], boxes, batch, y);
+
+	return sink==0.123456789; // (never)
+}
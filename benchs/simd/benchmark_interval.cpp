@@ -0,0 +1,145 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_interval.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+//
+// Micro-benchmark of the interval arithmetic. The program only uses the
+// public interface of the library so that it can be compiled against builds
+// with different interval libraries (e.g., -DINTERVAL_LIB=gaol and
+// -DINTERVAL_LIB=simd) to compare them.
+//
+// Usage: benchmark_interval [N]  (N = dimension, default 50)
+//
+// Workloads:
+//   arith     - scalar operations (+,-,*,/,sqr) on random intervals.
+//   matvec    - interval matrix-vector products.
+//   matmat    - interval matrix-matrix products.
+//   eval      - forward evaluation of a function R^N->R^N (Function::eval).
+//   gauss     - Gauss-Seidel iterations (gauss_seidel) on a preconditioned
+//               interval linear system.
+//============================================================================
+
+#include "ibex.h"
+#include <cstdlib>
+#include <chrono>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+double now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+Interval rand_itv(double lb, double ub) {
+	double a=RNG::rand(lb,ub);
+	double b=RNG::rand(lb,ub);
+	return a<b ? Interval(a,b) : Interval(b,a);
+}
+
+IntervalVector rand_vec(int n, double lb, double ub) {
+	IntervalVector v(n);
+	for (int i=0; i<n; i++) v[i]=rand_itv(lb,ub);
+	return v;
+}
+
+IntervalMatrix rand_mat(int n, double lb, double ub) {
+	IntervalMatrix m(n,n);
+	for (int i=0; i<n; i++) m[i]=rand_vec(n,lb,ub);
+	return m;
+}
+
+// prevents the compiler from discarding the computations
+double sink=0;
+
+double arith(int n) {
+	IntervalVector x=rand_vec(n,-10,10);
+	IntervalVector y=rand_vec(n,1,10);
+	double t=now();
+	for (int k=0; k<200000; k++) {
+		Interval s;
+		s=0;
+		for (int i=0; i<n; i++)
+			s+=(x[i]+y[i])*(x[i]-y[i])/y[i]+sqr(x[i]);
+		sink+=s.ub();
+	}
+	return now()-t;
+}
+
+double matvec(int n) {
+	IntervalMatrix A=rand_mat(n,-1,1);
+	IntervalVector x=rand_vec(n,-1,1);
+	double t=now();
+	for (int k=0; k<200000/n; k++) {
+		IntervalVector y=A*x;
+		IntervalVector z=x*A;
+		y+=z;
+		y*=Interval(0.5,1);
+		sink+=y[0].ub();
+	}
+	return now()-t;
+}
+
+double matmat(int n) {
+	IntervalMatrix A=rand_mat(n,-1,1);
+	IntervalMatrix B=rand_mat(n,-1,1);
+	double t=now();
+	for (int k=0; k<200000/(n*n)+1; k++) {
+		IntervalMatrix C=A*B;
+		sink+=C[0][0].ub();
+	}
+	return now()-t;
+}
+
+double eval(int n) {
+	Variable x(n);
+	Array<const ExprNode> comp(n);
+	for (int i=0; i<n; i++)
+		comp.set_ref(i, x[i]*x[(i+1)%n] - sqr(x[i]) + 2*x[(i+2)%n]/(1+sqr(x[(i+3)%n])) - 1);
+	Function f(x,ExprVector::new_col(comp));
+
+	IntervalVector box=rand_vec(n,-1,1);
+	double t=now();
+	for (int k=0; k<2000000/n; k++) {
+		IntervalVector y=f.eval_vector(box);
+		sink+=y[0].ub();
+	}
+	return now()-t;
+}
+
+double gauss(int n) {
+	// diagonally dominant system
+	IntervalMatrix A=rand_mat(n,-0.1,0.1);
+	for (int i=0; i<n; i++) A[i][i]+=Interval(n,n+0.1);
+	IntervalVector b=rand_vec(n,-1,1);
+	precond(A,b);
+	double t=now();
+	for (int k=0; k<100000/n; k++) {
+		IntervalVector x(n,Interval(-10,10));
+		gauss_seidel(A,b,x);
+		sink+=x[0].ub();
+	}
+	return now()-t;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 50;
+
+	RNG::srand(1);
+
+	cout << "arith : " << arith(n)  << "s" << endl;
+	cout << "matvec: " << matvec(n) << "s" << endl;
+	cout << "matmat: " << matmat(n) << "s" << endl;
+	cout << "eval  : " << eval(n)   << "s" << endl;
+	cout << "gauss : " << gauss(n)  << "s" << endl;
+
+	return sink==0.123456789; // (never)
+}
@@ -0,0 +1,150 @@
+#include "ibex_Interval.h"
+
+namespace ibex {
+
+// *** Deprecated ***
+// Note: the first constant also sets the rounding mode upward
+// (like gaol::init() with Gaol).
+const Interval Interval::EMPTY_SET( (fpu_round_up(), SIMD_INTERVAL()) );
+const Interval Interval::ALL_REALS(-(1.0/0.0), (1.0/0.0));
+const Interval Interval::NEG_REALS(-(1.0/0.0), 0.0);
+const Interval Interval::POS_REALS(0.0, (1.0/0.0));
+const Interval Interval::ZERO(0.0);
+const Interval Interval::ONE(1.0);
+const Interval Interval::PI(3.1415926535897931160, 3.1415926535897935601);
+const Interval Interval::TWO_PI(2*3.1415926535897931160, 2*3.1415926535897935601);
+const Interval Interval::HALF_PI(3.1415926535897931160/2, 3.1415926535897935601/2);
+
+const Interval& Interval::empty_set() {
+	static Interval _empty_set((SIMD_INTERVAL()));
+	return _empty_set;
+}
+const Interval& Interval::all_reals() {
+	static Interval _all_reals(-(1.0/0.0), (1.0/0.0));
+	return _all_reals;
+}
+
+const Interval& Interval::neg_reals() {
+	static Interval _neg_reals(-(1.0/0.0),0.0);
+	return _neg_reals;
+}
+
+const Interval& Interval::pos_reals() {
+	static Interval _pos_reals(0.0,(1.0/0.0));
+	return _pos_reals;
+}
+
+const Interval& Interval::zero() {
+	static Interval _zero(0.0);
+	return _zero;
+}
+
+const Interval& Interval::one() {
+	static Interval _one(1.0);
+	return _one;
+}
+
+const Interval& Interval::pi() {
+	static Interval _pi(3.1415926535897931160, 3.1415926535897935601);
+	return _pi;
+}
+
+const Interval& Interval::two_pi() {
+	static Interval _two_pi(2*3.1415926535897931160, 2*3.1415926535897935601);
+	return _two_pi;
+}
+
+const Interval& Interval::half_pi() {
+	static Interval _half_pi(3.1415926535897931160/2, 3.1415926535897935601/2);
+	return _half_pi;
+}
+
+double _simd_pow_bound(double x, int n, bool up) {
+	// binary exponentiation. All the factors are non-negative so
+	// that rounding upward each product gives an upper bound and
+	// rounding upward the opposite gives a lower bound.
+	double r=1;
+	double p=x;
+	while (n>0) {
+		if (n%2==1) r = up ? r*p : -((-r)*p);
+		n/=2;
+		if (n>0) p = up ? p*p : -((-p)*p);
+	}
+	return r;
+}
+
+double _simd_root_bound(double x, int n, bool up) {
+	if (x==0 || x==POS_INFINITY) return x;
+
+	fpu_round_near();
+	double r=::pow(x,1.0/n);
+	fpu_round_up();
+
+	// The libm gives an approximation which is corrected
+	// until r^n is certified to be greater (up) or smaller (down)
+	// than x. The step is doubled at each iteration.
+	int step=1;
+	if (up) {
+		while (_simd_pow_bound(r,n,false)<x) {
+			for (int i=0; i<step; i++) r=next_float(r);
+			step*=2;
+		}
+	} else {
+		while (r>0 && _simd_pow_bound(r,n,true)>x) {
+			for (int i=0; i<step; i++) r=previous_float(r);
+			step*=2;
+		}
+		if (r<0) r=0;
+	}
+	return r;
+}
+
+Interval _simd_sin_cos(const Interval& x, bool cosine) {
+	if (x.is_empty()) return Interval::empty_set();
+
+	static const Interval minus_one_one(-1,1);
+
+	if (x.is_unbounded() || x.diam()>=Interval::two_pi().lb()) return minus_one_one;
+
+	// sin(x)=cos(x-pi/2). The extrema of cos are the
+	// multiples of pi (even: maximum, odd: minimum).
+	Interval y=cosine ? x : x-Interval::half_pi();
+
+	double k=std::floor(y.lb()/Interval::pi().mid());
+	if (::fabs(k)>1e15) return minus_one_one;
+
+	bool max=false;
+	bool min=false;
+	for (int i=-1; i<=3; i++) {
+		double j=k+i;
+		Interval e=j*Interval::pi();
+		if (e.lb()<=y.ub() && e.ub()>=y.lb()) {
+			if (std::fmod(j,2.0)==0) max=true;
+			else min=true;
+		}
+	}
+
+	const double a=x.lb(), b=x.ub();
+	fpu_round_near();
+	double fa=cosine ? ::cos(a) : ::sin(a);
+	double fb=cosine ? ::cos(b) : ::sin(b);
+	fpu_round_up();
+
+	// the functions are exact at 0
+	double la=a==0 ? fa : _simd_lo(fa), ua=a==0 ? fa : _simd_hi(fa);
+	double lb=b==0 ? fb : _simd_lo(fb), ub=b==0 ? fb : _simd_hi(fb);
+
+	double l=min ? -1 : (la<lb ? la : lb);
+	double u=max ?  1 : (ua>ub ? ua : ub);
+
+	return Interval(l,u) & minus_one_one;
+}
+
+std::ostream& operator<<(std::ostream& os, const Interval& x) {
+	if (x.is_empty())
+		return os << "[ empty ]";
+	else
+		return os << "[" << x.lb() << ", " << x.ub() << "]";
+}
+
+} // end namespace
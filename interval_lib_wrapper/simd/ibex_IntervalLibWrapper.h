@@ -0,0 +1,75 @@
+/* ============================================================================
+ * I B E X - Interval type of the SIMD interval library wrapper
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef _IBEX_INTERVALLIBWRAPPER_H_
+#define _IBEX_INTERVALLIBWRAPPER_H_
+
+#include <math.h>
+#include <limits>
+#include <emmintrin.h>
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
+#define IBEX_INTERVAL_LIB_NEG_INFINITY (-std::numeric_limits<double>::infinity())
+#define IBEX_INTERVAL_LIB_POS_INFINITY (std::numeric_limits<double>::infinity())
+
+/**
+ * \brief Interval stored in a SSE2 register.
+ *
+ * The interval [a,b] is stored as the pair (-a,b): the first (low) lane
+ * contains the opposite of the lower bound and the second (high) lane
+ * the upper bound. The rounding mode is kept upward, so that both bounds
+ * are rounded outward by a single packed operation (since -(x op y)
+ * rounded upward is (x op y) rounded downward).
+ *
+ * The empty set is represented by (NaN,NaN).
+ */
+class SIMD_INTERVAL {
+public:
+	/** \brief Create the empty set. */
+	SIMD_INTERVAL() : v(_mm_set1_pd(std::numeric_limits<double>::quiet_NaN())) { }
+
+	/** \brief Create [a,b] (no check). */
+	SIMD_INTERVAL(double a, double b) : v(_mm_set_pd(b,-a)) { }
+
+	/** \brief Create [a,a]. */
+	SIMD_INTERVAL(double a) : v(_mm_set_pd(a,-a)) { }
+
+	/** \brief Create an interval from a register (-a,b). */
+	explicit SIMD_INTERVAL(__m128d v) : v(v) { }
+
+	/** \brief Lower bound. */
+	double inf() const { return -_mm_cvtsd_f64(v); }
+
+	/** \brief Upper bound. */
+	double sup() const { return _mm_cvtsd_f64(_mm_unpackhi_pd(v,v)); }
+
+	/** \brief The pair (-a,b). */
+	__m128d v;
+};
+
+namespace ibex {
+  typedef SIMD_INTERVAL interval_type_wrapper;
+
+  static inline double
+  _interval_distance_wrapper (const interval_type_wrapper &x1,
+                              const interval_type_wrapper &x2)
+  {
+    // |x1-x2| for both lanes (rounded upward) then maximum
+    __m128d d=_mm_sub_pd(x1.v,x2.v);
+    d=_mm_andnot_pd(_mm_set1_pd(-0.0),d);
+    d=_mm_max_sd(d,_mm_unpackhi_pd(d,d));
+    return _mm_cvtsd_f64(d);
+  }
+}
+
+#endif /* _IBEX_INTERVALLIBWRAPPER_H_ */
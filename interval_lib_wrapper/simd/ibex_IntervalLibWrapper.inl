@@ -0,0 +1,922 @@
+/* ============================================================================
+ * I B E X - Implementation of the Interval class with SSE2 intrinsics
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef _IBEX_INTERVALLIBWRAPPER_INL_
+#define _IBEX_INTERVALLIBWRAPPER_INL_
+
+#include "ibex_Exception.h"
+#include <cassert>
+#include <cfenv>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+
+/*
+ * Important: the rounding mode is set upward once for all (as with Gaol)
+ * when the library is initialized and all the functions below assume
+ * it is still the case when they are called. Functions that switch to
+ * another rounding mode (like the elementary functions that call the libm)
+ * restore it before returning.
+ *
+ * The arithmetic operators (+,-,*,/), sqr and sqrt are computed with
+ * correct (outward) rounding. Other elementary functions are computed with
+ * the libm (in round-to-nearest mode) and the result is enlarged by two ulps,
+ * which assumes the libm is accurate up to two ulps (this is the case of the
+ * GNU libm for all the functions used here).
+ */
+
+namespace ibex {
+
+inline void fpu_round_down() {
+	std::fesetround(FE_DOWNWARD);
+}
+
+inline void fpu_round_up() {
+	std::fesetround(FE_UPWARD);
+}
+
+inline void fpu_round_near() {
+	std::fesetround(FE_TONEAREST);
+}
+
+inline double previous_float(double x) {
+	return std::nextafter(x, NEG_INFINITY);
+}
+
+inline double next_float(double x) {
+	return std::nextafter(x, POS_INFINITY);
+}
+
+/*================================== internal functions ========================================*/
+
+// (a,b) -> (b,a)
+inline __m128d _simd_swap(__m128d x) {
+	return _mm_shuffle_pd(x,x,1);
+}
+
+// (a,b) -> (a,a)
+inline __m128d _simd_dup_lo(__m128d x) {
+	return _mm_unpacklo_pd(x,x);
+}
+
+// (a,b) -> (b,b)
+inline __m128d _simd_dup_hi(__m128d x) {
+	return _mm_unpackhi_pd(x,x);
+}
+
+// (a,b) -> (-a,b)
+inline __m128d _simd_neg_lo(__m128d x) {
+	return _mm_xor_pd(x,_mm_set_pd(0.0,-0.0));
+}
+
+// (a,b) -> (a,-b)
+inline __m128d _simd_neg_hi(__m128d x) {
+	return _mm_xor_pd(x,_mm_set_pd(-0.0,0.0));
+}
+
+// Replace NaN by 0 (in the products of bounds, 0*oo must be 0).
+inline __m128d _simd_nan_to_zero(__m128d x) {
+	return _mm_andnot_pd(_mm_cmpunord_pd(x,x),x);
+}
+
+// Lower bound of an interval enclosing f(x) where y is the result
+// of the libm for f(x), computed with the rounding mode set to nearest.
+inline double _simd_lo(double y) {
+	if (y==POS_INFINITY) return DBL_MAX; // overflow
+	return previous_float(previous_float(y));
+}
+
+// Upper bound of an interval enclosing f(x) where y is the result
+// of the libm for f(x), computed with the rounding mode set to nearest.
+inline double _simd_hi(double y) {
+	if (y==NEG_INFINITY) return -DBL_MAX; // overflow
+	return next_float(next_float(y));
+}
+
+// Product of [x1] and [x2] (both non-empty)
+inline __m128d _simd_mul(__m128d x1, __m128d x2) {
+	const double na=_mm_cvtsd_f64(x1);
+	const double b =_mm_cvtsd_f64(_simd_dup_hi(x1));
+	const double nc=_mm_cvtsd_f64(x2);
+	const double d =_mm_cvtsd_f64(_simd_dup_hi(x2));
+
+	// The result is (-lb,ub). Each bound is a product of two bounds of
+	// x1 and x2. The lower bound is obtained by negating one of the two
+	// factors, so that the product rounded upward is the opposite of the
+	// lower bound rounded downward.
+	__m128d r;
+	if (na<=0) {                                                  // a>=0
+		if (nc<=0)     r=_mm_mul_pd(x1,_simd_neg_lo(x2));             // [a*c, b*d]
+		else if (d<=0) r=_mm_mul_pd(_simd_neg_hi(_simd_swap(x1)),x2); // [b*c, a*d]
+		else           r=_mm_mul_pd(_simd_dup_hi(x1),x2);             // [b*c, b*d]
+	} else if (b<=0) {                                            // b<=0
+		if (nc<=0)     r=_mm_mul_pd(x1,_simd_neg_hi(_simd_swap(x2))); // [a*d, b*c]
+		else if (d<=0) r=_mm_mul_pd(_simd_neg_lo(_simd_swap(x1)),     // [b*d, a*c]
+		                            _simd_swap(x2));
+		else           r=_mm_mul_pd(_simd_dup_lo(x1),_simd_swap(x2)); // [a*d, a*c]
+	} else {                                                      // a<0<b
+		if (nc<=0)     r=_mm_mul_pd(x1,_simd_dup_hi(x2));             // [a*d, b*d]
+		else if (d<=0) r=_mm_mul_pd(_simd_swap(x1),_simd_dup_lo(x2)); // [b*c, a*c]
+		else           r=_mm_max_pd(_mm_mul_pd(x1,_simd_dup_hi(x2)),  // [min(a*d,b*c),
+		                            _mm_mul_pd(_simd_swap(x1),_simd_dup_lo(x2))); //  max(b*d,a*c)]
+	}
+	return _simd_nan_to_zero(r);
+}
+
+// Product of [x] by a non-negative and finite interval [c,d]
+// (branch-free, used by the batch operations)
+inline __m128d _simd_mul_pos(__m128d x, __m128d cd, __m128d dc) {
+	// lower bound: a*c if a>=0, a*d otherwise
+	// upper bound: b*d if b>=0, b*c otherwise
+	__m128d pos=_mm_cmpge_pd(_simd_neg_lo(x),_mm_setzero_pd());
+	__m128d m=_mm_or_pd(_mm_and_pd(pos,cd),_mm_andnot_pd(pos,dc));
+	return _simd_nan_to_zero(_mm_mul_pd(x,m));
+}
+
+// Upper (up=true) or lower (up=false) bound of x^n, for x>=0 and n>=1.
+double _simd_pow_bound(double x, int n, bool up);
+
+// Upper (up=true) or lower (up=false) bound of x^(1/n), for x>=0 and n>=1.
+double _simd_root_bound(double x, int n, bool up);
+
+// Enclosure of sin (cosine=false) or cos (cosine=true).
+Interval _simd_sin_cos(const Interval& x, bool cosine);
+
+/*================================== Interval class ========================================*/
+
+inline Interval::Interval(const SIMD_INTERVAL& x) : itv(x) {
+
+}
+
+inline Interval& Interval::operator=(const SIMD_INTERVAL& x) {
+	this->itv = x;
+	return *this;
+}
+
+inline Interval& Interval::operator+=(double d) {
+	if (d==NEG_INFINITY || d==POS_INFINITY) set_empty();
+	else itv.v=_mm_add_pd(itv.v,_mm_set_pd(d,-d));
+	return *this;
+}
+
+inline Interval& Interval::operator-=(double d) {
+	if (d==NEG_INFINITY || d==POS_INFINITY) set_empty();
+	else itv.v=_mm_add_pd(itv.v,_mm_set_pd(-d,d));
+	return *this;
+}
+
+inline Interval& Interval::operator*=(double d) {
+	if (d==NEG_INFINITY || d==POS_INFINITY) set_empty();
+	else if (!is_empty()) {
+		if (d>=0) itv.v=_simd_nan_to_zero(_mm_mul_pd(itv.v,_mm_set1_pd(d)));
+		else      itv.v=_simd_nan_to_zero(_mm_mul_pd(_simd_swap(itv.v),_mm_set1_pd(-d)));
+	}
+	return *this;
+}
+
+inline Interval& Interval::operator/=(double d) {
+	if (d==NEG_INFINITY || d==POS_INFINITY || d==0) set_empty();
+	else if (d>0) itv.v=_mm_div_pd(itv.v,_mm_set1_pd(d));
+	else          itv.v=_mm_div_pd(_simd_swap(itv.v),_mm_set1_pd(-d));
+	return *this;
+}
+
+inline Interval& Interval::operator+=(const Interval& x) {
+	// note: NaN (empty set) is propagated
+	itv.v=_mm_add_pd(itv.v,x.itv.v);
+	return *this;
+}
+
+inline Interval& Interval::operator-=(const Interval& x) {
+	// note: NaN (empty set) is propagated
+	itv.v=_mm_add_pd(itv.v,_simd_swap(x.itv.v));
+	return *this;
+}
+
+inline Interval& Interval::operator*=(const Interval& x) {
+	if (is_empty()) return *this;
+	if (x.is_empty()) { set_empty(); return *this; }
+	itv.v=_simd_mul(itv.v,x.itv.v);
+	return *this;
+}
+
+inline Interval& Interval::operator/=(const Interval& y) {
+
+	if (is_empty()) return *this;
+	if (y.is_empty()) { set_empty(); return *this; }
+
+	const double a(lb());
+	const double b(ub());
+	const double c(y.lb());
+	const double d(y.ub());
+
+	if (c==0 && d==0) { set_empty(); return *this; }
+
+	if (a==0 && b==0) return *this;
+
+	// The result is (-lb,ub) where each bound is a quotient
+	// of two bounds (the lower one with a negated numerator).
+	__m128d num, den;
+
+	if (c>0) {
+		if (a>=0)     { num=itv.v;                  den=_mm_set_pd(c,d); } // [a/d, b/c]
+		else if (b<0) { num=itv.v;                  den=_mm_set_pd(d,c); } // [a/c, b/d]
+		else          { num=itv.v;                  den=_mm_set1_pd(c);  } // [a/c, b/c]
+	} else if (d<0) {
+		num=_simd_swap(itv.v); // (b,-a)
+		if (a>=0)     den=_mm_set_pd(-c,-d);                               // [b/d, a/c]
+		else if (b<0) den=_mm_set_pd(-d,-c);                               // [b/c, a/d]
+		else          den=_mm_set1_pd(-d);                                 // [b/d, a/d]
+	} else {
+		// 0 is in y
+		if (b<=0 && d==0)      *this=Interval(-(-b/c), POS_INFINITY);   // [b/c, +oo)
+		else if (b<=0 && c==0) *this=Interval(NEG_INFINITY, b/d);       // (-oo, b/d]
+		else if (a>=0 && d==0) *this=Interval(NEG_INFINITY, a/c);       // (-oo, a/c]
+		else if (a>=0 && c==0) *this=Interval(-(-a/d), POS_INFINITY);   // [a/d, +oo)
+		else                   *this=Interval::all_reals();
+		return *this;
+	}
+	itv.v=_mm_div_pd(num,den);
+	return *this;
+}
+
+inline Interval Interval::operator-() const {
+	return SIMD_INTERVAL(_simd_swap(itv.v));
+}
+
+inline Interval& Interval::div2_inter(const Interval& x, const Interval& y) {
+	Interval out2;
+	div2_inter(x,y,out2);
+	*this |= out2;
+	return *this;
+}
+
+inline void Interval::set_empty() {
+	itv=SIMD_INTERVAL();
+}
+
+inline Interval& Interval::operator&=(const Interval& x) {
+	if (is_empty()) return *this;
+	if (x.is_empty()) { set_empty(); return *this; }
+
+	// (-max(a,c), min(b,d))
+	itv.v=_mm_min_pd(itv.v,x.itv.v);
+	if (lb()>ub()) set_empty();
+	return *this;
+}
+
+inline Interval& Interval::operator|=(const Interval& x) {
+	if (is_empty()) { *this=x; return *this; }
+	if (x.is_empty()) return *this;
+
+	// (-min(a,c), max(b,d))
+	itv.v=_mm_max_pd(itv.v,x.itv.v);
+	return *this;
+}
+
+inline double Interval::lb() const {
+	return itv.inf();
+}
+
+inline double Interval::ub() const {
+	return itv.sup();
+}
+
+inline double Interval::mid() const {
+	const double a=lb();
+	const double b=ub();
+	if (a==-b) return 0; // includes (-oo,+oo)
+	else if (a==NEG_INFINITY) return -DBL_MAX;
+	else if (b==POS_INFINITY) return DBL_MAX;
+	else {
+		double m=0.5*a+0.5*b; // no overflow
+		if (m<a) m=a; // watch dog
+		else if (m>b) m=b;
+		return m;
+	}
+}
+
+inline bool Interval::is_empty() const {
+	const double na=_mm_cvtsd_f64(itv.v);
+	return na!=na;
+}
+
+inline bool Interval::is_degenerated() const {
+	return is_empty() || lb()==ub();
+}
+
+inline bool Interval::is_unbounded() const {
+	if (is_empty()) return false;
+	return lb()==NEG_INFINITY || ub()==POS_INFINITY;
+}
+
+inline double Interval::diam() const {
+	if (is_empty()) return 0;
+	// b+(-a) rounded upward
+	return _mm_cvtsd_f64(_mm_add_sd(_simd_dup_hi(itv.v),itv.v));
+}
+
+inline double Interval::mig() const {
+	if (lb()>0)      return lb();
+	else if (ub()<0) return -ub();
+	else             return 0;
+}
+
+inline double Interval::mag() const {
+	__m128d m=_mm_andnot_pd(_mm_set1_pd(-0.0),itv.v);
+	return _mm_cvtsd_f64(_mm_max_sd(m,_simd_dup_hi(m)));
+}
+
+inline Interval operator&(const Interval& x1, const Interval& x2) {
+	Interval res(x1);
+	res &= x2;
+	return res;
+}
+
+inline Interval operator|(const Interval& x1, const Interval& x2) {
+	Interval res(x1);
+	res |= x2;
+	return res;
+}
+
+inline Interval operator+(const Interval& x, double d) {
+	return Interval(x)+=d;
+}
+
+inline Interval operator-(const Interval& x, double d) {
+	return Interval(x)-=d;
+}
+
+inline Interval operator*(const Interval& x, double d) {
+	return Interval(x)*=d;
+}
+
+inline Interval operator/(const Interval& x, double d) {
+	return Interval(x)/=d;
+}
+
+inline Interval operator+(double d,const Interval& x) {
+	return Interval(x)+=d;
+}
+
+inline Interval operator-(double d, const Interval& x) {
+	return (-x)+=d;
+}
+
+inline Interval operator*(double d, const Interval& x) {
+	return Interval(x)*=d;
+}
+
+inline Interval operator/(double d, const Interval& x) {
+	if (d==NEG_INFINITY || d==POS_INFINITY) return Interval::empty_set();
+	else return Interval(d)/=x;
+}
+
+inline Interval operator+(const Interval& x1, const Interval& x2) {
+	return Interval(x1)+=x2;
+}
+
+inline Interval operator-(const Interval& x1, const Interval& x2) {
+	return Interval(x1)-=x2;
+}
+
+inline Interval operator*(const Interval& x1, const Interval& x2) {
+	return Interval(x1)*=x2;
+}
+
+inline Interval operator/(const Interval& x1, const Interval& x2) {
+	return Interval(x1)/=x2;
+}
+
+inline Interval sqr(const Interval& x) {
+	if (x.is_empty()) return x;
+	const double a=x.lb(), b=x.ub();
+	if (a>=0)      return SIMD_INTERVAL(_mm_mul_pd(x.itv.v,_simd_neg_lo(x.itv.v)));    // [a*a, b*b]
+	else if (b<=0) return SIMD_INTERVAL(_mm_mul_pd(_simd_neg_lo(_simd_swap(x.itv.v)),  // [b*b, a*a]
+	                                               _simd_swap(x.itv.v)));
+	else {
+		__m128d m=_mm_mul_pd(x.itv.v,x.itv.v);
+		return SIMD_INTERVAL(_mm_move_sd(_mm_max_pd(m,_simd_swap(m)),_mm_set_sd(-0.0))); // [0, max(a*a,b*b)]
+	}
+}
+
+inline Interval sqrt(const Interval& x) {
+	if (x.is_empty() || x.ub()<0) return Interval::empty_set();
+	const double a=x.lb()<0 ? 0 : x.lb();
+	// both square roots rounded upward
+	__m128d s=_mm_sqrt_pd(_mm_set_pd(x.ub(),a));
+	double l=_mm_cvtsd_f64(s);
+	// the lower bound is l if the root is exact, the previous float otherwise
+	if (l*l!=a || -((-l)*l)!=a) l=previous_float(l);
+	return Interval(l,_mm_cvtsd_f64(_simd_dup_hi(s)));
+}
+
+inline Interval pow(const Interval& x, int n) {
+	if (x.is_empty()) return Interval::empty_set();
+	else if (n==0)    return Interval::one();
+	else if (n<0)     return 1.0/pow(x,-n);
+	else if (n==1)    return x;
+	else if (n==2)    return sqr(x);
+	else if (n%2==0)  return Interval(_simd_pow_bound(x.mig(),n,false), _simd_pow_bound(x.mag(),n,true));
+	else if (x.lb()>=0)
+		return Interval(_simd_pow_bound(x.lb(),n,false), _simd_pow_bound(x.ub(),n,true));
+	else if (x.ub()<=0)
+		return Interval(-_simd_pow_bound(-x.lb(),n,true), -_simd_pow_bound(-x.ub(),n,false));
+	else
+		return Interval(-_simd_pow_bound(-x.lb(),n,true), _simd_pow_bound(x.ub(),n,true));
+}
+
+inline Interval pow(const Interval& x, double d) {
+	if (d==NEG_INFINITY || d==POS_INFINITY)
+		return Interval::empty_set();
+	else if (d==0)
+		return Interval::one();
+	else if (::fabs(d)<=INT_MAX && d==std::floor(d))
+		return pow(x,(int) d);
+	else
+		return pow(x,Interval(d));
+}
+
+inline Interval pow(const Interval &x, const Interval &y) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return exp(y * log(x));
+}
+
+inline Interval root(const Interval& x, int den) {
+	if (x.is_empty() || den==0) return Interval::empty_set();
+	if (den<0) return 1.0/root(x,-den);
+	if (den==1) return x;
+
+	if (den%2==0) {
+		if (x.ub()<0) return Interval::empty_set();
+		const double a=x.lb()<0 ? 0 : x.lb();
+		return Interval(_simd_root_bound(a,den,false), _simd_root_bound(x.ub(),den,true));
+	} else if (x.lb()>=0)
+		return Interval(_simd_root_bound(x.lb(),den,false), _simd_root_bound(x.ub(),den,true));
+	else if (x.ub()<=0)
+		return Interval(-_simd_root_bound(-x.lb(),den,true), -_simd_root_bound(-x.ub(),den,false));
+	else
+		return Interval(-_simd_root_bound(-x.lb(),den,true), _simd_root_bound(x.ub(),den,true));
+}
+
+inline Interval exp(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	const double a=x.lb(), b=x.ub();
+	fpu_round_near();
+	double l=::exp(a), u=::exp(b);
+	fpu_round_up();
+	return Interval(a==0? 1 : _simd_lo(l), b==0? 1 : _simd_hi(u)) & Interval::pos_reals();
+}
+
+inline Interval log(const Interval& x) {
+	if (x.is_empty() || x.ub()<=0) return Interval::empty_set();
+	const double a=x.lb(), b=x.ub();
+	fpu_round_near();
+	double l=a<=0? NEG_INFINITY : ::log(a), u=::log(b);
+	fpu_round_up();
+	return Interval(a==1? 0 : _simd_lo(l), b==1? 0 : _simd_hi(u));
+}
+
+inline Interval cos(const Interval& x) {
+	return _simd_sin_cos(x,true);
+}
+
+inline Interval sin(const Interval& x) {
+	return _simd_sin_cos(x,false);
+}
+
+inline Interval tan(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	if (x.is_unbounded() || x.diam()>=Interval::pi().lb()) return Interval::all_reals();
+
+	// tan is increasing except at poles, which are -pi/2+k*pi.
+	// k is approximated and the neighbouring poles are checked rigorously.
+	Interval y=x+Interval::half_pi();
+	double k=std::floor(y.lb()/Interval::pi().mid());
+	if (::fabs(k)>1e15) return Interval::all_reals();
+	for (int i=-1; i<=2; i++) {
+		Interval pole=(k+i)*Interval::pi();
+		if (pole.lb()<=y.ub() && pole.ub()>=y.lb()) return Interval::all_reals();
+	}
+
+	const double a=x.lb(), b=x.ub();
+	fpu_round_near();
+	double l=::tan(a), u=::tan(b);
+	fpu_round_up();
+	return Interval(a==0? 0 : _simd_lo(l), b==0? 0 : _simd_hi(u));
+}
+
+inline Interval cosh(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	const double a=x.mig(), b=x.mag();
+	fpu_round_near();
+	double l=::cosh(a), u=::cosh(b);
+	fpu_round_up();
+	return Interval(a==0? 1 : _simd_lo(l), _simd_hi(u)) & Interval(1,POS_INFINITY);
+}
+
+inline Interval acos(const Interval& x) {
+	Interval y=x & Interval(-1,1);
+	if (y.is_empty()) return Interval::empty_set();
+	const double a=y.lb(), b=y.ub();
+	fpu_round_near();
+	double l=::acos(b), u=::acos(a);
+	fpu_round_up();
+	return Interval(b==1? 0 : _simd_lo(l), _simd_hi(u)) & Interval(0,Interval::pi().ub());
+}
+
+inline Interval asin(const Interval& x) {
+	Interval y=x & Interval(-1,1);
+	if (y.is_empty()) return Interval::empty_set();
+	const double a=y.lb(), b=y.ub();
+	fpu_round_near();
+	double l=::asin(a), u=::asin(b);
+	fpu_round_up();
+	return Interval(a==0? 0 : _simd_lo(l), b==0? 0 : _simd_hi(u))
+			& Interval(-Interval::half_pi().ub(),Interval::half_pi().ub());
+}
+
+inline Interval atan(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	const double a=x.lb(), b=x.ub();
+	fpu_round_near();
+	double l=::atan(a), u=::atan(b);
+	fpu_round_up();
+	return Interval(a==0? 0 : _simd_lo(l), b==0? 0 : _simd_hi(u))
+			& Interval(-Interval::half_pi().ub(),Interval::half_pi().ub());
+}
+
+inline Interval sinh(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	const double a=x.lb(), b=x.ub();
+	fpu_round_near();
+	double l=::sinh(a), u=::sinh(b);
+	fpu_round_up();
+	return Interval(a==0? 0 : _simd_lo(l), b==0? 0 : _simd_hi(u));
+}
+
+inline Interval tanh(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	const double a=x.lb(), b=x.ub();
+	fpu_round_near();
+	double l=::tanh(a), u=::tanh(b);
+	fpu_round_up();
+	return Interval(a==0? 0 : _simd_lo(l), b==0? 0 : _simd_hi(u)) & Interval(-1,1);
+}
+
+inline Interval acosh(const Interval& x) {
+	if (x.is_empty() || x.ub()<1) return Interval::empty_set();
+	const double a=x.lb()<1? 1 : x.lb(), b=x.ub();
+	fpu_round_near();
+	double l=::acosh(a), u=::acosh(b);
+	fpu_round_up();
+	return Interval(a==1? 0 : _simd_lo(l), _simd_hi(u)) & Interval::pos_reals();
+}
+
+inline Interval asinh(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	const double a=x.lb(), b=x.ub();
+	fpu_round_near();
+	double l=::asinh(a), u=::asinh(b);
+	fpu_round_up();
+	return Interval(a==0? 0 : _simd_lo(l), b==0? 0 : _simd_hi(u));
+}
+
+inline Interval atanh(const Interval& x) {
+	Interval y=x & Interval(-1,1);
+	if (y.is_empty()) return Interval::empty_set();
+	const double a=y.lb(), b=y.ub();
+	if (a==1 || b==-1) return Interval::empty_set(); // atanh(+/-1) is infinite
+	fpu_round_near();
+	double l=a==-1? NEG_INFINITY : ::atanh(a), u=b==1? POS_INFINITY : ::atanh(b);
+	fpu_round_up();
+	return Interval(a==0? 0 : _simd_lo(l), b==0? 0 : _simd_hi(u));
+}
+
+inline Interval abs(const Interval &x) {
+	if (x.is_empty()) return x;
+	else if (x.lb()>=0) return x;
+	else if (x.ub()<=0) return -x;
+	else return Interval(0,x.mag());
+}
+
+inline Interval max(const Interval& x, const Interval& y) {
+	if (x.is_empty() || y.is_empty()) return Interval::empty_set();
+	// (-max(a,c), max(b,d))
+	return SIMD_INTERVAL(_mm_move_sd(_mm_max_pd(x.itv.v,y.itv.v),_mm_min_pd(x.itv.v,y.itv.v)));
+}
+
+inline Interval min(const Interval& x, const Interval& y) {
+	if (x.is_empty() || y.is_empty()) return Interval::empty_set();
+	// (-min(a,c), min(b,d))
+	return SIMD_INTERVAL(_mm_move_sd(_mm_min_pd(x.itv.v,y.itv.v),_mm_max_pd(x.itv.v,y.itv.v)));
+}
+
+inline Interval integer(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	double l= (x.lb()==NEG_INFINITY? NEG_INFINITY : std::ceil(x.lb()));
+	double r= (x.ub()==POS_INFINITY? POS_INFINITY : std::floor(x.ub()));
+	if (l>r) return Interval::empty_set();
+	else return Interval(l,r);
+}
+
+inline Interval floor(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return Interval(std::floor(x.lb()),std::floor(x.ub()));
+}
+
+inline Interval ceil(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return Interval(std::ceil(x.lb()),std::ceil(x.ub()));
+}
+
+inline bool bwd_mul(const Interval& y, Interval& x1, Interval& x2) {
+	if (y.contains(0)) {
+		if (!x2.contains(0))                           // if y and x2 contains 0, x1 can be any double number.
+			if (x1.div2_inter(y,x2).is_empty()) { x2.set_empty(); return false; }  // otherwise y=x1*x2 => x1=y/x2
+		if (x1.contains(0)) return true;
+		if (x2.div2_inter(y,x1).is_empty()) { x1.set_empty(); return false; }
+		else return true;
+	} else {
+		if (x1.div2_inter(y,x2).is_empty()) { x2.set_empty(); return false; }
+		if (x2.div2_inter(y,x1).is_empty()) { x1.set_empty(); return false; }
+		else return true;
+	}
+}
+
+inline bool bwd_sqr(const Interval& y, Interval& x) {
+	Interval proj=sqrt(y);
+	Interval pos_proj= proj & x;
+	Interval neg_proj = (-proj) & x;
+
+	x = pos_proj | neg_proj;
+
+	return !x.is_empty();
+}
+
+inline bool bwd_pow(const Interval& y, int expon, Interval& x) {
+	if (expon % 2 ==0) {
+		Interval proj=root(y,expon);
+		Interval pos_proj= proj & x;
+		Interval neg_proj = (-proj) & x;
+
+		x = pos_proj | neg_proj;
+	} else {
+		x &= root(y, expon);
+	}
+	return !x.is_empty();
+}
+
+inline bool bwd_pow(const Interval& y, Interval& x1, Interval& x2) {
+	// y=exp(x2*log(x1)) (see pow)
+	Interval lx1=log(x1);
+	Interval z=x2*lx1;
+	if (!bwd_exp(y,z) || !bwd_mul(z,x2,lx1)) {
+		x1.set_empty();
+		x2.set_empty();
+		return false;
+	}
+	if (!bwd_log(lx1,x1)) {
+		x2.set_empty();
+		return false;
+	}
+	return true;
+}
+
+/**
+ * ftype:
+ *   COS = 0
+ *   SIN = 1
+ *   TAN = 2
+ */
+inline bool bwd_trigo(const Interval& y, Interval& x, int ftype) {
+
+	const int COS=0;
+	const int SIN=1;
+	const int TAN=2;
+
+	Interval period_0, nb_period;
+
+	switch (ftype) {
+	case COS :
+		period_0 = acos(y); break;
+	case SIN :
+		period_0 = asin(y); break;
+	case TAN :
+		period_0 = atan(y); break;
+	default :
+		assert(false); break;
+	}
+
+	if (period_0.is_empty()) { x.set_empty(); return false; }
+
+	if (x.lb()==NEG_INFINITY || x.ub()==POS_INFINITY) return true; // infinity of periods
+
+	switch (ftype) {
+	case COS :
+		nb_period = x / Interval::pi(); break;
+	case SIN :
+		nb_period = (x+Interval::half_pi()) / Interval::pi(); break;
+	case TAN :
+		nb_period = (x+Interval::half_pi()) / Interval::pi(); break;
+	default :
+		assert(false); break;
+	}
+
+	if (nb_period.mag() > INT_MAX) return true;
+
+	int p1 = ((int) nb_period.lb())-1;
+	int p2 = ((int) nb_period.ub());
+	Interval tmp1, tmp2;
+
+	bool found = false;
+	int i = p1-1;
+
+	switch(ftype) {
+	case COS :
+		// should find in at most 2 turns.. but consider rounding !
+		while (++i<=p2 && !found) found = !(tmp1 = (x & (i%2==0? period_0 + i*Interval::pi() : (i+1)*Interval::pi() - period_0))).is_empty();
+		break;
+	case SIN :
+		while (++i<=p2 && !found) found = !(tmp1 = (x & (i%2==0? period_0 + i*Interval::pi() : i*Interval::pi() - period_0))).is_empty();
+		break;
+	case TAN :
+		while (++i<=p2 && !found) found = !(tmp1 = (x & (period_0 + i*Interval::pi()))).is_empty();
+		break;
+	}
+
+	if (!found) { x.set_empty(); return false; }
+	found = false;
+	i=p2+1;
+
+	switch(ftype) {
+	case COS :
+		while (--i>=p1 && !found) found = !(tmp2 = (x & (i%2==0? period_0 + i*Interval::pi() : (i+1)*Interval::pi() - period_0))).is_empty();
+		break;
+	case SIN :
+		while (--i>=p1 && !found) found = !(tmp2 = (x & (i%2==0? period_0 + i*Interval::pi() : i*Interval::pi() - period_0))).is_empty();
+		break;
+	case TAN :
+		while (--i>=p1 && !found) found = !(tmp2 = (x & (period_0 + i*Interval::pi()))).is_empty();
+		break;
+	}
+
+	if (!found) {  x.set_empty(); return false; }
+
+	x = tmp1 | tmp2;
+
+	return true;
+}
+
+inline bool bwd_cos(const Interval& y,  Interval& x) {
+	return bwd_trigo(y,x,0);
+}
+
+inline bool bwd_sin(const Interval& y,  Interval& x) {
+	return bwd_trigo(y,x,1);
+}
+
+inline bool bwd_tan(const Interval& y,  Interval& x) {
+	return bwd_trigo(y,x,2);
+}
+
+inline bool bwd_cosh(const Interval& y,  Interval& x) {
+	Interval proj=acosh(y);
+	if (proj.is_empty()) { x.set_empty(); return false; }
+	Interval pos_proj= proj & x;
+	Interval neg_proj = (-proj) & x;
+
+	x = pos_proj | neg_proj;
+
+	return !x.is_empty();
+}
+
+inline bool bwd_sinh(const Interval& y,  Interval& x) {
+	x &= asinh(y);
+	return !x.is_empty();
+}
+
+inline bool bwd_tanh(const Interval& y,  Interval& x) {
+	x &= atanh(y);
+	return !x.is_empty();
+}
+
+inline bool bwd_abs(const Interval& y,  Interval& x) {
+	Interval x1 = x & y;
+	Interval x2 = x & (-y);
+	x &= x1 | x2;
+	return !x.is_empty();
+}
+
+/*================================== batch operations ========================================*/
+
+// Note: Interval is a single __m128d and arrays
+// of intervals are therefore arrays of (-lb,ub) pairs.
+
+inline void ___add_n(Interval* x, const Interval* y, int n) {
+	int i=0;
+#ifdef __AVX__
+	for (; i+1<n; i+=2)
+		_mm256_storeu_pd((double*) &x[i], _mm256_add_pd(_mm256_loadu_pd((double*) &x[i]), _mm256_loadu_pd((const double*) &y[i])));
+#endif
+	for (; i<n; i++)
+		x[i].itv.v=_mm_add_pd(x[i].itv.v,y[i].itv.v);
+}
+
+inline void ___sub_n(Interval* x, const Interval* y, int n) {
+	int i=0;
+#ifdef __AVX__
+	for (; i+1<n; i+=2)
+		_mm256_storeu_pd((double*) &x[i], _mm256_add_pd(_mm256_loadu_pd((double*) &x[i]),
+				_mm256_permute_pd(_mm256_loadu_pd((const double*) &y[i]),5)));
+#endif
+	for (; i<n; i++)
+		x[i].itv.v=_mm_add_pd(x[i].itv.v,_simd_swap(y[i].itv.v));
+}
+
+inline void ___add_n(Interval* x, const double* y, int n) {
+	for (int i=0; i<n; i++) {
+		if (y[i]==NEG_INFINITY || y[i]==POS_INFINITY) x[i].set_empty();
+		else x[i].itv.v=_mm_add_pd(x[i].itv.v,_simd_neg_lo(_mm_set1_pd(y[i])));
+	}
+}
+
+inline void ___sub_n(Interval* x, const double* y, int n) {
+	for (int i=0; i<n; i++) {
+		if (y[i]==NEG_INFINITY || y[i]==POS_INFINITY) x[i].set_empty();
+		else x[i].itv.v=_mm_sub_pd(x[i].itv.v,_simd_neg_lo(_mm_set1_pd(y[i])));
+	}
+}
+
+inline void ___mul_n(double d, Interval* x, int n) {
+	if (d==NEG_INFINITY || d==POS_INFINITY) {
+		for (int i=0; i<n; i++) x[i].set_empty();
+	} else if (d>=0) {
+		__m128d m=_mm_set1_pd(d);
+		for (int i=0; i<n; i++)
+			x[i].itv.v=_simd_nan_to_zero(_mm_mul_pd(x[i].itv.v,m));
+	} else {
+		__m128d m=_mm_set1_pd(-d);
+		for (int i=0; i<n; i++)
+			x[i].itv.v=_simd_nan_to_zero(_mm_mul_pd(_simd_swap(x[i].itv.v),m));
+	}
+}
+
+inline void ___mul_n(const Interval& a, Interval* x, int n) {
+	if (a.is_empty()) {
+		for (int i=0; i<n; i++) x[i].set_empty();
+	} else if (a.is_unbounded() || (a.lb()<0 && a.ub()>0)) {
+		for (int i=0; i<n; i++) x[i]*=a;
+	} else if (a.lb()>=0) {
+		__m128d cd=_simd_neg_lo(a.itv.v); // (c,d)
+		__m128d dc=_simd_swap(cd);         // (d,c)
+		for (int i=0; i<n; i++)
+			x[i].itv.v=_simd_mul_pos(x[i].itv.v,cd,dc);
+	} else {
+		// x*a = (-x)*(-a)
+		__m128d cd=_simd_neg_lo(_simd_swap(a.itv.v)); // (-d,-c)
+		__m128d dc=_simd_swap(cd);
+		for (int i=0; i<n; i++)
+			x[i].itv.v=_simd_mul_pos(_simd_swap(x[i].itv.v),cd,dc);
+	}
+}
+
+inline void ___mul_add_n(Interval* y, const Interval& a, const Interval* x, int n) {
+	if (a.is_empty()) {
+		for (int i=0; i<n; i++) y[i].set_empty();
+	} else if (a.is_unbounded() || (a.lb()<0 && a.ub()>0)) {
+		for (int i=0; i<n; i++) y[i]+=a*x[i];
+	} else {
+		// note: empty x[i] are propagated (NaN)
+		bool pos=a.lb()>=0;
+		__m128d cd=pos? _simd_neg_lo(a.itv.v) : _simd_neg_lo(_simd_swap(a.itv.v));
+		__m128d dc=_simd_swap(cd);
+		for (int i=0; i<n; i++) {
+			__m128d p=_simd_mul_pos(pos? x[i].itv.v : _simd_swap(x[i].itv.v),cd,dc);
+			if (x[i].is_empty()) p=x[i].itv.v;
+			y[i].itv.v=_mm_add_pd(y[i].itv.v,p);
+		}
+	}
+}
+
+inline void ___dot_n(Interval& y, const Interval* x1, const Interval* x2, int n) {
+	if (y.is_empty()) return;
+	__m128d s=y.itv.v;
+	for (int i=0; i<n; i++) {
+		if (x1[i].is_empty() || x2[i].is_empty()) { y.set_empty(); return; }
+		s=_mm_add_pd(s,_simd_mul(x1[i].itv.v,x2[i].itv.v));
+	}
+	y.itv.v=s;
+}
+
+} // end namespace ibex
+
+#endif /* _IBEX_INTERVALLIBWRAPPER_INL_ */
@@ -3,7 +3,7 @@
 // File        : ibex_LPLibWrapper.cpp
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
-// Last update : Feb 13, 2025 (Gilles Chabert)
+// Last update : Oct 18, 2026 (Gilles Chabert)
 //============================================================================
 
 #include "ibex_LPSolver.h"
@@ -53,7 +53,7 @@ LPSolver::~LPSolver() {
 }
 
 void LPSolver::init(LPSolver::Mode mode, double tolerance, double timeout, int max_iter) {
-    
+    statistics = NULL; // by default
     myclp = new ClpSimplex();
     mode_ = mode;
 
@@ -135,6 +135,7 @@ LPSolver::Status LPSolver::minimize() {
     // solve
     if (statistics!=NULL) statistics->add_call();
     myclp->dual();
+    if (statistics!=NULL) statistics->add_iterations(myclp->numberIterations());
     
     int clp_status = myclp->status();
     /** Status of problem:
@@ -223,6 +224,35 @@ LPSolver::Status LPSolver::minimize() {
     return status_;
 }
 
+bool LPSolver::get_basis(Basis& basis) const {
+    // status of the columns, followed by the status of the rows
+    const unsigned char* status = myclp->statusArray();
+    if(status==NULL) {
+        return false;
+    }
+    basis.col_status.assign(status, status+nb_vars());
+    basis.row_status.assign(status+nb_vars(), status+nb_vars()+nb_rows());
+    return true;
+}
+
+bool LPSolver::set_basis(const Basis& basis) {
+    if((int) basis.col_status.size() != nb_vars() || (int) basis.row_status.size() != nb_rows()) {
+        return false;
+    }
+    unsigned char* status = new unsigned char[nb_vars()+nb_rows()];
+    for(int j=0;j<nb_vars();j++) {
+        status[j]=(unsigned char) basis.col_status[j];
+    }
+    for(int i=0;i<nb_rows();i++) {
+        status[nb_vars()+i]=(unsigned char) basis.row_status[i];
+    }
+    has_changed = true;
+    myclp->copyinStatus(status);
+    delete [] status;
+    if (statistics!=NULL) statistics->add_warm_start();
+    return true;
+}
+
 void LPSolver::set_cost(const Vector& obj) {
     assert(obj.size() == nb_vars());
     assert(isfinite(obj));
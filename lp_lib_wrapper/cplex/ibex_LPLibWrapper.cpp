@@ -53,6 +53,7 @@ LPSolver::~LPSolver() {
 }
 
 void LPSolver::init(LPSolver::Mode mode, double tolerance, double timeout, int max_iter) {
+	statistics = NULL; // by default
     env.setOut(env.getNullStream());
     model = IloModel(env);
 	x = IloNumVarArray(env);
@@ -126,7 +127,22 @@ LPSolver::Status LPSolver::minimize() {
     assert(!ivec_bounds_.is_unbounded());
 
 	cplex.extract(model);
+	if(!start_basis.empty()) {
+		IloCplex::BasisStatusArray cstat(env, nb_vars());
+		for(int j = 0; j < nb_vars(); ++j) {
+			cstat[j] = (IloCplex::BasisStatus) start_basis.col_status[j];
+		}
+		IloCplex::BasisStatusArray rstat(env, nb_rows());
+		for(int i = 0; i < nb_rows(); ++i) {
+			rstat[i] = (IloCplex::BasisStatus) start_basis.row_status[i];
+		}
+		cplex.setBasisStatuses(cstat, x, rstat, constraints);
+		start_basis.col_status.clear();
+		start_basis.row_status.clear();
+	}
+	if (statistics!=NULL) statistics->add_call();
 	cplex.solve();
+	if (statistics!=NULL) statistics->add_iterations(cplex.getNiterations());
     IloCplex::CplexStatus cplex_status = cplex.getCplexStatus();
     status_ = LPSolver::Status::Unknown;
     switch(cplex_status) {
@@ -191,6 +207,37 @@ LPSolver::Status LPSolver::minimize() {
     return status_;
 }
 
+bool LPSolver::get_basis(Basis& basis) const {
+    try {
+        IloCplex::BasisStatusArray cstat(env);
+        IloCplex::BasisStatusArray rstat(env);
+        cplex.getBasisStatuses(cstat, x, rstat, constraints);
+        basis.col_status.resize(cstat.getSize());
+        for(int j = 0; j < cstat.getSize(); ++j) {
+            basis.col_status[j] = (int) cstat[j];
+        }
+        basis.row_status.resize(rstat.getSize());
+        for(int i = 0; i < rstat.getSize(); ++i) {
+            basis.row_status[i] = (int) rstat[i];
+        }
+        return true;
+    } catch(IloException&) {
+        // no basis available
+        return false;
+    }
+}
+
+bool LPSolver::set_basis(const Basis& basis) {
+    if((int) basis.col_status.size() != nb_vars() || (int) basis.row_status.size() != nb_rows()) {
+        return false;
+    }
+    has_changed = true;
+    // the basis is given to cplex after the model is extracted (see minimize())
+    start_basis = basis;
+    if (statistics!=NULL) statistics->add_warm_start();
+    return true;
+}
+
 void LPSolver::set_cost(const Vector& obj) {
     assert(obj.size() == nb_vars());
     assert(isfinite(obj));
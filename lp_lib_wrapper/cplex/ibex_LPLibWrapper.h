@@ -11,6 +11,7 @@
                                          IloObjective cost_; \
                                          IloRangeArray constraints; \
                                          std::unordered_map<IloInt, int> variableIdToIndex; \
+                                         Basis start_basis; \
                                          ibex::Vector linearit2ivec(int n, IloExpr::LinearIterator it) const;
 
 #endif /* _IBEX_LPLIBWRAPPER_H_ */
@@ -38,6 +38,16 @@ LPSolver::Status LPSolver::minimize() {
   return LPSolver::Status::Unknown; /* need this return, otherwise some compilers complain */
 }
 
+bool LPSolver::get_basis(Basis& basis) const {
+	ibex_error("LPSolver method called but no LPSolver has been configured");
+  return false; /* need this return, otherwise some compilers complain */
+}
+
+bool LPSolver::set_basis(const Basis& basis) {
+	ibex_error("LPSolver method called but no LPSolver has been configured");
+  return false; /* need this return, otherwise some compilers complain */
+}
+
 void LPSolver::set_cost(const Vector& obj) {
 	ibex_error("LPSolver method called but no LPSolver has been configured");
 }
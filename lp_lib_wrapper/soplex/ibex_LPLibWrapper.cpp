@@ -3,7 +3,7 @@
 // File        : ibex_LPLibWrapper.cpp
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
-// Last update : Feb 13, 2025 (Gilles Chabert)
+// Last update : Oct 18, 2026 (Gilles Chabert)
 //============================================================================
 
 #include "ibex_LPSolver.h"
@@ -209,6 +209,7 @@ LPSolver::Status LPSolver::minimize() {
     //assert(!ivec_bounds_.is_unbounded());
 	if (statistics!=NULL) statistics->add_call();
     mysoplex->solve();
+	if (statistics!=NULL) statistics->add_iterations(mysoplex->numIterations());
     mysoplex->ignoreUnscaledViolations();
     SPxSolver::Status soplex_status = mysoplex->status();
     status_ = LPSolver::Status::Unknown;
@@ -266,6 +267,36 @@ LPSolver::Status LPSolver::minimize() {
     return status_;
 }
 
+bool LPSolver::get_basis(Basis& basis) const {
+    if(!mysoplex->hasBasis()) {
+        return false;
+    }
+    std::vector<SPxSolver::VarStatus> rows(nb_rows());
+    std::vector<SPxSolver::VarStatus> cols(nb_vars());
+    mysoplex->getBasis(rows.data(), cols.data());
+    basis.row_status.assign(rows.begin(), rows.end());
+    basis.col_status.assign(cols.begin(), cols.end());
+    return true;
+}
+
+bool LPSolver::set_basis(const Basis& basis) {
+    if((int) basis.col_status.size() != nb_vars() || (int) basis.row_status.size() != nb_rows()) {
+        return false;
+    }
+    std::vector<SPxSolver::VarStatus> rows(nb_rows());
+    std::vector<SPxSolver::VarStatus> cols(nb_vars());
+    for(int i = 0; i < nb_rows(); ++i) {
+        rows[i] = (SPxSolver::VarStatus) basis.row_status[i];
+    }
+    for(int j = 0; j < nb_vars(); ++j) {
+        cols[j] = (SPxSolver::VarStatus) basis.col_status[j];
+    }
+    has_changed = true;
+    mysoplex->setBasis(rows.data(), cols.data());
+    if (statistics!=NULL) statistics->add_warm_start();
+    return true;
+}
+
 void LPSolver::set_cost(const Vector& obj) {
     assert(obj.size() == nb_vars());
     assert(isfinite(obj));
@@ -0,0 +1,393 @@
+/* ============================================================================
+ * I B E X - Batch of boxes (structure of arrays)
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_BoxBatch.h"
+
+#include <cstring>
+#include <cfloat>
+#include <stdint.h>
+#include <vector>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Packs of W doubles: AVX (W=4), SSE2 (W=2) or scalar (W=1).
+ * A mask is the result of a comparison.
+ */
+#if defined(__AVX__)
+
+typedef __m256d pack;
+typedef __m256d mask;
+const int W=4;
+
+inline pack vload(const double* x)              { return _mm256_load_pd(x); }
+inline pack vloadu(const double* x)             { return _mm256_loadu_pd(x); }
+inline void vstore(double* x, pack a)           { _mm256_store_pd(x,a); }
+inline pack vset1(double x)                     { return _mm256_set1_pd(x); }
+inline pack vadd(pack a, pack b)                { return _mm256_add_pd(a,b); }
+inline pack vsub(pack a, pack b)                { return _mm256_sub_pd(a,b); }
+inline pack vmul(pack a, pack b)                { return _mm256_mul_pd(a,b); }
+inline pack vmin(pack a, pack b)                { return _mm256_min_pd(a,b); }
+inline pack vmax(pack a, pack b)                { return _mm256_max_pd(a,b); }
+inline mask vlt(pack a, pack b)                 { return _mm256_cmp_pd(a,b,_CMP_LT_OQ); }
+inline mask vle(pack a, pack b)                 { return _mm256_cmp_pd(a,b,_CMP_LE_OQ); }
+inline mask veq(pack a, pack b)                 { return _mm256_cmp_pd(a,b,_CMP_EQ_OQ); }
+inline mask vand(mask a, mask b)                { return _mm256_and_pd(a,b); }
+inline mask vor(mask a, mask b)                 { return _mm256_or_pd(a,b); }
+inline mask vnone()                             { return _mm256_setzero_pd(); }
+inline bool vany(mask m)                        { return _mm256_movemask_pd(m)!=0; }
+inline bool vall(mask m)                        { return _mm256_movemask_pd(m)==0xf; }
+inline pack vselect(mask m, pack a, pack b)     { return _mm256_blendv_pd(b,a,m); }
+inline double vhmax(pack a) {
+	__m128d m=_mm_max_pd(_mm256_castpd256_pd128(a),_mm256_extractf128_pd(a,1));
+	return _mm_cvtsd_f64(_mm_max_sd(m,_mm_unpackhi_pd(m,m)));
+}
+
+#elif defined(__SSE2__)
+
+typedef __m128d pack;
+typedef __m128d mask;
+const int W=2;
+
+inline pack vload(const double* x)              { return _mm_load_pd(x); }
+inline pack vloadu(const double* x)             { return _mm_loadu_pd(x); }
+inline void vstore(double* x, pack a)           { _mm_store_pd(x,a); }
+inline pack vset1(double x)                     { return _mm_set1_pd(x); }
+inline pack vadd(pack a, pack b)                { return _mm_add_pd(a,b); }
+inline pack vsub(pack a, pack b)                { return _mm_sub_pd(a,b); }
+inline pack vmul(pack a, pack b)                { return _mm_mul_pd(a,b); }
+inline pack vmin(pack a, pack b)                { return _mm_min_pd(a,b); }
+inline pack vmax(pack a, pack b)                { return _mm_max_pd(a,b); }
+inline mask vlt(pack a, pack b)                 { return _mm_cmplt_pd(a,b); }
+inline mask vle(pack a, pack b)                 { return _mm_cmple_pd(a,b); }
+inline mask veq(pack a, pack b)                 { return _mm_cmpeq_pd(a,b); }
+inline mask vand(mask a, mask b)                { return _mm_and_pd(a,b); }
+inline mask vor(mask a, mask b)                 { return _mm_or_pd(a,b); }
+inline mask vnone()                             { return _mm_setzero_pd(); }
+inline bool vany(mask m)                        { return _mm_movemask_pd(m)!=0; }
+inline bool vall(mask m)                        { return _mm_movemask_pd(m)==0x3; }
+inline pack vselect(mask m, pack a, pack b)     { return _mm_or_pd(_mm_and_pd(m,a),_mm_andnot_pd(m,b)); }
+inline double vhmax(pack a)                     { return _mm_cvtsd_f64(_mm_max_sd(a,_mm_unpackhi_pd(a,a))); }
+
+#else
+
+typedef double pack;
+typedef bool mask;
+const int W=1;
+
+inline pack vload(const double* x)              { return *x; }
+inline pack vloadu(const double* x)             { return *x; }
+inline void vstore(double* x, pack a)           { *x=a; }
+inline pack vset1(double x)                     { return x; }
+inline pack vadd(pack a, pack b)                { return a+b; }
+inline pack vsub(pack a, pack b)                { return a-b; }
+inline pack vmul(pack a, pack b)                { return a*b; }
+inline pack vmin(pack a, pack b)                { return a<b? a : b; }
+inline pack vmax(pack a, pack b)                { return a>b? a : b; }
+inline mask vlt(pack a, pack b)                 { return a<b; }
+inline mask vle(pack a, pack b)                 { return a<=b; }
+inline mask veq(pack a, pack b)                 { return a==b; }
+inline mask vand(mask a, mask b)                { return a && b; }
+inline mask vor(mask a, mask b)                 { return a || b; }
+inline mask vnone()                             { return false; }
+inline bool vany(mask m)                        { return m; }
+inline bool vall(mask m)                        { return m; }
+inline pack vselect(mask m, pack a, pack b)     { return m? a : b; }
+inline double vhmax(pack a)                     { return a; }
+
+#endif
+
+// number of doubles of the alignment (32 bytes)
+const int ALIGN=4;
+
+/* ================== kernels (s: stride, multiple of W) ================== */
+
+bool k_is_empty(const double* lb, const double* ub, int s) {
+	for (int k=0; k<s; k+=W)
+		if (vany(vlt(vload(ub+k),vload(lb+k)))) return true;
+	return false;
+}
+
+void k_set_empty(double* lb, double* ub, int n) {
+	for (int k=0; k<n; k++) {
+		lb[k]=POS_INFINITY;
+		ub[k]=NEG_INFINITY;
+	}
+}
+
+// return false if empty (and not normalized)
+bool k_inter(double* lb, double* ub, const double* lb2, const double* ub2, int s) {
+	mask e=vnone();
+	for (int k=0; k<s; k+=W) {
+		pack l=vmax(vload(lb+k),vload(lb2+k));
+		pack u=vmin(vload(ub+k),vload(ub2+k));
+		vstore(lb+k,l);
+		vstore(ub+k,u);
+		e=vor(e,vlt(u,l));
+	}
+	return !vany(e);
+}
+
+void k_hull(double* lb, double* ub, const double* lb2, const double* ub2, int s) {
+	for (int k=0; k<s; k+=W) {
+		vstore(lb+k,vmin(vload(lb+k),vload(lb2+k)));
+		vstore(ub+k,vmax(vload(ub+k),vload(ub2+k)));
+	}
+}
+
+bool k_is_subset(const double* lb, const double* ub, const double* lb2, const double* ub2, int s) {
+	for (int k=0; k<s; k+=W)
+		if (!vall(vand(vle(vload(lb2+k),vload(lb+k)),vle(vload(ub+k),vload(ub2+k))))) return false;
+	return true;
+}
+
+// the bounds of the empty box (+oo,-oo) satisfy the first two tests
+// with (-oo,+oo): the emptiness of both boxes is also checked.
+bool k_intersects(const double* lb, const double* ub, const double* lb2, const double* ub2, int s) {
+	for (int k=0; k<s; k+=W) {
+		pack l=vload(lb+k), u=vload(ub+k), l2=vload(lb2+k), u2=vload(ub2+k);
+		if (!vall(vand(vand(vle(l,u2),vle(l2,u)),vand(vle(l,u),vle(l2,u2))))) return false;
+	}
+	return true;
+}
+
+// pt: unaligned, s doubles
+bool k_contains(const double* lb, const double* ub, const double* pt, int s) {
+	for (int k=0; k<s; k+=W) {
+		pack p=vloadu(pt+k);
+		if (!vall(vand(vle(vload(lb+k),p),vle(p,vload(ub+k))))) return false;
+	}
+	return true;
+}
+
+double k_max_diam(const double* lb, const double* ub, int s) {
+	pack d=vset1(0.0); // also discards the components of the empty box
+	for (int k=0; k<s; k+=W)
+		d=vmax(d,vsub(vload(ub+k),vload(lb+k)));
+	return vhmax(d);
+}
+
+inline pack k_diam(pack l, pack u) {
+	return vmax(vsub(u,l),vset1(0.0));
+}
+
+// see Interval::mid()
+inline pack k_mid(pack l, pack u) {
+	const pack half=vset1(0.5);
+	pack m=vadd(vmul(half,l),vmul(half,u));
+	m=vmin(vmax(m,l),u); // watch dog
+	m=vselect(veq(u,vset1(POS_INFINITY)),vset1(DBL_MAX),m);
+	m=vselect(veq(l,vset1(NEG_INFINITY)),vset1(-DBL_MAX),m);
+	m=vselect(veq(l,vsub(vset1(0.0),u)),vset1(0.0),m);
+	return m;
+}
+
+inline pack k_rad(pack l, pack u) {
+	pack m=k_mid(l,u);
+	return vmax(vmax(vsub(m,l),vsub(u,m)),vset1(0.0));
+}
+
+// apply a component-wise kernel to the ith box and store the n first results in v
+template<pack (*K)(pack,pack)>
+void k_apply(const double* lb, const double* ub, int n, double* v) {
+	alignas(32) double tmp[W];
+	for (int k=0; k<n; k+=W) {
+		vstore(tmp,K(vload(lb+k),vload(ub+k)));
+		for (int j=0; j<W && k+j<n; j++)
+			v[k+j]=tmp[j];
+	}
+}
+
+} // end anonymous namespace
+
+BoxBatch::BoxBatch(int n) : n(n), _stride(((n+ALIGN-1)/ALIGN)*ALIGN), _size(0), capacity(0), mem(NULL), data(NULL) {
+	assert(n>0);
+}
+
+BoxBatch::BoxBatch(const BoxBatch& b) : n(b.n), _stride(b._stride), _size(0), capacity(0), mem(NULL), data(NULL) {
+	*this = b;
+}
+
+BoxBatch& BoxBatch::operator=(const BoxBatch& b) {
+	if (this==&b) return *this;
+	if (n!=b.n) {
+		delete[] mem;
+		mem=data=NULL;
+		capacity=0;
+		n=b.n;
+		_stride=b._stride;
+	}
+	_size=0;
+	reserve(b._size);
+	if (b._size>0)
+		memcpy(data, b.data, 2*(size_t)b._size*_stride*sizeof(double));
+	_size=b._size;
+	return *this;
+}
+
+BoxBatch::~BoxBatch() {
+	delete[] mem;
+}
+
+void BoxBatch::realloc(int k) {
+	double* new_mem=new double[2*(size_t)k*_stride+ALIGN];
+	double* new_data=(double*) ((((uintptr_t) new_mem)+ALIGN*sizeof(double)-1) & ~(uintptr_t) (ALIGN*sizeof(double)-1));
+	if (_size>0)
+		memcpy(new_data, data, 2*(size_t)_size*_stride*sizeof(double));
+	delete[] mem;
+	mem=new_mem;
+	data=new_data;
+	capacity=k;
+}
+
+void BoxBatch::reserve(int k) {
+	if (k>capacity) realloc(k);
+}
+
+int BoxBatch::push_back(const IntervalVector& x) {
+	assert(x.size()==n);
+	if (_size==capacity) realloc(capacity<4? 4 : 2*capacity);
+	set(_size++,x);
+	return _size-1;
+}
+
+int BoxBatch::push_back(const BoxBatch& b, int j) {
+	assert(b.n==n);
+	if (_size==capacity) realloc(capacity<4? 4 : 2*capacity);
+	memcpy(_lb(_size), b.lb(j), 2*(size_t)_stride*sizeof(double));
+	return _size++;
+}
+
+void BoxBatch::remove(int i) {
+	assert(i>=0 && i<_size);
+	if (i<_size-1)
+		memcpy(_lb(i), lb(_size-1), 2*(size_t)_stride*sizeof(double));
+	_size--;
+}
+
+void BoxBatch::set(int i, const IntervalVector& x) {
+	assert(i>=0 && i<_size && x.size()==n);
+	double* l=_lb(i);
+	double* u=_ub(i);
+	for (int k=0; k<n; k++) {
+		if (x[k].is_empty()) { // the bounds may be NaN
+			k_set_empty(l,u,n);
+			break;
+		}
+		l[k]=x[k].lb();
+		u[k]=x[k].ub();
+	}
+	for (int k=n; k<_stride; k++) // padding
+		l[k]=u[k]=0;
+}
+
+void BoxBatch::get(int i, IntervalVector& x) const {
+	assert(x.size()==n);
+	const double* l=lb(i);
+	const double* u=ub(i);
+	if (is_empty(i))
+		x.set_empty();
+	else
+		for (int k=0; k<n; k++)
+			x[k]=Interval(l[k],u[k]);
+}
+
+bool BoxBatch::is_empty(int i) const {
+	return k_is_empty(lb(i),ub(i),_stride);
+}
+
+void BoxBatch::set_empty(int i) {
+	assert(i>=0 && i<_size);
+	k_set_empty(_lb(i),_ub(i),n);
+}
+
+bool BoxBatch::inter(int i, const BoxBatch& b, int j) {
+	assert(i>=0 && i<_size && b.n==n);
+	if (k_inter(_lb(i),_ub(i),b.lb(j),b.ub(j),_stride))
+		return true;
+	else {
+		set_empty(i); // normalization
+		return false;
+	}
+}
+
+void BoxBatch::hull(int i, const BoxBatch& b, int j) {
+	assert(i>=0 && i<_size && b.n==n);
+	k_hull(_lb(i),_ub(i),b.lb(j),b.ub(j),_stride);
+}
+
+bool BoxBatch::is_subset(int i, const BoxBatch& b, int j) const {
+	assert(b.n==n);
+	return k_is_subset(lb(i),ub(i),b.lb(j),b.ub(j),_stride);
+}
+
+bool BoxBatch::intersects(int i, const BoxBatch& b, int j) const {
+	assert(b.n==n);
+	return k_intersects(lb(i),ub(i),b.lb(j),b.ub(j),_stride);
+}
+
+Vector BoxBatch::diam(int i) const {
+	Vector d(n);
+	k_apply<k_diam>(lb(i),ub(i),n,d.raw());
+	return d;
+}
+
+double BoxBatch::max_diam(int i) const {
+	return k_max_diam(lb(i),ub(i),_stride);
+}
+
+Vector BoxBatch::mid(int i) const {
+	Vector m(n);
+	k_apply<k_mid>(lb(i),ub(i),n,m.raw());
+	return m;
+}
+
+Vector BoxBatch::rad(int i) const {
+	Vector r(n);
+	k_apply<k_rad>(lb(i),ub(i),n,r.raw());
+	return r;
+}
+
+void BoxBatch::inter(const IntervalVector& x) {
+	BoxBatch b(n);
+	b.push_back(x);
+	for (int i=0; i<_size; i++)
+		inter(i,b,0);
+}
+
+IntervalVector BoxBatch::hull() const {
+	BoxBatch b(n);
+	b.push_back(IntervalVector::empty(n));
+	for (int i=0; i<_size; i++)
+		b.hull(0,*this,i);
+	return b[0];
+}
+
+int BoxBatch::find(const Vector& pt, int start) const {
+	assert(pt.size()==n);
+	vector<double> p(_stride,0.0);
+	for (int k=0; k<n; k++) p[k]=pt[k];
+	for (int i=start; i<_size; i++)
+		if (k_contains(lb(i),ub(i),&p[0],_stride)) return i;
+	return -1;
+}
+
+} // namespace ibex
@@ -0,0 +1,287 @@
+/* ============================================================================
+ * I B E X - Batch of boxes (structure of arrays)
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_BOX_BATCH_H__
+#define __IBEX_BOX_BATCH_H__
+
+#include "ibex_IntervalVector.h"
+#include "ibex_Vector.h"
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Batch of boxes stored as a structure of arrays.
+ *
+ * An IntervalVector is an array of Interval objects, whose layout depends
+ * on the interval library (e.g., Gaol stores each interval as a pair of
+ * bounds). Whole-box operations (intersection, hull, inclusion tests,
+ * diameters, etc.) therefore perform one interval operation per component.
+ *
+ * In a batch, the lower bounds and the upper bounds of a box are stored in
+ * two separate arrays of doubles, aligned on 32 bytes and padded to a
+ * multiple of 4 components (with [0,0], which does not affect the results).
+ * The whole-box operations of this class are vectorized (SSE2, or AVX
+ * if enabled, e.g., with -march=native) and do not depend on the interval
+ * library.
+ *
+ * The empty box is represented by the bounds (+oo,-oo) in every component,
+ * so that the hull needs no test. Boxes with one empty component are
+ * normalized this way (like IntervalVector, a box with one empty component
+ * is empty).
+ *
+ * Boxes are converted from/to IntervalVector with #push_back(const IntervalVector&),
+ * #set(int,const IntervalVector&) and #get(int,IntervalVector&) (this conversion
+ * is not vectorized).
+ *
+ * The diameters and radii are rounded in the current rounding mode, i.e., upward
+ * with the interval libraries that keep the rounding mode upward (Gaol and SIMD).
+ */
+class BoxBatch {
+public:
+	/**
+	 * \brief Create an empty batch of boxes of dimension \a n.
+	 */
+	explicit BoxBatch(int n);
+
+	/**
+	 * \brief Copy a batch.
+	 */
+	BoxBatch(const BoxBatch& b);
+
+	/**
+	 * \brief Assignment.
+	 */
+	BoxBatch& operator=(const BoxBatch& b);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~BoxBatch();
+
+	/**
+	 * \brief Dimension of the boxes.
+	 */
+	int nb_var() const;
+
+	/**
+	 * \brief Number of boxes.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Number of doubles of the bound arrays (dimension rounded up to a multiple of 4).
+	 */
+	int stride() const;
+
+	/**
+	 * \brief Reserve memory for \a k boxes.
+	 */
+	void reserve(int k);
+
+	/**
+	 * \brief Remove all the boxes.
+	 */
+	void clear();
+
+	/**
+	 * \brief Add a box at the end of the batch.
+	 *
+	 * \return the index of the box.
+	 */
+	int push_back(const IntervalVector& x);
+
+	/**
+	 * \brief Add the jth box of \a b at the end of the batch.
+	 *
+	 * \return the index of the box.
+	 */
+	int push_back(const BoxBatch& b, int j);
+
+	/**
+	 * \brief Remove the ith box.
+	 *
+	 * The last box is moved to the index i.
+	 */
+	void remove(int i);
+
+	/**
+	 * \brief Set the ith box to \a x.
+	 */
+	void set(int i, const IntervalVector& x);
+
+	/**
+	 * \brief Get the ith box (x must have the dimension of the batch).
+	 */
+	void get(int i, IntervalVector& x) const;
+
+	/**
+	 * \brief Return the ith box (copy).
+	 */
+	IntervalVector operator[](int i) const;
+
+	/**
+	 * \brief Lower bounds of the ith box (#stride() doubles).
+	 */
+	const double* lb(int i) const;
+
+	/**
+	 * \brief Upper bounds of the ith box (#stride() doubles).
+	 */
+	const double* ub(int i) const;
+
+	/* ================== whole-box operations ================== */
+
+	/**
+	 * \brief True if the ith box is empty.
+	 */
+	bool is_empty(int i) const;
+
+	/**
+	 * \brief Set the ith box to the empty box.
+	 */
+	void set_empty(int i);
+
+	/**
+	 * \brief Intersect the ith box with the jth box of \a b.
+	 *
+	 * \return false if the result is empty.
+	 */
+	bool inter(int i, const BoxBatch& b, int j);
+
+	/**
+	 * \brief Replace the ith box by its hull with the jth box of \a b.
+	 */
+	void hull(int i, const BoxBatch& b, int j);
+
+	/**
+	 * \brief True if the ith box is a subset of the jth box of \a b.
+	 *
+	 * The empty box is a subset of any box.
+	 */
+	bool is_subset(int i, const BoxBatch& b, int j) const;
+
+	/**
+	 * \brief True if the ith box intersects the jth box of \a b.
+	 */
+	bool intersects(int i, const BoxBatch& b, int j) const;
+
+	/**
+	 * \brief Diameters of the ith box.
+	 *
+	 * (0 in all components if the box is empty).
+	 */
+	Vector diam(int i) const;
+
+	/**
+	 * \brief Maximal diameter of the ith box.
+	 *
+	 * (0 if the box is empty).
+	 */
+	double max_diam(int i) const;
+
+	/**
+	 * \brief Midpoint of the ith box (undefined if the box is empty).
+	 *
+	 * As with Interval::mid(), the midpoint of (-oo,+oo) is 0 and the midpoint
+	 * of an interval unbounded on one side is +/-DBL_MAX. The midpoint of
+	 * bounded intervals is calculated as 0.5*lb+0.5*ub in the current rounding
+	 * mode (it may differ by one ulp from Interval::mid() depending on the
+	 * interval library).
+	 */
+	Vector mid(int i) const;
+
+	/**
+	 * \brief Radii of the ith box (0 in all components if the box is empty).
+	 */
+	Vector rad(int i) const;
+
+	/* ================== operations on all the boxes ================== */
+
+	/**
+	 * \brief Intersect all the boxes with \a x.
+	 */
+	void inter(const IntervalVector& x);
+
+	/**
+	 * \brief Hull of all the boxes.
+	 */
+	IntervalVector hull() const;
+
+	/**
+	 * \brief Index of the first box (from the index \a start) that contains \a pt.
+	 *
+	 * \return -1 if there is no such box.
+	 */
+	int find(const Vector& pt, int start=0) const;
+
+private:
+	// the bounds of the ith box (lower bounds, then upper bounds)
+	double* _lb(int i);
+	double* _ub(int i);
+
+	// reallocate the memory for k boxes
+	void realloc(int k);
+
+	int n;         // dimension
+	int _stride;   // dimension rounded up
+	int _size;     // number of boxes
+	int capacity;  // number of boxes allocated
+	double* mem;   // allocated memory
+	double* data;  // aligned memory
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int BoxBatch::nb_var() const {
+	return n;
+}
+
+inline int BoxBatch::size() const {
+	return _size;
+}
+
+inline int BoxBatch::stride() const {
+	return _stride;
+}
+
+inline void BoxBatch::clear() {
+	_size=0;
+}
+
+inline const double* BoxBatch::lb(int i) const {
+	assert(i>=0 && i<_size);
+	return data+2*(size_t)i*_stride;
+}
+
+inline const double* BoxBatch::ub(int i) const {
+	assert(i>=0 && i<_size);
+	return data+(2*(size_t)i+1)*_stride;
+}
+
+inline double* BoxBatch::_lb(int i) {
+	return data+2*(size_t)i*_stride;
+}
+
+inline double* BoxBatch::_ub(int i) {
+	return data+(2*(size_t)i+1)*_stride;
+}
+
+inline IntervalVector BoxBatch::operator[](int i) const {
+	IntervalVector x(n);
+	get(i,x);
+	return x;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_BOX_BATCH_H__
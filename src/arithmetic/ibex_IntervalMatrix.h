@@ -481,6 +481,7 @@ public:
     operator const ExprConstant&() const;
 
 private:
+	template<class D> friend class ExprDomainSlab; // matrices stored in a slab
 
 	IntervalMatrix();
 
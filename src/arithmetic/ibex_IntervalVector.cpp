@@ -10,34 +10,49 @@
  * ---------------------------------------------------------------------------- */
 
 #include "ibex_IntervalVector.h"
+#include "ibex_Pool.h"
 #include <vector>
 #include <stdlib.h>
 #include <sstream>
 #include <math.h>
 #include <float.h>
 #include <algorithm>
+#include <new>
 
 
 #include "ibex_TemplateVector.h"
 
 namespace ibex {
 
-IntervalVector::IntervalVector(int nn) : n(nn), vec(new Interval[nn]) {
+Interval* IntervalVector::new_vec(int n) {
+	// note: the array is allocated in the pool, if enabled (see Pool)
+	Interval* v=(Interval*) Pool::alloc(n*sizeof(Interval));
+	for (int i=0; i<n; i++) new (&v[i]) Interval();
+	return v;
+}
+
+void IntervalVector::delete_vec(Interval* v, int n) {
+	if (!v) return;
+	for (int i=0; i<n; i++) v[i].~Interval();
+	Pool::free(v, n*sizeof(Interval));
+}
+
+IntervalVector::IntervalVector(int nn) : n(nn), vec(new_vec(nn)) {
 	assert(nn>=1);
 	for (int i=0; i<nn; i++) vec[i]=Interval::all_reals();
 }
 
-IntervalVector::IntervalVector(int n1, const Interval& x) : n(n1), vec(new Interval[n1]) {
+IntervalVector::IntervalVector(int n1, const Interval& x) : n(n1), vec(new_vec(n1)) {
 	assert(n1>=1);
 	for (int i=0; i<n1; i++) vec[i]=x;
 }
 
-IntervalVector::IntervalVector(const IntervalVector& x) : n(x.n), vec(new Interval[x.n]) {
+IntervalVector::IntervalVector(const IntervalVector& x) : n(x.n), vec(new_vec(x.n)) {
 	assert(x.vec!=NULL); // forbidden to copy uninitialized boxes
 	for (int i=0; i<n; i++) vec[i]=x[i];
 }
 
-IntervalVector::IntervalVector(int n1, double bounds[][2]) : n(n1), vec(new Interval[n1]) {
+IntervalVector::IntervalVector(int n1, double bounds[][2]) : n(n1), vec(new_vec(n1)) {
 	if (bounds==0) // probably, the user called IntervalVector(n,0) and 0 is interpreted as NULL!
 		for (int i=0; i<n1; i++)
 			vec[i]=Interval::zero();
@@ -46,16 +61,16 @@ IntervalVector::IntervalVector(int n1, double bounds[][2]) : n(n1), vec(new Inte
 			vec[i]=Interval(bounds[i][0],bounds[i][1]);
 }
 
-IntervalVector::IntervalVector(std::initializer_list<Interval> list) : n(list.size()), vec(new Interval[n]) {
+IntervalVector::IntervalVector(std::initializer_list<Interval> list) : n(list.size()), vec(new_vec(n)) {
 	assert(n >= 1);
 	std::copy(list.begin(), list.end(), vec);
 }
 
-IntervalVector::IntervalVector(const Vector& x) : n(x.size()), vec(new Interval[n]) {
+IntervalVector::IntervalVector(const Vector& x) : n(x.size()), vec(new_vec(n)) {
 	for (int i=0; i<n; i++) vec[i]=x[i];
 }
 
-IntervalVector::IntervalVector(const Interval& x) : n(1), vec(new Interval[1]) {
+IntervalVector::IntervalVector(const Interval& x) : n(1), vec(new_vec(1)) {
 	vec[0]=x;
 }
 
@@ -70,14 +85,14 @@ void IntervalVector::resize(int n2) {
 
 	if (n2==size()) return;
 
-	Interval* newVec=new Interval[n2];
+	Interval* newVec=new_vec(n2);
 	int i=0;
 	for (; i<size() && i<n2; i++)
 		newVec[i]=vec[i];
 	for (; i<n2; i++)
 		newVec[i]=Interval::all_reals();
 	if (vec!=NULL) // vec==NULL happens when default constructor is used (n==0)
-		delete[] vec;
+		delete_vec(vec,n);
 
 	n   = n2;
 	vec = newVec;
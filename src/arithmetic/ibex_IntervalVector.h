@@ -634,6 +634,17 @@ public:
 
 private:
 	friend class IntervalMatrix;
+	template<class D> friend class ExprDomainSlab; // vectors stored in a slab
+
+	/*
+	 * Allocate an array of n intervals (see #ibex::Pool).
+	 */
+	static Interval* new_vec(int n);
+
+	/*
+	 * Release an array allocated with new_vec.
+	 */
+	static void delete_vec(Interval* vec, int n);
 
 	int n;             // dimension (size of vec)
 	Interval *vec;	   // vector of elements
@@ -851,7 +862,7 @@ inline IntervalVector IntervalVector::empty(int n) {
 }
 
 inline IntervalVector::~IntervalVector() {
-	delete[] vec;
+	delete_vec(vec,n);
 }
 
 inline void IntervalVector::set_empty() {
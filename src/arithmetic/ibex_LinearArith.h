@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 18, 2012
-// Last Update : Apr 18, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 
@@ -44,6 +44,31 @@ void ___set_empty(IntervalVector& v);
 void ___set_empty(Matrix& m);
 void ___set_empty(IntervalMatrix& m);
 
+// the following functions are operations on arrays
+// (of doubles or intervals) used by the vector and matrix
+// operations. The interval library can overload them with
+// vectorized versions (e.g., the SIMD library).
+
+/* x[i]+=y[i], i=0..n-1 */
+template<typename T1, typename T2>
+inline void ___add_n(T1* x, const T2* y, int n)                    { for (int i=0; i<n; i++) x[i]+=y[i]; }
+
+/* x[i]-=y[i], i=0..n-1 */
+template<typename T1, typename T2>
+inline void ___sub_n(T1* x, const T2* y, int n)                    { for (int i=0; i<n; i++) x[i]-=y[i]; }
+
+/* x[i]*=a, i=0..n-1 */
+template<typename S, typename T>
+inline void ___mul_n(const S& a, T* x, int n)                      { for (int i=0; i<n; i++) x[i]*=a; }
+
+/* y[i]+=a*x[i], i=0..n-1 */
+template<typename T1, typename S, typename T2>
+inline void ___mul_add_n(T1* y, const S& a, const T2* x, int n)    { for (int i=0; i<n; i++) y[i]+=a*x[i]; }
+
+/* y+=x1[0]*x2[0]+...+x1[n-1]*x2[n-1] */
+template<typename S, typename T1, typename T2>
+inline void ___dot_n(S& y, const T1* x1, const T2* x2, int n)      { for (int i=0; i<n; i++) y+=x1[i]*x2[i]; }
+
 namespace {
 
 template<typename V>
@@ -64,10 +89,11 @@ template<typename V1, typename V2>
 inline V1& set_addV(V1& v1, const V2& v2) {
 	assert(v1.size()==v2.size());
 
+	if (v1.size()==0) return v1; // no first element for the kernel
+
 	if (___is_empty(v1) || ___is_empty(v2)) { ___set_empty(v1); return v1; }
 
-	for (int i=0; i<v1.size(); i++)
-		v1[i]+=v2[i];
+	___add_n(&v1[0],&v2[0],v1.size());
 
 	return v1;
 }
@@ -76,10 +102,11 @@ template<typename V1, typename V2>
 inline V1& set_subV(V1& v1, const V2& v2) {
 	assert(v1.size()==v2.size());
 
+	if (v1.size()==0) return v1; // no first element for the kernel
+
 	if (___is_empty(v1) || ___is_empty(v2)) { ___set_empty(v1); return v1; }
 
-	for (int i=0; i<v1.size(); i++)
-		v1[i]-=v2[i];
+	___sub_n(&v1[0],&v2[0],v1.size());
 
 	return v1;
 }
@@ -125,10 +152,11 @@ inline M1& set_subM(M1& m1, const M2& m2) {
 template<typename S, class V>
 inline V& set_mulSV(const S& x, V& v) {
 
+	if (v.size()==0) return v; // no first element for the kernel
+
 	if (___is_empty(x) || ___is_empty(v)) { ___set_empty(v); return v; }
 
-	for (int i=0; i<v.size(); i++)
-		v[i]*=x;
+	___mul_n(x,&v[0],v.size());
 	return v;
 }
 
@@ -149,14 +177,14 @@ inline S mulVV(const Vin1& v1, const Vin2& v2) {
 	const int n=v1.size();
 	S y=0;
 
+	if (n==0) return y; // no first element for the kernel
+
 	if (___is_empty(v1) || ___is_empty(v2)) {
 		___set_empty(y);
 		return y;
 	}
 
-	for (int i=0; i<n; i++) {
-		y+=v1[i]*v2[i];
-	}
+	___dot_n(y,&v1[0],&v2[0],n);
 	return y;
 }
 
@@ -225,12 +253,12 @@ inline Vout mulVM(const Vin& v, const M& m) {
 
 	Vout y(m.nb_cols());
 
-	for (int j=0; j<m.nb_cols(); j++) {
+	for (int j=0; j<m.nb_cols(); j++)
 		y[j]=0;
-		for (int i=0; i<m.nb_rows(); i++) {
-			y[j]+=m[i][j]*v[i];
-		}
-	}
+
+	// row by row (the sums are computed in the same order)
+	for (int i=0; i<m.nb_rows(); i++)
+		___mul_add_n(&y[0],v[i],&m[i][0],m.nb_cols());
 
 	return y;
 }
@@ -243,12 +271,12 @@ inline Mout mulMM(const Min1& m1, const Min2& m2) {
 
 	if (___is_empty(m1) || ___is_empty(m2)) { ___set_empty(m3); return m3; }
 
+	// row by row (the sums are computed in the same order)
 	for (int i=0; i<m1.nb_rows(); i++) {
-		for (int j=0; j<m2.nb_cols(); j++) {
+		for (int j=0; j<m2.nb_cols(); j++)
 			m3[i][j]=0;
-			for (int k=0; k<m1.nb_cols(); k++)
-				m3[i][j]+=m1[i][k]*m2[k][j];
-		}
+		for (int k=0; k<m1.nb_cols(); k++)
+			___mul_add_n(&m3[i][0],m1[i][k],&m2[k][0],m2.nb_cols());
 	}
 	return m3;
 }
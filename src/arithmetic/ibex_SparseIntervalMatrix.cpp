@@ -0,0 +1,129 @@
+/* ============================================================================
+ * I B E X - Sparse matrix of intervals
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_SparseIntervalMatrix.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+SparseIntervalMatrix::SparseIntervalMatrix(int nb_rows, int nb_cols, const vector<vector<int> >& pattern) :
+		_nb_rows(nb_rows), _nb_cols(nb_cols), _empty(false), row_start(nb_rows+1) {
+	assert(nb_rows>0 && nb_cols>0);
+	assert((int) pattern.size()==nb_rows);
+
+	row_start[0]=0;
+	for (int i=0; i<nb_rows; i++) {
+		vector<int> row(pattern[i]);
+		sort(row.begin(), row.end());
+		row.erase(unique(row.begin(), row.end()), row.end());
+		for (vector<int>::const_iterator it=row.begin(); it!=row.end(); ++it) {
+			assert(*it>=0 && *it<nb_cols);
+			cols.push_back(*it);
+		}
+		row_start[i+1]=(int) cols.size();
+	}
+	values.resize(cols.size(), Interval::zero());
+}
+
+SparseIntervalMatrix::SparseIntervalMatrix(const IntervalMatrix& m) :
+		_nb_rows(m.nb_rows()), _nb_cols(m.nb_cols()), _empty(m.is_empty()), row_start(m.nb_rows()+1) {
+
+	row_start[0]=0;
+	for (int i=0; i<_nb_rows; i++) {
+		for (int j=0; j<_nb_cols; j++) {
+			if (_empty || m[i][j]!=Interval::zero()) {
+				cols.push_back(j);
+				values.push_back(m[i][j]);
+			}
+		}
+		row_start[i+1]=(int) cols.size();
+	}
+}
+
+SparseIntervalMatrix::SparseIntervalMatrix(const SparseIntervalMatrix& m) :
+		_nb_rows(m._nb_rows), _nb_cols(m._nb_cols), _empty(m._empty),
+		row_start(m.row_start), cols(m.cols), values(m.values) {
+
+}
+
+SparseIntervalMatrix& SparseIntervalMatrix::operator=(const SparseIntervalMatrix& m) {
+	_nb_rows = m._nb_rows;
+	_nb_cols = m._nb_cols;
+	_empty = m._empty;
+	row_start = m.row_start;
+	cols = m.cols;
+	values = m.values;
+	return *this;
+}
+
+int SparseIntervalMatrix::find(int i, int j) const {
+	vector<int>::const_iterator first=cols.begin()+row_begin(i);
+	vector<int>::const_iterator last=cols.begin()+row_end(i);
+	vector<int>::const_iterator it=lower_bound(first, last, j);
+	return it!=last && *it==j ? (int) (it-cols.begin()) : -1;
+}
+
+void SparseIntervalMatrix::clear() {
+	fill(values.begin(), values.end(), Interval::zero());
+	_empty=false;
+}
+
+void SparseIntervalMatrix::set_empty() {
+	_empty=true;
+}
+
+IntervalMatrix SparseIntervalMatrix::dense() const {
+	IntervalMatrix m(_nb_rows, _nb_cols, Interval::zero());
+	if (_empty) {
+		m.set_empty();
+		return m;
+	}
+	for (int i=0; i<_nb_rows; i++)
+		for (int k=row_start[i]; k<row_start[i+1]; k++)
+			m[i][cols[k]]=values[k];
+	return m;
+}
+
+void SparseIntervalMatrix::gather(const IntervalMatrix& m) {
+	assert(m.nb_rows()==_nb_rows && m.nb_cols()==_nb_cols);
+	if (m.is_empty()) {
+		set_empty();
+		return;
+	}
+	for (int i=0; i<_nb_rows; i++)
+		for (int k=row_start[i]; k<row_start[i+1]; k++)
+			values[k]=m[i][cols[k]];
+	_empty=false;
+}
+
+IntervalVector SparseIntervalMatrix::operator*(const IntervalVector& x) const {
+	assert(x.size()==_nb_cols);
+	IntervalVector y(_nb_rows);
+	if (_empty || x.is_empty()) {
+		y.set_empty();
+		return y;
+	}
+	for (int i=0; i<_nb_rows; i++) {
+		y[i]=Interval::zero();
+		for (int k=row_start[i]; k<row_start[i+1]; k++)
+			y[i]+=values[k]*x[cols[k]];
+	}
+	return y;
+}
+
+ostream& operator<<(ostream& os, const SparseIntervalMatrix& m) {
+	return os << m.dense();
+}
+
+} // end namespace ibex
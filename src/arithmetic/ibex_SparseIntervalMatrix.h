@@ -0,0 +1,233 @@
+/* ============================================================================
+ * I B E X - Sparse matrix of intervals
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_SPARSE_INTERVAL_MATRIX_H__
+#define __IBEX_SPARSE_INTERVAL_MATRIX_H__
+
+#include "ibex_IntervalMatrix.h"
+
+#include <vector>
+#include <iostream>
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Sparse interval matrix.
+ *
+ * The matrix is stored in the compressed sparse row (CSR) format:
+ * only the entries of a fixed <i>pattern</i> (the "structural non-zeros")
+ * are stored, all the other entries being the degenerated interval [0,0].
+ *
+ * The pattern is given at construction and cannot be changed afterwards,
+ * so that a matrix can be filled repeatedly (typically, the Jacobian
+ * matrix of a function, see #Fnc::jacobian(const IntervalVector&, SparseIntervalMatrix&))
+ * without any allocation. The columns of each row are sorted.
+ *
+ * The kth stored entry is accessed with operator[](k). The entries of row i are
+ * the indices k in [row_begin(i),row_end(i)[ and the column of the kth entry is col(k).
+ */
+class SparseIntervalMatrix {
+
+public:
+	/**
+	 * \brief Create a (nb_rows x nb_cols) matrix with a given pattern.
+	 *
+	 * The ith row contains the entries whose columns are in pattern[i]
+	 * (that need not be sorted, duplicates are ignored). All entries are
+	 * initialized to [0,0].
+	 */
+	SparseIntervalMatrix(int nb_rows, int nb_cols, const std::vector<std::vector<int> >& pattern);
+
+	/**
+	 * \brief Create the sparse representation of a dense matrix.
+	 *
+	 * The pattern is made of all the entries different from [0,0].
+	 */
+	explicit SparseIntervalMatrix(const IntervalMatrix& m);
+
+	/**
+	 * \brief Duplicate a matrix.
+	 */
+	SparseIntervalMatrix(const SparseIntervalMatrix& m);
+
+	/**
+	 * \brief Set this matrix to m (both the pattern and the values).
+	 */
+	SparseIntervalMatrix& operator=(const SparseIntervalMatrix& m);
+
+	/**
+	 * \brief Number of rows.
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Number of columns.
+	 */
+	int nb_cols() const;
+
+	/**
+	 * \brief Number of stored entries.
+	 */
+	int nnz() const;
+
+	/**
+	 * \brief Ratio of stored entries, in [0,1].
+	 */
+	double density() const;
+
+	/**
+	 * \brief Index of the first stored entry of the ith row.
+	 */
+	int row_begin(int i) const;
+
+	/**
+	 * \brief Index following the last stored entry of the ith row.
+	 */
+	int row_end(int i) const;
+
+	/**
+	 * \brief Column of the kth stored entry.
+	 */
+	int col(int k) const;
+
+	/**
+	 * \brief The kth stored entry.
+	 */
+	Interval& operator[](int k);
+
+	/**
+	 * \brief The kth stored entry (const version).
+	 */
+	const Interval& operator[](int k) const;
+
+	/**
+	 * \brief Index of the entry (i,j) or -1 if it is not stored.
+	 *
+	 * Complexity: logarithmic in the number of entries of the row.
+	 */
+	int find(int i, int j) const;
+
+	/**
+	 * \brief Return the entry (i,j) ([0,0] if it is not stored).
+	 */
+	Interval operator()(int i, int j) const;
+
+	/**
+	 * \brief Set all the stored entries to [0,0].
+	 *
+	 * The matrix is no longer empty.
+	 */
+	void clear();
+
+	/**
+	 * \brief Set this matrix to the empty matrix.
+	 */
+	void set_empty();
+
+	/**
+	 * \brief Return true iff this matrix is empty.
+	 */
+	bool is_empty() const;
+
+	/**
+	 * \brief Return the dense matrix.
+	 */
+	IntervalMatrix dense() const;
+
+	/**
+	 * \brief Store the entries of a dense matrix m.
+	 *
+	 * Only the entries of the pattern are read.
+	 *
+	 * \pre m has the same dimensions as this matrix.
+	 */
+	void gather(const IntervalMatrix& m);
+
+	/**
+	 * \brief Return this*x.
+	 */
+	IntervalVector operator*(const IntervalVector& x) const;
+
+private:
+	int _nb_rows;
+	int _nb_cols;
+	bool _empty;
+
+	// row_start[i] is the index of the first entry of row i
+	// (size nb_rows+1)
+	std::vector<int> row_start;
+
+	// column of each entry
+	std::vector<int> cols;
+
+	// value of each entry
+	std::vector<Interval> values;
+};
+
+/**
+ * \brief Display the matrix m (in the dense format).
+ */
+std::ostream& operator<<(std::ostream& os, const SparseIntervalMatrix& m);
+
+/*================================== inline implementations ========================================*/
+
+inline int SparseIntervalMatrix::nb_rows() const {
+	return _nb_rows;
+}
+
+inline int SparseIntervalMatrix::nb_cols() const {
+	return _nb_cols;
+}
+
+inline int SparseIntervalMatrix::nnz() const {
+	return (int) cols.size();
+}
+
+inline double SparseIntervalMatrix::density() const {
+	return _nb_rows==0 || _nb_cols==0 ? 0 : ((double) nnz())/(((double) _nb_rows)*_nb_cols);
+}
+
+inline int SparseIntervalMatrix::row_begin(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return row_start[i];
+}
+
+inline int SparseIntervalMatrix::row_end(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return row_start[i+1];
+}
+
+inline int SparseIntervalMatrix::col(int k) const {
+	return cols[k];
+}
+
+inline Interval& SparseIntervalMatrix::operator[](int k) {
+	return values[k];
+}
+
+inline const Interval& SparseIntervalMatrix::operator[](int k) const {
+	return values[k];
+}
+
+inline Interval SparseIntervalMatrix::operator()(int i, int j) const {
+	int k=find(i,j);
+	return k==-1 ? Interval::zero() : values[k];
+}
+
+inline bool SparseIntervalMatrix::is_empty() const {
+	return _empty;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_SPARSE_INTERVAL_MATRIX_H__
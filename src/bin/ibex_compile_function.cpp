@@ -0,0 +1,133 @@
+//============================================================================
+//                                  I B E X
+//
+//                         **********************
+//                          ibex_compile_function
+//                         **********************
+//
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex.h"
+#include "parse_args.h"
+
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+int main(int argc, char** argv) {
+
+	args::ArgumentParser parser("********* ibex_compile_function *********.", "Generate the C++ code of a function "
+			"(evaluation, HC4Revise and Jacobian matrix) to be loaded with Function::load_native.");
+	args::HelpFlag help(parser, "help", "Display this help menu", {'h', "help"});
+	args::Flag version(parser, "version", "Display the version of this tool (same as the version of Ibex).", {'v',"version"});
+	args::ValueFlag<string> output_file(parser, "filename", "C++ output file. Default: the name of the input file with the .cpp extension.", {'o',"output"});
+	args::ValueFlag<string> prefix(parser, "string", "Prefix of the entry points. Default: \"ibex_\" followed by the name of the function.", {'p',"prefix"});
+	args::ValueFlag<string> shared(parser, "filename", "Compile the code into this shared object, with the command:\n"
+			"\t\t<cxx> -O2 -shared -fPIC `pkg-config --cflags ibex` <output> -o <filename>", {"shared"});
+	args::ValueFlag<string> cxx(parser, "command", "The C++ compiler used with --shared. Default: $CXX or c++.", {"cxx"});
+	args::Flag quiet(parser, "quiet", "Print no report on the standard output.",{'q',"quiet"});
+	args::Positional<std::string> filename(parser, "filename", "The name of the MINIBEX file (containing one function).");
+
+	try
+	{
+		parser.ParseCLI(argc, argv);
+	}
+	catch (args::Help&)
+	{
+		std::cout << parser;
+		return 0;
+	}
+	catch (args::ParseError& e)
+	{
+		std::cerr << e.what() << std::endl;
+		std::cerr << parser;
+		return 1;
+	}
+	catch (args::ValidationError& e)
+	{
+		std::cerr << e.what() << std::endl;
+		std::cerr << parser;
+		return 1;
+	}
+
+	if (version) {
+		cout << "ibex_compile_function Release " << _IBEX_RELEASE_ << endl;
+		exit(0);
+	}
+
+	if (filename.Get()=="") {
+		ibex_error("no input file (try ibex_compile_function --help)");
+		exit(1);
+	}
+
+	try {
+
+		Function f(filename.Get().c_str());
+
+		FunctionCodeGen gen(f);
+
+		if (!gen.supported()) {
+			cerr << "\n\033[31mError:\033[0m the function contains operations that are not supported (only scalar "
+					"operations are, see FunctionCodeGen)." << endl;
+			return 1;
+		}
+
+		string output;
+		if (output_file)
+			output = output_file.Get();
+		else {
+			string::size_type const p(filename.Get().find_last_of('.'));
+			output = filename.Get().substr(0, p) + ".cpp";
+		}
+
+		ofstream os(output.c_str());
+		if (!os.is_open()) {
+			cerr << "\n\033[31mError:\033[0m cannot write to " << output << endl;
+			return 1;
+		}
+
+		string _prefix = prefix ? prefix.Get() : FunctionCodeGen::default_prefix(f);
+		gen.generate(os, _prefix.c_str());
+		os.close();
+
+		if (!quiet) {
+			cout << "  function:\t\t" << f.name << " (" << f.nb_var() << " variables, " << f.nb_nodes() << " nodes)" << endl;
+			cout << "  entry points:\t\t" << _prefix << "_*" << endl;
+			cout << "  code written in:\t" << output << endl;
+		}
+
+		if (shared) {
+			string compiler = cxx ? cxx.Get() : getenv("CXX") ? getenv("CXX") : "c++";
+			stringstream cmd;
+			cmd << compiler << " -O2 -shared -fPIC `pkg-config --cflags ibex` \"" << output << "\" -o \"" << shared.Get() << "\"";
+
+			if (!quiet)
+				cout << "  compiling:\t\t" << cmd.str() << endl;
+
+			if (system(cmd.str().c_str())!=0) {
+				cerr << "\n\033[31mError:\033[0m compilation failed" << endl;
+				return 1;
+			}
+
+			if (!quiet)
+				cout << "  shared object:\t" << shared.Get() << endl;
+		}
+	}
+	catch(ibex::UnknownFileException& e) {
+		cerr << "Error: cannot read file '" << filename.Get() << "'" << endl;
+		return 1;
+	}
+	catch(ibex::SyntaxError& e) {
+		cout << e << endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -8,7 +8,7 @@
 // Author      : Gilles Chabert
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
-// Last Update : Feb 13, 2025
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex.h"
@@ -40,6 +40,9 @@ int main(int argc, char** argv) {
 	args::ValueFlag<double> abs_eps_f(parser, "float", _abs_eps_f.str(), {'a', "abs-eps-f"});
 	args::ValueFlag<double> eps_h(parser, "float", _eps_h.str(), {"eps-h"});
 	args::ValueFlag<double> timeout(parser, "float", "Timeout (time in seconds). Default value is +oo.", {'t', "timeout"});
+	args::ValueFlag<int>    threads(parser, "int", "Number of threads. With more than one thread, the time (and the timeout) "
+			"is the elapsed real time. Default value is 1.", {"threads"});
+	args::Flag real_time(parser, "real-time", "The time (and the timeout) is the elapsed real time instead of the CPU time.", {"real-time"});
 	args::ValueFlag<double> random_seed(parser, "float", _random_seed.str(), {"random-seed"});
 	args::ValueFlag<double> eps_x_arg(parser, "float", _eps_x.str(), {"eps-x"});
 	args::ValueFlag<int>    simpl_level(parser, "int", "Expression simplification level. Possible values are:\n"
@@ -48,6 +51,9 @@ int main(int argc, char** argv) {
 			"\t\t* 2:\tmore advanced simplifications without developing (can be slow). E.g. x*x + x^2 --> 2x^2\n"
 			"\t\t* 3:\tsimplifications with full polynomial developing (can blow up!). E.g. x*(x-1) + x --> x^2\n"
 			"Default value is : 1.", {"simpl"});
+	args::Flag cache(parser, "cache", "Create (or update) the binary cache <filename>.cache of the Minibex file, "
+			"so that the next runs skip parsing and simplification. By default, the cache is only used if it exists and is up to date.", {"cache"});
+	args::Flag no_cache(parser, "no-cache", "Do not use the binary cache of the Minibex file, even if it exists.", {"no-cache"});
 	args::ValueFlag<double> initial_loup(parser, "float", "Intial \"loup\" (a priori known upper bound).", {"initial-loup"});
 	args::ValueFlag<string> input_file(parser, "filename", "COV input file. The file contains "
 			"optimization data in the COV (binary) format.", {'i',"input"});
@@ -55,6 +61,7 @@ int main(int argc, char** argv) {
 			"optimization data in the COV (binary) format. See --format", {'o',"output"});
 	args::Flag rigor(parser, "rigor", "Activate rigor mode (certify feasibility of equalities).", {"rigor"});
 	args::Flag kkt(parser, "kkt", "Activate contractor based on Kuhn-Tucker conditions.", {"kkt"});
+	args::Flag pool(parser, "pool", "Allocate cells and boxes in a memory pool (may speed up long runs).", {"pool"});
 	args::Flag output_no_obj(parser, "output-no-obj", "Generate a COV with domains of variables only (not objective values).", {"output-no-obj"});
 	args::Flag trace(parser, "trace", "Activate trace. Updates of loup/uplo are printed while minimizing.", {"trace"});
 	args::Flag stats(parser, "stats", "Enable statistics. Note: This may slightly deteriorate performances. Only statistics for the LP solver exist so far.", {"stats"});
@@ -112,7 +119,7 @@ int main(int argc, char** argv) {
 		}
 		else
 			// Load a system of equations
-			sys = new System(filename.Get().c_str(), simpl_level? simpl_level.Get() : ExprNode::default_simpl_level);
+			sys = new System(filename.Get().c_str(), simpl_level? simpl_level.Get() : ExprNode::default_simpl_level, !no_cache, cache);
 
 		DefaultOptimizerConfig config(*sys);
 
@@ -257,6 +264,13 @@ int main(int argc, char** argv) {
 			config.set_timeout(timeout.Get());
 		}
 
+		// This option measures time with the wall clock
+		if (real_time) {
+			if (!quiet)
+				cout << "  real time:\t\tON" << endl;
+			config.set_real_time(true);
+		}
+
 		// This option prints each better feasible point when it is found
 		if (trace) {
 			if (!quiet)
@@ -283,12 +297,42 @@ int main(int argc, char** argv) {
 			config.set_extended_cov(false);
 		}
 
+		if (pool) {
+			if (!quiet)
+				cout << "  pool allocation:\tON" << endl;
+			config.set_pool_allocation(true);
+		}
+
+		int nb_threads=1;
+
+		if (threads) {
+			nb_threads=threads.Get();
+			if (nb_threads<1) {
+				ibex_error("the number of threads must be at least 1");
+				exit(1);
+			}
+			if (!quiet)
+				cout << "  threads:\t\t" << nb_threads << endl;
+		}
+
 		if (!quiet) {
 			cout << "*******************************************************" << endl << endl;
 		}
 
+		// One configuration per thread, each built on its own copy of the system
+		Array<OptimizerConfig> configs(nb_threads);
+		vector<System*> sys_copies;
+		configs.set_ref(0,config);
+		for (int i=1; i<nb_threads; i++) {
+			sys_copies.push_back(new System(*sys, System::COPY));
+			configs.set_ref(i,*new DefaultOptimizerConfig(*sys_copies.back(), config));
+		}
+
 		// Build the default optimizer
-		Optimizer o(config);
+		ParallelOptimizer* o=new ParallelOptimizer(configs);
+
+		// The results are directly written in the output file
+		o->output_file=output_cov_file;
 
 		// display solutions with up to 12 decimals
 		cout.precision(12);
@@ -300,23 +344,21 @@ int main(int argc, char** argv) {
 		// Get the solutions
 		if (input_file)
 			if (initial_loup)
-				o.optimize(input_file.Get().c_str(), initial_loup.Get());
+				o->optimize(input_file.Get().c_str(), initial_loup.Get());
 			else
-				o.optimize(input_file.Get().c_str());
+				o->optimize(input_file.Get().c_str());
 		else
 			if (initial_loup)
-				o.optimize(sys->box, initial_loup.Get());
+				o->optimize(sys->box, initial_loup.Get());
 			else
-				o.optimize(sys->box);
+				o->optimize(sys->box);
 
 		if (trace) cout << endl;
 
 		// Report some information (computation time, etc.)
 
 		if (!quiet)
-			o.report(); // will include statistics if they are enabled
-
-		o.get_data().save(output_cov_file.c_str());
+			o->report(); // will include statistics if they are enabled
 
 		if (!quiet) {
 			cout << " results written in " << output_cov_file << "\n";
@@ -324,6 +366,13 @@ int main(int argc, char** argv) {
 				cout << " (old file saved in " << cov_copy << ")\n";
 		}
 
+		delete o;
+
+		for (int i=1; i<nb_threads; i++) {
+			delete &configs[i];
+			delete sys_copies[i-1];
+		}
+
 		delete sys;
 
 		return 0;
@@ -8,7 +8,7 @@
 // Author      : Gilles Chabert
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
-// Last Update : Oct 01, 2017
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex.h"
@@ -35,12 +35,18 @@ int main(int argc, char** argv) {
 	args::ValueFlag<double> eps_x_min_arg(parser, "float", _eps_x_min.str(), {'e', "eps-min"});
 	args::ValueFlag<double> eps_x_max(parser, "float", _eps_x_max.str(), {'E', "eps-max"});
 	args::ValueFlag<double> timeout(parser, "float", "Timeout (time in seconds). Default value is +oo (none).", {'t', "timeout"});
+	args::Flag real_time(parser, "real-time", "The time (and the timeout) is the elapsed real time instead of the CPU time.", {"real-time"});
+	args::ValueFlag<int>    threads(parser, "int", "Number of threads. With more than one thread, the time (and the timeout) "
+			"is the elapsed real time. Default value is 1.", {"threads"});
 	args::ValueFlag<int>    simpl_level(parser, "int", "Expression simplification level. Possible values are:\n"
 			"\t\t* 0:\tno simplification at all (fast).\n"
 			"\t\t* 1:\tbasic simplifications (fairly fast). E.g. x+1+1 --> x+2\n"
 			"\t\t* 2:\tmore advanced simplifications without developing (can be slow). E.g. x*x + x^2 --> 2x^2\n"
 			"\t\t* 3:\tsimplifications with full polynomial developing (can blow up!). E.g. x*(x-1) + x --> x^2\n"
 			"Default value is : 1.", {"simpl"});
+	args::Flag cache(parser, "cache", "Create (or update) the binary cache <filename>.cache of the Minibex file, "
+			"so that the next runs skip parsing and simplification. By default, the cache is only used if it exists and is up to date.", {"cache"});
+	args::Flag no_cache(parser, "no-cache", "Do not use the binary cache of the Minibex file, even if it exists.", {"no-cache"});
 	args::ValueFlag<string> input_file(parser, "filename", "COV input file. The file contains a "
 			"(intermediate) description of the manifold with boxes in the COV (binary) format.", {'i',"input"});
 	args::ValueFlag<string> output_file(parser, "filename", "COV output file. The file will contain the "
@@ -55,6 +61,7 @@ int main(int argc, char** argv) {
 			"\t\t* half-ball:\t(**not implemented yet**) the intersection of the box and the solution set is homeomorphic to a half-ball of R^n\n"
 	        "\t\t* false: never satisfied. Set by default if m=0 or m=n (inequalities only/square systems)",
 			{"boundary"});
+	args::Flag pool(parser, "pool", "Allocate cells and boxes in a memory pool (may speed up long runs).", {"pool"});
 	args::Flag sols(parser, "sols", "Display the \"solutions\" (output boxes) on the standard output.", {'s',"sols"});
 	args::ValueFlag<double> random_seed(parser, "float", _random_seed.str(), {"random-seed"});
 	args::Flag quiet(parser, "quiet", "Print no report on the standard output.",{'q',"quiet"});
@@ -123,7 +130,7 @@ int main(int argc, char** argv) {
 		}
 
 		// Load a system of equations
-		System sys(filename.Get().c_str(), simpl_level? simpl_level.Get() : ExprNode::default_simpl_level);
+		System sys(filename.Get().c_str(), simpl_level? simpl_level.Get() : ExprNode::default_simpl_level, !no_cache, cache);
 
 		string output_manifold_file; // manifold output file
 		bool overwitten=false;       // is it overwritten?
@@ -190,12 +197,30 @@ int main(int argc, char** argv) {
 			}
 		}
 
-		// Build the default solver
-		DefaultSolver s(sys,
-				eps_x_min,
-				eps_x_max ? eps_x_max.Get() : DefaultSolver::default_eps_x_max,
-				!bfs,
-				random_seed? random_seed.Get() : DefaultSolver::default_random_seed);
+		int nb_threads=1;
+
+		if (threads) {
+			nb_threads=threads.Get();
+			if (nb_threads<1) {
+				ibex_error("the number of threads must be at least 1");
+				exit(1);
+			}
+		}
+
+		// One default solver per thread, each built on its own copy of the system
+		Array<Solver> solvers(nb_threads);
+		vector<System*> sys_copies;
+		for (int i=0; i<nb_threads; i++) {
+			if (i>0) sys_copies.push_back(new System(sys, System::COPY));
+			solvers.set_ref(i,*new DefaultSolver(i==0? sys : *sys_copies.back(),
+					eps_x_min,
+					eps_x_max ? eps_x_max.Get() : DefaultSolver::default_eps_x_max,
+					!bfs,
+					random_seed? random_seed.Get() : DefaultSolver::default_random_seed));
+		}
+
+		// Build the solver
+		ParallelSolver s(sys, solvers);
 
 		if (boundary_test_arg) {
 
@@ -243,6 +268,15 @@ int main(int argc, char** argv) {
 			s.time_limit=timeout.Get();
 		}
 
+		// This option measures time with the wall clock
+		// (always with several threads, otherwise the CPU time
+		// of all the threads would be summed up).
+		if (real_time || nb_threads>1) {
+			if (!quiet)
+				cout << "  real time:\t\tON" << endl;
+			s.real_time=true;
+		}
+
 		// This option prints each better feasible point when it is found
 		if (trace) {
 			if (!quiet)
@@ -250,6 +284,18 @@ int main(int argc, char** argv) {
 			s.trace=trace.Get();
 		}
 
+		if (pool) {
+			if (!quiet)
+				cout << "  pool allocation:\tON" << endl;
+			s.pool_allocation=true;
+		}
+
+		if (!quiet && nb_threads>1)
+			cout << "  threads:\t\t" << nb_threads << endl;
+
+		// The boxes are written in the output file as and when they are found
+		s.output_file=output_manifold_file;
+
 		if (!quiet) {
 			cout << "*****************************************************************" << endl << endl;
 		}
@@ -272,9 +318,11 @@ int main(int argc, char** argv) {
 
 		if (!quiet) s.report();
 
-		if (sols) cout << s.get_data() << endl;
-
-		s.get_data().save(output_manifold_file.c_str());
+		if (sols) {
+			// the boxes are read back from the output file
+			CovSolverData::Reader reader(output_manifold_file.c_str());
+			cout << reader << endl;
+		}
 
 		if (!quiet) {
 			cout << " results written in " << output_manifold_file << "\n";
@@ -285,6 +333,11 @@ int main(int argc, char** argv) {
 //			cout << " (note: use --sols to display solutions)" << endl;
 //		}
 
+		for (int i=0; i<nb_threads; i++) {
+			delete &solvers[i];
+			if (i>0) delete sys_copies[i-1];
+		}
+
 	}
 	catch(ibex::UnknownFileException& e) {
 		cerr << "Error: cannot read file '" << filename.Get() << "'" << endl;
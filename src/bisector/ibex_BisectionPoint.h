@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Dec 25, 2017
-// Last Update : Dec 25, 2017
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_BISECTION_POINT_H__
@@ -30,7 +30,7 @@ public:
 	/**
 	 * \brief Which variable is selected.
 	 */
-	const unsigned int var;
+	unsigned int var;
 
 	/**
 	 * \brief Where is the bisection point in
@@ -45,7 +45,7 @@ public:
 	 * or
 	 *       pos=0.5 and rel_pos=true
 	 */
-	const double pos;
+	double pos;
 
 	/**
 	 * \brief Whether the "pos" is relative or absolute.
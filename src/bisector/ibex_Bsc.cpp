@@ -5,11 +5,12 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 8, 2012
-// Last Update : Jul 6, 2018
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_Bsc.h"
 #include "ibex_Exception.h"
+#include "ibex_NoBisectableVariableException.h"
 #include "ibex_Id.h"
 
 using namespace std;
@@ -38,6 +39,15 @@ void Bsc::enable_statistics(Statistics& stats, const std::string& prefix) {
 
 }
 
+bool Bsc::try_choose_var(const Cell& cell, BisectionPoint& pt) {
+	try {
+		pt=choose_var(cell);
+		return true;
+	} catch(NoBisectableVariableException&) {
+		return false;
+	}
+}
+
 pair<IntervalVector,IntervalVector> Bsc::bisect(const IntervalVector& box) {
 	Cell cell(box);
 	pair<Cell*,Cell*> p=bisect(cell);
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 8, 2012
-// Last Update : Jul 6, 2018
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_BISECTOR_H__
@@ -80,6 +80,16 @@ public:
 	 */
 	std::pair<Cell*,Cell*> bisect(const Cell& cell);
 
+	/**
+	 * \brief Bisect the current cell (without exception).
+	 *
+	 * Same as #bisect(const Cell&) but return false instead of raising a
+	 * NoBisectableVariableException if no variable can be bisected.
+	 *
+	 * \param cells - (output) the two subcells, in case of success.
+	 */
+	bool try_bisect(const Cell& cell, std::pair<Cell*,Cell*>& cells);
+
 	/**
 	 * \brief Bisect a box and return the result.
 	 */
@@ -92,6 +102,21 @@ public:
 	 */
 	virtual BisectionPoint choose_var(const Cell& cell) = 0;
 
+	/**
+	 * \brief Return next variable to be bisected (without exception).
+	 *
+	 * Same as #choose_var(const Cell&) but return false instead of raising
+	 * a NoBisectableVariableException. Search strategies call this function:
+	 * throwing an exception is costly when many cells reach the precision.
+	 *
+	 * By default: call choose_var(...) and catch the exception. The bisectors
+	 * of Ibex override this function and their choose_var(...) is only a wrapper
+	 * (a subclass that overrides choose_var(...) must override this function too).
+	 *
+	 * \param pt - (output) the bisection point, in case of success.
+	 */
+	virtual bool try_choose_var(const Cell& cell, BisectionPoint& pt);
+
 	/**
 	 * Allows to add the properties required
 	 * by this bisector to the root cell before a
@@ -167,6 +192,13 @@ inline std::pair<Cell*,Cell*> Bsc::bisect(const Cell& cell) {
 	return cell.bisect(choose_var(cell));
 }
 
+inline bool Bsc::try_bisect(const Cell& cell, std::pair<Cell*,Cell*>& cells) {
+	BisectionPoint pt(0,0,false);
+	if (!try_choose_var(cell,pt)) return false;
+	cells=cell.bisect(pt);
+	return true;
+}
+
 } // end namespace ibex
 
 #endif // __IBEX_BISECTOR_H__
@@ -4,7 +4,7 @@
 // Author	  : Ignacio Araya, Bertrand Neveu
 // License	 : See the LICENSE file
 // Created	 : May, 25 2017
-// Last Update : May, 3 2019
+// Last Update : Oct, 18 2026
 //============================================================================
 
 #include "ibex_LSmear.h"
@@ -169,6 +169,7 @@ int LSmear::var_to_bisect(IntervalMatrix& J, const IntervalVector& box) const {
 }
 
 void LSmear::enable_statistics(Statistics& stats, const std::string& prefix) {
+	SmearSumRelative::enable_statistics(stats, prefix);
 	mylinearsolver->enable_statistics(stats, prefix + "/LSmear");
 }
 
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 19, 2012
-// Last Update : Dec 25, 2017
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_LargestFirst.h"
@@ -29,6 +29,13 @@ LargestFirst::LargestFirst(const Vector& prec, double ratio1) : Bsc(prec), ratio
 
 
 BisectionPoint LargestFirst::choose_var(const Cell& cell) {
+	BisectionPoint pt(0,0,false);
+	if (!try_choose_var(cell,pt))
+		throw NoBisectableVariableException();
+	return pt;
+}
+
+bool LargestFirst::try_choose_var(const Cell& cell, BisectionPoint& pt) {
 
 	const IntervalVector& box=cell.box;
 
@@ -51,10 +58,11 @@ BisectionPoint LargestFirst::choose_var(const Cell& cell) {
 	}
 
 	if (var !=-1){
-		return BisectionPoint(var,ratio,true);
+		pt=BisectionPoint(var,ratio,true);
+		return true;
 	}
 	else {
-		throw NoBisectableVariableException();
+		return false;
 	}
 
 }
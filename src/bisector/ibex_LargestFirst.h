@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 19, 2012
-// Last Update : Dec 25, 2017
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_LARGEST_FIRST_H__
@@ -49,6 +49,13 @@ public:
 	 */
 	virtual BisectionPoint choose_var(const Cell& cell) override;
 
+	/**
+	 * \brief Return next variable to be bisected (without exception).
+	 *
+	 * called by Bsc::try_bisect(...)
+	 */
+	virtual bool try_choose_var(const Cell& cell, BisectionPoint& pt) override;
+
 	/**
 	 * \brief Ratio to choose the split point.
 	 *
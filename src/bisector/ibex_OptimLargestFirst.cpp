@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Dec 3, 2018
-// Last Update : Apr 9, 2021
+// Last Update : Oct 18, 2026
 //============================================================================
 #include "float.h"
 #include "ibex_OptimLargestFirst.h"
@@ -26,6 +26,13 @@ namespace ibex {
 
 
 BisectionPoint OptimLargestFirst::choose_var(const Cell& cell) {
+	BisectionPoint pt(0,0,false);
+	if (!try_choose_var(cell,pt))
+		throw NoBisectableVariableException();
+	return pt;
+}
+
+bool OptimLargestFirst::try_choose_var(const Cell& cell, BisectionPoint& pt) {
 const IntervalVector& box=cell.box;
 	int var =-1;
 	double l=0.0;
@@ -54,10 +61,11 @@ const IntervalVector& box=cell.box;
     var=goal_var;
   //  cout << " bisected var " << var  << " l " << l << endl ;
   if (var !=-1){
-    return BisectionPoint(var,ratio,true);
+    pt=BisectionPoint(var,ratio,true);
+    return true;
   }
   else {
-    throw NoBisectableVariableException();
+    return false;
   }
 
 }
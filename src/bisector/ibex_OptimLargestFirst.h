@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Dec 3, 2018
-// Last Update : Oct 17, 2019
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_OPTIM_LARGEST_FIRST_H__
@@ -54,6 +54,13 @@ public:
 	 */
 	BisectionPoint choose_var(const Cell& cell);
 
+	/**
+	 * \brief Return next variable to be bisected (without exception).
+	 *
+	 * called by Bsc::try_bisect(...)
+	 */
+	bool try_choose_var(const Cell& cell, BisectionPoint& pt);
+
 
 protected:	
 
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 8, 2012
-// Last Update : Jun 29, 2018
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_RoundRobin.h"
@@ -24,6 +24,13 @@ RoundRobin::RoundRobin(const Vector& prec, double ratio) : Bsc(prec), ratio(rati
 }
 
 BisectionPoint RoundRobin::choose_var(const Cell& cell) {
+	BisectionPoint pt(0,0,false);
+	if (!try_choose_var(cell,pt))
+		throw NoBisectableVariableException();
+	return pt;
+}
+
+bool RoundRobin::try_choose_var(const Cell& cell, BisectionPoint& pt) {
 
 	int last_var=cell.bisected_var;
 
@@ -38,12 +45,12 @@ BisectionPoint RoundRobin::choose_var(const Cell& cell) {
 	while (var != last_var && too_small(box,var))
 		var = (var + 1)%n;
 
-	// if no variable can be bisected an exception is thrown
+	// if no variable can be bisected
 	if (var==last_var && too_small(box,var))
-		throw NoBisectableVariableException();
+		return false;
 
-	else
-		return BisectionPoint(var,ratio,true); // output
+	pt=BisectionPoint(var,ratio,true); // output
+	return true;
 }
 
 } // end namespace ibex
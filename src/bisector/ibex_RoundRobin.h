@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 08, 2012
-// Last Update : Jun 29, 2018
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_ROUND_ROBIN_H__
@@ -57,6 +57,13 @@ public:
 	 */
 	virtual BisectionPoint choose_var(const Cell& cell) override;
 
+	/**
+	 * \brief Return next variable to be bisected (without exception).
+	 *
+	 * See #choose_var(const Cell&) and #Bsc::try_choose_var(const Cell&, BisectionPoint&).
+	 */
+	virtual bool try_choose_var(const Cell& cell, BisectionPoint& pt) override;
+
 	/**
 	 * \brief Ratio to choose the split point.
 	 *
@@ -5,11 +5,13 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : July 19 2012
-// Last Update : May 9 2019
+// Last Update : Oct 18 2026
 //============================================================================
 
 #include "ibex_SmearFunction.h"
 #include "ibex_ExtendedSystem.h"
+#include "ibex_BxpSystemCache.h"
+#include "ibex_NoBisectableVariableException.h"
 
 using namespace std;
 
@@ -18,33 +20,48 @@ namespace ibex {
 
 void SmearFunction::add_property(const IntervalVector& init_box, BoxProperties& map) {
 	lf->add_property(init_box, map);
+	BxpSystemCache::add_property(sys, map, cache_statistics);
+}
+
+void SmearFunction::enable_statistics(Statistics& stats, const std::string& prefix) {
+	cache_statistics = BxpSystemCache::enable_statistics(sys, stats);
 }
 
 SmearFunction::~SmearFunction() {
 	if (lftodelete) delete lf;
 }
 
+void SmearFunction::init() {
+	ExtendedSystem* ext=dynamic_cast<ExtendedSystem*> (&sys);
+	_goal_ctr = ext ? ext->goal_ctr() : -1;
+	_goal_var = ext ? ext->goal_var() : -1;
+}
+
 // used in optimization with an ExtendedSystem sys ; returns the index of the goal ctr in sys
 // if sys is not an Extended system , returns -1
 int SmearFunction::goal_ctr() const {
-	if (dynamic_cast<ExtendedSystem*> (&sys)) {
-		return dynamic_cast<ExtendedSystem*> (&sys)->goal_ctr();
-	}
-	else  return -1;
+	return _goal_ctr;
 }
 // used  in optim plugin by LSmear bisector
 int  SmearFunction::goal_var() const {
-	if (dynamic_cast<ExtendedSystem*> (&sys)) {
-		return dynamic_cast<ExtendedSystem*> (&sys)->goal_var();
-	}
-	else  return -1;
+	return _goal_var;
 }
 
 // Used in optimization to not consider an inactive constraint
 // returns true if it is not an extended system, the constraint is inactive or it is the objective
+// (computed once per node by choose_var)
 bool SmearFunction::constraint_to_consider(int i, const IntervalVector & box) const {
-	if (i==goal_ctr() && _goal_to_consider==false ) return 0;
-	return (goal_ctr()==-1 || i== goal_ctr() || ((sys.ops[i]==LEQ || sys.ops[i]==LT) && sys.f_ctrs[i].eval(box).ub() >= 0.0));
+	return ctrs_to_consider[i];
+}
+
+void SmearFunction::smear_matrix(const IntervalMatrix& J, const IntervalVector& box, Matrix& S) const {
+	Vector diam=box.diam();
+	for (BitSet::const_iterator i=ctrs_to_consider.begin(); i!=ctrs_to_consider.end(); ++i) {
+		const IntervalVector& Ji=J[i];
+		Vector& Si=S[i];
+		for (int j=0; j<nbvars; j++)
+			Si[j] = Ji[j].mag() * diam[j];
+	}
 }
 
 // test to not consider the objective when it is equal to a variable
@@ -61,46 +78,86 @@ bool SmearFunction::goal_to_consider(const IntervalMatrix& J, int i) const{
 
 
 BisectionPoint SmearFunction::choose_var(const Cell& cell) {
+	BisectionPoint pt(0,0,false);
+	if (!try_choose_var(cell,pt))
+		throw NoBisectableVariableException();
+	return pt;
+}
+
+bool SmearFunction::try_choose_var(const Cell& cell, BisectionPoint& pt) {
 	const IntervalVector& box=cell.box;
 
 	IntervalMatrix J(sys.f_ctrs.image_dim(), sys.nb_var);
 
-	sys.f_ctrs.jacobian(box,J);
+	// The Jacobian matrix (and the evaluation of the constraints)
+	// are shared with other operators through the system cache.
+	const BxpSystemCache* cache=BxpSystemCache::get(sys, cell.prop, box);
+
+	if (cache)
+		cache->ctrs_jacobian(J);
+	else
+		sys.f_ctrs.jacobian(box,J);
+
+	if (goal_ctr()!=-1) {
+		// required by constraint_to_consider
+		if (cache)
+			cache->ctrs_eval(ctrs_ev);
+		else
+			ctrs_ev=sys.f_ctrs.eval_vector(box);
+	}
 	// in case of infinite derivatives  changing to largest first  bisection
 
 	for (int i=0; i<sys.f_ctrs.image_dim(); i++){
 		for (int j=0; j<sys.nb_var; j++)
 			if (J[i][j].mag() == POS_INFINITY ||((J[i][j].mag() ==0) && box[j].diam()== POS_INFINITY ))
-				return lf->choose_var(cell);
+				return lf->try_choose_var(cell,pt);
 		// check if the goal is to be considered
 		if (i==goal_ctr()){
 			_goal_to_consider=goal_to_consider(J,i);
 		}
 	}
 
+	// constraints to consider in this node
+	ctrs_to_consider.clear();
+	for (int i=0; i<sys.f_ctrs.image_dim(); i++) {
+		if (i==_goal_ctr) {
+			if (_goal_to_consider) ctrs_to_consider.add(i);
+		} else if (_goal_ctr==-1 || ((sys.ops[i]==LEQ || sys.ops[i]==LT) && ctrs_ev[i].ub() >= 0.0))
+			ctrs_to_consider.add(i);
+	}
+
 	int var = var_to_bisect (J,box);
 
 	// in case of selected var with infinite domain, change to largest first bisection
 	if (var == -1 || !(box[var].is_bisectable()))
-		return lf->choose_var(cell);
-	else
-		return BisectionPoint(var,lf->ratio,true);
+		return lf->try_choose_var(cell,pt);
+	else {
+		pt=BisectionPoint(var,lf->ratio,true);
+		return true;
+	}
 }
 
 
 // computes the variable with the greatest maximal impact
 int SmearMax::var_to_bisect(IntervalMatrix& J, const IntervalVector& box) const {
+	int m=sys.f_ctrs.image_dim();
+	Matrix S(m, nbvars);
+	smear_matrix(J, box, S);
+
+	// column reduction (max)
+	Vector score(nbvars, NEG_INFINITY);
+	for (BitSet::const_iterator i=ctrs_to_consider.begin(); i!=ctrs_to_consider.end(); ++i) {
+		const Vector& Si=S[i];
+		for (int j=0; j<nbvars; j++)
+			if (Si[j] > score[j]) score[j]=Si[j];
+	}
+
 	double max_magn = NEG_INFINITY;
 	int var=-1;
 	for (int j=0; j<nbvars; j++) {
-		if ((!too_small(box,j))) { // && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
-			for (int i=0; i<sys.f_ctrs.image_dim(); i++) {
-				if (constraint_to_consider (i, box))
-					if ( J[i][j].mag() * box[j].diam() > max_magn ) {
-						max_magn = J[i][j].mag()* box[j].diam();
-						var = j;
-					}
-			}
+		if ((!too_small(box,j)) && score[j] > max_magn) { // && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
+			max_magn = score[j];
+			var = j;
 		}
 	}
 	return var;
@@ -108,88 +165,90 @@ int SmearMax::var_to_bisect(IntervalMatrix& J, const IntervalVector& box) const
 
 // computes the variable with the greatest  sum of impacts
 int SmearSum::var_to_bisect(IntervalMatrix& J, const IntervalVector& box) const {
+	int m=sys.f_ctrs.image_dim();
+	Matrix S(m, nbvars);
+	smear_matrix(J, box, S);
+
+	// column reduction (sum)
+	Vector score(nbvars, 0.0);
+	for (BitSet::const_iterator i=ctrs_to_consider.begin(); i!=ctrs_to_consider.end(); ++i) {
+		const Vector& Si=S[i];
+		for (int j=0; j<nbvars; j++)
+			score[j] += Si[j];
+	}
+
 	double max_magn = NEG_INFINITY;
 	int var = -1;
 	for (int j=0; j<nbvars; j++) {
-		if ((!too_small(box,j))) { // && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
-			double sum_smear=0;
-			for (int i=0; i<sys.f_ctrs.image_dim(); i++) {
-				if (constraint_to_consider (i, box))
-					sum_smear+= J[i][j].mag() *box[j].diam();
-			}
-			if (sum_smear > max_magn) {
-				max_magn = sum_smear;
-				var = j;
-			}
+		if ((!too_small(box,j)) && score[j] > max_magn) { // && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
+			max_magn = score[j];
+			var = j;
 		}
 	}
 	return var;
 }
 
 int SmearSumRelative::var_to_bisect(IntervalMatrix& J, const IntervalVector& box) const {
-	double max_magn = NEG_INFINITY;
-	int var = -1;
-	// the normalizing factor per constraint
-	double* ctrjsum = new double[sys.f_ctrs.image_dim()];
+	int m=sys.f_ctrs.image_dim();
+	Matrix S(m, nbvars);
+	smear_matrix(J, box, S);
+
+	// row reduction: the normalizing factor per constraint
+	// (not an extended system or constraint is active or it is the objective)
+	Vector ctrjsum(m, 0.0);
+	for (BitSet::const_iterator i=ctrs_to_consider.begin(); i!=ctrs_to_consider.end(); ++i) {
+		const Vector& Si=S[i];
+		for (int j=0; j<nbvars ; j++)
+			ctrjsum[i] += Si[j];
+	}
 
-	for (int i=0; i<sys.f_ctrs.image_dim(); i++) {
-		ctrjsum[i]=0;
-		// not an extended system or constraint is active or it is the objective
-		if (constraint_to_consider(i, box))
-			for (int j=0; j<nbvars ; j++) {
-				ctrjsum[i]+= J[i][j].mag() * box[j].diam();
-			}
+	// column reduction: sum of normalized impacts
+	Vector score(nbvars, 0.0);
+	for (BitSet::const_iterator i=ctrs_to_consider.begin(); i!=ctrs_to_consider.end(); ++i) {
+		if (ctrjsum[i]==0) continue;
+		const Vector& Si=S[i];
+		for (int j=0; j<nbvars; j++)
+			score[j] += Si[j] / ctrjsum[i];
 	}
+
 	// computes the variable with the maximal sum of normalized impacts
+	double max_magn = NEG_INFINITY;
+	int var = -1;
 	for (int j=0; j<nbvars; j++) {
-		if ((!too_small(box,j))) { //&&  (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
-			double sum_smear=0;
-			for (int i=0; i<sys.f_ctrs.image_dim(); i++) {
-				if (ctrjsum[i]!=0)
-					sum_smear+= J[i][j].mag() * box[j].diam() / ctrjsum[i];
-			}
-
-
-			if (sum_smear > max_magn) {
-				max_magn = sum_smear;
-				var = j;
-			}
+		if ((!too_small(box,j)) && score[j] > max_magn) { //&&  (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
+			max_magn = score[j];
+			var = j;
 		}
-
 	}
-	delete[] ctrjsum;
 	return var;
 }
 
 int SmearMaxRelative::var_to_bisect(IntervalMatrix& J, const IntervalVector& box) const {
-
-	double max_magn = NEG_INFINITY;
-	int var = -1;
-
-	double* ctrjsum = new double[sys.f_ctrs.image_dim()]; // the normalizing factor per constraint
-	for (int i=0; i<sys.f_ctrs.image_dim(); i++) {
-		ctrjsum[i]=0;
-		for (int j=0; j<nbvars ; j++) {
-			ctrjsum[i]+= J[i][j].mag() * box[j].diam() ;
-		}
+	int m=sys.f_ctrs.image_dim();
+	Matrix S(m, nbvars);
+	smear_matrix(J, box, S);
+
+	// column reduction (max) of the normalized impacts
+	Vector score(nbvars, 0.0);
+	for (BitSet::const_iterator i=ctrs_to_consider.begin(); i!=ctrs_to_consider.end(); ++i) {
+		const Vector& Si=S[i];
+		double ctrjsum=0; // the normalizing factor of the constraint
+		for (int j=0; j<nbvars ; j++)
+			ctrjsum += Si[j];
+		if (ctrjsum==0) continue;
+		for (int j=0; j<nbvars; j++)
+			if (Si[j] / ctrjsum > score[j]) score[j]=Si[j] / ctrjsum;
 	}
 
 	// computes the variable with the greatest normalized impact
-	double maxsmear=0;
+	double max_magn = NEG_INFINITY;
+	int var = -1;
 	for (int j=0; j<nbvars; j++) {
-		if ((!too_small(box,j))) { // && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
-			for (int i=0; i<sys.f_ctrs.image_dim(); i++) {
-				if (constraint_to_consider(i,box))
-					if (ctrjsum[i]!=0)
-						maxsmear = J[i][j].mag() * box[j].diam() / ctrjsum[i];
-				if (maxsmear > max_magn) {
-					max_magn = maxsmear;
-					var = j;
-				}
-			}
+		if ((!too_small(box,j)) && score[j] > max_magn) { // && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
+			max_magn = score[j];
+			var = j;
 		}
 	}
-	delete[] ctrjsum;
 	return var;
 }
 
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : July 19, 2012
-// Last Update : July 19, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_SMEAR_FUNCTION_H__
@@ -15,6 +15,7 @@
 #include "ibex_RoundRobin.h"
 #include "ibex_LargestFirst.h"
 #include "ibex_System.h"
+#include "ibex_StsSystemCache.h"
 
 namespace ibex {
 
@@ -66,20 +67,38 @@ public:
 	 */
 	virtual BisectionPoint choose_var(const Cell& cell) override;
 
+	/**
+	 * \brief Return next variable to be bisected (without exception).
+	 *
+	 * called by Bsc::try_bisect(...)
+	 */
+	virtual bool try_choose_var(const Cell& cell, BisectionPoint& pt) override;
+
 	/**
 	 * \brief Returns the variable to bisect.
 	 *
 	 * Return the index i of the variable with the greatest maximum impact Abs(Dfj/Dxi) * Diam(xi).
 	 *
 	 * \param J the jacobian matrix J
+	 *
+	 * \note The constraints to consider are determined once per node by #choose_var(const Cell&),
+	 *       so \a box must be the box of the cell given to the last call to choose_var.
 	 */
 	virtual int var_to_bisect(IntervalMatrix& J, const IntervalVector& box) const=0;
 
 	/**
-	 * \brief Add backtrackable data required by round robin.
+	 * \brief Add backtrackable data required by round robin
+	 * and the system cache (see #BxpSystemCache).
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& map) override;
 
+	/**
+	 * \brief Enable statistics (of the system cache).
+	 *
+	 * \see #Bsc::enable_statistics.
+	 */
+	virtual void enable_statistics(Statistics& stats, const std::string& prefix) override;
+
 	
 protected :
 	LargestFirst* lf; // the bisector by default when smear function strategy does not apply: 
@@ -93,9 +112,34 @@ protected :
 	bool constraint_to_consider(int i, const IntervalVector & box) const;
 	bool goal_to_consider( const IntervalMatrix& J, int i) const;
 
+	/*
+	 * Impacts of the variables on the constraints to consider:
+	 * S[i][j]=|J[i][j]|*diam(box[j]) for each constraint i in ctrs_to_consider
+	 * (the other rows are left unset).
+	 *
+	 * This is the only O(m.n) loop of the smear functions: the scores of the
+	 * variables are then obtained by reductions on the rows and columns of S.
+	 */
+	void smear_matrix(const IntervalMatrix& J, const IntervalVector& box, Matrix& S) const;
+
+	/* Evaluation of the constraints on the current box
+	 * (only computed for an extended system, see constraint_to_consider). */
+	IntervalVector ctrs_ev;
+
+	/* Constraints to consider in the current box, computed once
+	 * per node by choose_var (see constraint_to_consider). */
+	BitSet ctrs_to_consider;
+
+	/* Statistics of the system cache (NULL if disabled) */
+	StsSystemCache* cache_statistics;
+
 private :
+	void init();
+
 	bool lftodelete; // = true means that  default bisector has to be deleted by the destuctor when the it has been allocated by the constructor.
 	bool _goal_to_consider;
+	int _goal_ctr; // see goal_ctr()
+	int _goal_var; // see goal_var()
 };
 
 /**
@@ -261,30 +305,34 @@ public :
 
 /*============================================ inline implementation ============================================ */
 
-inline SmearFunction::SmearFunction(System& sys, double prec, double ratio) : Bsc(prec), sys(sys) {
+inline SmearFunction::SmearFunction(System& sys, double prec, double ratio) : Bsc(prec), sys(sys), ctrs_ev(1), ctrs_to_consider(sys.f_ctrs.image_dim()), cache_statistics(NULL) {
         lf = new LargestFirst(prec,ratio);
 	lftodelete=true;
 	nbvars=sys.nb_var;
+	init();
 }
 
- inline SmearFunction::SmearFunction(System& sys, double prec, LargestFirst& lf1) : Bsc(prec), sys(sys) {
+ inline SmearFunction::SmearFunction(System& sys, double prec, LargestFirst& lf1) : Bsc(prec), sys(sys), ctrs_ev(1), ctrs_to_consider(sys.f_ctrs.image_dim()), cache_statistics(NULL) {
    lf= &lf1;
    lftodelete=false;
    nbvars=sys.nb_var;
+   init();
 }
 
 
 
-inline SmearFunction::SmearFunction(System& sys, const Vector& prec, double ratio) : Bsc(prec), sys(sys) {
+inline SmearFunction::SmearFunction(System& sys, const Vector& prec, double ratio) : Bsc(prec), sys(sys), ctrs_ev(1), ctrs_to_consider(sys.f_ctrs.image_dim()), cache_statistics(NULL) {
         lf = new LargestFirst(prec,ratio);
 	lftodelete=true;
         nbvars=sys.nb_var;
+        init();
 }
 
- inline SmearFunction::SmearFunction(System& sys, const Vector& prec, LargestFirst& lf1) : Bsc(prec), sys(sys) {
+ inline SmearFunction::SmearFunction(System& sys, const Vector& prec, LargestFirst& lf1) : Bsc(prec), sys(sys), ctrs_ev(1), ctrs_to_consider(sys.f_ctrs.image_dim()), cache_statistics(NULL) {
    lf= &lf1;
    lftodelete=false;
    nbvars=sys.nb_var;
+   init();
 }
 
 
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 10, 2012
-// Last Update : Jun 07, 2018
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_CELL_H__
@@ -15,6 +15,7 @@
 #include "ibex_BoxProperties.h"
 #include "ibex_BisectionPoint.h"
 #include "ibex_Map.h"
+#include "ibex_Pool.h"
 
 namespace ibex {
 
@@ -71,6 +72,16 @@ public:
 	 */
 	virtual ~Cell();
 
+	/**
+	 * \brief Allocate a cell (in the pool, if enabled: see #ibex::Pool).
+	 */
+	static void* operator new(size_t size);
+
+	/**
+	 * \brief Release a cell (in the pool, if enabled: see #ibex::Pool).
+	 */
+	static void operator delete(void* p, size_t size);
+
 	/**
 	 * \brief The box
 	 */
@@ -100,6 +111,16 @@ public:
  */
 std::ostream& operator<<(std::ostream& os, const Cell& c);
 
+/*================================== inline implementations ========================================*/
+
+inline void* Cell::operator new(size_t size) {
+	return Pool::alloc(size);
+}
+
+inline void Cell::operator delete(void* p, size_t size) {
+	Pool::free(p, size);
+}
+
 } // end namespace ibex
 
 #endif // __IBEX_CELL_H__
@@ -5,35 +5,117 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 25, 2012
-// Last Update : Apr 25, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_QInter.h"
 #include <algorithm>
+#include <vector>
+#include <cmath>
 
 using namespace std;
 
 namespace ibex {
 
-IntervalVector qinter(const Array<IntervalVector>& _boxes, int q) {
-	assert(_boxes.size()>0);
-	int n=_boxes[0].size();
+namespace {
+
+/*
+ * Q-intersection of the projections in the dimension d
+ * of the boxes in "act" (lb and ub are working arrays).
+ */
+Interval qinter_dim(const Array<IntervalVector>& boxes, const vector<int>& act, int d, int q, vector<double>& lb, vector<double>& ub) {
+	int p=act.size();
+	lb.resize(p);
+	ub.resize(p);
 
-	// ====== remove the empty boxes from the list ====
-	int p=0; // count the number of non-empty boxes
-	for (int i=0; i<_boxes.size(); i++) {
-		if (!_boxes[i].is_empty()) p++;
+	for (int k=0; k<p; k++) {
+		lb[k]=boxes[act[k]][d].lb();
+		ub[k]=boxes[act[k]][d].ub();
 	}
 
-	if (p==0) return IntervalVector::empty(n);
+	sort(lb.begin(),lb.end());
+	sort(ub.begin(),ub.end());
 
-	Array<IntervalVector> boxes(p);
-	int j=0;
-	for (int i=0; i<_boxes.size(); i++) {
-		if (!_boxes[i].is_empty()) boxes.set_ref(j++,_boxes[i]);
+	// The lower bound is the smallest lower bound x
+	// such that #{lb<=x} - #{ub<x} >= q
+	int k=0;
+	int j=0; // number of upper bounds < lb[k]
+	for (; k<p; k++) {
+		while (j<p && ub[j]<lb[k]) j++;
+		if (k+1-j>=q) break;
+	}
+	if (k==p) return Interval::empty_set();
+	double l=lb[k];
+
+	// The upper bound is the largest upper bound x
+	// such that #{ub>=x} - #{lb>x} >= q
+	k=p-1;
+	j=p-1; // p-1-j is the number of lower bounds > ub[k]
+	for (; k>=0; k--) {
+		while (j>=0 && lb[j]>ub[k]) j--;
+		if ((p-k)-(p-1-j)>=q) break;
+	}
+	assert(k>=0);
+
+	return Interval(l,ub[k]);
+}
+
+/*
+ * Projection algorithm. In return, "act" contains
+ * the indices of the boxes that intersect the result.
+ */
+IntervalVector projf(const Array<IntervalVector>& boxes, int q, vector<int>& act) {
+	int n=boxes[0].size();
+
+	act.clear();
+	for (int i=0; i<boxes.size(); i++) {
+		if (!boxes[i].is_empty()) act.push_back(i);
 	}
 
-	// ================================================
+	if ((int) act.size()<q) return IntervalVector::empty(n);
+
+	IntervalVector res(n);
+	vector<double> lb,ub;
+
+	bool removed=true;
+
+	while (removed) {
+		removed=false;
+
+		for (int d=0; d<n; d++) {
+			res[d] &= qinter_dim(boxes,act,d,q,lb,ub);
+
+			if (res[d].is_empty()) {
+				act.clear();
+				return IntervalVector::empty(n);
+			}
+
+			// remove the boxes that do not intersect the projection
+			int p=0;
+			for (unsigned int k=0; k<act.size(); k++) {
+				if (boxes[act[k]][d].intersects(res[d])) act[p++]=act[k];
+			}
+
+			if (p<(int) act.size()) {
+				act.resize(p);
+				removed=true;
+				if (p<q) {
+					act.clear();
+					return IntervalVector::empty(n);
+				}
+			}
+		}
+	}
+	return res;
+}
+
+/*
+ * The grid algorithm (the boxes are all nonempty).
+ */
+IntervalVector qinter_grid(const Array<IntervalVector>& boxes, int q) {
+	int n=boxes[0].size();
+	int p=boxes.size();
+
 
 	double ** x= new double* [n]; //double x[n][2*p];
 	int* ind=new int[n];     // ind[i] is the current index in x[(d+i)%n]
@@ -180,4 +262,33 @@ IntervalVector qinter(const Array<IntervalVector>& _boxes, int q) {
 	return inner_box;
 }
 
+} // end anonymous namespace
+
+IntervalVector qinter(const Array<IntervalVector>& _boxes, int q, double max_cells) {
+	assert(_boxes.size()>0);
+
+	vector<int> act;
+	IntervalVector proj=projf(_boxes,q,act);
+
+	if (proj.is_empty()) return proj;
+
+	int p=act.size();
+
+	if (std::pow(2.0*p, proj.size()) > max_cells) return proj;
+
+	Array<IntervalVector> boxes(p);
+	for (int j=0; j<p; j++) {
+		boxes.set_ref(j,_boxes[act[j]]);
+	}
+
+	return qinter_grid(boxes,q);
+}
+
+IntervalVector qinter_projf(const Array<IntervalVector>& boxes, int q) {
+	assert(boxes.size()>0);
+
+	vector<int> act;
+	return projf(boxes,q,act);
+}
+
 } // end namespace ibex
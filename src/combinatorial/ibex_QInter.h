@@ -1,11 +1,11 @@
 //============================================================================
-//                                  I B E X                                   
+//                                  I B E X
 // File        : Q-intersection
 // Author      : Gilles Chabert
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 25, 2012
-// Last Update : Apr 25, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_Q_INTER_H__
@@ -25,8 +25,30 @@ namespace ibex {
 /**
  * \ingroup combinatorial
  * \brief Q-intersection - EXACT - Grid algorithm
+ *
+ * The boxes are first filtered by the projection algorithm
+ * (see #qinter_projf): the grid is only built with the boxes
+ * that intersect the projection.
+ *
+ * The number of cells of the grid grows as (2p)^n where p is the number
+ * of remaining boxes. If this number exceeds \a max_cells, the result of
+ * the projection algorithm is returned instead (which is not exact).
+ * By default, the result is always exact.
  */
-IntervalVector qinter(const Array<IntervalVector>& boxes, int q);
+IntervalVector qinter(const Array<IntervalVector>& boxes, int q, double max_cells=POS_INFINITY);
+
+/**
+ * \ingroup combinatorial
+ * \brief Q-intersection - OUTER - Projection algorithm
+ *
+ * Calculates, in each dimension, the q-intersection of the projections
+ * of the boxes (by a sweep over the sorted bounds) and removes the boxes
+ * that do not intersect it. This is repeated until no box is removed.
+ *
+ * The result encloses the hull of the q-intersection. Each iteration
+ * takes O(n p log p) time, which allows to handle large numbers p of boxes.
+ */
+IntervalVector qinter_projf(const Array<IntervalVector>& boxes, int q);
 
 } // end namespace ibex
 
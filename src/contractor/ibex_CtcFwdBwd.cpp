@@ -145,8 +145,8 @@ void CtcFwdBwd::contract(IntervalVector& box, ContractContext& context) {
 	// is no multiple occurrence because some operators
 	// may be non-optimal in backward mode.
 
-	//TODO: set used_vars in output impact
-	context.prop.update(BoxEvent(box,BoxEvent::CONTRACT));
+	// only the variables of the constraint may have been contracted
+	context.prop.update(BoxEvent(box,BoxEvent::CONTRACT,*output));
 }
 
 
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 20, 2017
-// Created     : Jul 11, 2019
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_CtcKuhnTucker.h"
@@ -13,44 +13,50 @@
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_ExprDiff.h"
 #include "ibex_CtcNewton.h"
+#include "ibex_BxpSystemCache.h"
 
 using namespace std;
 
 namespace ibex {
 
-CtcKuhnTucker::CtcKuhnTucker(const NormalizedSystem& sys, bool reject_unbounded) : Ctc(sys.nb_var+1 /* extended box expected*/), sys(sys), reject_unbounded(reject_unbounded) {
+CtcKuhnTucker::CtcKuhnTucker(const NormalizedSystem& sys, bool reject_unbounded) : Ctc(sys.nb_var+1 /* extended box expected*/), sys(sys), reject_unbounded(reject_unbounded), cache_statistics(NULL) {
 	try {
 		df = new Function(*sys.goal,Function::DIFF);
-
-		if (sys.nb_ctr>0) {
-			dg = new Function*[sys.f_ctrs.image_dim()];
-
-			for (int i=0; i<sys.f_ctrs.image_dim(); i++) {
-				dg[i] = new Function(sys.f_ctrs[i], Function::DIFF);
-			}
-		} else {
-			dg = NULL;
-		}
-
 	} catch(Exception&) {
 		//TODO: replace with ExprDiffException.
 		// Currently, DimException is also sometimes raised.
 		cerr << "Warning: symbolic differentiation has failed ==> KKT contractor disabled" << endl;
 		df = NULL;
-		dg = NULL;
+		return;
+	}
+
+	// Hessian matrices are calculated by automatic differentiation
+	if (!sys.goal->hessian_calculator().is_supported() ||
+			(sys.nb_ctr>0 && !sys.f_ctrs.hessian_calculator().is_supported())) {
+		cerr << "Warning: automatic differentiation of Hessian matrices not supported ==> KKT contractor disabled" << endl;
+		delete df;
+		df = NULL;
 	}
 }
 
 CtcKuhnTucker::~CtcKuhnTucker() {
 	if (df) delete df;
-	if (dg!=NULL) {
-		for (int i=0; i<sys.f_ctrs.image_dim(); i++)
-			delete dg[i];
-		delete[] dg;
-	}
+}
+
+void CtcKuhnTucker::add_property(const IntervalVector& init_box, BoxProperties& prop) {
+	BxpSystemCache::add_property(sys, prop, cache_statistics);
+}
+
+void CtcKuhnTucker::enable_statistics(Statistics& stats, const std::string& prefix) {
+	cache_statistics = BxpSystemCache::enable_statistics(sys, stats);
 }
 
 void CtcKuhnTucker::contract(IntervalVector& box) {
+	ContractContext context(box);
+	contract(box,context);
+}
+
+void CtcKuhnTucker::contract(IntervalVector& box, ContractContext& context) {
 
 	assert(df!=NULL);
 
@@ -62,7 +68,10 @@ void CtcKuhnTucker::contract(IntervalVector& box) {
 
 	IntervalVector x=box.subvector(0,n-1);
 
-	FncKuhnTucker fkkt(sys,*df,dg,x);
+	// note: the cache works with the extended box (the goal variable is ignored)
+	const BxpSystemCache* cache=BxpSystemCache::get(sys, context.prop, box);
+
+	FncKuhnTucker fkkt(sys,x,cache? cache->active_ctrs() : sys.active_ctrs(x));
 
 	if (fkkt.nb_mult==1) { // <=> no active constraint
 		// for unconstrained optimization we benefit from a cheap
@@ -82,7 +91,21 @@ void CtcKuhnTucker::contract(IntervalVector& box) {
 		return;
 	}
 
-	if (fkkt.rejection_test(x)) {
+	bool rejected;
+	if (cache) {
+		// note: gradients over the cached box (which contains x) are valid
+		IntervalVector g(n);
+		cache->goal_gradient(g);
+		if (fkkt.active().empty())
+			rejected=fkkt.rejection_test(x, g, NULL);
+		else {
+			IntervalMatrix J=cache->active_ctrs_jacobian();
+			rejected=fkkt.rejection_test(x, g, &J);
+		}
+	} else
+		rejected=fkkt.rejection_test(x);
+
+	if (rejected) {
 		box.set_empty();
 		return;
 	}
@@ -108,6 +131,8 @@ void CtcKuhnTucker::contract(IntervalVector& box) {
 		box.put(0,full_box.subvector(0,n-1));
 	}
 	// =========================================================================================
+
+	context.prop.update(BoxEvent(box,BoxEvent::CONTRACT));
 }
 
 } /* namespace ibex */
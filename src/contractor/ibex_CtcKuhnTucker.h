@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 19, 2017
-// Created     : Jul 11, 2019
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_KUHN_TUCKER_H__
@@ -14,6 +14,7 @@
 #include "ibex_Ctc.h"
 #include "ibex_NormalizedSystem.h"
 #include "ibex_FncKuhnTucker.h"
+#include "ibex_StsSystemCache.h"
 
 namespace ibex {
 
@@ -32,10 +33,10 @@ public:
 	 * an "extended" box in the "contract" function (in order to be uniform with
 	 * all other contractors in optimization).
 	 *
-	 * \warning: building this object is **costly** in both time and memory!
-	 *           (symbolic derivation of all constraints, because Ibex does not
-	 *           have automatic hessian computation).
-	 *           Don't build this contractor on-the-fly.
+	 * The Hessian matrices of the objective and the constraints are calculated
+	 * by automatic differentiation (see #FncKuhnTucker). Only the gradient of
+	 * the objective is derived symbolically (for a cheap contraction with
+	 * gradient=0 when no constraint is active).
 	 *
 	 * \warning: sys.box should be properly set before calling this constructor.
 	 *           In particular, this field **should not change** once this
@@ -58,6 +59,27 @@ public:
 	 */
 	virtual void contract(IntervalVector& box) override;
 
+	/**
+	 * \brief Contract with context.
+	 *
+	 * The active constraints, the gradient of the objective and the
+	 * Jacobian matrix of the constraints are taken from the system
+	 * cache, if present (see #BxpSystemCache).
+	 */
+	virtual void contract(IntervalVector& box, ContractContext& context) override;
+
+	/**
+	 * \brief Add the system cache (see #BxpSystemCache).
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop) override;
+
+	/**
+	 * \brief Enable statistics (of the system cache).
+	 *
+	 * \see #Ctc::enable_statistics.
+	 */
+	virtual void enable_statistics(Statistics& stats, const std::string& prefix) override;
+
 	/**
 	 * \brief Delete this.
 	 */
@@ -75,17 +97,17 @@ protected:
 	 */
 	Function* df;
 
-	/**
-	 * \brief Symbolic gradient of constraints.
-	 */
-	Function** dg;
-
 	/**
 	 * \brief Whether unbounded boxes are rejected.
 	 *
 	 * See constructor.
 	 */
 	bool reject_unbounded;
+
+	/**
+	 * \brief Statistics of the system cache (NULL if disabled).
+	 */
+	StsSystemCache* cache_statistics;
 };
 
 } /* namespace ibex */
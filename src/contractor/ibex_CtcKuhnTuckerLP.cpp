@@ -5,55 +5,158 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 31, 2019
+// Last update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_CtcKuhnTuckerLP.h"
-#include "ibex_LinearizerXTaylor.h"
+#include "ibex_FncKuhnTucker.h"
+#include "ibex_CtcPolytopeHull.h"
+
+#include <vector>
 
 using namespace std;
 
 namespace ibex {
 
-CtcKuhnTuckerLP::CtcKuhnTuckerLP(const NormalizedSystem& _sys, bool reject_unbounded) : Ctc(_sys.nb_var+1 /* extended box expected*/),
-		reject_unbounded(reject_unbounded) {
-	try {
-		kkt = new KuhnTuckerSystem(_sys, true);
-		_lr = new LinearizerXTaylor(*kkt);
-		ph = new CtcPolytopeHull(*_lr); // note: I would prefer to use CtcLinearRelax directly.
-
-	} catch(Exception&) {
-		//TODO: replace with ExprDiffException.
-		// Currently, DimException is also sometimes raised.
-		cerr << "Warning: symbolic differentiation has failed ==> KKT contractor disabled" << endl;
-		kkt = NULL;
+namespace {
+
+class Unsatisfiability { };
+
+/*
+ * Linear relaxation of g(z)<=0 at a corner of the box
+ * (see LinearizerXTaylor::linearize_leq_corner).
+ *
+ * The row a*z<=b is appended to A and b, unless it is satisfied
+ * by any point of the box. Throws Unsatisfiability if it is
+ * satisfied by none.
+ */
+void relax_leq_corner(const IntervalVector& box, const IntervalVector& corner, bool inf,
+		const IntervalVector& dg_box, const Interval& g_corner, vector<Vector>& A, vector<double>& b) {
+
+	if (dg_box.is_unbounded() || g_corner.is_empty() || g_corner.is_unbounded())
+		return; // skip
+
+	Vector a(box.size());
+	for (int j=0; j<box.size(); j++)
+		a[j] = inf ? dg_box[j].lb() : dg_box[j].ub();
+
+	Interval rhs = -g_corner + a*corner;
+
+	double b_rhs = rhs.ub();
+
+	Interval ax=a*box;
+	if (ax.lb()>b_rhs)
+		throw Unsatisfiability();
+	else if (ax.ub()>b_rhs) {
+		A.push_back(a);
+		b.push_back(b_rhs);
 	}
+}
 
 }
 
-CtcKuhnTuckerLP::~CtcKuhnTuckerLP() {
-	if (kkt) {
-		delete kkt;
-		delete _lr;
-		delete ph;
+CtcKuhnTuckerLP::CtcKuhnTuckerLP(const NormalizedSystem& sys, bool reject_unbounded) : Ctc(sys.nb_var+1 /* extended box expected*/),
+		sys(sys), reject_unbounded(reject_unbounded), supported(true) {
+
+	// Hessian matrices are calculated by automatic differentiation
+	if (!sys.goal->hessian_calculator().is_supported() ||
+			(sys.nb_ctr>0 && !sys.f_ctrs.hessian_calculator().is_supported())) {
+		cerr << "Warning: automatic differentiation of Hessian matrices not supported ==> KKT contractor disabled" << endl;
+		supported = false;
 	}
 }
 
+CtcKuhnTuckerLP::~CtcKuhnTuckerLP() {
+
+}
+
 void CtcKuhnTuckerLP::contract(IntervalVector& box) {
-	if (kkt==NULL || box.is_empty()) return;
+	if (!supported || box.is_empty()) return;
 
 	if (reject_unbounded && box.is_unbounded()) return;
 
-	IntervalVector x=box.subvector(0,kkt->n-1); // !! sys.n <> this->nb_var if extended system !!
-	IntervalVector xlambda = kkt->box; // we keep all the domains for multipliers
-	xlambda.put(0,x);                  // and overwrite the domain for x with current domain
+	int n=sys.nb_var; // !! <> nb_var !!
+
+	IntervalVector x=box.subvector(0,n-1);
+
+	// the linearization requires corners
+	if (x.is_unbounded()) return;
+
+	FncKuhnTucker fkkt(sys,x);
+
+	// note: unlike with Newton (see CtcKuhnTucker), the constraints need
+	// not be qualified: the multiplier of the goal makes the conditions
+	// (Fritz John) hold at any minimum, and the LP needs no inverse.
+
+	if (fkkt.rejection_test(x)) {
+		box.set_empty();
+		return;
+	}
+
+	IntervalVector full_box = cart_prod(x, fkkt.multiplier_domain());
+	int N=full_box.size();
+
+	// The active inequalities g(x)<=0 are also linearized (the KKT
+	// conditions only contain the complementarity constraints).
+	// Note: the indices in fkkt.ineq() refer to the active constraints.
+	bool with_ineq = !fkkt.active().empty() && !fkkt.ineq().empty();
+
+	IntervalMatrix J(fkkt.image_dim(), N);
+	IntervalMatrix Jg(with_ineq ? fkkt.active().size() : 1, n);
+
+	vector<Vector> A;
+	vector<double> b;
+
+	try {
+		for (int k=0; k<2; k++) {
+			bool inf = (k==0);
+			// the corner -> typed IntervalVector just to have guaranteed computations
+			IntervalVector corner(inf ? full_box.lb() : full_box.ub());
+
+			// KKT conditions: fkkt(z)=0
+			// (Hansen slopes, see LinearizerXTaylor)
+			fkkt.hansen_matrix(full_box, corner, J);
+			IntervalVector f_corner=fkkt.eval_vector(corner, BitSet::all(fkkt.image_dim()));
+			for (int i=0; i<fkkt.image_dim(); i++) {
+				relax_leq_corner(full_box, corner, inf, J[i], f_corner[i], A, b);
+				relax_leq_corner(full_box, corner, inf, -J[i], -f_corner[i], A, b);
+			}
+
+			// active inequalities: g(x)<=0
+			if (with_ineq) {
+				IntervalVector corner_x = corner.subvector(0,n-1);
+				sys.f_ctrs.hansen_matrix(x, corner_x, Jg, fkkt.active());
+				IntervalVector g_corner=sys.f_ctrs.eval_vector(corner_x, fkkt.active());
+				IntervalVector dg(N, Interval::zero());
+				for (BitSet::const_iterator i=fkkt.ineq().begin(); i!=fkkt.ineq().end(); ++i) {
+					dg.put(0, Jg[i]);
+					relax_leq_corner(full_box, corner, inf, dg, g_corner[i], A, b);
+				}
+			}
+		}
+	} catch(Unsatisfiability&) {
+		box.set_empty();
+		return;
+	}
+
+	if (A.empty()) return;
+
+	Matrix _A((int) A.size(), N);
+	Vector _b((int) b.size());
+	for (size_t i=0; i<A.size(); i++) {
+		_A.set_row(i, A[i]);
+		_b[i] = b[i];
+	}
+
+	CtcPolytopeHull ph(_A,_b);
 
-	ph->contract(xlambda);
+	ph.contract(full_box);
 
-	if (xlambda.is_empty()) {
+	if (full_box.is_empty()) {
 		box.set_empty();
 	}
 	else {
-		box.put(0,xlambda.subvector(0,kkt->n-1));
+		box.put(0,full_box.subvector(0,n-1));
 	}
 }
 
@@ -5,6 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 31, 2019
+// Last update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_KUHN_TUCKER_LP_H__
@@ -12,8 +13,6 @@
 
 #include "ibex_Ctc.h"
 #include "ibex_NormalizedSystem.h"
-#include "ibex_KuhnTuckerSystem.h"
-#include "ibex_CtcPolytopeHull.h"
 
 namespace ibex {
 
@@ -26,6 +25,10 @@ namespace ibex {
  * Newton (as in CtcKuhnTucker). This avoids in particular pessimism due to
  * preconditioning.
  *
+ * The KKT conditions (see #FncKuhnTucker) are linearized at two opposite
+ * corners of the box (as in #LinearizerXTaylor), with their Jacobian matrix
+ * (i.e., the Hessian matrices of the goal and the constraints) calculated
+ * by automatic differentiation.
  */
 class CtcKuhnTuckerLP : public Ctc {
 public:
@@ -37,15 +40,9 @@ public:
 	 * an "extended" box in the "contract" function (in order to be uniform with
 	 * all other contractors in optimization).
 	 *
-	 * \warning: building this object is **costly** in both time and memory!
-	 *           (symbolic derivation of all constraints, because Ibex does not
-	 *           have automatic hessian computation).
-	 *           Don't build this contractor on-the-fly.
-	 *
 	 * \warning: sys.box should be properly set before calling this constructor.
 	 *           In particular, this field **should not change** once this
-	 *           contractor is built (the box gives rise to bound constraints
-	 *           that are set once for all and not dynamically updated).
+	 *           contractor is built (the box gives rise to bound constraints).
 	 *
 	 * \param reject_unbounded: If true, the contractor does nothing when called
 	 *        on an unbounded box. This is because minima points at infinity may
@@ -68,14 +65,12 @@ public:
 	 */
 	virtual ~CtcKuhnTuckerLP();
 
-protected:
-
 	/**
-	 * \brief The KKT conditions
+	 * \brief The (normalized) NLP problem.
 	 */
-	const KuhnTuckerSystem* kkt;
+	const NormalizedSystem& sys;
 
-	CtcPolytopeHull* ph;
+protected:
 
 	/**
 	 * \brief Whether unbounded boxes are rejected.
@@ -84,7 +79,11 @@ protected:
 	 */
 	bool reject_unbounded;
 
-	Linearizer* _lr; // kept for cleanup only
+	/**
+	 * \brief False if the Hessian matrices cannot be calculated
+	 *        (the contractor is disabled).
+	 */
+	bool supported;
 };
 
 } /* namespace ibex */
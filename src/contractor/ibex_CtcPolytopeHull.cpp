@@ -5,27 +5,22 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Oct 31, 2013
-// Last update : Feb 13, 2025
+// Last update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_CtcPolytopeHull.h"
 
 #include "ibex_LinearizerFixed.h"
+#include "ibex_Id.h"
 
 using namespace std;
 
 namespace ibex {
 
-namespace {
-
-class PolytopeHullEmptyBoxException { };
-
-}
-
 CtcPolytopeHull::CtcPolytopeHull(Linearizer& lr, int max_iter, int time_out, double eps) :
 		Ctc(lr.nb_var()), lr(lr),
 		mylinearsolver(nb_var, LPSolver::Mode::Certified, eps, time_out, max_iter),
-		contracted_vars(BitSet::all(nb_var)), own_lr(false), primal_sols(2*nb_var, nb_var),
+		contracted_vars(BitSet::all(nb_var)), basis_prop_id(next_id()), own_lr(false), primal_sols(2*nb_var, nb_var),
 		primal_sol_found(2*nb_var) {
 
 }
@@ -33,7 +28,7 @@ CtcPolytopeHull::CtcPolytopeHull(Linearizer& lr, int max_iter, int time_out, dou
 CtcPolytopeHull::CtcPolytopeHull(const Matrix& A, const Vector& b, int max_iter, int time_out, double eps) :
 		Ctc(A.nb_cols()), lr(*new LinearizerFixed(A,b)),
 		mylinearsolver(nb_var, LPSolver::Mode::Certified, eps, time_out, max_iter),
-		contracted_vars(BitSet::all(nb_var)), own_lr(true), primal_sols(2*nb_var, nb_var),
+		contracted_vars(BitSet::all(nb_var)), basis_prop_id(next_id()), own_lr(true), primal_sols(2*nb_var, nb_var),
 		primal_sol_found(2*nb_var) {
 
 }
@@ -44,10 +39,13 @@ CtcPolytopeHull::~CtcPolytopeHull() {
 
 void CtcPolytopeHull::add_property(const IntervalVector& init_box, BoxProperties& map) {
 	lr.add_property(init_box, map);
+	if (!map[basis_prop_id])
+		map.add(new BxpLPBasis(basis_prop_id, 2*nb_var));
 }
 
 void CtcPolytopeHull::enable_statistics(Statistics& stats, const std::string& prefix) {
 	mylinearsolver.enable_statistics(stats, prefix + "/PolytopeHull");
+	lr.enable_statistics(stats, prefix + "/PolytopeHull");
 }
 
 void CtcPolytopeHull::contract(IntervalVector& box) {
@@ -60,27 +58,28 @@ void CtcPolytopeHull::contract(IntervalVector& box, ContractContext& context) {
 
 	if (box.is_unbounded()) return;
 
-	try {
-		//returns the number of constraints in the linearized system
-		int cont = lr.linearize(box, mylinearsolver, context.prop);
+	//returns the number of constraints in the linearized system
+	int cont = lr.linearize(box, mylinearsolver, context.prop);
 
-		//cout << "[polytope-hull] end of LR" << endl;
+	//cout << "[polytope-hull] end of LR" << endl;
 
-		if (cont==-1) throw PolytopeHullEmptyBoxException();
+	if (cont==0) return;
 
-		if (cont==0) return;
+	bool feasible = (cont!=-1);
 
-		optimizer(box);
-
-		//mylinearsolver.writeFile("LP.lp");
-		//system ("cat LP.lp");
-		//cout << "[polytope-hull] box after LR: " << box << endl;
-		mylinearsolver.clear_constraints();
+	if (feasible) {
+		// Each LP is warm-started from the basis found for the same
+		// bound in this box (or the parent box).
+		feasible = optimizer(box, (BxpLPBasis*) context.prop[basis_prop_id]);
 	}
-	catch(PolytopeHullEmptyBoxException& e) {
+
+	if (!feasible)
 		box.set_empty(); // empty the box before exiting
-		mylinearsolver.clear_constraints();
-	}
+
+	//mylinearsolver.writeFile("LP.lp");
+	//system ("cat LP.lp");
+	//cout << "[polytope-hull] box after LR: " << box << endl;
+	mylinearsolver.clear_constraints();
 
 	context.prop.update(BoxEvent(box,BoxEvent::CONTRACT));
 
@@ -90,7 +89,21 @@ void CtcPolytopeHull::set_contracted_vars(const BitSet& vars) {
 	contracted_vars = vars;
 }
 
-void CtcPolytopeHull::optimizer(IntervalVector& box) {
+LPSolver::Status CtcPolytopeHull::minimize(int k, BxpLPBasis* basis) {
+	// Ignored if the relaxation has changed of size. If no basis
+	// is stored, the simplex starts from the last basis (previous bound).
+	if (basis && !basis->basis[k].empty())
+		mylinearsolver.set_basis(basis->basis[k]);
+
+	LPSolver::Status stat = mylinearsolver.minimize();
+
+	if (basis && stat == LPSolver::Status::OptimalProved)
+		mylinearsolver.get_basis(basis->basis[k]);
+
+	return stat;
+}
+
+bool CtcPolytopeHull::optimizer(IntervalVector& box, BxpLPBasis* basis) {
 
 	Interval opt(0.0);
 	int* inf_bound = new int[nb_var]; // indicator inf_bound = 1 means the inf bound is feasible or already contracted, call to simplex useless (cf Baharev)
@@ -124,7 +137,7 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		{
 			inf_bound[i]=1;
 			mylinearsolver.set_cost(i, 1.0);
-			stat = mylinearsolver.minimize();
+			stat = minimize(2*i, basis);
 			mylinearsolver.set_cost(i, 0.0);
 			//cout << "[polytope-hull]->[optimize] simplex for left bound returns stat:" << stat << endl;
 			if (stat == LPSolver::Status::OptimalProved) {
@@ -133,7 +146,7 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 				if(opt.lb()>box[i].ub()) {
 					delete[] inf_bound;
 					delete[] sup_bound;
-					throw PolytopeHullEmptyBoxException();
+					return false;
 				}
 				primal_sols[2*i]=mylinearsolver.not_proved_primal_sol();
 				primal_sol_found.add(2*i);
@@ -150,8 +163,8 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 			else if (stat == LPSolver::Status::InfeasibleProved) {
 				delete[] inf_bound;
 				delete[] sup_bound;
-				// the infeasibility is proved, the EmptyBox exception is raised
-				throw PolytopeHullEmptyBoxException();
+				// the infeasibility is proved
+				return false;
 			}
 
 			else if (stat == LPSolver::Status::Infeasible) {
@@ -178,7 +191,7 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		else if (infnexti==1 && sup_bound[i]==0) { // computing the right bound :  maximizing x_i
 			sup_bound[i]=1;
 			mylinearsolver.set_cost(i, -1.0);
-			stat= mylinearsolver.minimize();
+			stat = minimize(2*i+1, basis);
 			mylinearsolver.set_cost(i, 0.0);
 			//cout << "[polytope-hull]->[optimize] simplex for right bound returns stat=" << stat << endl;
 			if( stat == LPSolver::Status::OptimalProved) {
@@ -187,7 +200,7 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 				if(opt.ub() <box[i].lb()) {
 					delete[] inf_bound;
 					delete[] sup_bound;
-					throw PolytopeHullEmptyBoxException();
+					return false;
 				}
 
 				primal_sols[2*i+1]=mylinearsolver.not_proved_primal_sol();
@@ -205,8 +218,8 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 			else if(stat == LPSolver::Status::InfeasibleProved) {
 				delete[] inf_bound;
 				delete[] sup_bound;
-				// the infeasibility is proved,  the EmptyBox exception is raised
-				throw PolytopeHullEmptyBoxException();
+				// the infeasibility is proved
+				return false;
 			}
 			else if (stat == LPSolver::Status::Infeasible) {
 				// the infeasibility is found but not proved, no other call is needed
@@ -232,6 +245,7 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 	}
 	delete[] inf_bound;
 	delete[] sup_bound;
+	return true;
 }
 
 bool CtcPolytopeHull::choose_next_variable(IntervalVector & box, int & nexti, int & infnexti, int* inf_bound, int* sup_bound) {
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Oct 31, 2013
-// Last update : Feb 13, 2025
+// Last update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_POLYTOPE_HULL_H__
@@ -15,6 +15,7 @@
 #include "ibex_Ctc.h"
 #include "ibex_LPSolver.h"
 #include "ibex_BitSet.h"
+#include "ibex_BxpLPBasis.h"
 
 namespace ibex {
 
@@ -77,6 +78,15 @@ public:
 
 	/**
 	 * \brief Add linearizer properties to the map
+	 *
+	 * Also add the bases of the simplex (see #BxpLPBasis), used
+	 * to warm-start the simplex in the sub-boxes: the LP of a bound
+	 * starts from the optimal basis of the same bound in the parent box.
+	 *
+	 * Note: only the bases are inherited. The rows of the linear
+	 * relaxation are still rebuilt by the linearizer at each call
+	 * (they are not updated in place), so a basis is only used
+	 * when the relaxation of the sub-box has the same number of rows.
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& map) override;
 
@@ -121,9 +131,17 @@ protected:
 	bool choose_next_variable(IntervalVector &box,  int & nexti, int & infnexti, int* inf_bound, int* sup_bound);
 
 	/**
-	 * TODO: add comment.
+	 * \brief Contract the box with the simplex (one LP per bound).
+	 *
+	 * \param basis - the bases of the LPs, updated in return (NULL if none)
+	 * \return false if it is proven that the polytope is empty.
 	 */
-	void optimizer(IntervalVector &box);
+	bool optimizer(IntervalVector &box, BxpLPBasis* basis=NULL);
+
+	/**
+	 * \brief Solve the kth LP (see #BxpLPBasis), with a warm start.
+	 */
+	LPSolver::Status minimize(int k, BxpLPBasis* basis);
 
 	/**
 	 * \brief The linearization technique
@@ -140,6 +158,11 @@ protected:
 	 */
 	BitSet contracted_vars;
 
+	/**
+	 * \brief Identifier of the basis property (see #BxpLPBasis)
+	 */
+	const long basis_prop_id;
+
 private:
 	bool own_lr; // for memory cleanup
 
@@ -22,7 +22,7 @@ constexpr double CtcPropag::default_ratio;
 CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
 		  Ctc(cl), list(cl), ratio(ratio), incremental(incremental),
 		  accumulate(false), g(cl.size(), nb_var), agenda(cl.size()),
-		  active(BitSet::empty(cl.size())) {
+		  active(BitSet::empty(cl.size())), old_box(nb_var) {
 
 	assert(check_nb_var_ctc_list(cl));
 
@@ -32,6 +32,8 @@ CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
 			if (list[i].input && (*list[i].output)[j]) g.add_arc(i,j,false);
 		}
 
+	g.freeze();
+
 	//cout << g << endl;
 }
 
@@ -61,9 +63,8 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 
 		for (int i=0; i<nb_var; i++) {
 			if (context.impact[i]) {
-				set<int> ctrs=g.output_ctrs(i);
-				for (set<int>::iterator c=ctrs.begin(); c!=ctrs.end(); ++c)
-					agenda.push(*c);
+				for (int c : g.output_ctrs(i))
+					agenda.push(c);
 			}
 		}
 	} else { // push all the contractors
@@ -71,8 +72,6 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 			agenda.push(i);
 	}
 
-	BitSet input_impact(context.impact); // save (useful?)
-
 	/*
 	 * Now, context.impact is the impact of a call to a
 	 * subcontractor.
@@ -96,8 +95,10 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 	 * old_box is either:
 	 * - variables domains before last propagation ("fine" propagation, accumulate=true)
 	 * - variables domains before last projection ("coarse" propagation, accumulate=false)
+	 *
+	 * Note: old_box is a field to avoid memory allocation at each call.
 	 */
-	IntervalVector old_box(box);
+	old_box = box;
 
 	//   VECTOR thres(_nb_var);        // threshold for propagation
 	//   for (int i=1; i<=_nb_var; i++) {
@@ -109,13 +110,13 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 
 		agenda.pop(c);
 
-		set<int> vars=g.output_vars(c);
+		DirectedHyperGraph::Adj vars=g.output_vars(c);
 
 		// ===================== fine propagation =========================
 		// reset the old box to the current domains just before contraction
 		if (!accumulate) {
-			for (set<int>::iterator v=vars.begin(); v!=vars.end(); ++v) {
-				old_box[*v] = box[*v];
+			for (int v : vars) {
+				old_box[v] = box[v];
 			}
 		}
 		// ================================================================
@@ -137,15 +138,13 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 			active.remove(c);
 		}
 
-		for (set<int>::iterator it=vars.begin(); it!=vars.end(); ++it) {
-			int v=*it;
+		for (int v : vars) {
 			//cout << "   " << old_box[v] << " % " << box[v] << "   " << old_box[v].ratiodelta(box[v]) << endl;
 			//if (old_box[v].rel_distance(box[v])>=ratio) {
 			if (old_box[v].ratiodelta(box[v])>=ratio) {
-				set<int> ctrs=g.output_ctrs(v);
-				for (set<int>::iterator c2=ctrs.begin(); c2!=ctrs.end(); ++c2) {
-					if ((c!=*c2 && active[*c2]) || (c==*c2 && !context.output_flags[FIXPOINT]))
-						agenda.push(*c2);
+				for (int c2 : g.output_ctrs(v)) {
+					if ((c!=c2 && active[c2]) || (c==c2 && !context.output_flags[FIXPOINT]))
+						agenda.push(c2);
 				}
 				// ===================== coarse propagation =========================
 				// reset the old box to the current domains just after propagation
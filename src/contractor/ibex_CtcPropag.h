@@ -92,6 +92,8 @@ protected:
 
 	BitSet active;      // mark active sub-contractors
 
+	IntervalVector old_box; // domains before last contraction (see contract)
+
 
 };
 
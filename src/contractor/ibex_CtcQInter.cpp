@@ -5,17 +5,28 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 30, 2012
-// Last Update : Apr 30, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_CtcQInter.h"
 #include "ibex_QInter.h"
+#include "ibex_BxpQInter.h"
+#include "ibex_ParallelFor.h"
+#include "ibex_Id.h"
+
+#include <vector>
+
+using namespace std;
 
 namespace ibex {
 
-CtcQInter::CtcQInter(const Array<Ctc>& list, int q) : Ctc(list), list(list), q(q), boxes(list.size(), nb_var) { }
+CtcQInter::CtcQInter(const Array<Ctc>& list, int q, int nb_threads) : Ctc(list), list(list), q(q), nb_threads(nb_threads),
+		max_grid_cells(POS_INFINITY), discarded_prop_id(next_id()), boxes(list.size(), nb_var) { }
 
 void CtcQInter::add_property(const IntervalVector& init_box, BoxProperties& map) {
+	if (!map[discarded_prop_id])
+		map.add(new BxpQInter(discarded_prop_id, list.size()));
+
 	for (int i=0; i<list.size(); i++)
 		list[i].add_property(init_box, map);
 }
@@ -26,19 +37,52 @@ void CtcQInter::contract(IntervalVector& box) {
 }
 
 void CtcQInter::contract(IntervalVector& box, ContractContext& context) {
-	Array<IntervalVector> refs(list.size());
+	BxpQInter* bxp=(BxpQInter*) context.prop[discarded_prop_id];
 
+	// the sub-contractors not discarded
+	vector<int> sub;
 	for (int i=0; i<list.size(); i++) {
+		if (!bxp || !bxp->is_discarded(i)) sub.push_back(i);
+	}
+
+	int p=sub.size();
+
+	if (p==0 || p<q) {
+		box.set_empty();
+		context.prop.update(BoxEvent(box,BoxEvent::CONTRACT));
+		return;
+	}
+
+	auto contract_sub = [&](int k) {
+		int i=sub[k];
 		boxes[i]=box;
 
 		ContractContext c_context(boxes[i], context);
 
 		list[i].contract(boxes[i], c_context);
+	};
+
+	// The first sub-contractor is called alone: the
+	// copy of the properties (in c_context) sorts the
+	// dependencies of context.prop, which is then
+	// only read by the other threads.
+	contract_sub(0);
+
+	parallel_for(p-1, nb_threads, [&](int k) { contract_sub(k+1); });
 
-		refs.set_ref(i,boxes[i]);
+	Array<IntervalVector> refs(p);
+
+	for (int k=0; k<p; k++) {
+		refs.set_ref(k,boxes[sub[k]]);
 	}
 
-	box = qinter(refs,q);
+	box = qinter(refs,q,max_grid_cells);
+
+	if (bxp && !box.is_empty()) {
+		for (int k=0; k<p; k++) {
+			if (!boxes[sub[k]].intersects(box)) bxp->discard(sub[k]);
+		}
+	}
 
 	context.prop.update(BoxEvent(box,BoxEvent::CONTRACT));
 
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 30, 2012
-// Last Update : Apr 30, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_Q_INTER_H__
@@ -21,6 +21,15 @@ namespace ibex {
  * \ingroup contractor
  * \brief Q-intersection contractor.
  *
+ * The box is contracted by each sub-contractor and the result is the
+ * q-intersection of the boxes obtained (see #qinter).
+ *
+ * A sub-contractor whose box is disjoint from the result cannot be
+ * satisfied in any sub-box. Such sub-contractors are recorded in the
+ * properties of the box (see #BxpQInter) and not called anymore in the
+ * sub-nodes (if the property has been added with #add_property).
+ *
+ * The sub-contractors can be called in parallel (see #nb_threads).
  */
 class CtcQInter : public Ctc {
 public:
@@ -28,8 +37,13 @@ public:
 	 * \brief q-intersection on a list of contractors.
 	 *
 	 * The list itself is not kept by reference.
+	 *
+	 * \param nb_threads - the number of threads used to call the sub-contractors.
+	 *                     The sub-contractors must not share data (in particular,
+	 *                     they must be built on different functions, with no common
+	 *                     sub-function). Default value is 1 (sequential).
 	 */
-	CtcQInter(const Array<Ctc>& list, int q);
+	CtcQInter(const Array<Ctc>& list, int q, int nb_threads=1);
 
 	/**
 	 * \brief Contract the box.
@@ -43,6 +57,8 @@ public:
 
 	/**
 	 * \brief Add sub-contractors properties to the map
+	 *
+	 * Also add the set of discarded sub-contractors (#BxpQInter).
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& map) override;
 
@@ -57,6 +73,27 @@ public:
 	 */
 	int q;
 
+	/**
+	 * The number of threads.
+	 */
+	int nb_threads;
+
+	/**
+	 * \brief Maximal number of cells of the grid algorithm.
+	 *
+	 * Above this number, the q-intersection is only calculated by
+	 * the projection algorithm (see #qinter), which is not exact.
+	 *
+	 * By default, the result is always exact. With a large number of
+	 * boxes, a limit (e.g., 1e4) avoids the (2p)^n growth of the grid.
+	 */
+	double max_grid_cells;
+
+	/**
+	 * Identifier of the set of discarded sub-contractors (#BxpQInter).
+	 */
+	const long discarded_prop_id;
+
 protected:
 	IntervalMatrix boxes; // store boxes for each contraction
 };
@@ -5,13 +5,14 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Nov 07, 2018
-// Last update : Feb 28, 2019
+// Last update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_CovList.h"
 
 #include <sstream>
 #include <cassert>
+#include <limits>
 
 using namespace std;
 
@@ -81,6 +82,24 @@ void CovList::add(const IntervalVector& x) {
 	data->vec.push_back(&data->lst.back());
 }
 
+void CovList::add(const BoxBatch& batch) {
+	if (n!=(size_t) batch.nb_var())
+		ibex_error("[CovList] boxes must have all the same size.");
+	IntervalVector x(n);
+	for (int i=0; i<batch.size(); i++) {
+		batch.get(i,x);
+		add(x); // virtual
+	}
+}
+
+void CovList::boxes(BoxBatch& batch) const {
+	if (n!=(size_t) batch.nb_var())
+		ibex_error("[CovList] boxes must have all the same size.");
+	batch.reserve(batch.size()+size());
+	for (size_t i=0; i<size(); i++)
+		batch.push_back((*this)[i]);
+}
+
 ostream& operator<<(ostream& os, const CovList& cov) {
 
 	for (size_t i=0; i<cov.size(); i++) {
@@ -146,6 +165,174 @@ ofstream* CovList::write(const char* filename, const CovList& cov, std::stack<un
 	return f;
 }
 
+CovList::Writer::Writer(const char* filename, size_t n) :
+		Writer(filename, n, stack<unsigned int>(), stack<unsigned int>()) {
+
+}
+
+CovList::Writer::Writer(const char* filename, size_t n, stack<unsigned int> format_id, stack<unsigned int> format_version) :
+		n(n), _size(0), _last(n), closed(false) {
+
+	format_id.push(subformat_number);
+	format_version.push(FORMAT_VERSION);
+	format_id.push(Cov::subformat_number);
+	format_version.push(Cov::FORMAT_VERSION);
+
+	f.open(filename, ios::out | ios::binary);
+
+	if (f.fail())
+		ibex_error("[CovList]: cannot create output file.\n");
+
+	write_signature(f);
+	write_format_seq(f, format_id, format_version);
+	write_pos_int(f, n);
+
+	size_pos = f.tellp();
+	write_pos_int(f, 0); // fixed up by close()
+}
+
+CovList::Writer::~Writer() {
+	close();
+}
+
+void CovList::Writer::add(const IntervalVector& x) {
+	append(x);
+}
+
+void CovList::Writer::append(const IntervalVector& x) {
+	assert(!closed);
+	assert((size_t) x.size()==n);
+
+	if (_size==numeric_limits<uint32_t>::max())
+		ibex_error("[CovList]: too many boxes.");
+
+	write_box(f, x);
+	_last = x;
+	_size++;
+}
+
+void CovList::Writer::write_data() {
+
+}
+
+void CovList::Writer::close() {
+	if (closed) return;
+
+	write_data();
+
+	// fix up the number of boxes
+	f.seekp(size_pos);
+	write_pos_int(f, (uint32_t) _size);
+
+	f.close();
+	closed = true;
+
+	if (f.fail())
+		ibex_error("[CovList]: cannot write output file.\n");
+}
+
+CovList::Reader::Reader() : n(0), _size(0), _index(0) {
+
+}
+
+CovList::Reader::Reader(const char* filename) : n(0), _size(0), _index(0) {
+	stack<unsigned int> format_id;
+	stack<unsigned int> format_version;
+	open(filename, format_id, format_version);
+}
+
+CovList::Reader::~Reader() {
+	f.close();
+}
+
+void CovList::Reader::open(const char* filename, stack<unsigned int>& format_id, stack<unsigned int>& format_version) {
+
+	f.open(filename, ios::in | ios::binary);
+
+	if (f.fail()) ibex_error("[Cov]: cannot open input file.\n");
+
+	read_signature(f);
+
+	read_format_seq(f, format_id, format_version);
+
+	if (format_id.top()!=Cov::subformat_number || format_version.top()>Cov::FORMAT_VERSION)
+		ibex_error("[Cov] unsupported format version");
+
+	format_id.pop();
+	format_version.pop();
+
+	(size_t&) n = read_pos_int(f);
+
+	if (format_id.empty()) // a simple Cov: no box
+		_size = 0;
+	else if (format_id.top()!=subformat_number || format_version.top()!=FORMAT_VERSION)
+		ibex_error("[CovList] unsupported format version");
+	else {
+		format_id.pop();
+		format_version.pop();
+		_size = read_pos_int(f);
+	}
+
+	boxes_pos = f.tellg();
+	_index = 0;
+}
+
+void CovList::Reader::rewind() {
+	f.clear();
+	f.seekg(boxes_pos);
+	_index = 0;
+}
+
+bool CovList::Reader::next(IntervalVector& box) {
+	if (_index==_size) return false;
+
+	assert((size_t) box.size()==n);
+
+	for (size_t j=0; j<n; j++) {
+		double lb=read_double(f);
+		double ub=read_double(f);
+		box[j]=Interval(lb,ub);
+	}
+
+	_index++;
+	return true;
+}
+
+size_t CovList::Reader::next(BoxBatch& batch, size_t k) {
+	assert((size_t) batch.nb_var()==n);
+
+	IntervalVector box(n);
+	size_t i=0;
+	for (; i<k && next(box); i++)
+		batch.push_back(box);
+	return i;
+}
+
+void CovList::Reader::skip_boxes() {
+	f.clear();
+	f.seekg(boxes_pos + (streamoff) (_size*n*2*sizeof(double)));
+	_index = _size;
+}
+
+CovList::Reader::iterator::iterator(Reader& reader, size_t i) : reader(&reader), box(reader.n), i(i) {
+	if (i<reader.size()) reader.next(box);
+}
+
+CovList::Reader::iterator& CovList::Reader::iterator::operator++() {
+	i++;
+	if (i<reader->size()) reader->next(box);
+	return *this;
+}
+
+CovList::Reader::iterator CovList::Reader::begin() {
+	rewind();
+	return iterator(*this, 0);
+}
+
+CovList::Reader::iterator CovList::Reader::end() {
+	return iterator(*this, _size);
+}
+
 void CovList::format(stringstream& ss, const string& title, std::stack<unsigned int>& format_id, std::stack<unsigned int>& format_version) {
 	format_id.push(subformat_number);
 	format_version.push(FORMAT_VERSION);
@@ -5,16 +5,18 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Nov 07, 2018
-// Last update : Feb 28, 2019
+// Last update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_COV_LIST_H__
 #define __IBEX_COV_LIST_H__
 
 #include "ibex_Cov.h"
+#include "ibex_BoxBatch.h"
 
 #include <list>
 #include <vector>
+#include <iterator>
 
 namespace ibex {
 
@@ -62,6 +64,19 @@ public:
 	 */
 	virtual void add(const IntervalVector& x);
 
+	/**
+	 * \brief Add all the boxes of a batch at the end of the list.
+	 */
+	void add(const BoxBatch& batch);
+
+	/**
+	 * \brief Append all the boxes of the list to a batch.
+	 *
+	 * Whole-box operations (inclusion tests, hull, etc.) on the
+	 * boxes of a large list are faster on a batch.
+	 */
+	void boxes(BoxBatch& batch) const;
+
 	/**
 	 * \brief Get the ith box.
 	 */
@@ -82,6 +97,210 @@ public:
 	 */
 	static constexpr unsigned int FORMAT_VERSION = 1;
 
+	/**
+	 * \brief Incremental writer of a COV file.
+	 *
+	 * Boxes are appended to the file as and when they are added,
+	 * so that they are never stored in memory. The number of boxes
+	 * (in the header of the list) is fixed up when the file is closed.
+	 *
+	 * The file is a valid CovList file once closed.
+	 */
+	class Writer {
+	public:
+		/**
+		 * \brief Create a new CovList file.
+		 *
+		 * \param n - the dimension of the boxes.
+		 */
+		Writer(const char* filename, size_t n);
+
+		/**
+		 * \brief Close the file (if not already done) and delete this.
+		 */
+		virtual ~Writer();
+
+		/**
+		 * \brief Append a box to the file.
+		 */
+		virtual void add(const IntervalVector& x);
+
+		/**
+		 * \brief Number of boxes written so far.
+		 */
+		size_t size() const;
+
+		/**
+		 * \brief The last box written.
+		 */
+		const IntervalVector& last() const;
+
+		/**
+		 * \brief Write the end of the file and fix up the header.
+		 *
+		 * Nothing can be added afterwards. Does nothing
+		 * if the file is already closed.
+		 */
+		void close();
+
+		/**
+		 * \brief Dimension of the boxes.
+		 */
+		const size_t n;
+
+	protected:
+		/**
+		 * \brief Create a new file.
+		 *
+		 * \param format_id, format_version - format sequence of the subclasses
+		 *                                    (without Cov and CovList).
+		 */
+		Writer(const char* filename, size_t n, std::stack<unsigned int> format_id, std::stack<unsigned int> format_version);
+
+		/**
+		 * \brief Append a box to the file.
+		 */
+		void append(const IntervalVector& x);
+
+		/**
+		 * \brief Write the data that follows the list of boxes
+		 *        (nothing at this level).
+		 */
+		virtual void write_data();
+
+		std::ofstream f;
+		std::streampos size_pos;  // position of the number of boxes
+		size_t _size;
+		IntervalVector _last;
+		bool closed;
+	};
+
+	/**
+	 * \brief Streaming reader of a COV file.
+	 *
+	 * Boxes are read one at a time from the file (of any COV format
+	 * deriving from CovList), so that the list is never loaded in memory.
+	 *
+	 * Example:
+	 *
+	 *   CovList::Reader reader("file.cov");
+	 *   for (CovList::Reader::iterator it=reader.begin(); it!=reader.end(); ++it)
+	 *      cout << *it << endl;
+	 *
+	 * There can be only one iteration at a time.
+	 */
+	class Reader {
+	public:
+		/**
+		 * \brief Open a COV file.
+		 */
+		Reader(const char* filename);
+
+		/**
+		 * \brief Close the file and delete this.
+		 */
+		virtual ~Reader();
+
+		/**
+		 * \brief Number of boxes.
+		 */
+		size_t size() const;
+
+		/**
+		 * \brief Go back to the first box.
+		 */
+		void rewind();
+
+		/**
+		 * \brief Read the next box.
+		 *
+		 * \return false if all the boxes have been read.
+		 */
+		bool next(IntervalVector& box);
+
+		/**
+		 * \brief Read the next \a k boxes (or less if the end is reached)
+		 *        and append them to a batch.
+		 *
+		 * \return the number of boxes read.
+		 */
+		size_t next(BoxBatch& batch, size_t k);
+
+		/**
+		 * \brief Number of boxes read so far (index of the next box).
+		 */
+		size_t index() const;
+
+		/**
+		 * \brief Input iterator over the boxes.
+		 */
+		class iterator {
+		public:
+			typedef std::input_iterator_tag iterator_category;
+			typedef IntervalVector value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef const IntervalVector* pointer;
+			typedef const IntervalVector& reference;
+
+			/** \brief Current box. */
+			const IntervalVector& operator*() const  { return box; }
+			/** \brief Current box. */
+			const IntervalVector* operator->() const { return &box; }
+			/** \brief Index of the current box. */
+			size_t index() const                     { return i; }
+			/** \brief Read the next box. */
+			iterator& operator++();
+			bool operator==(const iterator& it) const { return i==it.i; }
+			bool operator!=(const iterator& it) const { return i!=it.i; }
+
+		protected:
+			friend class Reader;
+			iterator(Reader& reader, size_t i);
+			Reader* reader;
+			IntervalVector box;
+			size_t i;
+		};
+
+		/**
+		 * \brief Iterator on the first box (rewinds the file).
+		 */
+		iterator begin();
+
+		/**
+		 * \brief Iterator past the last box.
+		 */
+		iterator end();
+
+		/**
+		 * \brief Dimension of the boxes.
+		 */
+		const size_t n;
+
+	protected:
+		/**
+		 * \brief Create a reader (the file is opened by the subclass).
+		 */
+		Reader();
+
+		/**
+		 * \brief Open a COV file and read the header of the list.
+		 *
+		 * In return, the format sequence contains the formats of
+		 * the subclasses (Cov and CovList are popped).
+		 */
+		void open(const char* filename, std::stack<unsigned int>& format_id, std::stack<unsigned int>& format_version);
+
+		/**
+		 * \brief Move to the data that follows the list of boxes.
+		 */
+		void skip_boxes();
+
+		std::ifstream f;
+		std::streampos boxes_pos; // position of the first box
+		size_t _size;
+		size_t _index;
+	};
+
 protected:
 	/**
 	 * \brief Load a list from a COV file.
@@ -133,6 +352,22 @@ inline const IntervalVector& CovList::operator[](int i) const {
 	return *(data->vec)[i];
 }
 
+inline size_t CovList::Writer::size() const {
+	return _size;
+}
+
+inline const IntervalVector& CovList::Writer::last() const {
+	return _last;
+}
+
+inline size_t CovList::Reader::size() const {
+	return _size;
+}
+
+inline size_t CovList::Reader::index() const {
+	return _index;
+}
+
 
 } /* namespace ibex */
 
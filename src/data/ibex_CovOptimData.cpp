@@ -239,6 +239,50 @@ void CovOptimData::format(stringstream& ss, const string& title, std::stack<unsi
 	<< separator;
 }
 
+stack<unsigned int> CovOptimData::Writer::format_id() {
+	stack<unsigned int> s;
+	s.push(CovOptimData::subformat_number);
+	return s;
+}
+
+stack<unsigned int> CovOptimData::Writer::format_version() {
+	stack<unsigned int> s;
+	s.push(CovOptimData::FORMAT_VERSION);
+	return s;
+}
+
+CovOptimData::Writer::Writer(const char* filename, size_t n) : CovList::Writer(filename, n, format_id(), format_version()) {
+	CovOptimData tmp(n);
+	info = *tmp.data; // default values
+	info._optim_loup_point = IntervalVector::empty(n);
+}
+
+CovOptimData::Writer::~Writer() {
+	close();
+}
+
+void CovOptimData::Writer::set_data(const CovOptimData& data) {
+	assert(data.n==n);
+	info = *data.data;
+}
+
+void CovOptimData::Writer::write_data() {
+	if (info._optim_var_names.size()==n)
+		write_vars(f, info._optim_var_names);
+	else
+		write_vars(f, vector<string>(n, ""));
+
+	write_pos_int(f, info._optim_optimizer_status);
+	write_pos_int(f, (uint32_t) info._optim_is_extended_space);
+	write_double (f, info._optim_uplo);
+	write_double (f, info._optim_uplo_of_epsboxes);
+	write_double (f, info._optim_loup);
+	// the first box is the loup-point (not checked)
+	write_pos_int(f, size()>0 && !info._optim_loup_point.is_empty() ? 1 : 0);
+	write_double (f, info._optim_time);
+	write_pos_int(f, info._optim_nb_cells);
+}
+
 string CovOptimData::format() {
 	stringstream ss;
 	stack<unsigned int> format_id;
@@ -84,6 +84,7 @@ public:
 	 */
 	static constexpr unsigned int FORMAT_VERSION = 1;
 
+
 	/**
 	 * \brief Names of the variables.
 	 *
@@ -192,6 +193,50 @@ protected:
 	} *data;
 
 	bool own_data;
+
+public:
+	/**
+	 * \brief Incremental writer of an optimizer data file.
+	 *
+	 * Boxes are appended to the file as and when they are added,
+	 * so that they are never stored in memory (see CovList::Writer).
+	 * By convention, the first box must be the loup-point (see #loup_point()).
+	 *
+	 * The optimization information is given by #set_data(const CovOptimData&)
+	 * and written when the file is closed.
+	 */
+	class Writer : public CovList::Writer {
+	public:
+		/**
+		 * \brief Create a new optimizer data file.
+		 *
+		 * \param n - size of boxes
+		 */
+		Writer(const char* filename, size_t n);
+
+		/**
+		 * \brief Close the file (if not already done) and delete this.
+		 */
+		~Writer();
+
+		/**
+		 * \brief Set the information about the optimization
+		 *        (the boxes of \a data are ignored).
+		 */
+		void set_data(const CovOptimData& data);
+
+	protected:
+		/**
+		 * \brief Write the optimization information.
+		 */
+		virtual void write_data();
+
+		/* format sequence of the subclasses of CovList */
+		static std::stack<unsigned int> format_id();
+		static std::stack<unsigned int> format_version();
+
+		Data info;
+	};
 };
 
 /**
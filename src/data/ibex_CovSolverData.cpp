@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <cstdio>
 
 using namespace std;
 
@@ -143,6 +144,22 @@ ostream& operator<<(ostream& os, const CovSolverData& solver) {
 
 }
 
+ostream& operator<<(ostream& os, CovSolverData::Reader& reader) {
+
+	const char* name[] = { "solution", "boundary", "unknown", "pending" };
+
+	// one pass per status
+	for (int k=CovSolverData::SOLUTION; k<=CovSolverData::PENDING; k++) {
+		size_t j=0;
+		for (CovSolverData::Reader::iterator it=reader.begin(); it!=reader.end(); ++it) {
+			if (reader.status(it.index())==(CovSolverData::BoxStatus) k)
+				os << " " << name[k] << " n°" << (++j) << " = " << *it << endl;
+		}
+	}
+
+	return os;
+}
+
 void CovSolverData::read_vars(ifstream& f, size_t n, vector<string>& var_names) {
 	char x;
 	for (size_t i=0; i<n; i++) {
@@ -294,6 +311,226 @@ void CovSolverData::format(stringstream& ss, const string& title, std::stack<uns
 	<< separator;
 }
 
+stack<unsigned int> CovSolverData::Writer::format_id() {
+	stack<unsigned int> s;
+	s.push(CovSolverData::subformat_number);
+	s.push(CovManifold::subformat_number);
+	s.push(CovIBUList::subformat_number);
+	s.push(CovIUList::subformat_number);
+	return s;
+}
+
+stack<unsigned int> CovSolverData::Writer::format_version() {
+	stack<unsigned int> s;
+	s.push(CovSolverData::FORMAT_VERSION);
+	s.push(CovManifold::FORMAT_VERSION);
+	s.push(CovIBUList::FORMAT_VERSION);
+	s.push(CovIUList::FORMAT_VERSION);
+	return s;
+}
+
+CovSolverData::Writer::Writer(const char* filename, size_t n, size_t m, size_t nb_ineq, BoundaryType boundary_type, const vector<string>& var_names) :
+		CovList::Writer(filename, n, format_id(), format_version()), m(m), nb_ineq(nb_ineq), boundary_type(boundary_type),
+		var_names(var_names), solver_status(Solver::SUCCESS), time(-1), nb_cells(0),
+		_nb_solution(0), _nb_boundary(0), _nb_unknown(0),
+		sol_filename(string(filename)+".sol.tmp"), bnd_filename(string(filename)+".bnd.tmp") {
+
+	sol_file.open(sol_filename.c_str(), ios::out | ios::binary);
+	bnd_file.open(bnd_filename.c_str(), ios::out | ios::binary);
+
+	if (sol_file.fail() || bnd_file.fail())
+		ibex_error("[CovSolverData]: cannot create temporary file.\n");
+}
+
+CovSolverData::Writer::~Writer() {
+	close();
+}
+
+void CovSolverData::Writer::add(const IntervalVector& x) {
+	add_unknown(x);
+}
+
+void CovSolverData::Writer::add_inner(const IntervalVector& x) {
+	if (m>0)
+		ibex_error("[CovSolverData] inner boxes not allowed with equalities");
+	append(x);
+	inner.push_back(size()-1);
+	_nb_solution++;
+}
+
+void CovSolverData::Writer::add_unknown(const IntervalVector& x) {
+	append(x);
+	_nb_unknown++;
+}
+
+void CovSolverData::Writer::add_boundary(const IntervalVector& x, const VarSet& varset) {
+	append(x);
+	if (boundary_type==HALF_BALL)
+		ibu_boundary.push_back(size()-1);
+
+	write_pos_int(bnd_file, size()-1);
+	if (m>0 && m<n)
+		write_varset(bnd_file, varset);
+	_nb_boundary++;
+}
+
+void CovSolverData::Writer::add_solution(const IntervalVector& existence, const IntervalVector& unicity, const VarSet& varset) {
+	if (m==0)
+		ibex_error("[CovSolverData]: solution boxes not allowed without equalities");
+	append(existence);
+	ibu_boundary.push_back(size()-1);
+
+	write_pos_int(sol_file, size()-1);
+	if (m<n)
+		write_varset(sol_file, varset);
+	write_box(sol_file, unicity);
+	_nb_solution++;
+}
+
+void CovSolverData::Writer::add_pending(const IntervalVector& x) {
+	append(x);
+	pending.push_back(size()-1);
+}
+
+namespace {
+
+void write_indices(ofstream& f, const vector<uint32_t>& indices) {
+	if (!indices.empty())
+		f.write((const char*) &indices[0], indices.size()*sizeof(uint32_t));
+}
+
+// move a temporary file at the end of f
+void append_file(ofstream& f, ofstream& tmp, const string& tmp_filename) {
+	tmp.close();
+	if (tmp.fail())
+		ibex_error("[CovSolverData]: cannot write temporary file.\n");
+	ifstream in(tmp_filename.c_str(), ios::in | ios::binary);
+	if (in.peek()!=ifstream::traits_type::eof())
+		f << in.rdbuf();
+	in.close();
+	remove(tmp_filename.c_str());
+}
+
+}
+
+void CovSolverData::Writer::write_data() {
+	// ---------------- CovIUList ----------------
+	write_pos_int(f, inner.size());
+	write_indices(f, inner);
+
+	// ---------------- CovIBUList ----------------
+	write_pos_int(f, 1); // INNER_AND_OUTER_PT (see CovManifold)
+	write_pos_int(f, ibu_boundary.size());
+	write_indices(f, ibu_boundary);
+
+	// ---------------- CovManifold ----------------
+	write_pos_int(f, m);
+	write_pos_int(f, nb_ineq);
+	write_pos_int(f, (uint32_t) boundary_type);
+
+	if (m>0) {
+		write_pos_int(f, _nb_solution);
+	}
+	append_file(f, sol_file, sol_filename);
+
+	write_pos_int(f, _nb_boundary);
+	append_file(f, bnd_file, bnd_filename);
+
+	// ---------------- CovSolverData ----------------
+	if (var_names.size()==n)
+		write_vars(f, var_names);
+	else
+		write_vars(f, vector<string>(n, ""));
+
+	write_pos_int(f, solver_status);
+	write_double(f, time);
+	write_pos_int(f, nb_cells);
+	write_pos_int(f, pending.size());
+	write_indices(f, pending);
+}
+
+CovSolverData::Reader::Reader(const char* filename) : _nb_solution(0), _nb_boundary(0), _nb_unknown(0), _nb_pending(0) {
+
+	stack<unsigned int> format_id;
+	stack<unsigned int> format_version;
+
+	open(filename, format_id, format_version);
+
+	unsigned int id[4]      = { CovIUList::subformat_number, CovIBUList::subformat_number, CovManifold::subformat_number, CovSolverData::subformat_number };
+	unsigned int version[4] = { CovIUList::FORMAT_VERSION,   CovIBUList::FORMAT_VERSION,   CovManifold::FORMAT_VERSION,   CovSolverData::FORMAT_VERSION };
+
+	for (int i=0; i<4; i++) {
+		if (format_id.empty() || format_id.top()!=id[i] || format_version.top()!=version[i])
+			ibex_error("[CovSolverData]: not a solver data file.");
+		format_id.pop();
+		format_version.pop();
+	}
+
+	// the index lists follow the boxes
+	skip_boxes();
+
+	_status.resize(size(), (unsigned char) UNKNOWN);
+
+	auto read_index = [this]() {
+		uint32_t i=read_pos_int(f);
+		if (i>=size()) ibex_error("[CovSolverData]: invalid box index.");
+		return i;
+	};
+
+	// note: solutions are "inner" boxes if m=0
+	size_t nb_inner=read_pos_int(f);
+	for (size_t i=0; i<nb_inner; i++)
+		_status[read_index()]=SOLUTION;
+
+	read_pos_int(f); // CovIBUList boundary type
+	size_t nb_ibu_boundary=read_pos_int(f);
+	for (size_t i=0; i<nb_ibu_boundary; i++)
+		read_index();
+
+	_nb_eq=read_pos_int(f);
+	_nb_ineq=read_pos_int(f);
+	read_pos_int(f); // boundary type
+
+	size_t nb_sol=0;
+	if (_nb_eq>0) {
+		nb_sol=read_pos_int(f);
+		for (size_t i=0; i<nb_sol; i++) {
+			_status[read_index()]=SOLUTION;
+			if (_nb_eq<n)
+				for (size_t j=0; j<n-_nb_eq; j++) read_pos_int(f); // varset
+			for (size_t j=0; j<2*n; j++) read_double(f); // unicity box
+		}
+	}
+	_nb_solution=nb_inner+nb_sol;
+
+	_nb_boundary=read_pos_int(f);
+	for (size_t i=0; i<_nb_boundary; i++) {
+		_status[read_index()]=BOUNDARY;
+		if (_nb_eq>0 && _nb_eq<n)
+			for (size_t j=0; j<n-_nb_eq; j++) read_pos_int(f); // varset
+	}
+
+	read_vars(f, n, _var_names);
+	_solver_status=read_pos_int(f);
+	_time=read_double(f);
+	_nb_cells=read_pos_int(f);
+
+	_nb_pending=read_pos_int(f);
+	for (size_t i=0; i<_nb_pending; i++)
+		_status[read_index()]=PENDING;
+
+	_nb_unknown=size()-_nb_solution-_nb_boundary-_nb_pending;
+
+	rewind();
+}
+
+bool CovSolverData::Reader::next(IntervalVector& box, BoxStatus& status) {
+	size_t i=index();
+	if (!next(box)) return false;
+	status=(BoxStatus) _status[i];
+	return true;
+}
+
 string CovSolverData::format() {
 	stringstream ss;
 	stack<unsigned int> format_id;
@@ -206,6 +206,251 @@ public:
 	 */
 	static constexpr unsigned int FORMAT_VERSION = 2;
 
+	/**
+	 * \brief Incremental writer of a solver data file.
+	 *
+	 * Boxes are appended to the file as and when they are added,
+	 * so that they are never stored in memory (see CovList::Writer).
+	 * Only the indices of inner, boundary and pending boxes are kept
+	 * in memory until the file is closed. The data of solutions and
+	 * boundary boxes (unicity boxes, parameters) is spilled into two
+	 * temporary files (next to the output file).
+	 *
+	 * The methods mimic those of CovSolverData and the file obtained
+	 * once closed is the same as with CovSolverData::save(...).
+	 */
+	class Writer : public CovList::Writer {
+	public:
+		/**
+		 * \brief Create a new solver data file.
+		 *
+		 * \see CovSolverData(size_t, size_t, size_t, BoundaryType, const std::vector<std::string>&).
+		 */
+		Writer(const char* filename, size_t n, size_t m, size_t nb_ineq=0, BoundaryType boundary_type=EQU_ONLY, const std::vector<std::string>& var_names=std::vector<std::string>());
+
+		/**
+		 * \brief Close the file (if not already done) and delete this.
+		 */
+		~Writer();
+
+		/**
+		 * \brief Append a new 'unknown' box.
+		 */
+		virtual void add(const IntervalVector& x);
+
+		/**
+		 * \brief Append a new 'inner' box.
+		 */
+		void add_inner(const IntervalVector& x);
+
+		/**
+		 * \brief Append a new 'unknown' box.
+		 */
+		void add_unknown(const IntervalVector& x);
+
+		/**
+		 * \brief Append a new 'boundary' box.
+		 */
+		void add_boundary(const IntervalVector& x);
+
+		/**
+		 * \brief Append a new 'boundary' box.
+		 */
+		void add_boundary(const IntervalVector& x, const VarSet& varset);
+
+		/**
+		 * \brief Append a new 'solution' box.
+		 */
+		void add_solution(const IntervalVector& existence);
+
+		/**
+		 * \brief Append a new 'solution' box.
+		 */
+		void add_solution(const IntervalVector& existence, const IntervalVector& unicity);
+
+		/**
+		 * \brief Append a new 'solution' box.
+		 */
+		void add_solution(const IntervalVector& existence, const IntervalVector& unicity, const VarSet& varset);
+
+		/**
+		 * \brief Append a new 'pending' box.
+		 */
+		void add_pending(const IntervalVector& x);
+
+		/**
+		 * \brief Set the status of the solver.
+		 */
+		void set_solver_status(unsigned int status);
+
+		/**
+		 * \brief Set the CPU running time.
+		 */
+		void set_time(double time);
+
+		/**
+		 * \brief Set the number of cells.
+		 */
+		void set_nb_cells(unsigned long nb_cells);
+
+		/**
+		 * \brief Number of inner boxes.
+		 */
+		size_t nb_inner() const;
+
+		/**
+		 * \brief Number of solutions (including inner boxes).
+		 *
+		 * \see CovManifold::nb_solution().
+		 */
+		size_t nb_solution() const;
+
+		/**
+		 * \brief Number of boundary boxes.
+		 */
+		size_t nb_boundary() const;
+
+		/**
+		 * \brief Number of unknown boxes (pending boxes excluded).
+		 */
+		size_t nb_unknown() const;
+
+		/**
+		 * \brief Number of pending boxes.
+		 */
+		size_t nb_pending() const;
+
+		/**
+		 * \brief Number of equalities.
+		 */
+		const size_t m;
+
+		/**
+		 * \brief Number of inequalities.
+		 */
+		const size_t nb_ineq;
+
+		/**
+		 * \brief Boundary type.
+		 */
+		const BoundaryType boundary_type;
+
+	protected:
+		/**
+		 * \brief Write the index lists and the solver data.
+		 */
+		virtual void write_data();
+
+		/* format sequence of the subclasses of CovList */
+		static std::stack<unsigned int> format_id();
+		static std::stack<unsigned int> format_version();
+
+		std::vector<std::string> var_names;
+		unsigned int             solver_status;
+		double                   time;
+		unsigned long            nb_cells;
+
+		std::vector<uint32_t>    inner;        // indices of inner boxes
+		std::vector<uint32_t>    ibu_boundary; // indices of CovIBUList boundary boxes
+		std::vector<uint32_t>    pending;      // indices of pending boxes
+		size_t                   _nb_solution;
+		size_t                   _nb_boundary;
+		size_t                   _nb_unknown;
+
+		std::string              sol_filename; // temporary file for solutions
+		std::string              bnd_filename; // temporary file for boundary boxes
+		std::ofstream            sol_file;
+		std::ofstream            bnd_file;
+	};
+
+	/**
+	 * \brief Streaming reader of a solver data file.
+	 *
+	 * Boxes are read one at a time (see CovList::Reader). The status of
+	 * the boxes and the solver data are read when the file is opened
+	 * (the unicity boxes and the parameters of solutions are skipped).
+	 */
+	class Reader : public CovList::Reader {
+	public:
+		/**
+		 * \brief Open a solver data file.
+		 */
+		Reader(const char* filename);
+
+		/**
+		 * \brief Read the next box and its status.
+		 *
+		 * \return false if all the boxes have been read.
+		 */
+		bool next(IntervalVector& box, BoxStatus& status);
+
+		using CovList::Reader::next;
+
+		/**
+		 * \brief Status of the ith box.
+		 */
+		BoxStatus status(size_t i) const;
+
+		/**
+		 * \brief Number of solutions (including inner boxes).
+		 */
+		size_t nb_solution() const;
+
+		/**
+		 * \brief Number of boundary boxes.
+		 */
+		size_t nb_boundary() const;
+
+		/**
+		 * \brief Number of unknown boxes (pending boxes excluded).
+		 */
+		size_t nb_unknown() const;
+
+		/**
+		 * \brief Number of pending boxes.
+		 */
+		size_t nb_pending() const;
+
+		/**
+		 * \brief Number of equalities.
+		 */
+		size_t nb_eq() const;
+
+		/**
+		 * \brief Number of inequalities.
+		 */
+		size_t nb_ineq() const;
+
+		/**
+		 * \brief Names of the variables.
+		 */
+		const std::vector<std::string>& var_names() const;
+
+		/**
+		 * \brief Status of the solver.
+		 */
+		unsigned int solver_status() const;
+
+		/**
+		 * \brief CPU running time.
+		 */
+		double time() const;
+
+		/**
+		 * \brief Number of cells.
+		 */
+		unsigned long nb_cells() const;
+
+	protected:
+		std::vector<unsigned char> _status; // status of the ith box
+		size_t _nb_solution, _nb_boundary, _nb_unknown, _nb_pending;
+		size_t _nb_eq, _nb_ineq;
+		std::vector<std::string> _var_names;
+		unsigned int _solver_status;
+		double _time;
+		unsigned long _nb_cells;
+	};
+
 protected:
 	friend class Solver;
 
@@ -255,6 +500,12 @@ protected:
  */
 std::ostream& operator<<(std::ostream& os, const CovSolverData& solver);
 
+/**
+ * \brief Stream out the boxes of a solver data file
+ *        (same output as for CovSolverData).
+ */
+std::ostream& operator<<(std::ostream& os, CovSolverData::Reader& reader);
+
 /*================================== inline implementations ========================================*/
 
 inline CovSolverData::BoxStatus CovSolverData::status(int i) const {
@@ -305,6 +556,98 @@ inline size_t CovSolverData::nb_unknown() const {
 	return data->_solver_unknown.size();
 }
 
+inline size_t CovSolverData::Writer::nb_inner() const {
+	return inner.size();
+}
+
+inline size_t CovSolverData::Writer::nb_solution() const {
+	return _nb_solution;
+}
+
+inline size_t CovSolverData::Writer::nb_boundary() const {
+	return _nb_boundary;
+}
+
+inline size_t CovSolverData::Writer::nb_unknown() const {
+	return _nb_unknown;
+}
+
+inline size_t CovSolverData::Writer::nb_pending() const {
+	return pending.size();
+}
+
+inline void CovSolverData::Writer::set_solver_status(unsigned int status) {
+	solver_status = status;
+}
+
+inline void CovSolverData::Writer::set_time(double t) {
+	time = t;
+}
+
+inline void CovSolverData::Writer::set_nb_cells(unsigned long n) {
+	nb_cells = n;
+}
+
+inline void CovSolverData::Writer::add_boundary(const IntervalVector& x) {
+	if (m>0 && m<n)
+		ibex_error("[CovSolverData]: a boundary box for an under-constrained system requires \"VarSet\" structure (parameters/variables)");
+	add_boundary(x, VarSet(n,BitSet::empty(n),false));
+}
+
+inline void CovSolverData::Writer::add_solution(const IntervalVector& existence) {
+	add_solution(existence, existence);
+}
+
+inline void CovSolverData::Writer::add_solution(const IntervalVector& existence, const IntervalVector& unicity) {
+	if (m<n)
+		ibex_error("[CovSolverData]: a solution of under-constrained system requires \"VarSet\" structure (parameters/variables)");
+	add_solution(existence, unicity, VarSet(n,BitSet::empty(n),false));
+}
+
+inline CovSolverData::BoxStatus CovSolverData::Reader::status(size_t i) const {
+	return (BoxStatus) _status[i];
+}
+
+inline size_t CovSolverData::Reader::nb_solution() const {
+	return _nb_solution;
+}
+
+inline size_t CovSolverData::Reader::nb_boundary() const {
+	return _nb_boundary;
+}
+
+inline size_t CovSolverData::Reader::nb_unknown() const {
+	return _nb_unknown;
+}
+
+inline size_t CovSolverData::Reader::nb_pending() const {
+	return _nb_pending;
+}
+
+inline size_t CovSolverData::Reader::nb_eq() const {
+	return _nb_eq;
+}
+
+inline size_t CovSolverData::Reader::nb_ineq() const {
+	return _nb_ineq;
+}
+
+inline const std::vector<std::string>& CovSolverData::Reader::var_names() const {
+	return _var_names;
+}
+
+inline unsigned int CovSolverData::Reader::solver_status() const {
+	return _solver_status;
+}
+
+inline double CovSolverData::Reader::time() const {
+	return _time;
+}
+
+inline unsigned long CovSolverData::Reader::nb_cells() const {
+	return _nb_cells;
+}
+
 inline void CovSolverData::add_boundary(const IntervalVector& x) {
 	CovManifold::add_boundary(x);
 }
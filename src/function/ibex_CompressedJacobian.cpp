@@ -0,0 +1,589 @@
+/* ============================================================================
+ * I B E X - Compressed Jacobian (forward mode)
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Function.h"
+#include "ibex_CompressedJacobian.h"
+
+#include <algorithm>
+#include <iterator>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+typedef vector<int> Vars;
+
+// b := a U b (both sorted)
+void merge(const Vars& a, Vars& b) {
+	if (a.empty()) return;
+	Vars r;
+	r.reserve(a.size()+b.size());
+	set_union(a.begin(),a.end(),b.begin(),b.end(),back_inserter(r));
+	b.swap(r);
+}
+
+/*
+ * Variables each scalar component of each node depends on
+ * (the components of a matrix are numbered row by row,
+ * like the variables).
+ */
+class Dependencies : public FwdAlgorithm {
+public:
+	Dependencies(const Function& f) : f(f), dep(new vector<Vars>[f.nb_nodes()]), first_var(f.nb_arg()), supported(true) {
+		for (int i=0, j=0; i<f.nb_arg(); i++) {
+			first_var[i]=j;
+			j+=f.arg(i).dim.size();
+		}
+		for (int i=0; i<f.nb_nodes(); i++)
+			dep[i].resize(f.node(i).dim.size());
+		f.cf.forward<Dependencies>(*this);
+	}
+
+	~Dependencies() {
+		delete[] dep;
+	}
+
+	// y_k depends on x_k
+	void copy(int x, int y) { dep[y]=dep[x]; }
+
+	// y_k depends on x1_k and x2_k
+	void comp(int x1, int x2, int y) {
+		for (size_t k=0; k<dep[y].size(); k++) {
+			dep[y][k]=dep[x1][k];
+			merge(dep[x2][k],dep[y][k]);
+		}
+	}
+
+	// all the y_k depend on all the x_k
+	void all(int x, int y) {
+		Vars u;
+		for (size_t k=0; k<dep[x].size(); k++)
+			merge(dep[x][k],u);
+		for (size_t k=0; k<dep[y].size(); k++)
+			merge(u,dep[y][k]);
+	}
+
+	void idx_fwd(int x, int y) {
+		const DoubleIndex& idx=((const ExprIndex&) f.node(y)).index;
+		int nc=f.node(x).dim.nb_cols();
+		int k=0;
+		for (int i=idx.first_row(); i<=idx.last_row(); i++)
+			for (int j=idx.first_col(); j<=idx.last_col(); j++)
+				dep[y][k++]=dep[x][i*nc+j];
+	}
+
+	void idx_cp_fwd(int x, int y) { idx_fwd(x,y); }
+
+	void symbol_fwd(int y) {
+		int first=first_var[((const ExprSymbol&) f.node(y)).key];
+		for (size_t k=0; k<dep[y].size(); k++)
+			dep[y][k]=Vars(1,first+k);
+	}
+
+	void cst_fwd(int) { }
+
+	void vector_fwd(int* x, int y) {
+		const ExprVector& v = (const ExprVector&) f.node(y);
+		int nc=v.dim.nb_cols();
+		int r=0,c=0; // position of the current argument
+
+		for (int i=0; i<v.length(); i++) {
+			const Dim& di=v.arg(i).dim;
+			if (v.dim.is_vector()) {
+				for (int k=0; k<di.size(); k++)
+					dep[y][r++]=dep[x[i]][k];
+			} else if (di.is_vector()) {
+				for (int k=0; k<di.vec_size(); k++)
+					dep[y][v.row_vector() ? k*nc+c : r*nc+k]=dep[x[i]][k];
+				if (v.row_vector()) c++; else r++;
+			} else if (di.is_matrix()) {
+				for (int a=0; a<di.nb_rows(); a++)
+					for (int b=0; b<di.nb_cols(); b++)
+						dep[y][(r+a)*nc+c+b]=dep[x[i]][a*di.nb_cols()+b];
+				if (v.row_vector()) c+=di.nb_cols(); else r+=di.nb_rows();
+			}
+		}
+	}
+
+	void apply_fwd(int* x, int y) {
+		supported=false;
+		const ExprApply& a = (const ExprApply&) f.node(y);
+		for (int i=0; i<a.nb_args; i++) all(x[i],y);
+	}
+
+	void chi_fwd(int a, int b, int c, int y)  { all(a,y); all(b,y); all(c,y); }
+	void gen2_fwd(int x1, int x2, int y)      { supported=false; all(x1,y); all(x2,y); }
+	void gen1_fwd(int x, int y)               { supported=false; all(x,y); }
+
+	void add_fwd(int x1, int x2, int y)       { comp(x1,x2,y); }
+	void mul_fwd(int x1, int x2, int y)       { comp(x1,x2,y); }
+	void sub_fwd(int x1, int x2, int y)       { comp(x1,x2,y); }
+	void div_fwd(int x1, int x2, int y)       { comp(x1,x2,y); }
+	void max_fwd(int x1, int x2, int y)       { comp(x1,x2,y); }
+	void min_fwd(int x1, int x2, int y)       { comp(x1,x2,y); }
+	void atan2_fwd(int x1, int x2, int y)     { comp(x1,x2,y); }
+	void add_V_fwd(int x1, int x2, int y)     { comp(x1,x2,y); }
+	void add_M_fwd(int x1, int x2, int y)     { comp(x1,x2,y); }
+	void sub_V_fwd(int x1, int x2, int y)     { comp(x1,x2,y); }
+	void sub_M_fwd(int x1, int x2, int y)     { comp(x1,x2,y); }
+
+	void mul_SV_fwd(int x1, int x2, int y) {
+		for (size_t k=0; k<dep[y].size(); k++) {
+			dep[y][k]=dep[x2][k];
+			merge(dep[x1][0],dep[y][k]);
+		}
+	}
+
+	void mul_SM_fwd(int x1, int x2, int y)    { mul_SV_fwd(x1,x2,y); }
+	void mul_VV_fwd(int x1, int x2, int y)    { all(x1,y); all(x2,y); }
+
+	// y_i = sum_j x1_(i,j)*x2_j
+	void mul_MV_fwd(int x1, int x2, int y) {
+		int nc=f.node(x1).dim.nb_cols();
+		for (size_t i=0; i<dep[y].size(); i++)
+			for (int j=0; j<nc; j++) {
+				merge(dep[x1][i*nc+j],dep[y][i]);
+				merge(dep[x2][j],dep[y][i]);
+			}
+	}
+
+	// y_j = sum_i x1_i*x2_(i,j)
+	void mul_VM_fwd(int x1, int x2, int y) {
+		int nc=f.node(x2).dim.nb_cols();
+		for (size_t i=0; i<dep[x1].size(); i++)
+			for (int j=0; j<nc; j++) {
+				merge(dep[x1][i],dep[y][j]);
+				merge(dep[x2][i*nc+j],dep[y][j]);
+			}
+	}
+
+	// y_(i,j) = sum_k x1_(i,k)*x2_(k,j)
+	void mul_MM_fwd(int x1, int x2, int y) {
+		int nr=f.node(y).dim.nb_rows();
+		int nc=f.node(y).dim.nb_cols();
+		int p=f.node(x1).dim.nb_cols();
+		for (int i=0; i<nr; i++)
+			for (int j=0; j<nc; j++)
+				for (int k=0; k<p; k++) {
+					merge(dep[x1][i*p+k],dep[y][i*nc+j]);
+					merge(dep[x2][k*nc+j],dep[y][i*nc+j]);
+				}
+	}
+
+	void minus_fwd(int x, int y)              { copy(x,y); }
+	void minus_V_fwd(int x, int y)            { copy(x,y); }
+	void minus_M_fwd(int x, int y)            { copy(x,y); }
+	void trans_V_fwd(int x, int y)            { copy(x,y); }
+
+	void trans_M_fwd(int x, int y) {
+		int nr=f.node(y).dim.nb_rows();
+		int nc=f.node(y).dim.nb_cols();
+		for (int i=0; i<nr; i++)
+			for (int j=0; j<nc; j++)
+				dep[y][i*nc+j]=dep[x][j*nr+i];
+	}
+
+	void sign_fwd(int x, int y)               { copy(x,y); }
+	void abs_fwd(int x, int y)                { copy(x,y); }
+	void power_fwd(int x, int y, int)         { copy(x,y); }
+	void sqr_fwd(int x, int y)                { copy(x,y); }
+	void sqrt_fwd(int x, int y)               { copy(x,y); }
+	void exp_fwd(int x, int y)                { copy(x,y); }
+	void log_fwd(int x, int y)                { copy(x,y); }
+	void cos_fwd(int x, int y)                { copy(x,y); }
+	void sin_fwd(int x, int y)                { copy(x,y); }
+	void tan_fwd(int x, int y)                { copy(x,y); }
+	void cosh_fwd(int x, int y)               { copy(x,y); }
+	void sinh_fwd(int x, int y)               { copy(x,y); }
+	void tanh_fwd(int x, int y)               { copy(x,y); }
+	void acos_fwd(int x, int y)               { copy(x,y); }
+	void asin_fwd(int x, int y)               { copy(x,y); }
+	void atan_fwd(int x, int y)               { copy(x,y); }
+	void acosh_fwd(int x, int y)              { copy(x,y); }
+	void asinh_fwd(int x, int y)              { copy(x,y); }
+	void atanh_fwd(int x, int y)              { copy(x,y); }
+	void floor_fwd(int x, int y)              { copy(x,y); }
+	void ceil_fwd(int x, int y)               { copy(x,y); }
+	void saw_fwd(int x, int y)                { copy(x,y); }
+
+	const Function& f;
+	vector<Vars>* dep;
+	vector<int> first_var; // first variable of each argument
+	bool supported;
+};
+
+// in decreasing order of degree
+struct Degree {
+	Degree(const vector<Vars>& col_rows) : col_rows(col_rows) { }
+	bool operator()(int j1, int j2) const { return col_rows[j1].size()>col_rows[j2].size(); }
+	const vector<Vars>& col_rows;
+};
+
+}
+
+CompressedJacobian::CompressedJacobian(Eval& e) : f(e.f), _eval(e), d(e.d), t(f),
+		supported(true), row_of(new int[f.image_dim()]), agenda(NULL), seed(f.nb_var()), one_col(1) {
+
+	int n=f.nb_var();
+	int m=f.image_dim();
+
+	assert(!f.expr().dim.is_matrix());
+
+	// ====================== sparsity pattern =========================
+	{
+		Dependencies dep(f);
+		supported=dep.supported;
+		_pattern.assign(dep.dep[0].begin(),dep.dep[0].end()); // the root is node n°0
+	}
+
+	// ====================== coloring =================================
+	vector<Vars> col_rows(n);
+	for (int i=0; i<m; i++)
+		for (Vars::const_iterator it=_pattern[i].begin(); it!=_pattern[i].end(); ++it)
+			col_rows[*it].push_back(i);
+
+	vector<int> order(n);
+	for (int j=0; j<n; j++) order[j]=j;
+	stable_sort(order.begin(),order.end(),Degree(col_rows));
+
+	_color.assign(n,-1);
+	vector<int> mark; // mark[c]==j <=> color c is forbidden for j
+
+	for (int k=0; k<n; k++) {
+		int j=order[k];
+		if (col_rows[j].empty()) break; // unused variables (at the end)
+
+		for (Vars::const_iterator i=col_rows[j].begin(); i!=col_rows[j].end(); ++i)
+			for (Vars::const_iterator j2=_pattern[*i].begin(); j2!=_pattern[*i].end(); ++j2)
+				if (_color[*j2]!=-1) mark[_color[*j2]]=j;
+
+		int c=0;
+		while (c<(int) mark.size() && mark[c]==j) c++;
+		if (c==(int) mark.size()) mark.push_back(-1);
+		_color[j]=c;
+	}
+
+	seeds.resize(mark.size());
+	for (int j=0; j<n; j++)
+		if (_color[j]!=-1) seeds[_color[j]].push_back(j);
+
+	entries.resize(mark.size());
+	for (int i=0; i<m; i++)
+		for (Vars::const_iterator j=_pattern[i].begin(); j!=_pattern[i].end(); ++j)
+			entries[_color[*j]].push_back(make_pair(i,*j));
+
+	// ====================== cost of the reverse mode =================
+	cone_size.assign(m,f.nb_nodes()/m); // if the components are generated: average size
+	if (_eval.fwd_agenda!=NULL) {
+		for (int i=0; i<m; i++) {
+			const Agenda& a=*(_eval.bwd_agenda[i]);
+			cone_size[i]=0;
+			for (int z=a.first(); z!=a.end(); z=a.next(z))
+				cone_size[i]++;
+		}
+
+		agenda = new Agenda(f.nodes.size());
+	}
+}
+
+CompressedJacobian::~CompressedJacobian() {
+	delete[] row_of;
+	if (agenda) delete agenda;
+}
+
+bool CompressedJacobian::is_faster(const BitSet& rows, int v) const {
+	long n=f.nb_var();
+
+	// a backward sweep visits the nodes of one component but reading
+	// and writing the gradient of the arguments costs about n/2 nodes
+	long rev=0;
+	long cones=0;
+	for (int c=rows.min(), i=0; i<rows.size(); c=rows.next(c), i++) {
+		rev+=cone_size[c] + n/2;
+		cones+=cone_size[c];
+	}
+
+	// a forward sweep visits the nodes of the rows (at most all
+	// the nodes, since the cones may overlap) and loads the seed
+	long nodes=agenda && cones<f.nb_nodes() ? cones : f.nb_nodes();
+	long fwd=(v==-1 ? nb_colors() : 1) * (nodes + n);
+
+	return fwd < rev;
+}
+
+const Interval& CompressedJacobian::tangent(int i) const {
+	if (agenda)
+		return t[_eval.bwd_agenda[i]->first()].i(); // the root may not be calculated
+	else
+		return f.expr().dim.is_scalar() ? t.top->i() : t.top->v()[i];
+}
+
+bool CompressedJacobian::eval(const IntervalVector& box, const BitSet& rows) {
+	if (!agenda)
+		return !_eval.eval(box).is_empty();
+
+	// merge the agendas of the rows (see Eval)
+	agenda->flush();
+	for (BitSet::const_iterator c=rows.begin(); c!=rows.end(); ++c)
+		agenda->push(*(_eval.fwd_agenda[c]));
+
+	return !_eval.eval(box,rows).is_empty();
+}
+
+bool CompressedJacobian::in_rows(int k, const BitSet& rows) const {
+	for (vector<pair<int,int> >::const_iterator e=entries[k].begin(); e!=entries[k].end(); ++e)
+		if (rows[e->first]) return true;
+	return false;
+}
+
+void CompressedJacobian::sweep(const vector<int>& cols) {
+	seed.clear();
+	for (vector<int>::const_iterator j=cols.begin(); j!=cols.end(); ++j)
+		seed[*j]=1.0;
+
+	if (agenda) {
+		t.write_arg_domains(seed);
+		f.cf.forward<CompressedJacobian>(*this,*agenda);
+	} else
+		tangents(seed);
+}
+
+void CompressedJacobian::tangents(const IntervalVector& u) {
+	t.write_arg_domains(u);
+
+	f.cf.forward<CompressedJacobian>(*this);
+}
+
+bool CompressedJacobian::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitSet& components, const BitSet& rows, int v) {
+
+	assert(supported);
+
+	int m=f.image_dim();
+
+	if (!eval(box,rows))
+		// outside definition domain -> empty jacobian
+		return false;
+
+	for (int c=0; c<m; c++) row_of[c]=-1;
+	for (int c=components.min(), i=0; i<components.size(); c=components.next(c), i++)
+		if (rows[c]) row_of[c]=i;
+
+	if (v!=-1) {
+		// one sweep in the direction of x_v
+		if (_color[v]==-1) {
+			for (int c=0; c<m; c++)
+				if (row_of[c]!=-1) J[row_of[c]][v]=0;
+			return true;
+		}
+
+		one_col[0]=v;
+		sweep(one_col);
+
+		for (int c=0; c<m; c++) {
+			if (row_of[c]==-1) continue;
+			J[row_of[c]][v]=tangent(c);
+			if (J[row_of[c]][v].is_empty()) return false;
+		}
+		return true;
+	}
+
+	for (int c=0; c<m; c++)
+		if (row_of[c]!=-1) J[row_of[c]].clear();
+
+	for (int k=0; k<nb_colors(); k++) {
+
+		if (!in_rows(k,rows)) continue;
+
+		sweep(seeds[k]);
+
+		for (vector<pair<int,int> >::const_iterator e=entries[k].begin(); e!=entries[k].end(); ++e) {
+			if (row_of[e->first]==-1) continue;
+			Interval& x=J[row_of[e->first]][e->second];
+			x=tangent(e->first);
+			if (x.is_empty()) return false;
+		}
+	}
+
+	return true;
+}
+
+bool CompressedJacobian::jacobian(const IntervalVector& box, SparseIntervalMatrix& J, const BitSet& rows) {
+
+	assert(supported);
+
+	if (!eval(box,rows))
+		return false;
+
+	for (int k=0; k<nb_colors(); k++) {
+
+		if (!in_rows(k,rows)) continue;
+
+		sweep(seeds[k]);
+
+		for (vector<pair<int,int> >::const_iterator e=entries[k].begin(); e!=entries[k].end(); ++e) {
+			if (!rows[e->first]) continue;
+			int p=J.find(e->first,e->second);
+			if (p==-1) continue; // structural nonzero but null derivative
+			J[p]=tangent(e->first);
+			if (J[p].is_empty()) return false;
+		}
+	}
+
+	return true;
+}
+
+void CompressedJacobian::idx_cp_fwd(int x, int y) {
+	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
+
+	const ExprIndex& e = (const ExprIndex&) f.node(y);
+
+	t[y] = t[x][e.index];
+}
+
+void CompressedJacobian::vector_fwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	const ExprVector& v = (const ExprVector&) f.node(y);
+
+	assert(v.type()!=Dim::SCALAR);
+
+	int j=0;
+
+	if (v.dim.is_vector()) {
+		for (int i=0; i<v.length(); i++) {
+			if (v.arg(i).dim.is_vector()) {
+				t[y].v().put(j,t[x[i]].v());
+				j+=v.arg(i).dim.vec_size();
+			} else {
+				t[y].v()[j]=t[x[i]].i();
+				j++;
+			}
+		}
+	}
+	else {
+		if (v.row_vector()) {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					t[y].m().put(0,j,t[x[i]].m());
+					j+=v.arg(i).dim.nb_cols();
+				} else if (v.arg(i).dim.is_vector()) {
+					t[y].m().set_col(j,t[x[i]].v());
+					j++;
+				}
+			}
+		} else {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					t[y].m().put(j,0,t[x[i]].m());
+					j+=v.arg(i).dim.nb_rows();
+				} else if (v.arg(i).dim.is_vector()) {
+					t[y].m().set_row(j,t[x[i]].v());
+					j++;
+				}
+			}
+		}
+	}
+}
+
+void CompressedJacobian::apply_fwd(int*, int) {
+	not_implemented("forward-mode differentiation of a function call");
+}
+
+void CompressedJacobian::gen1_fwd(int, int) {
+	not_implemented("forward-mode differentiation of a generic operator");
+}
+
+void CompressedJacobian::gen2_fwd(int, int, int) {
+	not_implemented("forward-mode differentiation of a generic operator");
+}
+
+// The local derivatives below are the same as in Gradient
+
+void CompressedJacobian::chi_fwd(int a, int b, int c, int y) {
+	Interval ga,gb,gc;
+
+	if (d[a].i().ub()<0) {
+		ga=Interval::zero();
+		gb=Interval::one();
+		gc=Interval::zero();
+	}
+	else if (d[a].i().lb()>0) {
+		ga=Interval::zero();
+		gb=Interval::zero();
+		gc=Interval::one();
+	} else {
+
+		if (d[b].i().is_degenerated() && d[c].i().is_degenerated()) {
+			double _b =d[b].i().ub();
+			double _c =d[c].i().ub();
+			if (_b<_c) ga=Interval::pos_reals();
+			else if (_b>_c) ga=Interval::neg_reals();
+			else ga=Interval::zero();
+		} else {
+			ga=Interval::all_reals();
+		}
+
+		gb=Interval(0,1);
+		gc=Interval(0,1);
+	}
+
+	t[y].i() = t[a].i() * ga + t[b].i() * gb + t[c].i() * gc;
+}
+
+void CompressedJacobian::max_fwd(int x1, int x2, int y) {
+	if (d[x1].i().lb() > d[x2].i().ub())
+		t[y].i() = t[x1].i();
+	else if (d[x2].i().lb() > d[x1].i().ub())
+		t[y].i() = t[x2].i();
+	else
+		t[y].i() = t[x1].i() * Interval(0,1) + t[x2].i() * Interval(0,1);
+}
+
+void CompressedJacobian::min_fwd(int x1, int x2, int y) {
+	if (d[x1].i().lb() > d[x2].i().ub())
+		t[y].i() = t[x2].i();
+	else if (d[x2].i().lb() > d[x1].i().ub())
+		t[y].i() = t[x1].i();
+	else
+		t[y].i() = t[x1].i() * Interval(0,1) + t[x2].i() * Interval(0,1);
+}
+
+void CompressedJacobian::sign_fwd(int x, int y) {
+	if (d[x].i().contains(0)) t[y].i() = t[x].i() * Interval::pos_reals();
+	else t[y].i() = Interval::zero();
+}
+
+void CompressedJacobian::floor_fwd(int x, int y) {
+	if (std::floor(d[x].i().ub()) >= d[x].i().lb()) t[y].i() = t[x].i() * Interval::pos_reals();
+	else t[y].i() = Interval::zero();
+}
+
+void CompressedJacobian::ceil_fwd(int x, int y) {
+	if (std::floor(d[x].i().ub()) >= d[x].i().lb()) t[y].i() = t[x].i() * Interval::pos_reals();
+	else t[y].i() = Interval::zero();
+}
+
+void CompressedJacobian::saw_fwd(int x, int y) {
+	if (round(d[x].i().lb()) == round(d[x].i().ub()))
+		t[y].i() = t[x].i();
+	else
+		t[y].i() = t[x].i() * Interval(NEG_INFINITY,1);
+}
+
+void CompressedJacobian::abs_fwd(int x, int y) {
+	if (d[x].i().lb()>0) t[y].i() = t[x].i();
+	else if (d[x].i().ub()<0) t[y].i() = -t[x].i();
+	else t[y].i() = Interval(-1,1) * t[x].i();
+}
+
+} // namespace ibex
@@ -0,0 +1,271 @@
+/* ============================================================================
+ * I B E X - Compressed Jacobian (forward mode)
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_COMPRESSED_JACOBIAN_H__
+#define __IBEX_COMPRESSED_JACOBIAN_H__
+
+#include <vector>
+#include <utility>
+
+#include "ibex_Eval.h"
+#include "ibex_SparseIntervalMatrix.h"
+#include "ibex_BitSet.h"
+#include "ibex_Agenda.h"
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Jacobian matrix by forward-mode automatic differentiation
+ *        with column compression.
+ *
+ * The reverse mode (see #Gradient) calculates the Jacobian matrix row by row,
+ * with one backward sweep per component. In forward mode, a sweep calculates
+ * the derivative of all the components in one direction (a "seed"), i.e.,
+ * one column of the matrix. When the matrix is sparse, several columns can be
+ * calculated with the same sweep: if two variables x_j and x_k never appear in
+ * the same component, the derivative in the direction e_j+e_k gives column j on
+ * the rows that depend on x_j and column k on the others.
+ *
+ * The sparsity pattern of the Jacobian matrix is obtained structurally, by a
+ * forward traversal of the DAG (this does not require to generate the components
+ * of the function). The columns are then grouped with the greedy coloring of
+ * Curtis, Powell and Reid (largest-first ordering): two columns with the same color
+ * do not share any row. The full matrix requires one sweep per color, whatever the
+ * number of rows, instead of one backward sweep per row.
+ *
+ * Calls to other functions (apply) and generic operators are not supported
+ * (see #is_supported()).
+ *
+ * For memory saving, the domains of the nodes are shared with an
+ * already existing Eval object (the tangents are stored separately).
+ *
+ * As in reverse mode, if f is a vector of expressions, only the nodes the
+ * requested rows depend on are evaluated and differentiated.
+ */
+class CompressedJacobian : public FwdAlgorithm {
+
+public:
+	/**
+	 * \brief Build the forward-mode Jacobian of a vector-valued function.
+	 *
+	 * The sparsity pattern and the coloring are calculated here.
+	 */
+	CompressedJacobian(Eval& eval);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~CompressedJacobian();
+
+	/**
+	 * \brief False if the function contains operations not supported in forward mode.
+	 */
+	bool is_supported() const;
+
+	/**
+	 * \brief Structural sparsity pattern.
+	 *
+	 * The ith vector contains the variables (sorted) the ith component depends on.
+	 * This is a superset of the variables with a nonzero derivative.
+	 */
+	const std::vector<std::vector<int> >& pattern() const;
+
+	/**
+	 * \brief Number of colors (i.e., of forward sweeps for the full matrix).
+	 */
+	int nb_colors() const;
+
+	/**
+	 * \brief Color of the jth variable (-1 if no component depends on it).
+	 */
+	int color(int j) const;
+
+	/**
+	 * \brief True if forward mode is expected to be faster than reverse mode.
+	 *
+	 * Compares the number of nodes visited by the forward sweeps
+	 * (one per color, or only one if \a v!=-1, restricted to the nodes
+	 * the components in \a rows depend on) with the number
+	 * of nodes visited by the backward sweeps of the components in \a rows.
+	 * The cost of loading the seed (forward) or the gradient (reverse) in
+	 * the arguments, which is linear in the number of variables, is included:
+	 * on large sparse systems, this is often the dominating cost of the
+	 * reverse mode.
+	 *
+	 * \param rows - the components to calculate
+	 * \param v    - the column to calculate (-1 means all)
+	 */
+	bool is_faster(const BitSet& rows, int v=-1) const;
+
+	/**
+	 * \brief Calculate some rows of the Jacobian matrix of f on the box \a box.
+	 *
+	 * \param components - the components of f in J (the ith row of J is the
+	 *                     ith component in the set)
+	 * \param rows       - the components to calculate (a subset of components).
+	 *                     The other rows of J are not modified.
+	 * \param v          - only update the vth column of J. Default value is -1
+	 *                     (means: update all the columns).
+	 * \return false if the Jacobian is empty (box outside of the definition domain).
+	 *         J is partially updated in this case.
+	 */
+	bool jacobian(const IntervalVector& box, IntervalMatrix& J, const BitSet& components, const BitSet& rows, int v=-1);
+
+	/**
+	 * \brief Calculate some rows of the Jacobian matrix (sparse version).
+	 *
+	 * Only the entries of the pattern of J are calculated (the entries
+	 * of the rows not in \a rows are not modified).
+	 *
+	 * \return false if the Jacobian is empty.
+	 */
+	bool jacobian(const IntervalVector& box, SparseIntervalMatrix& J, const BitSet& rows);
+
+	/**
+	 * \brief Calculate the tangents of all the nodes in the direction \a u.
+	 *
+	 * The domains of the nodes must have been calculated before (by the
+	 * Eval object). In return, t[i] is the derivative of the ith node
+	 * in the direction u.
+	 */
+	void tangents(const IntervalVector& u);
+
+	/* ====================================== Forward =================================== */
+
+	inline void idx_fwd(int , int ) { /* nothing to do */ }
+	       void idx_cp_fwd(int x, int y);
+	       void vector_fwd(int* x, int y);
+	inline void cst_fwd(int y)                { t[y].clear(); }
+	inline void symbol_fwd(int)               { /* nothing to do (seed) */ }
+	       void apply_fwd(int* x, int y);
+	       void chi_fwd(int a, int b, int c, int y);
+	       void gen2_fwd(int x1, int x2, int y);
+	inline void add_fwd(int x1, int x2, int y)    { t[y].i()=t[x1].i()+t[x2].i(); }
+	inline void mul_fwd(int x1, int x2, int y)    { t[y].i()=t[x1].i()*d[x2].i()+d[x1].i()*t[x2].i(); }
+	inline void sub_fwd(int x1, int x2, int y)    { t[y].i()=t[x1].i()-t[x2].i(); }
+	inline void div_fwd(int x1, int x2, int y)    { t[y].i()=t[x1].i()/d[x2].i()+t[x2].i()*(-d[x1].i())/sqr(d[x2].i()); }
+	       void max_fwd(int x1, int x2, int y);
+	       void min_fwd(int x1, int x2, int y);
+	inline void atan2_fwd(int x1, int x2, int y)  { t[y].i()=(t[x1].i()*d[x2].i()-t[x2].i()*d[x1].i())/(sqr(d[x2].i())+sqr(d[x1].i())); }
+	       void gen1_fwd(int x, int y);
+	inline void minus_fwd(int x, int y)       { t[y].i()=-t[x].i(); }
+	inline void minus_V_fwd(int x, int y)     { t[y].v()=-t[x].v(); }
+	inline void minus_M_fwd(int x, int y)     { t[y].m()=-t[x].m(); }
+	inline void trans_V_fwd(int, int)         { /* nothing to do because t[y].v() is a reference to t[x].v() */ }
+	inline void trans_M_fwd(int x, int y)     { t[y].m()=t[x].m().transpose(); }
+	       void sign_fwd(int x, int y);
+	       void abs_fwd(int x, int y);
+	inline void power_fwd(int x, int y, int p) { t[y].i()=t[x].i() * p * pow(d[x].i(), p-1); }
+	inline void sqr_fwd(int x, int y)         { t[y].i()=t[x].i() * 2.0 * d[x].i(); }
+	inline void sqrt_fwd(int x, int y)        { t[y].i()=t[x].i() * 0.5 / sqrt(d[x].i()); }
+	inline void exp_fwd(int x, int y)         { t[y].i()=t[x].i() * exp(d[x].i()); }
+	inline void log_fwd(int x, int y)         { t[y].i()=t[x].i() / d[x].i(); }
+	inline void cos_fwd(int x, int y)         { t[y].i()=t[x].i() * -sin(d[x].i()); }
+	inline void sin_fwd(int x, int y)         { t[y].i()=t[x].i() * cos(d[x].i()); }
+	inline void tan_fwd(int x, int y)         { t[y].i()=t[x].i() * (1.0 + sqr(tan(d[x].i()))); }
+	inline void cosh_fwd(int x, int y)        { t[y].i()=t[x].i() * sinh(d[x].i()); }
+	inline void sinh_fwd(int x, int y)        { t[y].i()=t[x].i() * cosh(d[x].i()); }
+	inline void tanh_fwd(int x, int y)        { t[y].i()=t[x].i() * (1.0 - sqr(tanh(d[x].i()))); }
+	inline void acos_fwd(int x, int y)        { t[y].i()=t[x].i() * -1.0 / sqrt(1.0-sqr(d[x].i())); }
+	inline void asin_fwd(int x, int y)        { t[y].i()=t[x].i() * 1.0 / sqrt(1.0-sqr(d[x].i())); }
+	inline void atan_fwd(int x, int y)        { t[y].i()=t[x].i() * 1.0 / (1.0+sqr(d[x].i())); }
+	inline void acosh_fwd(int x, int y)       { t[y].i()=t[x].i() * 1.0 / sqrt(sqr(d[x].i()) -1.0); }
+	inline void asinh_fwd(int x, int y)       { t[y].i()=t[x].i() * 1.0 / sqrt(1.0+sqr(d[x].i())); }
+	inline void atanh_fwd(int x, int y)       { t[y].i()=t[x].i() * 1.0 / (1.0-sqr(d[x].i())); }
+	       void floor_fwd(int x, int y);
+	       void ceil_fwd(int x, int y);
+	       void saw_fwd(int x, int y);
+	inline void add_V_fwd(int x1, int x2, int y)  { t[y].v()=t[x1].v()+t[x2].v(); }
+	inline void add_M_fwd(int x1, int x2, int y)  { t[y].m()=t[x1].m()+t[x2].m(); }
+	inline void mul_SV_fwd(int x1, int x2, int y) { t[y].v()=t[x1].i()*d[x2].v()+d[x1].i()*t[x2].v(); }
+	inline void mul_SM_fwd(int x1, int x2, int y) { t[y].m()=t[x1].i()*d[x2].m()+d[x1].i()*t[x2].m(); }
+	inline void mul_VV_fwd(int x1, int x2, int y) { t[y].i()=t[x1].v()*d[x2].v()+d[x1].v()*t[x2].v(); }
+	inline void mul_MV_fwd(int x1, int x2, int y) { t[y].v()=t[x1].m()*d[x2].v()+d[x1].m()*t[x2].v(); }
+	inline void mul_VM_fwd(int x1, int x2, int y) { t[y].v()=t[x1].v()*d[x2].m()+d[x1].v()*t[x2].m(); }
+	inline void mul_MM_fwd(int x1, int x2, int y) { t[y].m()=t[x1].m()*d[x2].m()+d[x1].m()*t[x2].m(); }
+	inline void sub_V_fwd(int x1, int x2, int y)  { t[y].v()=t[x1].v()-t[x2].v(); }
+	inline void sub_M_fwd(int x1, int x2, int y)  { t[y].m()=t[x1].m()-t[x2].m(); }
+
+	Function& f;
+	Eval& _eval;
+	ExprDomain& d;
+	// The tangent of each node (derivative
+	// of the node in the direction of the seed)
+	ExprDomain  t;
+
+private:
+	// evaluate the components in rows (all the components if f is not a
+	// vector of expressions) and select the nodes of the next sweeps.
+	// Return false if the result is empty.
+	bool eval(const IntervalVector& box, const BitSet& rows);
+
+	// true if the kth color has an entry in one of the rows
+	bool in_rows(int k, const BitSet& rows) const;
+
+	// forward sweep with the seed e_{j1}+e_{j2}+...
+	// (for all the variables j_k in cols)
+	void sweep(const std::vector<int>& cols);
+
+	// tangent of the ith component of f (after a sweep)
+	const Interval& tangent(int i) const;
+
+	bool supported;
+
+	std::vector<std::vector<int> > _pattern;
+
+	// color of each variable
+	std::vector<int> _color;
+
+	// variables of each color
+	std::vector<std::vector<int> > seeds;
+
+	// entries (i,j) of the pattern with the variable j
+	// of a given color
+	std::vector<std::vector<std::pair<int,int> > > entries;
+
+	// number of nodes visited by the backward sweep
+	// of each component (in reverse mode)
+	std::vector<int> cone_size;
+
+	// row of J of each component (-1 if none)
+	int* row_of;
+
+	// nodes the rows of the current Jacobian depend on
+	// (NULL if f is not a vector of expressions: all the nodes)
+	Agenda* agenda;
+
+	IntervalVector seed;
+	std::vector<int> one_col;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline bool CompressedJacobian::is_supported() const {
+	return supported;
+}
+
+inline const std::vector<std::vector<int> >& CompressedJacobian::pattern() const {
+	return _pattern;
+}
+
+inline int CompressedJacobian::nb_colors() const {
+	return seeds.size();
+}
+
+inline int CompressedJacobian::color(int j) const {
+	return _color[j];
+}
+
+} // namespace ibex
+
+#endif // __IBEX_COMPRESSED_JACOBIAN_H__
@@ -7,11 +7,12 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Jan 14, 2012
- * Last update : Jul 10, 2019
+ * Last update : Oct 17, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "ibex_Function.h"
 #include "ibex_Eval.h"
+#include "ibex_EvalContext.h"
 
 #include <typeinfo>
 
@@ -19,7 +20,7 @@ using namespace std;
 
 namespace ibex {
 
-Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL), matrix_fwd_agenda(NULL), matrix_bwd_agenda(NULL) {
+Eval::Eval(EvalContext& c) : f(c.f), ctx(c), d(c.f), fwd_agenda(NULL), bwd_agenda(NULL), matrix_fwd_agenda(NULL), matrix_bwd_agenda(NULL) {
 
 	Dim dim=f.expr().dim;
 	int m=dim.vec_size();
@@ -160,7 +161,7 @@ Domain Eval::eval(const IntervalVector& box, const BitSet& components) {
 		// so we resort to the components functions f[i] --> symbolic copy+no DAG :(
 		int i=0;
 		for (BitSet::const_iterator c=components.begin(); c!=components.end(); ++c) {
-			res[i++] = f[c].eval_domain(box);
+			res[i++] = ctx.comp(c).eval_domain(box);
 		}
 		assert(i==m);
 
@@ -225,7 +226,7 @@ Domain Eval::eval(const IntervalVector& box, const BitSet& rows, const BitSet& c
 		for (BitSet::const_iterator r=rows.begin(); r!=rows.end(); ++r, i++) {
 				int j=0;
 				for (BitSet::const_iterator c=cols.begin(); c!=cols.end(); ++c, j++) {
-					res[i][j] = f[r][c].eval_domain(box);
+					res[i][j] = ctx.comp(r).comp(c).eval_domain(box);
 				}
 				assert(j==n);
 		}
@@ -280,7 +281,7 @@ void Eval::apply_fwd(int* x, int y) {
 		d2.set_ref(i,d[x[i]]);
 	}
 
-	d[y] = a.func.basic_evaluator().eval(d2);
+	d[y] = ctx.sub(a.func).eval_domain(d2);
 }
 
 void Eval::vector_fwd(int* x, int y) {
@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Jan 14, 2012
- * Last update : Jul 10, 2019
+ * Last update : Oct 17, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __IBEX_EVAL_H__
@@ -20,6 +20,7 @@
 namespace ibex {
 
 class Function;
+class EvalContext;
 
 /**
  * \ingroup symbolic
@@ -31,9 +32,12 @@ class Eval : public FwdAlgorithm {
 
 public:
 	/**
-	 * \brief Build the evaluator for the function f.
+	 * \brief Build the evaluator for the function of a context.
+	 *
+	 * The domains are specific to this evaluator; sub-functions and
+	 * components are evaluated in the sub-contexts of \a c.
 	 */
-	Eval(Function &f);
+	Eval(EvalContext& c);
 
 	/**
 	 * \brief Delete this.
@@ -139,6 +143,7 @@ public: // because called from CompiledFunction
 	inline void sub_M_fwd  (int x1, int x2, int y);
 
 	Function& f;
+	EvalContext& ctx;
 	ExprDomain d;
 	Agenda** fwd_agenda;         // one agenda for each vector component/matrix row
 	Agenda** bwd_agenda;         // one agenda for each vector component/matrix row
@@ -0,0 +1,191 @@
+/* ============================================================================
+ * I B E X - Evaluation of a function on several boxes
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Function.h"
+#include "ibex_EvalBatch.h"
+#include "ibex_EvalContext.h"
+#include "ibex_ExprOperators.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// true if all the arguments of e are scalar
+bool scalar_args(const ExprNode& e) {
+	if (const ExprBinaryOp* b=dynamic_cast<const ExprBinaryOp*>(&e))
+		return b->left.dim.is_scalar() && b->right.dim.is_scalar();
+	else if (const ExprUnaryOp* u=dynamic_cast<const ExprUnaryOp*>(&e))
+		return u->expr.dim.is_scalar();
+	else if (const ExprNAryOp* a=dynamic_cast<const ExprNAryOp*>(&e)) {
+		for (int i=0; i<a->nb_args; i++)
+			if (!a->arg(i).dim.is_scalar()) return false;
+		return true;
+	} else
+		return true;
+}
+
+}
+
+EvalBatch::EvalBatch(EvalContext& c) : f(c.f), ctx(c), batch(true), n(f.nodes.size()), pos(new int[n]),
+		K(0), capacity(0), buf(NULL), empty(NULL) {
+
+	// Nodes that are symbols or (possibly nested) indices of a symbol
+	// with a reference to the symbol domain.
+	bool* var = new bool[n];
+
+	// Leaves have the highest ranks.
+	for (int i=n-1; i>=0; i--) {
+		const ExprNode& e=f.node(i);
+		pos[i]=-1;
+		var[i]=false;
+
+		if (dynamic_cast<const ExprSymbol*>(&e)) {
+			var[i]=true;
+		} else if (const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&e)) {
+			var[i]=idx->index.domain_ref() && var[f.nodes.rank(idx->expr)];
+			if (!var[i]) batch=false;
+		} else if (const ExprVector* vec=dynamic_cast<const ExprVector*>(&e)) {
+			if (i>0 || !scalar_args(e)) batch=false;
+			else
+				for (int j=0; j<vec->nb_args; j++)
+					root_args.push_back(f.nodes.rank(vec->arg(j)));
+		} else if (!e.dim.is_scalar() || !scalar_args(e)
+				|| dynamic_cast<const ExprApply*>(&e)
+				|| dynamic_cast<const ExprGenericUnaryOp*>(&e)
+				|| dynamic_cast<const ExprGenericBinaryOp*>(&e)
+				|| dynamic_cast<const ExprTrans*>(&e)) {
+			batch=false;
+		}
+	}
+
+	if (batch) {
+		// Get the position in the box of each scalar variable node
+		// by loading the "box" (0,1,2,...) in a domain of the function.
+		ExprDomain d(f);
+		IntervalVector probe(f.nb_var());
+		for (int j=0; j<f.nb_var(); j++) probe[j]=Interval(j);
+		d.write_arg_domains(probe);
+
+		for (int i=0; i<n; i++) {
+			if (var[i] && f.node(i).dim.is_scalar()) {
+				const Interval& p=d[i].i();
+				// note: unused symbols are not loaded
+				if (p.is_degenerated() && p.lb()>=0 && p.lb()<f.nb_var())
+					pos[i]=(int) p.lb();
+			}
+		}
+	}
+
+	delete[] var;
+}
+
+EvalBatch::~EvalBatch() {
+	delete[] pos;
+	delete[] buf;
+	delete[] empty;
+}
+
+void EvalBatch::cst_fwd(int y) {
+	const ExprConstant& c = (const ExprConstant&) f.node(y);
+	Interval* _y=lanes(y);
+	for (int k=0; k<K; k++) _y[k]=c.get_value();
+}
+
+template<class V>
+void EvalBatch::forward(const vector<V>& x) {
+	K=x.size();
+
+	if (K>capacity) {
+		delete[] buf;
+		delete[] empty;
+		buf=new Interval[n*K];
+		empty=new bool[K];
+		capacity=K;
+	}
+
+	for (int k=0; k<K; k++) empty[k]=false;
+
+	for (int i=0; i<n; i++) {
+		if (pos[i]!=-1) {
+			Interval* _y=lanes(i);
+			for (int k=0; k<K; k++) _y[k]=x[k][pos[i]];
+		}
+	}
+
+	f.forward<EvalBatch>(*this);
+}
+
+template<class V>
+vector<Interval> EvalBatch::_eval(const vector<V>& x) {
+	vector<Interval> res;
+	res.reserve(x.size());
+
+	if (!batch) {
+		for (typename vector<V>::const_iterator it=x.begin(); it!=x.end(); ++it)
+			res.push_back(ctx.eval(*it));
+		return res;
+	}
+
+	forward(x);
+
+	const Interval* y=lanes(0);
+	for (int k=0; k<K; k++)
+		res.push_back(empty[k] ? Interval::empty_set() : y[k]);
+	return res;
+}
+
+template<class V>
+vector<IntervalVector> EvalBatch::_eval_vector(const vector<V>& x) {
+	vector<IntervalVector> res;
+	res.reserve(x.size());
+
+	if (!batch || (root_args.empty() && !f.expr().dim.is_scalar())) {
+		for (typename vector<V>::const_iterator it=x.begin(); it!=x.end(); ++it)
+			res.push_back(ctx.eval_vector(*it));
+		return res;
+	}
+
+	forward(x);
+
+	int m=root_args.empty() ? 1 : root_args.size();
+
+	for (int k=0; k<K; k++) {
+		res.push_back(IntervalVector(m));
+		if (empty[k])
+			res.back().set_empty();
+		else if (root_args.empty())
+			res.back()[0]=lanes(0)[k];
+		else
+			for (int j=0; j<m; j++)
+				res.back()[j]=lanes(root_args[j])[k];
+	}
+	return res;
+}
+
+vector<Interval> EvalBatch::eval(const vector<IntervalVector>& boxes) {
+	return _eval(boxes);
+}
+
+vector<Interval> EvalBatch::eval(const vector<Vector>& points) {
+	return _eval(points);
+}
+
+vector<IntervalVector> EvalBatch::eval_vector(const vector<IntervalVector>& boxes) {
+	return _eval_vector(boxes);
+}
+
+vector<IntervalVector> EvalBatch::eval_vector(const vector<Vector>& points) {
+	return _eval_vector(points);
+}
+
+} // namespace ibex
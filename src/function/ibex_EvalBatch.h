@@ -0,0 +1,306 @@
+/* ============================================================================
+ * I B E X - Evaluation of a function on several boxes
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_EVAL_BATCH_H__
+#define __IBEX_EVAL_BATCH_H__
+
+#include <vector>
+
+#include "ibex_FwdAlgorithm.h"
+#include "ibex_IntervalVector.h"
+#include "ibex_Vector.h"
+
+namespace ibex {
+
+class Function;
+class EvalContext;
+
+/**
+ * \ingroup function
+ *
+ * \brief Evaluation of a function on several boxes at once.
+ *
+ * Evaluating a function on K boxes with #Eval means traversing K times
+ * the compiled expression. This evaluator traverses it only once: the
+ * domain of each node is an array of K intervals (one "lane" per box)
+ * and each operation is applied to the K lanes in a row. This amortizes
+ * the dispatch on the operation type and makes the inner loops
+ * vectorizable (see the SIMD interval library).
+ *
+ * The result for each box is the same as with #Eval (in particular, the
+ * result is empty if the box is outside the definition domain of f).
+ *
+ * Only expressions made of scalar operations are evaluated this way,
+ * i.e., functions where variables appear through scalar components
+ * (like x or x[i] or x[i][j]) and whose result is either a scalar or a
+ * vector of scalar expressions (this is the case of all functions built
+ * from a Minibex system). Otherwise (vector/matrix operations, calls to
+ * other functions, generic operators), the boxes are simply evaluated one
+ * by one with #Eval.
+ */
+class EvalBatch : public FwdAlgorithm {
+
+public:
+	/**
+	 * \brief Build the batch evaluator for the function of a context.
+	 */
+	EvalBatch(EvalContext& c);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~EvalBatch();
+
+	/**
+	 * \brief True if the boxes can be evaluated in one sweep.
+	 *
+	 * If false, the evaluation is performed box by box.
+	 */
+	bool is_batch() const;
+
+	/**
+	 * \brief Evaluate a real-valued function on each box.
+	 */
+	std::vector<Interval> eval(const std::vector<IntervalVector>& boxes);
+
+	/**
+	 * \brief Evaluate a real-valued function on each point.
+	 */
+	std::vector<Interval> eval(const std::vector<Vector>& points);
+
+	/**
+	 * \brief Evaluate a vector-valued function on each box.
+	 */
+	std::vector<IntervalVector> eval_vector(const std::vector<IntervalVector>& boxes);
+
+	/**
+	 * \brief Evaluate a vector-valued function on each point.
+	 */
+	std::vector<IntervalVector> eval_vector(const std::vector<Vector>& points);
+
+public: // because called from CompiledFunction
+
+	inline void idx_fwd    (int x, int y);
+	inline void idx_cp_fwd (int x, int y);
+	inline void symbol_fwd (int y);
+	       void cst_fwd    (int y);
+	inline void vector_fwd (int* x, int y);
+	inline void apply_fwd  (int* x, int y);
+	inline void chi_fwd    (int x1, int x2, int x3, int y);
+	inline void gen2_fwd   (int x, int x2, int y);
+	inline void add_fwd    (int x1, int x2, int y);
+	inline void mul_fwd    (int x1, int x2, int y);
+	inline void sub_fwd    (int x1, int x2, int y);
+	inline void div_fwd    (int x1, int x2, int y);
+	inline void max_fwd    (int x1, int x2, int y);
+	inline void min_fwd    (int x1, int x2, int y);
+	inline void atan2_fwd  (int x1, int x2, int y);
+	inline void gen1_fwd   (int x, int y);
+	inline void minus_fwd  (int x, int y);
+	inline void minus_V_fwd(int x, int y);
+	inline void minus_M_fwd(int x, int y);
+	inline void trans_V_fwd(int x, int y);
+	inline void trans_M_fwd(int x, int y);
+	inline void sign_fwd   (int x, int y);
+	inline void abs_fwd    (int x, int y);
+	inline void power_fwd  (int x, int y, int p);
+	inline void sqr_fwd    (int x, int y);
+	inline void sqrt_fwd   (int x, int y);
+	inline void exp_fwd    (int x, int y);
+	inline void log_fwd    (int x, int y);
+	inline void cos_fwd    (int x, int y);
+	inline void sin_fwd    (int x, int y);
+	inline void tan_fwd    (int x, int y);
+	inline void cosh_fwd   (int x, int y);
+	inline void sinh_fwd   (int x, int y);
+	inline void tanh_fwd   (int x, int y);
+	inline void acos_fwd   (int x, int y);
+	inline void asin_fwd   (int x, int y);
+	inline void atan_fwd   (int x, int y);
+	inline void acosh_fwd  (int x, int y);
+	inline void asinh_fwd  (int x, int y);
+	inline void atanh_fwd  (int x, int y);
+	inline void floor_fwd  (int x, int y);
+	inline void ceil_fwd   (int x, int y);
+	inline void saw_fwd    (int x, int y);
+	inline void add_V_fwd  (int x1, int x2, int y);
+	inline void add_M_fwd  (int x1, int x2, int y);
+	inline void mul_SV_fwd (int x1, int x2, int y);
+	inline void mul_SM_fwd (int x1, int x2, int y);
+	inline void mul_VV_fwd (int x1, int x2, int y);
+	inline void mul_MV_fwd (int x1, int x2, int y);
+	inline void mul_VM_fwd (int x1, int x2, int y);
+	inline void mul_MM_fwd (int x1, int x2, int y);
+	inline void sub_V_fwd  (int x1, int x2, int y);
+	inline void sub_M_fwd  (int x1, int x2, int y);
+
+	Function& f;
+	EvalContext& ctx;
+
+private:
+	EvalBatch(const EvalBatch&);              // forbidden
+	EvalBatch& operator=(const EvalBatch&);   // forbidden
+
+	/*
+	 * Write the input lanes and run the forward algorithm.
+	 */
+	template<class V>
+	void forward(const std::vector<V>& x);
+
+	/*
+	 * Implementation of eval(boxes) and eval(points).
+	 */
+	template<class V>
+	std::vector<Interval> _eval(const std::vector<V>& x);
+
+	/*
+	 * Implementation of eval_vector(boxes) and eval_vector(points).
+	 */
+	template<class V>
+	std::vector<IntervalVector> _eval_vector(const std::vector<V>& x);
+
+	/*
+	 * Lanes of the ith node.
+	 */
+	Interval* lanes(int i);
+
+	/*
+	 * Set the lane k to empty if y[k] is empty.
+	 */
+	void check_empty(const Interval* y);
+
+	// true if the boxes can be evaluated in one sweep
+	bool batch;
+
+	// number of nodes
+	int n;
+
+	// position of the variable in the box, for scalar symbol or
+	// (index of symbol) nodes. -1 for other nodes.
+	int* pos;
+
+	// Ranks of the components of the result
+	// (when the root node is a vector).
+	std::vector<int> root_args;
+
+	// current number of lanes (K)
+	int K;
+
+	// maximal number of lanes allocated so far
+	int capacity;
+
+	// the lanes of all nodes (K consecutive intervals for each node)
+	Interval* buf;
+
+	// empty[k] is true if the box n°k is outside the definition domain
+	bool* empty;
+};
+
+/* ============================================================================
+ 	 	 	 	 	 	 	 implementation
+  ============================================================================*/
+
+inline bool EvalBatch::is_batch() const {
+	return batch;
+}
+
+inline Interval* EvalBatch::lanes(int i) {
+	return buf+i*K;
+}
+
+inline void EvalBatch::check_empty(const Interval* y) {
+	for (int k=0; k<K; k++)
+		if (y[k].is_empty()) empty[k]=true;
+}
+
+inline void EvalBatch::idx_fwd(int, int)     { /* lanes are written before the forward phase */ }
+inline void EvalBatch::idx_cp_fwd(int, int)  { /* lanes are written before the forward phase */ }
+inline void EvalBatch::symbol_fwd(int)       { /* lanes are written before the forward phase */ }
+inline void EvalBatch::vector_fwd(int*, int) { /* the result is read directly in the arguments */ }
+
+inline void EvalBatch::apply_fwd(int*, int)                 { assert(false); /* not in batch mode */ }
+inline void EvalBatch::gen1_fwd(int, int)                   { assert(false); /* not in batch mode */ }
+inline void EvalBatch::gen2_fwd(int, int, int)              { assert(false); /* not in batch mode */ }
+inline void EvalBatch::minus_V_fwd(int, int)                { assert(false); /* not in batch mode */ }
+inline void EvalBatch::minus_M_fwd(int, int)                { assert(false); /* not in batch mode */ }
+inline void EvalBatch::trans_V_fwd(int, int)                { assert(false); /* not in batch mode */ }
+inline void EvalBatch::trans_M_fwd(int, int)                { assert(false); /* not in batch mode */ }
+inline void EvalBatch::add_V_fwd(int, int, int)             { assert(false); /* not in batch mode */ }
+inline void EvalBatch::add_M_fwd(int, int, int)             { assert(false); /* not in batch mode */ }
+inline void EvalBatch::mul_SV_fwd(int, int, int)            { assert(false); /* not in batch mode */ }
+inline void EvalBatch::mul_SM_fwd(int, int, int)            { assert(false); /* not in batch mode */ }
+inline void EvalBatch::mul_VV_fwd(int, int, int)            { assert(false); /* not in batch mode */ }
+inline void EvalBatch::mul_MV_fwd(int, int, int)            { assert(false); /* not in batch mode */ }
+inline void EvalBatch::mul_VM_fwd(int, int, int)            { assert(false); /* not in batch mode */ }
+inline void EvalBatch::mul_MM_fwd(int, int, int)            { assert(false); /* not in batch mode */ }
+inline void EvalBatch::sub_V_fwd(int, int, int)             { assert(false); /* not in batch mode */ }
+inline void EvalBatch::sub_M_fwd(int, int, int)             { assert(false); /* not in batch mode */ }
+
+#define _IBEX_BATCH_UNARY(expr) { \
+	const Interval* _x=lanes(x); Interval* _y=lanes(y); \
+	for (int k=0; k<K; k++) _y[k]=expr; \
+}
+
+#define _IBEX_BATCH_UNARY_DOM(expr) { \
+	const Interval* _x=lanes(x); Interval* _y=lanes(y); \
+	for (int k=0; k<K; k++) _y[k]=expr; \
+	check_empty(_y); \
+}
+
+#define _IBEX_BATCH_BINARY(expr) { \
+	const Interval* _x1=lanes(x1); const Interval* _x2=lanes(x2); Interval* _y=lanes(y); \
+	for (int k=0; k<K; k++) _y[k]=expr; \
+}
+
+inline void EvalBatch::chi_fwd(int x1, int x2, int x3, int y) {
+	const Interval* _x1=lanes(x1); const Interval* _x2=lanes(x2); const Interval* _x3=lanes(x3); Interval* _y=lanes(y);
+	for (int k=0; k<K; k++) _y[k]=chi(_x1[k],_x2[k],_x3[k]);
+}
+
+inline void EvalBatch::add_fwd(int x1, int x2, int y)   _IBEX_BATCH_BINARY(_x1[k]+_x2[k])
+inline void EvalBatch::mul_fwd(int x1, int x2, int y)   _IBEX_BATCH_BINARY(_x1[k]*_x2[k])
+inline void EvalBatch::sub_fwd(int x1, int x2, int y)   _IBEX_BATCH_BINARY(_x1[k]-_x2[k])
+inline void EvalBatch::div_fwd(int x1, int x2, int y)   _IBEX_BATCH_BINARY(_x1[k]/_x2[k])
+inline void EvalBatch::max_fwd(int x1, int x2, int y)   _IBEX_BATCH_BINARY(max(_x1[k],_x2[k]))
+inline void EvalBatch::min_fwd(int x1, int x2, int y)   _IBEX_BATCH_BINARY(min(_x1[k],_x2[k]))
+inline void EvalBatch::atan2_fwd(int x1, int x2, int y) _IBEX_BATCH_BINARY(atan2(_x1[k],_x2[k]))
+
+inline void EvalBatch::minus_fwd(int x, int y)          _IBEX_BATCH_UNARY(-_x[k])
+inline void EvalBatch::sign_fwd(int x, int y)           _IBEX_BATCH_UNARY(sign(_x[k]))
+inline void EvalBatch::abs_fwd(int x, int y)            _IBEX_BATCH_UNARY(abs(_x[k]))
+inline void EvalBatch::power_fwd(int x, int y, int p)   _IBEX_BATCH_UNARY(pow(_x[k],p))
+inline void EvalBatch::sqr_fwd(int x, int y)            _IBEX_BATCH_UNARY(sqr(_x[k]))
+inline void EvalBatch::sqrt_fwd(int x, int y)           _IBEX_BATCH_UNARY_DOM(sqrt(_x[k]))
+inline void EvalBatch::exp_fwd(int x, int y)            _IBEX_BATCH_UNARY(exp(_x[k]))
+inline void EvalBatch::log_fwd(int x, int y)            _IBEX_BATCH_UNARY_DOM(log(_x[k]))
+inline void EvalBatch::cos_fwd(int x, int y)            _IBEX_BATCH_UNARY(cos(_x[k]))
+inline void EvalBatch::sin_fwd(int x, int y)            _IBEX_BATCH_UNARY(sin(_x[k]))
+inline void EvalBatch::tan_fwd(int x, int y)            _IBEX_BATCH_UNARY_DOM(tan(_x[k]))
+inline void EvalBatch::cosh_fwd(int x, int y)           _IBEX_BATCH_UNARY(cosh(_x[k]))
+inline void EvalBatch::sinh_fwd(int x, int y)           _IBEX_BATCH_UNARY(sinh(_x[k]))
+inline void EvalBatch::tanh_fwd(int x, int y)           _IBEX_BATCH_UNARY(tanh(_x[k]))
+inline void EvalBatch::acos_fwd(int x, int y)           _IBEX_BATCH_UNARY_DOM(acos(_x[k]))
+inline void EvalBatch::asin_fwd(int x, int y)           _IBEX_BATCH_UNARY_DOM(asin(_x[k]))
+inline void EvalBatch::atan_fwd(int x, int y)           _IBEX_BATCH_UNARY(atan(_x[k]))
+inline void EvalBatch::acosh_fwd(int x, int y)          _IBEX_BATCH_UNARY_DOM(acosh(_x[k]))
+inline void EvalBatch::asinh_fwd(int x, int y)          _IBEX_BATCH_UNARY(asinh(_x[k]))
+inline void EvalBatch::atanh_fwd(int x, int y)          _IBEX_BATCH_UNARY_DOM(atanh(_x[k]))
+inline void EvalBatch::floor_fwd(int x, int y)          _IBEX_BATCH_UNARY_DOM(floor(_x[k]))
+inline void EvalBatch::ceil_fwd(int x, int y)           _IBEX_BATCH_UNARY_DOM(ceil(_x[k]))
+inline void EvalBatch::saw_fwd(int x, int y)            _IBEX_BATCH_UNARY_DOM(saw(_x[k]))
+
+#undef _IBEX_BATCH_UNARY
+#undef _IBEX_BATCH_UNARY_DOM
+#undef _IBEX_BATCH_BINARY
+
+} // namespace ibex
+
+#endif // __IBEX_EVAL_BATCH_H__
@@ -0,0 +1,194 @@
+/* ============================================================================
+ * I B E X - Evaluation context of a function
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Function.h"
+#include "ibex_EvalContext.h"
+
+#ifndef _WIN32 // MinGW does not support mutex
+#include <mutex>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+#ifndef _WIN32
+// The components of a function are generated on demand (see Function::operator[]).
+// This lock prevents two contexts from generating them at the same time.
+std::mutex comp_mutex;
+#endif
+
+// number of components of a vector/matrix-valued function
+int nb_comp(const Function& f) {
+	const Dim& dim=f.expr().dim;
+	return dim.is_vector() ? dim.vec_size() : dim.nb_rows();
+}
+
+}
+
+EvalContext::EvalContext(const Function& f) : EvalContext((Function&) f, false) {
+
+}
+
+EvalContext::EvalContext(Function& f, bool is_default) : f(f), is_default(is_default),
+		_eval(NULL), _batch(NULL), _hc4revise(NULL), _grad(NULL), _hessian(NULL), _inhc4revise(NULL), _comp(NULL) {
+	init();
+}
+
+void EvalContext::init() {
+	_eval = new Eval(*this);
+	_hc4revise = new HC4Revise(*_eval);
+	_grad = new Gradient(*_eval);
+	_inhc4revise = new InHC4Revise(*_eval);
+}
+
+EvalContext::~EvalContext() {
+	delete _inhc4revise;
+	delete _hessian;
+	delete _grad;
+	delete _hc4revise;
+	delete _batch;
+	delete _eval;
+
+	if (_comp!=NULL) {
+		for (int i=0; i<nb_comp(f); i++)
+			if (_comp[i]!=this) delete _comp[i];
+		delete[] _comp;
+	}
+
+	for (map<const Function*, EvalContext*>::iterator it=_sub.begin(); it!=_sub.end(); ++it)
+		delete it->second;
+}
+
+IntervalVector EvalContext::eval_vector(const IntervalVector& box) {
+	const Dim& dim=f.expr().dim;
+	assert(!dim.is_matrix());
+	return dim.is_scalar() ? IntervalVector(1,eval(box)) :
+			f._native ? f._native->eval_vector(box) : _eval->eval(box).v();
+}
+
+IntervalMatrix EvalContext::eval_matrix(const IntervalVector& box) {
+	const Dim& dim=f.expr().dim;
+
+	IntervalMatrix M(dim.nb_rows(),dim.nb_cols());
+
+	switch (dim.type()) {
+	case Dim::SCALAR     : M[0][0]=eval(box);        break;
+	case Dim::ROW_VECTOR : M.set_row(0,eval_vector(box)); break;
+	case Dim::COL_VECTOR : M.set_col(0,eval_vector(box)); break;
+	default              : M=_eval->eval(box).m();
+	}
+
+	return M;
+}
+
+void EvalContext::native_jacobian(const IntervalVector& x, IntervalMatrix& J, int v) {
+	if (v==-1) {
+		f._native->jacobian(x,J);
+		return;
+	}
+
+	// only the vth column is updated
+	IntervalMatrix J2(J.nb_rows(),J.nb_cols());
+	f._native->jacobian(x,J2);
+	if (J2.is_empty())
+		J.set_empty();
+	else
+		J.set_col(v,J2.col(v));
+}
+
+void EvalContext::jacobian(const IntervalVector& x, SparseIntervalMatrix& J) {
+	if (f._native)
+		f.Fnc::jacobian(x,J); // dense native code
+	else
+		_grad->jacobian(x,J);
+}
+
+void EvalContext::hansen_matrix(const IntervalVector& x, const IntervalVector& x0, SparseIntervalMatrix& H) {
+	if (f._native)
+		f.Fnc::hansen_matrix(x,x0,H); // dense native code
+	else
+		_grad->hansen_matrix(x,x0,H);
+}
+
+void EvalContext::hessian(const IntervalVector& x, const IntervalVector& w, IntervalMatrix& H, const BitSet& components, int v) {
+	assert(!components.empty());
+	assert(w.size()==components.size());
+
+	if (components.size()==nb_comp(f)) {
+		hessian(x,w,H,v);
+		return;
+	}
+
+	// The selected components are differentiated separately
+	// so that the other ones are not evaluated.
+	IntervalMatrix Hc(H.nb_rows(),H.nb_cols());
+	int i=0;
+	for (BitSet::const_iterator c=components.begin(); c!=components.end(); ++c, ++i) {
+		comp(c).hessian(x, IntervalVector(1,w[i]), Hc, v);
+
+		if (Hc.is_empty()) { // note: all the entries are empty in this case
+			H.set_empty();
+			return;
+		}
+
+		if (v==-1) {
+			if (i==0) H=Hc;
+			else H+=Hc;
+		} else {
+			if (i==0) H.set_col(v,Hc.col(v));
+			else H.set_col(v,H.col(v)+Hc.col(v));
+		}
+	}
+}
+
+Function& EvalContext::comp_function(int i) {
+#ifndef _WIN32
+	lock_guard<mutex> lock(comp_mutex);
+#endif
+	return f[i];
+}
+
+EvalContext& EvalContext::comp(int i) {
+
+	// note: another (thread-local) context may be generating the
+	// components at the same time.
+	if (is_default) return *comp_function(i)._ctx;
+
+	if (_comp==NULL) {
+		int m=nb_comp(f);
+		_comp = new EvalContext*[m];
+		for (int j=0; j<m; j++) _comp[j]=NULL;
+	}
+
+	if (_comp[i]==NULL) {
+		Function* fi=&comp_function(i);
+		// note: if f has only one component, f[0] is f itself
+		_comp[i] = fi==&f ? this : new EvalContext(*fi,false);
+	}
+
+	return *_comp[i];
+}
+
+EvalContext& EvalContext::sub(const Function& g) {
+
+	if (is_default) return *g._ctx;
+
+	map<const Function*, EvalContext*>::iterator it=_sub.find(&g);
+	if (it!=_sub.end())
+		return *it->second;
+	else
+		return *(_sub[&g] = new EvalContext((Function&) g,false));
+}
+
+} // end namespace ibex
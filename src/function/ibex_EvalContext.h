@@ -0,0 +1,409 @@
+/* ============================================================================
+ * I B E X - Evaluation context of a function
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_EVAL_CONTEXT_H__
+#define __IBEX_EVAL_CONTEXT_H__
+
+#include "ibex_Eval.h"
+#include "ibex_EvalBatch.h"
+#include "ibex_HC4Revise.h"
+#include "ibex_Gradient.h"
+#include "ibex_Hessian.h"
+#include "ibex_InHC4Revise.h"
+#include "ibex_NativeCode.h"
+
+#include <map>
+
+namespace ibex {
+
+class Function;
+
+/**
+ * \ingroup function
+ *
+ * \brief Evaluation context of a function.
+ *
+ * The forward/backward algorithms of a function (evaluation, HC4Revise,
+ * gradient, inner projection) store intermediate results in domains attached
+ * to the nodes of the expression (see #ExprDomain). These domains are
+ * scratch memory written on every call, so the algorithms called through
+ * the #Function interface (f.eval(x), f.backward(y,x), f.gradient(x), ...)
+ * cannot be used from two threads at the same time.
+ *
+ * An evaluation context gathers a separate copy of this scratch memory
+ * (with its own Eval, HC4Revise, Gradient and InHC4Revise objects) while
+ * the compiled DAG of the function is shared read-only. Creating one context
+ * per thread allows to evaluate the same function concurrently, without
+ * copying it:
+ *
+ * \code
+ * // in each thread:
+ * EvalContext c(f);
+ * Interval y=c.eval(box);
+ * c.backward(Interval(0,1),box);
+ * \endcode
+ *
+ * Sub-functions (called in the expression of f) and components of f
+ * (in the case of a vector-valued function with heterogeneous components)
+ * get their own sub-context, created on first use.
+ *
+ * If the native code of f is loaded (see #Function::load_native), the
+ * native code is called instead (it does not use the scratch memory).
+ *
+ * \warning A context must not be used by two threads at the same time.
+ * The function f must not be modified/deleted while a context is alive.
+ */
+class EvalContext {
+public:
+
+	/**
+	 * \brief Create a new evaluation context for f.
+	 */
+	explicit EvalContext(const Function& f);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~EvalContext();
+
+	/**
+	 * \brief Evaluate f (see #Function::eval_domain(const IntervalVector&)).
+	 */
+	Domain& eval_domain(const IntervalVector& box);
+
+	/**
+	 * \brief Evaluate f (see #Function::eval_domain(const Array<const Domain>&)).
+	 */
+	Domain& eval_domain(const Array<const Domain>& d);
+
+	/**
+	 * \brief Evaluate a real-valued function (see #Function::eval(const IntervalVector&)).
+	 */
+	Interval eval(const IntervalVector& box);
+
+	/**
+	 * \brief Evaluate a vector-valued function (see #Function::eval_vector(const IntervalVector&)).
+	 */
+	IntervalVector eval_vector(const IntervalVector& box);
+
+	/**
+	 * \brief Evaluate a matrix-valued function (see #Function::eval_matrix(const IntervalVector&)).
+	 */
+	IntervalMatrix eval_matrix(const IntervalVector& box);
+
+	/**
+	 * \brief Evaluate a real-valued function on several boxes (see #Function::eval_batch(const std::vector<IntervalVector>&)).
+	 */
+	std::vector<Interval> eval_batch(const std::vector<IntervalVector>& boxes);
+
+	/**
+	 * \brief Evaluate a real-valued function on several points (see #Function::eval_batch(const std::vector<Vector>&)).
+	 */
+	std::vector<Interval> eval_batch(const std::vector<Vector>& points);
+
+	/**
+	 * \brief Evaluate a vector-valued function on several boxes (see #Function::eval_vector_batch(const std::vector<IntervalVector>&)).
+	 */
+	std::vector<IntervalVector> eval_vector_batch(const std::vector<IntervalVector>& boxes);
+
+	/**
+	 * \brief Evaluate a vector-valued function on several points (see #Function::eval_vector_batch(const std::vector<Vector>&)).
+	 */
+	std::vector<IntervalVector> eval_vector_batch(const std::vector<Vector>& points);
+
+	/**
+	 * \brief Contract x w.r.t. f(x)=y (see #Function::backward(const Domain&, IntervalVector&)).
+	 */
+	bool backward(const Domain& y, IntervalVector& x);
+
+	/**
+	 * \brief Contract x w.r.t. f(x)=y.
+	 */
+	bool backward(const Interval& y, IntervalVector& x);
+
+	/**
+	 * \brief Contract x w.r.t. f(x)=y.
+	 */
+	bool backward(const IntervalVector& y, IntervalVector& x);
+
+	/**
+	 * \brief Inner projection f(x)=y onto x.
+	 */
+	void ibwd(const Domain& y, IntervalVector& x);
+
+	/**
+	 * \brief Inner projection f(x)=y onto x, inflating xin.
+	 */
+	void ibwd(const Domain& y, IntervalVector& x, const IntervalVector& xin);
+
+	/**
+	 * \brief Calculate the gradient of a real-valued function.
+	 */
+	void gradient(const IntervalVector& x, IntervalVector& g);
+
+	/**
+	 * \brief Calculate the Jacobian matrix of a vector-valued function.
+	 *
+	 * \see #Fnc::jacobian(const IntervalVector&, IntervalMatrix&, int).
+	 */
+	void jacobian(const IntervalVector& x, IntervalMatrix& J, int v=-1);
+
+	/**
+	 * \brief Calculate some rows of the Jacobian matrix.
+	 */
+	void jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v=-1);
+
+	/**
+	 * \brief Calculate the Jacobian matrix (sparse version).
+	 *
+	 * \see #Fnc::jacobian(const IntervalVector&, SparseIntervalMatrix&).
+	 */
+	void jacobian(const IntervalVector& x, SparseIntervalMatrix& J);
+
+	/**
+	 * \brief Calculate the Hansen matrix (sparse version).
+	 *
+	 * \see #Fnc::hansen_matrix(const IntervalVector&, const IntervalVector&, SparseIntervalMatrix&).
+	 */
+	void hansen_matrix(const IntervalVector& x, const IntervalVector& x0, SparseIntervalMatrix& H);
+
+	/**
+	 * \brief Calculate the Hessian matrix of w^T f.
+	 *
+	 * \see #Function::hessian(const IntervalVector&, const IntervalVector&, IntervalMatrix&, int).
+	 */
+	void hessian(const IntervalVector& x, const IntervalVector& w, IntervalMatrix& H, int v=-1);
+
+	/**
+	 * \brief Calculate the Hessian matrix of w^T f_I (some components of f).
+	 *
+	 * \see #Function::hessian(const IntervalVector&, const IntervalVector&, IntervalMatrix&, const BitSet&, int).
+	 */
+	void hessian(const IntervalVector& x, const IntervalVector& w, IntervalMatrix& H, const BitSet& components, int v=-1);
+
+	/**
+	 * \brief Calculate the product of the Hessian matrix of w^T f by u.
+	 *
+	 * \see #Function::hessian_vector(const IntervalVector&, const IntervalVector&, const IntervalVector&, IntervalVector&).
+	 */
+	void hessian_vector(const IntervalVector& x, const IntervalVector& w, const IntervalVector& u, IntervalVector& Hu);
+
+	/**
+	 * \brief The evaluator of this context.
+	 */
+	Eval& basic_evaluator();
+
+	/**
+	 * \brief The batch evaluator of this context (created on first use).
+	 */
+	EvalBatch& batch_evaluator();
+
+	/**
+	 * \brief The gradient calculator of this context.
+	 */
+	Gradient& deriv_calculator();
+
+	/**
+	 * \brief The Hessian calculator of this context (created on first use).
+	 */
+	Hessian& hessian_calculator();
+
+	/**
+	 * \brief The HC4Revise algorithm of this context.
+	 */
+	HC4Revise& hc4revise();
+
+	/**
+	 * \brief The InHC4Revise algorithm of this context.
+	 */
+	InHC4Revise& inhc4revise();
+
+	/**
+	 * \brief Context of the ith component of f.
+	 *
+	 * For internal purposes (used when the components of f
+	 * are evaluated separately).
+	 */
+	EvalContext& comp(int i);
+
+	/**
+	 * \brief Context of a function g called in the expression of f.
+	 *
+	 * For internal purposes (used by "apply" nodes).
+	 */
+	EvalContext& sub(const Function& g);
+
+	/**
+	 * \brief The function.
+	 */
+	Function& f;
+
+private:
+	friend class Function;
+
+	/*
+	 * \brief Create a context of f.
+	 *
+	 * If is_default is true, this is the context used through the
+	 * Function interface. The sub-contexts of a default context are
+	 * the default contexts of the components/sub-functions.
+	 */
+	EvalContext(Function& f, bool is_default);
+
+	/*
+	 * Create the evaluators.
+	 */
+	void init();
+
+	/*
+	 * Jacobian matrix with the native code.
+	 */
+	void native_jacobian(const IntervalVector& x, IntervalMatrix& J, int v);
+
+	/*
+	 * The ith component of f (generated under a lock).
+	 */
+	Function& comp_function(int i);
+
+	EvalContext(const EvalContext&);              // forbidden
+	EvalContext& operator=(const EvalContext&);   // forbidden
+
+	// true if this is the context owned by the function
+	const bool is_default;
+
+	Eval *_eval;
+	EvalBatch *_batch; // only generated if required
+	HC4Revise *_hc4revise;
+	Gradient *_grad;
+	Hessian *_hessian; // only generated if required
+	InHC4Revise *_inhc4revise;
+
+	// contexts of the components (only generated if required)
+	EvalContext** _comp;
+
+	// contexts of the sub-functions (only generated if required)
+	std::map<const Function*, EvalContext*> _sub;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline Domain& EvalContext::eval_domain(const IntervalVector& box) {
+	return _eval->eval(box);
+}
+
+inline Domain& EvalContext::eval_domain(const Array<const Domain>& d) {
+	return _eval->eval(d);
+}
+
+inline Interval EvalContext::eval(const IntervalVector& box) {
+	return f._native ? f._native->eval(box) : eval_domain(box).i();
+}
+
+inline std::vector<Interval> EvalContext::eval_batch(const std::vector<IntervalVector>& boxes) {
+	return batch_evaluator().eval(boxes);
+}
+
+inline std::vector<Interval> EvalContext::eval_batch(const std::vector<Vector>& points) {
+	return batch_evaluator().eval(points);
+}
+
+inline std::vector<IntervalVector> EvalContext::eval_vector_batch(const std::vector<IntervalVector>& boxes) {
+	return batch_evaluator().eval_vector(boxes);
+}
+
+inline std::vector<IntervalVector> EvalContext::eval_vector_batch(const std::vector<Vector>& points) {
+	return batch_evaluator().eval_vector(points);
+}
+
+inline bool EvalContext::backward(const Domain& y, IntervalVector& x) {
+	if (f._native && !y.dim.is_matrix())
+		return f._native->backward(y,x);
+	else
+		return _hc4revise->proj(y,x);
+}
+
+inline bool EvalContext::backward(const Interval& y, IntervalVector& x) {
+	return backward(Domain((Interval&) y),x); // y will not be modified
+}
+
+inline bool EvalContext::backward(const IntervalVector& y, IntervalVector& x) {
+	assert(f.expr().dim.is_vector());
+	return backward(Domain((IntervalVector&) y, f.expr().dim.type()==Dim::ROW_VECTOR),x); // y will not be modified
+}
+
+inline void EvalContext::ibwd(const Domain& y, IntervalVector& x) {
+	_inhc4revise->iproj(y,x);
+}
+
+inline void EvalContext::ibwd(const Domain& y, IntervalVector& x, const IntervalVector& xin) {
+	_inhc4revise->iproj(y,x,xin);
+}
+
+inline void EvalContext::gradient(const IntervalVector& x, IntervalVector& g) {
+	assert(g.size()==f.nb_var());
+	assert(x.size()==f.nb_var());
+	if (f._native && f.expr().dim.is_scalar())
+		f._native->gradient(x,g);
+	else
+		_grad->gradient(x,g);
+}
+
+inline void EvalContext::jacobian(const IntervalVector& x, IntervalMatrix& J, int v) {
+	if (f._native)
+		native_jacobian(x,J,v);
+	else
+		_grad->jacobian(x,J,v);
+}
+
+inline void EvalContext::jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v) {
+	if (f._native && components.size()==f.image_dim())
+		native_jacobian(x,J,v);
+	else
+		_grad->jacobian(x,J,components,v);
+}
+
+inline Eval& EvalContext::basic_evaluator() {
+	return *_eval;
+}
+
+inline EvalBatch& EvalContext::batch_evaluator() {
+	if (!_batch) _batch = new EvalBatch(*this);
+	return *_batch;
+}
+
+inline Gradient& EvalContext::deriv_calculator() {
+	return *_grad;
+}
+
+inline Hessian& EvalContext::hessian_calculator() {
+	if (!_hessian) _hessian = new Hessian(*_grad);
+	return *_hessian;
+}
+
+inline void EvalContext::hessian(const IntervalVector& x, const IntervalVector& w, IntervalMatrix& H, int v) {
+	hessian_calculator().hessian(x,w,H,v);
+}
+
+inline void EvalContext::hessian_vector(const IntervalVector& x, const IntervalVector& w, const IntervalVector& u, IntervalVector& Hu) {
+	hessian_calculator().hessian_vector(x,w,u,Hu);
+}
+
+inline HC4Revise& EvalContext::hc4revise() {
+	return *_hc4revise;
+}
+
+inline InHC4Revise& EvalContext::inhc4revise() {
+	return *_inhc4revise;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_EVAL_CONTEXT_H__
@@ -25,6 +25,11 @@ public:
 	// The object to build
 	ExprData<T>* data;
 
+	/**
+	 * \brief Create a factory.
+	 */
+	ExprDataFactory();
+
 	/**
 	 * \brief Build the object "data".
 	 */
@@ -419,6 +424,11 @@ std::ostream& operator<<(std::ostream& os, const ExprData<T>&);
 /* ============================================================================
  	 	 	 	 	 	 	 implementation
   ============================================================================*/
+template<class T>
+ExprDataFactory<T>::ExprDataFactory() : data(NULL) {
+
+}
+
 template<class T>
 ExprDataFactory<T>::~ExprDataFactory() {
 
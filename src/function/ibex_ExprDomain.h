@@ -2,14 +2,80 @@
 #define __IBEX_EXPR_DOMAIN__
 
 #include <iostream>
+#include <new>
 
 #include "ibex_ExprData.h"
 
 namespace ibex {
 
+/**
+ * \brief Contiguous storage of the domains of a function.
+ *
+ * All the domains associated to the nodes of a function are packed
+ * into a single array of scalars, in the order they are created by
+ * ExprDomainFactory (the last node first, i.e., children before their
+ * fathers). A vector (matrix) domain is a range of consecutive scalars
+ * (row by row). The TemplateDomain objects (and the vector/matrix
+ * objects) are themselves stored in contiguous arrays.
+ *
+ * Forward and backward algorithms therefore go through memory
+ * linearly instead of jumping from one heap block to another.
+ */
+template<class D>
+class ExprDomainSlab {
+public:
+	/**
+	 * \brief Allocate the storage for the domains of f.
+	 */
+	ExprDomainSlab(const Function& f);
+
+	/**
+	 * \brief Delete this (and all the domains).
+	 */
+	~ExprDomainSlab();
+
+	/**
+	 * \brief New domain of dimension \a dim.
+	 *
+	 * The domain is initialized to (-oo,+oo).
+	 */
+	TemplateDomain<D>* alloc(const Dim& dim);
+
+	/**
+	 * \brief New domain that points to the internal domain of d.
+	 */
+	TemplateDomain<D>* alloc_ref(const TemplateDomain<D>& d);
+
+	/**
+	 * \brief The scalars.
+	 */
+	typename D::SCALAR* const scalars;
+
+	/**
+	 * \brief Number of scalars.
+	 */
+	const size_t nb_scalars;
+
+private:
+	ExprDomainSlab(const ExprDomainSlab&); // forbidden
+
+	static size_t count(const Function& f, size_t& nb_vectors, size_t& nb_matrices);
+
+	size_t nb_vectors, nb_matrices;
+
+	TemplateDomain<D>* domains;  // one per node
+	typename D::VECTOR* vectors; // vectors and rows of matrices
+	typename D::MATRIX* matrices;
+
+	// number of objects allocated so far
+	size_t _scalars, _domains, _vectors, _matrices;
+};
+
 template<class D>
 class ExprDomainFactory : public ExprDataFactory<TemplateDomain<D> > {
 public:
+	/** Create a factory that allocates domains in a slab. */
+	ExprDomainFactory(ExprDomainSlab<D>& slab);
 	/** Delete this. */
 	virtual ~ExprDomainFactory();
 	/** Visit an indexed expression. */
@@ -24,6 +90,9 @@ public:
 	virtual TemplateDomain<D>* init(const ExprUnaryOp& e, TemplateDomain<D>& expr_deco);
 	/** Visit a transpose. */
 	virtual TemplateDomain<D>* init(const ExprTrans& e, TemplateDomain<D>& expr_deco);
+
+protected:
+	ExprDomainSlab<D>& slab;
 };
 
 /**
@@ -34,7 +103,7 @@ public:
  *
  */
 template<class D>
-class ExprTemplateDomain : public ExprData<TemplateDomain<D> > {
+class ExprTemplateDomain : private ExprDomainSlab<D>, public ExprData<TemplateDomain<D> > {
 public:
 
 	ExprTemplateDomain(const Function& f);
@@ -96,6 +165,102 @@ typedef ExprTemplateDomain<Interval> ExprDomain;
 /* ============================================================================
  	 	 	 	 	 	 	 inline implementation
   ============================================================================*/
+template<class D>
+size_t ExprDomainSlab<D>::count(const Function& f, size_t& nb_vectors, size_t& nb_matrices) {
+	size_t nb_scalars=0;
+	nb_vectors=nb_matrices=0;
+
+	for (int i=0; i<f.nodes.size(); i++) {
+		const ExprNode& e=f.nodes[i];
+
+		// domains of these nodes are references (see ExprDomainFactory)
+		const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&e);
+		if (idx && idx->index.domain_ref()) continue;
+		if (dynamic_cast<const ExprTrans*>(&e) && e.dim.is_vector()) continue;
+
+		nb_scalars += e.dim.size();
+		switch (e.dim.type()) {
+		case Dim::SCALAR:     break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR: nb_vectors++; break;
+		case Dim::MATRIX:     nb_vectors+=e.dim.nb_rows(); nb_matrices++; break;
+		}
+	}
+	return nb_scalars;
+}
+
+template<class D>
+ExprDomainSlab<D>::ExprDomainSlab(const Function& f) :
+		scalars(NULL), nb_scalars(count(f, nb_vectors, nb_matrices)),
+		_scalars(0), _domains(0), _vectors(0), _matrices(0) {
+
+	(typename D::SCALAR*&) scalars = new typename D::SCALAR[nb_scalars];
+	domains  = (TemplateDomain<D>*) ::operator new(f.nodes.size()*sizeof(TemplateDomain<D>));
+	vectors  = (typename D::VECTOR*) ::operator new(nb_vectors*sizeof(typename D::VECTOR));
+	matrices = (typename D::MATRIX*) ::operator new(nb_matrices*sizeof(typename D::MATRIX));
+}
+
+template<class D>
+ExprDomainSlab<D>::~ExprDomainSlab() {
+	// Note: vectors and matrices do not own their scalars
+	// and are not destroyed (their destructor would free them).
+	for (size_t i=0; i<_domains; i++)
+		domains[i].~TemplateDomain<D>();
+	::operator delete(domains);
+	::operator delete(vectors);
+	::operator delete(matrices);
+	delete[] scalars;
+}
+
+template<class D>
+TemplateDomain<D>* ExprDomainSlab<D>::alloc(const Dim& dim) {
+	typename D::SCALAR* x=&scalars[_scalars];
+	_scalars += dim.size();
+	assert(_scalars<=nb_scalars);
+
+	TemplateDomain<D>* d=&domains[_domains++];
+
+	switch (dim.type()) {
+	case Dim::SCALAR:
+		return new (d) TemplateDomain<D>(*x);
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR:
+	{
+		assert(_vectors<nb_vectors);
+		typename D::VECTOR* v=new (&vectors[_vectors++]) typename D::VECTOR();
+		v->n=dim.vec_size();
+		v->vec=x;
+		return new (d) TemplateDomain<D>(*v, dim.type()==Dim::ROW_VECTOR);
+	}
+	default:
+	{
+		assert(_vectors+dim.nb_rows()<=nb_vectors && _matrices<nb_matrices);
+		typename D::VECTOR* rows=&vectors[_vectors];
+		_vectors += dim.nb_rows();
+		for (int i=0; i<dim.nb_rows(); i++) {
+			new (&rows[i]) typename D::VECTOR();
+			rows[i].n=dim.nb_cols();
+			rows[i].vec=x+i*dim.nb_cols();
+		}
+		typename D::MATRIX* m=new (&matrices[_matrices++]) typename D::MATRIX();
+		m->_nb_rows=dim.nb_rows();
+		m->_nb_cols=dim.nb_cols();
+		m->M=rows;
+		return new (d) TemplateDomain<D>(*m);
+	}
+	}
+}
+
+template<class D>
+TemplateDomain<D>* ExprDomainSlab<D>::alloc_ref(const TemplateDomain<D>& d) {
+	return new (&domains[_domains++]) TemplateDomain<D>(d, true);
+}
+
+template<class D>
+ExprDomainFactory<D>::ExprDomainFactory(ExprDomainSlab<D>& slab) : slab(slab) {
+
+}
+
 template<class D>
 ExprDomainFactory<D>::~ExprDomainFactory() {
 
@@ -104,27 +269,33 @@ ExprDomainFactory<D>::~ExprDomainFactory() {
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprIndex& e, TemplateDomain<D>& d_expr) {
 	TemplateDomain<D> d(d_expr[e.index]); // Depending on the type of index, can be a reference or a copy.
-	return new TemplateDomain<D>(d,d.is_reference);
+	if (d.is_reference)
+		return slab.alloc_ref(d);
+	else {
+		TemplateDomain<D>* res=slab.alloc(e.dim);
+		*res = d;
+		return res;
+	}
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprLeaf& e) {
-	return new TemplateDomain<D>(e.dim);
+	return slab.alloc(e.dim);
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprNAryOp& e, Array<TemplateDomain<D> >&) {
-	return new TemplateDomain<D>(e.dim);
+	return slab.alloc(e.dim);
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprBinaryOp& e, TemplateDomain<D>&, TemplateDomain<D>&) {
-	return new TemplateDomain<D>(e.dim);
+	return slab.alloc(e.dim);
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprUnaryOp& e, TemplateDomain<D>&) {
-	return new TemplateDomain<D>(e.dim);
+	return slab.alloc(e.dim);
 }
 
 template<class D>
@@ -132,24 +303,23 @@ TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprTrans& e, TemplateDomain
 
 	if (e.dim.is_vector()) {
 		// share references
-		return new TemplateDomain<D>(expr_deco, true);
+		return slab.alloc_ref(expr_deco);
 	} else {
 		// TODO: seems impossible to have references
 		// in case of matrices...
-		return new TemplateDomain<D>(e.dim);
+		return slab.alloc(e.dim);
 	}
 }
 
 template<class D>
-inline ExprTemplateDomain<D>::ExprTemplateDomain(const Function& f) : ExprData<TemplateDomain<D> >(f, ExprDomainFactory<D>()) {
+inline ExprTemplateDomain<D>::ExprTemplateDomain(const Function& f) : ExprDomainSlab<D>(f),
+		ExprData<TemplateDomain<D> >(f, ExprDomainFactory<D>(*this)) {
 
 }
 
 template<class D>
 inline ExprTemplateDomain<D>::~ExprTemplateDomain() {
-	for (int i=0; i<ExprData<TemplateDomain<D> >::data.size(); i++) {
-		delete &ExprData<TemplateDomain<D> >::data[i];
-	}
+	// the domains are deleted by ExprDomainSlab
 }
 
 template<class D>
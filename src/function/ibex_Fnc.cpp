@@ -8,22 +8,64 @@
 #include "ibex_Fnc.h"
 #include <cassert>
 
+#ifndef _WIN32 // MinGW does not support mutex
+#include <mutex>
+#endif
+
+using namespace std;
+
 namespace ibex {
 
-Fnc::Fnc() : _nb_var(-1), _image_dim() /* tmp assign */ {
+namespace {
+
+#ifndef _WIN32
+// prevents two threads from calculating the pattern
+// of the same function at the same time.
+std::mutex pattern_mutex;
+#endif
+
+}
+
+Fnc::Fnc() : _nb_var(-1), _image_dim() /* tmp assign */, _pattern(NULL) {
+
+}
+
+Fnc::Fnc(int n, int m) : _nb_var(n), _image_dim(m,1), _pattern(NULL) {
 
 }
 
-Fnc::Fnc(int n, int m) : _nb_var(n), _image_dim(m,1) {
+Fnc::Fnc(int n, int m, int p) : _nb_var(n), _image_dim(m,p), _pattern(NULL) {
 
 }
 
-Fnc::Fnc(int n, int m, int p) : _nb_var(n), _image_dim(m,p) {
+Fnc::Fnc(const Fnc& f) : _nb_var(f._nb_var), _image_dim(f._image_dim), _pattern(NULL) {
 
 }
 
 Fnc::~Fnc() {
+	if (_pattern) delete _pattern;
+}
+
+const SparseIntervalMatrix& Fnc::cached_jacobian_pattern() const {
+	{
+#ifndef _WIN32
+		lock_guard<mutex> lock(pattern_mutex);
+#endif
+		if (_pattern) return *_pattern;
+	}
 
+	// note: calculated outside of the lock (the pattern of
+	// a function may require the pattern of another one).
+	SparseIntervalMatrix* J=new SparseIntervalMatrix(jacobian_pattern());
+
+#ifndef _WIN32
+	lock_guard<mutex> lock(pattern_mutex);
+#endif
+	if (_pattern)
+		delete J; // calculated by another thread in the meantime
+	else
+		_pattern=J;
+	return *_pattern;
 }
 
 void Fnc::jacobian(const IntervalVector& box, IntervalMatrix& J_var, IntervalMatrix& J_param, const VarSet& set) const {
@@ -40,6 +82,20 @@ void Fnc::jacobian(const IntervalVector& box, IntervalMatrix& J_var, IntervalMat
 	}
 }
 
+SparseIntervalMatrix Fnc::jacobian_pattern() const {
+	vector<vector<int> > pattern(image_dim(), vector<int>(nb_var()));
+	for (int i=0; i<image_dim(); i++)
+		for (int j=0; j<nb_var(); j++)
+			pattern[i][j]=j;
+	return SparseIntervalMatrix(image_dim(), nb_var(), pattern);
+}
+
+void Fnc::jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const {
+	IntervalMatrix D(image_dim(), nb_var());
+	jacobian(x,D);
+	J.gather(D);
+}
+
 //void Fnc::jacobian(const IntervalVector& x, const BitSet& fi, const BitSet& xj, IntervalMatrix& J) const {
 //	IntervalMatrix Jfull(image_dim(),nb_var());
 //	assert(J.nb_rows()==((int) fi.size()));
@@ -97,6 +153,12 @@ void Fnc::hansen_matrix(const IntervalVector& box, const IntervalVector& x0, Int
 
 }
 
+void Fnc::hansen_matrix(const IntervalVector& box, const IntervalVector& x0, SparseIntervalMatrix& H) const {
+	IntervalMatrix D(image_dim(), nb_var());
+	hansen_matrix(box,x0,D);
+	H.gather(D);
+}
+
 void Fnc::hansen_matrix(const IntervalVector& box, const IntervalVector& x0, IntervalMatrix& H_var, IntervalMatrix& J_param, const VarSet& set) const {
 
 	int n=set.nb_var;
@@ -13,6 +13,7 @@
 #define __IBEX_FNC_H__
 
 #include "ibex_IntervalMatrix.h"
+#include "ibex_SparseIntervalMatrix.h"
 #include "ibex_VarSet.h"
 
 namespace ibex {
@@ -190,6 +191,35 @@ public:
 	 */
 	virtual void jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v=-1) const;
 
+	/**
+	 * \brief Sparsity pattern of the Jacobian matrix.
+	 *
+	 * Return a (m x n) sparse matrix whose entries are the
+	 * pairs (i,j) such that f_i may depend on x_j.
+	 *
+	 * Default implementation: all the entries (dense pattern).
+	 */
+	virtual SparseIntervalMatrix jacobian_pattern() const;
+
+	/**
+	 * \brief Sparsity pattern of the Jacobian matrix (calculated once).
+	 *
+	 * Same as #jacobian_pattern() but the pattern is calculated on
+	 * the first call only and then stored in the function.
+	 */
+	const SparseIntervalMatrix& cached_jacobian_pattern() const;
+
+	/**
+	 * \brief Calculate the Jacobian matrix of f (sparse version).
+	 *
+	 * Only the entries of the pattern of J are calculated.
+	 *
+	 * Default implementation: calculates the dense Jacobian matrix.
+	 *
+	 * \pre J must contain (at least) the pattern returned by #jacobian_pattern().
+	 */
+	virtual void jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const;
+
 	/**
 	 * \brief Calculate the Hansen matrix of f.
 	 *
@@ -212,6 +242,17 @@ public:
 	 */
 	void hansen_matrix(const IntervalVector& x, const IntervalVector& x0, IntervalMatrix& H, const BitSet& components) const;
 
+	/**
+	 * \brief Calculate the Hansen matrix of f (sparse version).
+	 *
+	 * Only the entries of the pattern of H are calculated.
+	 *
+	 * Default implementation: calculates the dense Hansen matrix.
+	 *
+	 * \pre H must contain (at least) the pattern returned by #jacobian_pattern().
+	 */
+	virtual void hansen_matrix(const IntervalVector& x, const IntervalVector& x0, SparseIntervalMatrix& H) const;
+
 	/**
 	 * \brief Calculate the Hansen matrix of a restriction of f
 	 *
@@ -243,9 +284,21 @@ protected:
 
 	Fnc(); // for Function only
 
+	/**
+	 * \brief Copy the dimensions of f (not the cached pattern).
+	 */
+	Fnc(const Fnc& f);
+
+	Fnc& operator=(const Fnc&); // forbidden
+
 	int _nb_var;
 
 	Dim _image_dim;
+
+private:
+	// pattern of the Jacobian matrix (NULL until
+	// cached_jacobian_pattern is called)
+	mutable SparseIntervalMatrix* _pattern;
 };
 
 
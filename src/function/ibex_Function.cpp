@@ -16,6 +16,8 @@
 #include "ibex_InHC4Revise.h"
 #include "ibex_Gradient.h"
 #include "ibex_ExprFuncDomain.h"
+#include "ibex_FunctionCodeGen.h"
+#include "ibex_NativeCode.h"
 
 using namespace std;
 
@@ -30,13 +32,12 @@ const System& Function::def_domain() const {
 Function::~Function() {
 
 	// note: destructor of Eval requires *this
-	if (_eval!=NULL) {
-		delete _eval;
-		delete _hc4revise;
-		delete _grad;
-		delete _inhc4revise;
+	if (_ctx!=NULL) {
+		delete _ctx;
 	}
 
+	unload_native();
+
 	if (comp!=NULL) {
 		/* warning... if there is only one constraint
 		 * then comp[0] is the same object as f itself!
@@ -71,6 +72,31 @@ Function::~Function() {
 	}
 }
 
+bool Function::load_native(const char* filename, const char* prefix) {
+	unload_native();
+	string p=prefix ? string(prefix) : FunctionCodeGen::default_prefix(*this);
+	_native=NativeCode::load(filename, p.c_str(), *this);
+	return _native!=NULL;
+}
+
+void Function::unload_native() {
+	if (_native!=NULL) {
+		delete _native;
+		_native=NULL;
+	}
+}
+
+SparseIntervalMatrix Function::jacobian_pattern() const {
+	if (expr().dim.is_matrix())
+		ibex_error("Cannot called \"jacobian_pattern\" on a matrix-valued function");
+
+	int m=image_dim();
+	vector<vector<int> > pattern(m);
+	for (int i=0; i<m; i++)
+		pattern[i]=(*this)[i].used_vars;
+	return SparseIntervalMatrix(m, nb_var(), pattern);
+}
+
 void Function::print(std::ostream& os) const {
 	if (name!=NULL) os << name << ":";
 	os << "(";
@@ -206,7 +232,7 @@ IntervalMatrix Function::eval_matrix(const IntervalVector& box) const {
 		M.set_col(0,eval_vector(box));
 		break;
 	case Dim::MATRIX:
-		M=((Function*) this)->_eval->eval(box).m();
+		M=_ctx->_eval->eval(box).m();
 		break;
 	default :
 		throw std::logic_error("Function::eval_matrix: invalid Dim type");
@@ -233,9 +259,9 @@ IntervalMatrix Function::eval_matrix(const IntervalVector& box, const BitSet& ro
 		break;
 	case Dim::MATRIX:
 		if (rows.size()==1)
-			M.set_row(0,((Function*) this)->_eval->eval(box,rows).v());
+			M.set_row(0,_ctx->_eval->eval(box,rows).v());
 		else
-			M=((Function*) this)->_eval->eval(box,rows).m();
+			M=_ctx->_eval->eval(box,rows).m();
 		break;
 	default :
 		throw std::logic_error("Function::eval_matrix: invalid Dim type");
@@ -265,14 +291,14 @@ IntervalMatrix Function::eval_matrix(const IntervalVector& box, const BitSet& ro
 	case Dim::MATRIX:
 		if (rows.size()==1)
 			if (cols.size()==1)
-				M[0][0]=((Function*) this)->_eval->eval(box,rows,cols).i();
+				M[0][0]=_ctx->_eval->eval(box,rows,cols).i();
 			else
-				M.set_row(0,((Function*) this)->_eval->eval(box,rows,cols).v());
+				M.set_row(0,_ctx->_eval->eval(box,rows,cols).v());
 		else
 			if (cols.size()==1)
-				M.set_col(0,((Function*) this)->_eval->eval(box,rows,cols).v());
+				M.set_col(0,_ctx->_eval->eval(box,rows,cols).v());
 			else
-		        M=((Function*) this)->_eval->eval(box,rows,cols).m();
+		        M=_ctx->_eval->eval(box,rows,cols).m();
 		break;
 	default :
 		throw std::logic_error("Function::eval_matrix: invalid Dim type");
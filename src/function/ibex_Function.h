@@ -21,6 +21,7 @@
 #include "ibex_BitSet.h"
 
 #include <stdexcept>
+#include <vector>
 #include <stdarg.h>
 #include <stdio.h>
 
@@ -31,7 +32,10 @@ class VarSet;
 class Eval;
 class HC4Revise;
 class Gradient;
+class Hessian;
 class InHC4Revise;
+class EvalContext;
+class NativeCode;
 
 /**
  * \ingroup function
@@ -55,6 +59,9 @@ class InHC4Revise;
  * output vector has 1 component. If f is a m*n matrix function,
  * the output vector has m*n components.
  *
+ * The evaluation functions (eval, backward, gradient, etc.) are not
+ * thread-safe. To evaluate the same function from several threads,
+ * use one #EvalContext per thread.
  *
  */
 class Function : public Fnc {
@@ -649,6 +656,8 @@ public:
 
 	/**
 	 *\see #ibex::Fnc
+	 *
+	 * \note Always interpreted (see #load_native(const char*, const char*)).
 	 */
 	Interval eval(int i, const IntervalVector& box) const;
 
@@ -685,8 +694,46 @@ public:
 	 */
 	virtual IntervalMatrix eval_matrix(const IntervalVector& x, const BitSet& rows, const BitSet& cols) const;
 
+	/**
+	 * \brief Calculate f on several boxes.
+	 *
+	 * Same as calling eval(boxes[k]) for each box, but the
+	 * expression is traversed only once (see #ibex::EvalBatch).
+	 *
+	 * \pre f must be real-valued.
+	 */
+	std::vector<Interval> eval_batch(const std::vector<IntervalVector>& boxes) const;
+
+	/**
+	 * \brief Calculate f on several points.
+	 *
+	 * \pre f must be real-valued.
+	 * \see #eval_batch(const std::vector<IntervalVector>&) const.
+	 */
+	std::vector<Interval> eval_batch(const std::vector<Vector>& points) const;
+
+	/**
+	 * \brief Calculate f on several boxes.
+	 *
+	 * Same as calling eval_vector(boxes[k]) for each box, but the
+	 * expression is traversed only once (see #ibex::EvalBatch).
+	 *
+	 * \pre f must be vector-valued.
+	 */
+	std::vector<IntervalVector> eval_vector_batch(const std::vector<IntervalVector>& boxes) const;
+
+	/**
+	 * \brief Calculate f on several points.
+	 *
+	 * \pre f must be vector-valued.
+	 * \see #eval_vector_batch(const std::vector<IntervalVector>&) const.
+	 */
+	std::vector<IntervalVector> eval_vector_batch(const std::vector<Vector>& points) const;
+
 	/**
 	 * \brief Calculate f(box) using interval arithmetic.
+	 *
+	 * \note Always interpreted (see #load_native(const char*, const char*)).
 	 */
 	Domain& eval_domain(const IntervalVector& box) const;
 
@@ -745,6 +792,27 @@ public:
 	 */
 	virtual void jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v=-1) const;
 
+	/**
+	 * \brief Sparsity pattern of the Jacobian matrix.
+	 *
+	 * The pattern is detected from the expression: the ith row
+	 * contains the variables used by the ith component (see #used_vars).
+	 *
+	 * \pre f must be real or vector-valued.
+	 */
+	virtual SparseIntervalMatrix jacobian_pattern() const;
+
+	/**
+	 * \brief Calculate the Jacobian matrix (sparse version).
+	 *
+	 * The gradient is calculated for each component separately so that
+	 * the time and memory required is proportional to the number
+	 * of entries of the pattern (and not to m x n).
+	 *
+	 *\see #ibex::Fnc
+	 */
+	virtual void jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const;
+
 	/**
 	 *\see #ibex::Fnc
 	 */
@@ -760,6 +828,16 @@ public:
 	 */
 	void hansen_matrix(const IntervalVector& x, const IntervalVector& x0, IntervalMatrix& H, const BitSet& components) const;
 
+	/**
+	 * \brief Calculate the Hansen matrix (sparse version).
+	 *
+	 * The entries are calculated row by row: for each component,
+	 * one gradient per used variable.
+	 *
+	 *\see #ibex::Fnc
+	 */
+	virtual void hansen_matrix(const IntervalVector& x, const IntervalVector& x0, SparseIntervalMatrix& H) const;
+
 	/**
 	 *\see #ibex::Fnc
 	 */
@@ -770,6 +848,66 @@ public:
 	 */
 	void hansen_matrix(const IntervalVector& full_box, const IntervalVector& x0, IntervalMatrix& H_var, IntervalMatrix& J_param, const VarSet& set) const;
 
+	/**
+	 * \brief Calculate the Hessian matrix of f.
+	 *
+	 * The matrix is calculated by automatic differentiation on
+	 * the expression of f (see #Hessian), without generating the
+	 * symbolic gradient.
+	 *
+	 * \param v - only update the vth column of H. Default value is -1
+	 *            (means: update all the columns).
+	 * \pre f must be real-valued
+	 */
+	void hessian(const IntervalVector& x, IntervalMatrix& H, int v=-1) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of f.
+	 * \pre f must be real-valued
+	 */
+	IntervalMatrix hessian(const IntervalVector& x) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of w^T f.
+	 *
+	 * \param w - the weights of the components of f (e.g., Lagrange multipliers).
+	 * \param v - only update the vth column of H. Default value is -1
+	 *            (means: update all the columns).
+	 * \pre f must be real or vector-valued
+	 */
+	void hessian(const IntervalVector& x, const IntervalVector& w, IntervalMatrix& H, int v=-1) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of w^T f_I, where f_I
+	 *        are some components of f.
+	 *
+	 * Unlike the Hessian of w^T f with zero weights for the other
+	 * components, the other components are not evaluated (a component
+	 * can be undefined on x, and 0*empty is empty).
+	 *
+	 * \param w - the weights of the selected components (w[i] is the
+	 *            weight of the ith component in \a components).
+	 * \param v - only update the vth column of H. Default value is -1
+	 *            (means: update all the columns).
+	 * \pre f must be real or vector-valued
+	 */
+	void hessian(const IntervalVector& x, const IntervalVector& w, IntervalMatrix& H, const BitSet& components, int v=-1) const;
+
+	/**
+	 * \brief Calculate the product of the Hessian matrix of f by u.
+	 *
+	 * The cost is a small multiple of the cost of a gradient.
+	 *
+	 * \pre f must be real-valued
+	 */
+	void hessian_vector(const IntervalVector& x, const IntervalVector& u, IntervalVector& Hu) const;
+
+	/**
+	 * \brief Calculate the product of the Hessian matrix of w^T f by u.
+	 * \pre f must be real or vector-valued
+	 */
+	void hessian_vector(const IntervalVector& x, const IntervalVector& w, const IntervalVector& u, IntervalVector& Hu) const;
+
 	/**
 	 * \brief Contract x w.r.t. f(x)=y.
 	 * \throw EmptyBoxException if x is empty.
@@ -814,6 +952,49 @@ public:
 	 */
 	void ibwd(const Interval& y, IntervalVector& x, const IntervalVector& xin) const;
 
+	/**
+	 * \brief Load the native code of the function.
+	 *
+	 * The native code is a shared object compiled from the C++ code
+	 * generated by #FunctionCodeGen (see the ibex_compile_function tool).
+	 * Once loaded, eval, eval_vector, backward, gradient and jacobian
+	 * (in all the evaluation contexts of f) call the native code instead of
+	 * the interpreter, except for partial calls (selected components,
+	 * matrix-valued images) that are still interpreted.
+	 *
+	 * The following functions are always interpreted:
+	 * <ul>
+	 * <li> eval_domain, because it returns the domain of the root node
+	 *      in the interpreter;
+	 * <li> eval(int,const IntervalVector&), because the native code would
+	 *      evaluate all the components;
+	 * <li> hessian, ibwd and the batch evaluation (eval_batch, etc.).
+	 * </ul>
+	 *
+	 * The shared object is rejected if it has not been generated from the
+	 * same expression (see #NativeCode).
+	 *
+	 * \param filename - the shared object
+	 * \param prefix   - the prefix of the entry points. By default,
+	 *                   see #FunctionCodeGen::default_prefix(const Function&).
+	 *
+	 * \return false if the native code could not be loaded (the
+	 *         interpreter is used in this case).
+	 *
+	 * \warning Must not be called while the function is evaluated.
+	 */
+	bool load_native(const char* filename, const char* prefix=NULL);
+
+	/**
+	 * \brief Unload the native code (back to the interpreter).
+	 */
+	void unload_native();
+
+	/**
+	 * \brief True if the native code of the function is loaded.
+	 */
+	bool is_native() const;
+
 	/*
 	 * \brief Get a reference to the evaluator.
 	 *
@@ -828,6 +1009,13 @@ public:
 	 */
 	Gradient& deriv_calculator() const;
 
+	/*
+	 * \brief Get a reference to the Hessian calculator.
+	 *
+	 * For internal purposes.
+	 */
+	Hessian& hessian_calculator() const;
+
 	/*
 	 * \brief Get a reference to the HC4Revise algorithm.
 	 *
@@ -905,6 +1093,7 @@ protected:
 
 private:
 	friend class VarSet;
+	friend class EvalContext;
 
 	void build_from_string(const Array<const char*>& x, const char* y, const char* name=NULL);
 
@@ -943,19 +1132,22 @@ private:
 	// point to this field (instead of being a copy)
 	Function *zero;
 
-	Eval *_eval;
-	HC4Revise *_hc4revise;
-	// TODO: actually never used if f is vector/matrix valued
-	Gradient *_grad;
-	InHC4Revise *_inhc4revise;
+	// The evaluators (Eval, HC4Revise, Gradient, InHC4Revise)
+	// used through this interface.
+	EvalContext *_ctx;
+
+	// The native code (NULL if the function is interpreted)
+	NativeCode *_native;
 };
 
 } // end namespace
 
 #include "ibex_Eval.h"
+#include "ibex_EvalBatch.h"
 #include "ibex_Gradient.h"
 #include "ibex_HC4Revise.h"
 #include "ibex_InHC4Revise.h"
+#include "ibex_EvalContext.h"
 #include "ibex_VarSet.h"
 
 namespace ibex {
@@ -1017,24 +1209,40 @@ inline void Function::forward(const V& algo) const {
 	cf.forward<V>(algo);
 }
 
+inline std::vector<Interval> Function::eval_batch(const std::vector<IntervalVector>& boxes) const {
+	return _ctx->eval_batch(boxes);
+}
+
+inline std::vector<Interval> Function::eval_batch(const std::vector<Vector>& points) const {
+	return _ctx->eval_batch(points);
+}
+
+inline std::vector<IntervalVector> Function::eval_vector_batch(const std::vector<IntervalVector>& boxes) const {
+	return _ctx->eval_vector_batch(boxes);
+}
+
+inline std::vector<IntervalVector> Function::eval_vector_batch(const std::vector<Vector>& points) const {
+	return _ctx->eval_vector_batch(points);
+}
+
 inline Domain& Function::eval_domain(const IntervalVector& box) const {
-	return ((Function*) this)->_eval->eval(box);
+	return _ctx->_eval->eval(box);
 }
 
 inline Domain& Function::eval_domain(const Array<const Domain>& d) const {
-	return ((Function*) this)->_eval->eval(d);
+	return _ctx->_eval->eval(d);
 }
 
 inline Domain& Function::eval_domain(const Array<Domain>& d) const {
-	return ((Function*) this)->_eval->eval(d);
+	return _ctx->_eval->eval(d);
 }
 
 inline Interval Function::eval(const IntervalVector& box) const {
-	return eval_domain(box).i();
+	return _ctx->eval(box);
 }
 
 inline Interval Function::eval(int i, const IntervalVector& box) const {
-	return ((Function*) this)->_eval->eval(box,BitSet::singleton(_image_dim.size(),i)).i();
+	return _ctx->_eval->eval(box,BitSet::singleton(_image_dim.size(),i)).i();
 }
 
 inline IntervalVector Function::eval_vector(const IntervalVector& box) const {
@@ -1042,10 +1250,7 @@ inline IntervalVector Function::eval_vector(const IntervalVector& box) const {
 	// (note that in this case, the root node of the expression is not evaluated)
 	//return eval_vector(box, BitSet::all(image_dim()));
 	// --------------------------------------------------
-	assert(!_image_dim.is_matrix());
-	return _image_dim.is_scalar() ?
-			IntervalVector(1,eval(box)) :
-			((Function*) this)->_eval->eval(box).v();
+	return _ctx->eval_vector(box);
 }
 
 inline IntervalVector Function::eval_vector(const IntervalVector& box, const BitSet& components) const {
@@ -1053,9 +1258,9 @@ inline IntervalVector Function::eval_vector(const IntervalVector& box, const Bit
 	return _image_dim.is_scalar() ?
 			IntervalVector(1,eval(box)) :
 			components.size()==1 ?
-					IntervalVector(1,((Function*) this)->_eval->eval(box,components).i())
+					IntervalVector(1,_ctx->_eval->eval(box,components).i())
 					:
-					((Function*) this)->_eval->eval(box,components).v();
+					_ctx->_eval->eval(box,components).v();
 }
 
 template<class V>
@@ -1064,7 +1269,7 @@ inline void Function::backward(const V& algo) const {
 }
 
 inline bool Function::backward(const Domain& y, IntervalVector& x) const {
-	return ((Function*) this)->_hc4revise->proj(y,x);
+	return _ctx->backward(y,x);
 }
 
 inline bool Function::backward(const Interval& y, IntervalVector& x) const {
@@ -1081,11 +1286,11 @@ inline bool Function::backward(const IntervalMatrix& y, IntervalVector& x) const
 }
 
 inline void Function::ibwd(const Domain& y, IntervalVector& x) const {
-	((Function*) this)->_inhc4revise->iproj(y,x);
+	_ctx->_inhc4revise->iproj(y,x);
 }
 
 inline void Function::ibwd(const Domain& y, IntervalVector& x, const IntervalVector& xin) const {
-	((Function*) this)->_inhc4revise->iproj(y,x,xin);
+	_ctx->_inhc4revise->iproj(y,x,xin);
 }
 
 inline void Function::ibwd(const Interval& y, IntervalVector& x) const {
@@ -1101,9 +1306,7 @@ inline void Function::print_expr(std::ostream& os) const {
 }
 
 inline void Function::gradient(const IntervalVector& x, IntervalVector& g) const {
-	assert(g.size()==nb_var());
-	assert(x.size()==nb_var());
-	_grad->gradient(x,g);
+	_ctx->gradient(x,g);
 //	if (!df) ((Function*) this)->df=new Function(*this,DIFF);
 //	g=df->eval_vector(x);
 }
@@ -1124,7 +1327,7 @@ inline IntervalMatrix Function::jacobian(const IntervalVector& x, const BitSet&
 
 inline void Function::jacobian(const IntervalVector& x, IntervalMatrix& J, int v) const {
 	Fnc::jacobian(x, J, v);
-	// <=> 	_grad->jacobian(x,J,v);
+	// <=> 	_ctx->_grad->jacobian(x,J,v);
 }
 
 inline void Function::jacobian(const IntervalVector& full_box, IntervalMatrix& J_var, IntervalMatrix& J_param, const VarSet& set) const {
@@ -1132,7 +1335,41 @@ inline void Function::jacobian(const IntervalVector& full_box, IntervalMatrix& J
 }
 
 inline void Function::jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v) const {
-	_grad->jacobian(x, J, components, v);
+	_ctx->jacobian(x, J, components, v);
+}
+
+inline void Function::jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const {
+	_ctx->jacobian(x, J);
+}
+
+inline void Function::hessian(const IntervalVector& x, IntervalMatrix& H, int v) const {
+	_ctx->hessian_calculator().hessian(x, H, v);
+}
+
+inline IntervalMatrix Function::hessian(const IntervalVector& x) const {
+	IntervalMatrix H(nb_var(),nb_var());
+	hessian(x,H);
+	return H;
+}
+
+inline void Function::hessian(const IntervalVector& x, const IntervalVector& w, IntervalMatrix& H, int v) const {
+	_ctx->hessian(x, w, H, v);
+}
+
+inline void Function::hessian(const IntervalVector& x, const IntervalVector& w, IntervalMatrix& H, const BitSet& components, int v) const {
+	_ctx->hessian(x, w, H, components, v);
+}
+
+inline void Function::hessian_vector(const IntervalVector& x, const IntervalVector& u, IntervalVector& Hu) const {
+	_ctx->hessian_calculator().hessian_vector(x, u, Hu);
+}
+
+inline void Function::hessian_vector(const IntervalVector& x, const IntervalVector& w, const IntervalVector& u, IntervalVector& Hu) const {
+	_ctx->hessian_vector(x, w, u, Hu);
+}
+
+inline bool Function::is_native() const {
+	return _native!=NULL;
 }
 
 inline void Function::hansen_matrix(const IntervalVector& x, IntervalMatrix& H) const {
@@ -1147,6 +1384,10 @@ inline void Function::hansen_matrix(const IntervalVector& x, const IntervalVecto
 	Fnc::hansen_matrix(x, x0, H, components);
 }
 
+inline void Function::hansen_matrix(const IntervalVector& x, const IntervalVector& x0, SparseIntervalMatrix& H) const {
+	_ctx->hansen_matrix(x, x0, H);
+}
+
 inline void Function::hansen_matrix(const IntervalVector& full_box, IntervalMatrix& H_var, IntervalMatrix& J_param, const VarSet& set) const {
 	Fnc::hansen_matrix(full_box, H_var, J_param, set);
 }
@@ -1156,19 +1397,23 @@ inline void Function::hansen_matrix(const IntervalVector& full_box, const Interv
 }
 
 inline Eval& Function::basic_evaluator() const {
-	return *_eval;
+	return *_ctx->_eval;
 }
 
 inline Gradient& Function::deriv_calculator() const {
-	return *_grad;
+	return *_ctx->_grad;
+}
+
+inline Hessian& Function::hessian_calculator() const {
+	return _ctx->hessian_calculator();
 }
 
 inline HC4Revise& Function::hc4revise() const {
-	return *_hc4revise;
+	return *_ctx->_hc4revise;
 }
 
 inline InHC4Revise& Function::inhc4revise() const {
-	return *_inhc4revise;
+	return *_ctx->_inhc4revise;
 }
 
 inline std::ostream& operator<<(std::ostream& os, const Function& f) {
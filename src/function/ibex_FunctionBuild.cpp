@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Jan 5, 2012
- * Last Update : Nov 22, 2017
+ * Last Update : Oct 18, 2026
  * ---------------------------------------------------------------------------- */
 
 #include <sstream>
@@ -25,23 +25,9 @@
 #include "ibex_SyntaxError.h"
 #include "ibex_P_Struct.h"
 
-#ifndef _WIN32 // MinGW does not support mutex
-#include <mutex>
-namespace {
-std::mutex mtx;
-}
-#define LOCK mtx.lock()
-#define UNLOCK mtx.unlock()
-#else
-#define LOCK
-#define UNLOCK
-#endif
 
 using namespace std;
 
-
-extern void ibexparse_string(const char* syntax);
-
 namespace ibex {
 
 namespace {
@@ -140,7 +126,7 @@ const char* duplicate_or_generate(const char* name) {
 }
 
 Function::Function() : name(NULL), comp(NULL), df(NULL), _def_domain(NULL), zero(NULL),
-		_eval(NULL), _hc4revise(NULL), _grad(NULL), _inhc4revise(NULL) {
+		_ctx(NULL), _native(NULL) {
 	// root==NULL <=> the function is not initialized yet
 }
 
@@ -228,13 +214,6 @@ Function::Function(const Array<const ExprSymbol>& x, const ExprNode& y, const ch
 	init(x,y,name);
 }
 
-} // end namespace ibex
-
-extern int ibexparse();
-extern void ibexrestart(FILE *);
-extern FILE* ibexin;
-
-namespace ibex {
 
 Function::Function(const char* x, const char* y) {
 	build_from_string(Array<const char*>(x),y);
@@ -341,7 +320,6 @@ void Function::build_from_string(const Array<const char*>& x, const char* y, con
 
 	char* syntax = strdup(s.str().c_str());
 
-	LOCK;
 	try {
 		parser::pstruct = new parser::P_StructFunction(*this);
 		ibexparse_string(syntax);
@@ -352,10 +330,8 @@ void Function::build_from_string(const Array<const char*>& x, const char* y, con
 		delete parser::pstruct;
 		parser::pstruct = NULL;
 		free(syntax);
-		UNLOCK;
 		throw e;
 	}
-	UNLOCK;
 }
 
 Function::Function(const char* filename) {
@@ -363,19 +339,9 @@ Function::Function(const char* filename) {
 	FILE *fd;
 	if ((fd = fopen(filename, "r")) == NULL) throw UnknownFileException(filename);
 
-	LOCK;
-
-	ibexrestart(fd);
-
-	if (ibexin == fd) {
-		rewind(fd);
-	}
-
-	ibexin = fd;	
-
 	try {
 		parser::pstruct = new parser::P_StructFunction(*this);
-		ibexparse();
+		ibexparse_file(fd);
 		delete parser::pstruct;
 		parser::pstruct = NULL;
 	}
@@ -383,34 +349,25 @@ Function::Function(const char* filename) {
 		delete parser::pstruct;
 		parser::pstruct = NULL;
 		fclose(fd);
-		UNLOCK;
 		throw e;
 	}
 
 	fclose(fd);
-	UNLOCK;
 }
 
 Function::Function(FILE* fd) {
 
-	LOCK;
-
-	ibexin = fd;
-
 	try {
 		parser::pstruct = new parser::P_StructFunction(*this);
-		ibexparse();
+		ibexparse_file(fd);
 		delete parser::pstruct;
 		parser::pstruct = NULL;
 	}
 	catch(SyntaxError& e) {
 		delete parser::pstruct;
 		parser::pstruct = NULL;
-		ibexrestart(ibexin);
-		UNLOCK;
 		throw e;
 	}
-	UNLOCK;
 }
 
 
@@ -514,6 +471,7 @@ void Function::init(const Array<const ExprSymbol>& x, const ExprNode& y, const c
 	_def_domain=NULL;
 	comp=NULL;
 	zero=NULL;
+	_native=NULL;
 
 	this->name=duplicate_or_generate(name);
 
@@ -559,10 +517,7 @@ void Function::init(const Array<const ExprSymbol>& x, const ExprNode& y, const c
 
 	decorate(x,y);
 
-	_eval = new Eval(*this);
-	_hc4revise = new HC4Revise(*_eval);
-	_grad = new Gradient(*_eval);
-	_inhc4revise = new InHC4Revise(*_eval);
+	_ctx = new EvalContext(*this, true);
 
 	// ===== display adjacency (debug) =========
 //	cout << "adjacency of function" << *this << ":" << endl;
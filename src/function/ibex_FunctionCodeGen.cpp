@@ -0,0 +1,396 @@
+/* ============================================================================
+ * I B E X - Generation of the C++ code of a function
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_FunctionCodeGen.h"
+#include "ibex_Function.h"
+#include "ibex_NativeCode.h"
+#include "ibex_Setting.h"
+
+#include <sstream>
+#include <iomanip>
+#include <cctype>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+typedef CompiledFunction CF;
+
+// a double that can be read back exactly by the compiler
+string num(double x) {
+	if (x==POS_INFINITY) return "POS_INFINITY";
+	if (x==NEG_INFINITY) return "NEG_INFINITY";
+	stringstream s;
+	s << setprecision(17) << x;
+	return s.str();
+}
+
+string cst(const Interval& x) {
+	if (x.is_empty())
+		return "Interval::empty_set()";
+	else if (x.is_degenerated())
+		return "Interval(" + num(x.lb()) + ")";
+	else
+		return "Interval(" + num(x.lb()) + "," + num(x.ub()) + ")";
+}
+
+}
+
+const char* FunctionCodeGen::binary(int op) {
+	switch (op) {
+	case CF::ADD:   return "add";
+	case CF::SUB:   return "sub";
+	case CF::MUL:   return "mul";
+	case CF::DIV:   return "div";
+	case CF::MAX:   return "max";
+	case CF::MIN:   return "min";
+	case CF::ATAN2: return "atan2";
+	default:        return NULL;
+	}
+}
+
+const char* FunctionCodeGen::unary(int op) {
+	switch (op) {
+	case CF::SIGN:  return "sign";
+	case CF::ABS:   return "abs";
+	case CF::SQR:   return "sqr";
+	case CF::SQRT:  return "sqrt";
+	case CF::EXP:   return "exp";
+	case CF::LOG:   return "log";
+	case CF::COS:   return "cos";
+	case CF::SIN:   return "sin";
+	case CF::TAN:   return "tan";
+	case CF::COSH:  return "cosh";
+	case CF::SINH:  return "sinh";
+	case CF::TANH:  return "tanh";
+	case CF::ACOS:  return "acos";
+	case CF::ASIN:  return "asin";
+	case CF::ATAN:  return "atan";
+	case CF::ACOSH: return "acosh";
+	case CF::ASINH: return "asinh";
+	case CF::ATANH: return "atanh";
+	case CF::FLOOR: return "floor";
+	case CF::CEIL:  return "ceil";
+	case CF::SAW:   return "saw";
+	default:        return NULL;
+	}
+}
+
+bool FunctionCodeGen::restricted(int op) {
+	switch (op) {
+	case CF::SQRT: case CF::LOG:  case CF::TAN:   case CF::ACOS:
+	case CF::ASIN: case CF::ACOSH:case CF::ATANH: case CF::FLOOR:
+	case CF::CEIL: case CF::SAW:  return true;
+	default:       return false;
+	}
+}
+
+FunctionCodeGen::FunctionCodeGen(const Function& f) : f(f), n(f.cf.n), _supported(true),
+		pos(new int[f.nodes.size()]), var(new bool[f.nodes.size()]) {
+
+	const CompiledFunction& cf=f.cf;
+
+	for (int i=n-1; i>=0; i--) {
+		const ExprNode& e=f.node(i);
+		pos[i]=-1;
+		var[i]=false;
+
+		switch (cf.code[i]) {
+		case CF::SYM:
+			var[i]=true;
+			break;
+		case CF::IDX:
+			var[i]=var[cf.args[i][0]];
+			if (!var[i]) _supported=false;
+			break;
+		case CF::VEC:
+			if (i>0) _supported=false;
+			for (int j=0; j<cf.nb_args[i]; j++) {
+				if (!f.node(cf.args[i][j]).dim.is_scalar()) _supported=false;
+				roots.push_back(cf.args[i][j]);
+			}
+			break;
+		case CF::CST:
+			if (!e.dim.is_scalar()) _supported=false;
+			break;
+		case CF::POWER:
+			break;
+		default:
+			if (!binary(cf.code[i]) && !unary(cf.code[i]) && cf.code[i]!=CF::MINUS)
+				_supported=false;
+		}
+	}
+
+	if (roots.empty()) {
+		if (!f.expr().dim.is_scalar()) _supported=false;
+		roots.push_back(0);
+	}
+
+	if (_supported) {
+		// Get the position in the box of each scalar variable node
+		// by loading the "box" (0,1,2,...) in a domain of the function.
+		ExprDomain d(f);
+		IntervalVector probe(f.nb_var());
+		for (int j=0; j<f.nb_var(); j++) probe[j]=Interval(j);
+		d.write_arg_domains(probe);
+
+		for (int i=0; i<n; i++) {
+			if (var[i] && f.node(i).dim.is_scalar()) {
+				const Interval& p=d[i].i();
+				if (p.is_degenerated() && p.lb()>=0 && p.lb()<f.nb_var())
+					pos[i]=(int) p.lb();
+				else
+					_supported=false;
+			}
+		}
+	}
+}
+
+FunctionCodeGen::~FunctionCodeGen() {
+	delete[] pos;
+	delete[] var;
+}
+
+bool FunctionCodeGen::supported() const {
+	return _supported;
+}
+
+string FunctionCodeGen::default_prefix(const Function& f) {
+	string s="ibex_";
+	for (const char* c=f.name; c && *c; c++)
+		s += isalnum(*c) ? *c : '_';
+	return s;
+}
+
+bool FunctionCodeGen::is_local(int i) const {
+	return !var[i] && f.cf.code[i]!=CF::VEC;
+}
+
+string FunctionCodeGen::val(int i) const {
+	stringstream s;
+	if (pos[i]!=-1)
+		s << "x[" << pos[i] << "]";
+	else
+		s << "v" << i;
+	return s.str();
+}
+
+void FunctionCodeGen::forward(ostream& os) const {
+	const CompiledFunction& cf=f.cf;
+
+	for (int i=n-1; i>=0; i--) {
+		if (!is_local(i)) continue;
+
+		int op=cf.code[i];
+		string a=op==CF::CST ? "" : val(cf.args[i][0]);
+
+		os << "\tInterval " << val(i) << "=";
+
+		if (op==CF::CST)
+			os << cst(((const ExprConstant&) f.node(i)).get_value());
+		else if (op==CF::MINUS)
+			os << "-" << a;
+		else if (op==CF::POWER)
+			os << "pow(" << a << "," << ((const ExprPower&) f.node(i)).expon << ")";
+		else if (unary(op))
+			os << unary(op) << "(" << a << ")";
+		else {
+			string b=val(cf.args[i][1]);
+			switch (op) {
+			case CF::ADD: os << a << "+" << b; break;
+			case CF::SUB: os << a << "-" << b; break;
+			case CF::MUL: os << a << "*" << b; break;
+			case CF::DIV: os << a << "/" << b; break;
+			default:      os << binary(op) << "(" << a << "," << b << ")";
+			}
+		}
+		os << ";\n";
+
+		if (restricted(op))
+			os << "\tif (" << val(i) << ".is_empty()) return 0;\n";
+	}
+}
+
+void FunctionCodeGen::backward(ostream& os) const {
+	const CompiledFunction& cf=f.cf;
+
+	for (size_t k=0; k<roots.size(); k++)
+		os << "\tif ((" << val(roots[k]) << " &= y[" << k << "]).is_empty()) return 0;\n";
+
+	for (int i=0; i<n; i++) {
+		if (!is_local(i) || cf.code[i]==CF::CST) continue;
+
+		int op=cf.code[i];
+		string y=val(i);
+		string a=val(cf.args[i][0]);
+
+		if (op==CF::MINUS)
+			os << "\tif ((" << a << " &= -" << y << ").is_empty()) return 0;\n";
+		else if (op==CF::POWER)
+			os << "\tif (!bwd_pow(" << y << "," << ((const ExprPower&) f.node(i)).expon << "," << a << ")) return 0;\n";
+		else if (unary(op))
+			os << "\tif (!bwd_" << unary(op) << "(" << y << "," << a << ")) return 0;\n";
+		else
+			os << "\tif (!bwd_" << binary(op) << "(" << y << "," << a << "," << val(cf.args[i][1]) << ")) return 0;\n";
+	}
+}
+
+void FunctionCodeGen::gradient(ostream& os, int k) const {
+	const CompiledFunction& cf=f.cf;
+
+	// the nodes of the kth component
+	vector<bool> sub(n,false);
+	sub[roots[k]]=true;
+	for (int i=roots[k]; i<n; i++) {
+		if (!sub[i] || cf.code[i]==CF::CST || cf.code[i]==CF::SYM) continue;
+		for (int j=0; j<cf.nb_args[i]; j++)
+			sub[cf.args[i][j]]=true;
+	}
+
+	// name of the variable storing the derivative w.r.t. the ith node
+	stringstream* s=new stringstream[n];
+	for (int i=0; i<n; i++) {
+		if (pos[i]!=-1)
+			s[i] << "J[" << k*f.nb_var()+pos[i] << "]";
+		else
+			s[i] << "g" << i;
+	}
+
+	for (int i=roots[k]; i<n; i++) {
+		if (sub[i] && is_local(i))
+			os << "\t\tInterval g" << i << "(" << (i==roots[k]? 1 : 0) << ");\n";
+	}
+	if (pos[roots[k]]!=-1)
+		os << "\t\t" << s[roots[k]].str() << "=1;\n";
+
+	for (int i=roots[k]; i<n; i++) {
+		if (!sub[i] || !is_local(i) || cf.code[i]==CF::CST) continue;
+
+		int op=cf.code[i];
+		string y=val(i);
+		string gy=s[i].str();
+		string a=val(cf.args[i][0]);
+		string ga=s[cf.args[i][0]].str();
+		string b=cf.nb_args[i]>1 ? val(cf.args[i][1]) : "";
+		string gb=cf.nb_args[i]>1 ? s[cf.args[i][1]].str() : "";
+
+		os << "\t\t";
+		switch (op) {
+		case CF::ADD:   os << ga << " += " << gy << "; " << gb << " += " << gy << ";"; break;
+		case CF::SUB:   os << ga << " += " << gy << "; " << gb << " += -" << gy << ";"; break;
+		case CF::MUL:   os << ga << " += " << gy << "*" << b << "; " << gb << " += " << gy << "*" << a << ";"; break;
+		case CF::DIV:   os << ga << " += " << gy << "/" << b << "; " << gb << " += " << gy << "*(-" << a << ")/sqr(" << b << ");"; break;
+		case CF::MAX:
+		case CF::MIN:
+		{
+			// see Gradient::max_bwd and Gradient::min_bwd
+			string g1=op==CF::MAX ? ga : gb;
+			string g2=op==CF::MAX ? gb : ga;
+			os << "if (" << a << ".lb()>" << b << ".ub()) " << g1 << " += " << gy << "; "
+			   << "else if (" << b << ".lb()>" << a << ".ub()) " << g2 << " += " << gy << "; "
+			   << "else { " << ga << " += " << gy << "*Interval(0,1); " << gb << " += " << gy << "*Interval(0,1); }";
+			break;
+		}
+		case CF::ATAN2:
+			os << ga << " += " << gy << "*" << b << "/(sqr(" << b << ")+sqr(" << a << ")); "
+			   << gb << " += " << gy << "*-" << a << "/(sqr(" << b << ")+sqr(" << a << "));";
+			break;
+		case CF::MINUS: os << ga << " += -1.0*" << gy << ";"; break;
+		case CF::SIGN:  os << "if (" << a << ".contains(0)) " << ga << " += " << gy << "*Interval::pos_reals();"; break;
+		case CF::ABS:
+			os << "if (" << a << ".lb()>0) " << ga << " += 1.0*" << gy << "; "
+			   << "else if (" << a << ".ub()<0) " << ga << " += -1.0*" << gy << "; "
+			   << "else " << ga << " += Interval(-1,1)*" << gy << ";";
+			break;
+		case CF::POWER:
+		{
+			int p=((const ExprPower&) f.node(i)).expon;
+			os << ga << " += " << gy << "*" << p << "*pow(" << a << "," << p-1 << ");";
+			break;
+		}
+		case CF::SQR:   os << ga << " += " << gy << "*2.0*" << a << ";"; break;
+		case CF::SQRT:  os << ga << " += " << gy << "*0.5/sqrt(" << a << ");"; break;
+		case CF::EXP:   os << ga << " += " << gy << "*exp(" << a << ");"; break;
+		case CF::LOG:   os << ga << " += " << gy << "/" << a << ";"; break;
+		case CF::COS:   os << ga << " += " << gy << "*-sin(" << a << ");"; break;
+		case CF::SIN:   os << ga << " += " << gy << "*cos(" << a << ");"; break;
+		case CF::TAN:   os << ga << " += " << gy << "*(1.0+sqr(tan(" << a << ")));"; break;
+		case CF::COSH:  os << ga << " += " << gy << "*sinh(" << a << ");"; break;
+		case CF::SINH:  os << ga << " += " << gy << "*cosh(" << a << ");"; break;
+		case CF::TANH:  os << ga << " += " << gy << "*(1.0-sqr(tanh(" << a << ")));"; break;
+		case CF::ACOS:  os << ga << " += " << gy << "*-1.0/sqrt(1.0-sqr(" << a << "));"; break;
+		case CF::ASIN:  os << ga << " += " << gy << "*1.0/sqrt(1.0-sqr(" << a << "));"; break;
+		case CF::ATAN:  os << ga << " += " << gy << "*1.0/(1.0+sqr(" << a << "));"; break;
+		case CF::ACOSH: os << ga << " += " << gy << "*1.0/sqrt(sqr(" << a << ")-1.0);"; break;
+		case CF::ASINH: os << ga << " += " << gy << "*1.0/sqrt(1.0+sqr(" << a << "));"; break;
+		case CF::ATANH: os << ga << " += " << gy << "*1.0/(1.0-sqr(" << a << "));"; break;
+		case CF::FLOOR:
+		case CF::CEIL:
+			os << "if (std::floor(" << a << ".ub())>=" << a << ".lb()) " << ga << " += " << gy << "*Interval::pos_reals();";
+			break;
+		case CF::SAW:
+			os << "if (round(" << a << ".lb())==round(" << a << ".ub())) " << ga << " += " << gy << "; "
+			   << "else " << ga << " += " << gy << "*Interval(NEG_INFINITY,1);";
+			break;
+		default:
+			assert(false);
+		}
+		os << "\n";
+	}
+
+	delete[] s;
+}
+
+void FunctionCodeGen::generate(ostream& os, const char* _prefix) const {
+	assert(_supported);
+
+	string p=_prefix ? string(_prefix) : default_prefix(f);
+	int m=roots.size();
+
+	os << "// Code generated by Ibex " << _IBEX_RELEASE_ << " (" << _IBEX_INTERVAL_LIB_ << ") for the function \"" << f.name << "\".\n";
+	os << "// Entry points: see ibex_NativeCode.h\n\n";
+	os << "#include \"ibex_NativeCode.h\"\n\n";
+	os << "#include <cmath>\n\n";
+	os << "using namespace ibex;\n\n";
+	os << "extern \"C\" {\n\n";
+
+	os << "int " << p << "_abi() { return native_code_abi(); }\n\n";
+	os << "uint64_t " << p << "_hash() { return native_code_hash(" << NativeCode::expr_hash(f) << "ULL); }\n\n";
+	os << "int " << p << "_nb_var() { return " << f.nb_var() << "; }\n\n";
+	os << "int " << p << "_image_dim() { return " << m << "; }\n\n";
+
+	os << "int " << p << "_eval(const Interval* x, Interval* y) {\n";
+	forward(os);
+	for (int k=0; k<m; k++)
+		os << "\ty[" << k << "]=" << val(roots[k]) << ";\n";
+	os << "\treturn 1;\n}\n\n";
+
+	os << "int " << p << "_proj(const Interval* y, Interval* x) {\n";
+	forward(os);
+	backward(os);
+	os << "\treturn 1;\n}\n\n";
+
+	os << "int " << p << "_jacobian(const Interval* x, Interval* J) {\n";
+	forward(os);
+	os << "\tfor (int j=0; j<" << m*f.nb_var() << "; j++) J[j]=0;\n";
+	for (int k=0; k<m; k++) {
+		os << "\t{ // component " << k << "\n";
+		gradient(os,k);
+		os << "\t}\n";
+	}
+	os << "\treturn 1;\n}\n\n";
+
+	os << "} // extern \"C\"\n";
+}
+
+} // end namespace ibex
@@ -0,0 +1,132 @@
+/* ============================================================================
+ * I B E X - Generation of the C++ code of a function
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_FUNCTION_CODE_GEN_H__
+#define __IBEX_FUNCTION_CODE_GEN_H__
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace ibex {
+
+class Function;
+
+/**
+ * \ingroup function
+ *
+ * \brief Generation of the C++ code of a function.
+ *
+ * The forward/backward algorithms (#Eval, #HC4Revise, #Gradient) interpret
+ * the compiled function (#CompiledFunction), i.e., dispatch on the operation
+ * of each node. This class emits instead straight-line C++ code for the
+ * evaluation, the HC4Revise projection and the Jacobian matrix of a given
+ * function, where each node becomes a local variable and each operation a
+ * direct call to the interval arithmetic.
+ *
+ * The code is meant to be compiled into a shared object and loaded with
+ * #Function::load_native(const char*, const char*) (see #NativeCode for
+ * the entry points).
+ *
+ * Only expressions made of scalar operations can be generated, i.e.,
+ * functions where variables appear through scalar components (like x or
+ * x[i] or x[i][j]) and whose result is either a scalar or a vector of scalar
+ * expressions (this is the case of all functions built from a Minibex
+ * system). Generic operators and "chi" are not supported.
+ */
+class FunctionCodeGen {
+public:
+	/**
+	 * \brief Prepare the generation of the code of f.
+	 */
+	FunctionCodeGen(const Function& f);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~FunctionCodeGen();
+
+	/**
+	 * \brief True if the code of the function can be generated.
+	 */
+	bool supported() const;
+
+	/**
+	 * \brief Write the code.
+	 *
+	 * \param prefix - the prefix of the entry points. By default,
+	 *                 see #default_prefix(const Function&).
+	 *
+	 * \pre the function is supported.
+	 */
+	void generate(std::ostream& os, const char* prefix=NULL) const;
+
+	/**
+	 * \brief The default prefix of the entry points of f.
+	 *
+	 * "ibex_" followed by the name of the function (where
+	 * characters that are not allowed in a C identifier are
+	 * replaced by '_').
+	 */
+	static std::string default_prefix(const Function& f);
+
+	/**
+	 * \brief The function.
+	 */
+	const Function& f;
+
+private:
+	// name of a binary operation in the interval arithmetic (NULL if none)
+	static const char* binary(int op);
+
+	// name of a unary operation in the interval arithmetic (NULL if none)
+	static const char* unary(int op);
+
+	// operations that raise an EmptyBoxException in Eval
+	static bool restricted(int op);
+
+	// name of the variable storing the value of the ith node
+	std::string val(int i) const;
+
+	// forward phase: one statement per node
+	void forward(std::ostream& os) const;
+
+	// backward phase of HC4Revise: one statement per node
+	void backward(std::ostream& os) const;
+
+	// gradient of the kth component (backward phase)
+	void gradient(std::ostream& os, int k) const;
+
+	// true if the ith node is not a symbol or an index of a symbol
+	// and must be declared as a local variable.
+	bool is_local(int i) const;
+
+	// number of nodes
+	int n;
+
+	// is the function supported
+	bool _supported;
+
+	// if the ith node is a scalar component of a variable
+	// then pos[i] is the index of this variable, -1 otherwise.
+	int* pos;
+
+	// true if the ith node is a symbol or an index of a symbol
+	bool* var;
+
+	// the nodes of each component
+	// (only one if the function is real-valued)
+	std::vector<int> roots;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_FUNCTION_CODE_GEN_H__
@@ -18,7 +18,8 @@ using namespace std;
 namespace ibex {
 
 Gradient::Gradient(Eval& e): f(e.f), _eval(e), d(e.d), g(f),
-		coeff_matrix(f.image_dim(),f.nb_var()+1), is_linear(new bool[f.image_dim()]) {
+		coeff_matrix(f.image_dim(),f.nb_var()+1), is_linear(new bool[f.image_dim()]),
+		jacobian_mode(AUTO_MODE), _fwd(NULL), row(f.nb_var()), hansen_box(f.nb_var()) {
 
 	if (f.expr().dim.is_matrix())
 		return; // class not called in this case
@@ -37,6 +38,17 @@ Gradient::Gradient(Eval& e): f(e.f), _eval(e), d(e.d), g(f),
 
 Gradient::~Gradient() {
 	delete[] is_linear;
+	delete _fwd;
+}
+
+bool Gradient::forward_mode(const BitSet& rows, int v) {
+	if (jacobian_mode==REVERSE_MODE) return false;
+
+	if (_fwd==NULL) _fwd=new CompressedJacobian(_eval);
+
+	if (!_fwd->is_supported()) return false;
+
+	return jacobian_mode==FORWARD_MODE || _fwd->is_faster(rows,v);
 }
 
 void Gradient::gradient(const Array<Domain>& d2, IntervalVector& gbox) {
@@ -132,6 +144,13 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitS
 
 		gradient(box,J[0]);
 
+	} else if (forward_mode(nonlinear_components,v)) {
+
+		// One forward sweep per color (or in the direction of x_v).
+		// The domains of all the nodes are calculated once.
+		if (!_fwd->jacobian(box,J,components,nonlinear_components,v))
+			J.set_empty();
+
 	} else if(_eval.fwd_agenda!=NULL) {
 
 		// If f is just a vector of expressions, we avoid to generate
@@ -195,7 +214,7 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitS
 		for (int i=0; i<m; i++) {
 			c=i==0? components.min() : components.next(c);
 
-			f[c].gradient(box,J[i]);
+			_eval.ctx.comp(c).gradient(box,J[i]);
 
 			if (J[i].is_empty()) {
 				J.set_empty();
@@ -246,22 +265,9 @@ void Gradient::jacobian(const Array<Domain>& d, IntervalMatrix& J) {
 	// ================== Option n°1 ===========================
 	// calculate the gradient of each component of f
 	for (int i=0; i<m; i++) {
-		const Function* fi=dynamic_cast<const Function*>(&f[i]);
-		if (fi!=NULL) {
-			// if this is a Function object we can
-			// directly calculate the gradient with d
-			fi->deriv_calculator().gradient(d,J[i]);
-		} else {
-			// otherwise we must give a box in argument
-			// TODO add gradient with Array<Domain> in argument
-			// in Function interface?
-			// But, for the moment, cannot happen, because
-			// this function is called by apply_bwd.
-			IntervalVector box(f.nb_var());
-			load(box,d);
-			f[i].gradient(box,J[i]);
-			if (J[i].is_empty()) { J.set_empty(); return; }
-		}
+		// the component is a Function object so we can
+		// directly calculate the gradient with d
+		_eval.ctx.comp(i).deriv_calculator().gradient(d,J[i]);
 	}
 
 	// ================== Option n°2 ===========================
@@ -269,6 +275,106 @@ void Gradient::jacobian(const Array<Domain>& d, IntervalMatrix& J) {
 	// TODO
 }
 
+bool Gradient::comp_gradient(int i, const IntervalVector& box) {
+	if (f.image_dim()==1)
+		gradient(box,row);
+	else
+		_eval.ctx.comp(i).gradient(box,row);
+	return !row.is_empty();
+}
+
+void Gradient::jacobian(const IntervalVector& box, SparseIntervalMatrix& J) {
+
+	int m=f.image_dim();
+
+	if (f.expr().dim.is_matrix()) {
+		ibex_error("Cannot called \"jacobian\" on a matrix-valued function");
+	}
+
+	assert(J.nb_rows()==m);
+	assert(J.nb_cols()==f.nb_var());
+	assert(box.size()==f.nb_var());
+
+	J.clear();
+
+	BitSet nonlinear_components=BitSet::empty(m);
+
+	for (int i=0; i<m; i++) {
+		if (is_linear[i]) {
+			for (int k=J.row_begin(i); k<J.row_end(i); k++)
+				J[k]=coeff_matrix[i][J.col(k)];
+		} else
+			nonlinear_components.add(i);
+	}
+
+	if (nonlinear_components.empty()) return;
+
+	if (m>1 && forward_mode(nonlinear_components,-1)) {
+		if (!_fwd->jacobian(box,J,nonlinear_components))
+			J.set_empty();
+		return;
+	}
+
+	for (int i=0; i<m; i++) {
+
+		if (is_linear[i]) continue;
+
+		if (!comp_gradient(i,box)) {
+			J.set_empty();
+			return;
+		}
+
+		for (int k=J.row_begin(i); k<J.row_end(i); k++)
+			J[k]=row[J.col(k)];
+	}
+}
+
+void Gradient::hansen_matrix(const IntervalVector& box, const IntervalVector& x0, SparseIntervalMatrix& H) {
+
+	int m=f.image_dim();
+
+	if (f.expr().dim.is_matrix()) {
+		ibex_error("Cannot called \"hansen_matrix\" on a matrix-valued function");
+	}
+
+	assert(H.nb_rows()==m);
+	assert(H.nb_cols()==f.nb_var());
+	assert(box.size()==f.nb_var());
+	assert(x0.size()==f.nb_var());
+
+	// Column j of the Hansen matrix is calculated with the domains
+	// of x_0...x_j set to box and the ones of x_{j+1}...x_{n-1}
+	// set to x0. Since the ith component only depends on the
+	// variables of the ith row (sorted by increasing indices),
+	// the domains are set incrementally along the row.
+	hansen_box=x0;
+
+	H.clear();
+
+	for (int i=0; i<m; i++) {
+
+		const IntervalVector& coeff=coeff_matrix[i];
+
+		for (int k=H.row_begin(i); k<H.row_end(i); k++) {
+			int j=H.col(k);
+
+			hansen_box[j]=box[j];
+
+			if (!coeff[j].is_unbounded()) // linearity w.r.t. to x_j is enough
+				H[k]=coeff[j];
+			else if (comp_gradient(i,hansen_box))
+				H[k]=row[j];
+			else {
+				H.set_empty();
+				return;
+			}
+		}
+
+		for (int k=H.row_begin(i); k<H.row_end(i); k++)
+			hansen_box[H.col(k)]=x0[H.col(k)];
+	}
+}
+
 void Gradient::vector_fwd(int* x, int y) {
 	const ExprVector& v = (const ExprVector&) f.node(y);
 
@@ -355,7 +461,7 @@ void Gradient::apply_bwd(int* x, int y) {
 	IntervalVector tmp_g(n);
 
 	if (a.func.expr().dim.is_scalar()) {
-		a.func.deriv_calculator().gradient(d2,tmp_g);
+		_eval.ctx.sub(a.func).deriv_calculator().gradient(d2,tmp_g);
 		//cout << "tmp-g=" << tmp_g << endl;
 		tmp_g *= g[y].i();   // pre-multiplication by y.g
 		tmp_g += old_g;      // addition to the old value of g
@@ -365,7 +471,7 @@ void Gradient::apply_bwd(int* x, int y) {
 			not_implemented("automatic differentiation of matrix-valued function");
 		int m=a.func.expr().dim.vec_size();
 		IntervalMatrix J(m,n);
-		a.func.deriv_calculator().jacobian(d2,J);
+		_eval.ctx.sub(a.func).deriv_calculator().jacobian(d2,J);
 		tmp_g = g[y].v()*J; // pre-multiplication by y.g
 		tmp_g += old_g;
 		load(g2,tmp_g);
@@ -13,8 +13,10 @@
 #define __IBEX_GRADIENT_H__
 
 #include "ibex_Eval.h"
+#include "ibex_SparseIntervalMatrix.h"
 #include "ibex_BwdAlgorithm.h"
 #include "ibex_Agenda.h"
+#include "ibex_CompressedJacobian.h"
 
 namespace ibex {
 
@@ -61,6 +63,10 @@ public:
 	/**
 	 * \brief Calculate some components of the Jacobian of f on the box \a box and store the result in \a J.
 	 *
+	 * The rows are calculated either in reverse mode (one backward sweep per row)
+	 * or in forward mode (one forward sweep per group of structurally orthogonal
+	 * columns, see #CompressedJacobian), depending on #jacobian_mode.
+	 *
 	 * \param v - only update the vth column of J (useful for Hansen's scheme). Default value is -1
 	 *            (means: update all the columns).
 	 */
@@ -71,6 +77,22 @@ public:
 	 */
 	void jacobian(const Array<Domain>& d, IntervalMatrix& J);
 
+	/**
+	 * \brief Calculate the Jacobian of f on the box \a box (sparse version).
+	 *
+	 * Only the entries of the pattern of J are calculated.
+	 */
+	void jacobian(const IntervalVector& box, SparseIntervalMatrix& J);
+
+	/**
+	 * \brief Calculate the Hansen matrix of f (sparse version).
+	 *
+	 * Same as #Fnc::hansen_matrix(const IntervalVector&, const IntervalVector&, IntervalMatrix&)
+	 * but the matrix is calculated row by row, each entry requiring the
+	 * gradient of one component only (instead of the full Jacobian matrix).
+	 */
+	void hansen_matrix(const IntervalVector& box, const IntervalVector& x0, SparseIntervalMatrix& H);
+
 	/* ====================================== Forward =================================== */
 
 	inline void idx_fwd(int , int ) { /* nothing to do */ }
@@ -169,9 +191,9 @@ public:
 	inline void acosh_bwd (int x, int y) { g[x].i() += g[y].i() * 1.0 / sqrt(sqr(d[x].i()) -1.0); }
 	inline void asinh_bwd (int x, int y) { g[x].i() += g[y].i() * 1.0 / sqrt(1.0+sqr(d[x].i())); }
 	inline void atanh_bwd (int x, int y) { g[x].i() += g[y].i() * 1.0 / (1.0-sqr(d[x].i())); }
-	inline void floor_bwd (int x, int y);
-	inline void ceil_bwd  (int x, int y);
-	inline void saw_bwd   (int x, int y);
+	       void floor_bwd (int x, int y);
+	       void ceil_bwd  (int x, int y);
+	       void saw_bwd   (int x, int y);
 
 	inline void add_V_bwd (int x1, int x2, int y) { g[x1].v() += g[y].v();        g[x2].v() += g[y].v(); }
 	inline void add_M_bwd (int x1, int x2, int y) { g[x1].m() += g[y].m();        g[x2].m() += g[y].m(); }
@@ -193,6 +215,33 @@ public:
 	IntervalMatrix coeff_matrix;
 	// True if the ith component is linear (wrt all variables)
 	bool *is_linear;
+
+	/**
+	 * \brief Mode of automatic differentiation for Jacobian matrices.
+	 *
+	 * AUTO_MODE (default): the forward mode is used if the function
+	 * is supported and is expected to be faster than the reverse mode
+	 * (see #CompressedJacobian::is_faster(const BitSet&, int) const).
+	 */
+	typedef enum { AUTO_MODE, FORWARD_MODE, REVERSE_MODE } JacobianMode;
+
+	JacobianMode jacobian_mode;
+
+private:
+	// true if the rows of the Jacobian must be calculated in forward mode
+	// (the forward-mode algorithm is built on first call)
+	bool forward_mode(const BitSet& rows, int v);
+
+	// forward-mode Jacobian (NULL if not built yet)
+	CompressedJacobian* _fwd;
+
+	// gradient of the ith component in "row"
+	// (return false if the gradient is empty)
+	bool comp_gradient(int i, const IntervalVector& box);
+
+	// buffers for the sparse Jacobian/Hansen matrices
+	IntervalVector row;
+	IntervalVector hansen_box;
 };
 
 } // namespace ibex
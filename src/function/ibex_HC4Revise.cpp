@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Dec 31, 2011
-// Last update : Jan 28, 2020
+// Last update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_Function.h"
@@ -98,7 +98,7 @@ void HC4Revise::apply_bwd(int* x, int y) {
 	// it will be caught by proj(...,IntervalVector& x).
 	// (it is a protected function, not called outside of the class
 	// so there is no risk)
-	a.func.hc4revise().proj(d[y],d2);
+	eval.ctx.sub(a.func).hc4revise().proj(d[y],d2);
 }
 
 void HC4Revise::vector_bwd(int* x, int y) {
@@ -0,0 +1,369 @@
+/* ============================================================================
+ * I B E X - Hessian matrix (forward-over-reverse)
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Function.h"
+#include "ibex_Hessian.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// Derivative (in the direction of the tangent) of the
+// first derivative of a nonsmooth operator, multiplied
+// by the adjoint gy, when the domain contains a point
+// where the first derivative jumps.
+Interval jump(const Interval& gy, double tangent_mag) {
+	return (gy==Interval::zero() || tangent_mag==0) ? Interval::zero() : Interval::all_reals();
+}
+
+}
+
+Hessian::Hessian(Gradient& grad) : f(grad.f), _grad(grad), d(grad.d), g(grad.g),
+		fwd(grad._eval), t(fwd.t), h(f), one(1,Interval::one()), u(f.nb_var()), col(f.nb_var()) {
+
+}
+
+bool Hessian::adjoints(const IntervalVector& box, const IntervalVector& w) {
+
+	if (f.expr().dim.is_matrix()) {
+		ibex_error("Cannot called \"hessian\" on a matrix-valued function");
+	}
+
+	if (w.size()!=f.image_dim()) {
+		ibex_error("Hessian: the number of weights does not match the number of components");
+	}
+
+	if (!is_supported()) {
+		not_implemented("Hessian of a function with \"apply\" or generic operators");
+	}
+
+	if (_grad._eval.eval(box).is_empty())
+		// outside definition domain
+		return false;
+
+	col.clear();
+
+	g.write_arg_domains(col);
+
+	f.forward<Gradient>(_grad);
+
+	if (f.expr().dim.is_scalar())
+		g.top->i()=w[0];
+	else
+		g.top->v()=w;
+
+	f.backward<Gradient>(_grad);
+
+	return true;
+}
+
+void Hessian::product(const IntervalVector& u, IntervalVector& Hu) {
+
+	fwd.tangents(u);
+
+	for (int i=0; i<f.nb_nodes(); i++)
+		h[i].clear();
+
+	f.backward<Hessian>(*this);
+
+	h.read_arg_domains(Hu);
+}
+
+void Hessian::hessian(const IntervalVector& box, const IntervalVector& w, IntervalMatrix& H, int v) {
+	int n=f.nb_var();
+
+	assert(H.nb_rows()==n);
+	assert(H.nb_cols()==n);
+	assert(box.size()==n);
+
+	if (!adjoints(box,w)) {
+		H.set_empty();
+		return;
+	}
+
+	if (v!=-1) {
+		u.clear();
+		u[v]=1.0;
+		product(u,col);
+		H.set_col(v,col);
+		return;
+	}
+
+	for (int j=0; j<n; j++) {
+		if (fwd.color(j)==-1)
+			// f does not depend on x_j
+			col.clear();
+		else {
+			u.clear();
+			u[j]=1.0;
+			product(u,col);
+		}
+		H.set_col(j,col);
+	}
+
+	// H_ij and H_ji are two enclosures of the same
+	// second derivative (unless f is not C2)
+	for (int i=0; i<n; i++)
+		for (int j=i+1; j<n; j++) {
+			Interval hij=H[i][j] & H[j][i];
+			if (!hij.is_empty()) {
+				H[i][j]=hij;
+				H[j][i]=hij;
+			}
+		}
+}
+
+void Hessian::hessian_vector(const IntervalVector& box, const IntervalVector& w, const IntervalVector& u, IntervalVector& Hu) {
+	assert(box.size()==f.nb_var());
+	assert(u.size()==f.nb_var());
+	assert(Hu.size()==f.nb_var());
+
+	if (!adjoints(box,w)) {
+		Hu.set_empty();
+		return;
+	}
+
+	product(u,Hu);
+}
+
+void Hessian::idx_cp_bwd(int x, int y) {
+	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
+
+	const ExprIndex& e = (const ExprIndex&) f.node(y);
+	Domain hx=h[x][e.index];
+	hx = hx + h[y];
+	h[x].put(e.index.first_row(), e.index.first_col(), hx);
+}
+
+void Hessian::vector_bwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	const ExprVector& v = (const ExprVector&) f.node(y);
+
+	assert(v.type()!=Dim::SCALAR);
+
+	int j=0;
+
+	if (v.dim.is_vector()) {
+		for (int i=0; i<v.length(); i++) {
+			if (v.arg(i).dim.is_vector()) {
+				h[x[i]].v()+=h[y].v().subvector(j,j+v.arg(i).dim.vec_size()-1);
+				j+=v.arg(i).dim.vec_size();
+			} else {
+				h[x[i]].i()+=h[y].v()[j];
+				j++;
+			}
+		}
+
+		assert(j==v.dim.vec_size());
+	}
+	else {
+		if (v.row_vector()) {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					h[x[i]].m()+=h[y].m().submatrix(0,v.dim.nb_rows()-1,j,j+v.arg(i).dim.nb_cols()-1);
+					j+=v.arg(i).dim.nb_cols();
+				} else if (v.arg(i).dim.is_vector()) {
+					h[x[i]].v()+=h[y].m().col(j);
+					j++;
+				}
+			}
+		} else {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					h[x[i]].m()+=h[y].m().submatrix(j,j+v.arg(i).dim.nb_rows()-1,0,v.dim.nb_cols()-1);
+					j+=v.arg(i).dim.nb_rows();
+				} else if (v.arg(i).dim.is_vector()) {
+					h[x[i]].v()+=h[y].m().row(j);
+					j++;
+				}
+			}
+		}
+	}
+}
+
+void Hessian::apply_bwd(int*, int) {
+	not_implemented("Hessian of a function with \"apply\"");
+}
+
+void Hessian::gen1_bwd(int, int) {
+	not_implemented("Hessian of a function with generic operators");
+}
+
+void Hessian::gen2_bwd(int, int, int) {
+	not_implemented("Hessian of a function with generic operators");
+}
+
+void Hessian::chi_bwd(int a, int b, int c, int y) {
+	if (d[a].i().ub()<0) {
+		h[b].i() += h[y].i();
+	}
+	else if (d[a].i().lb()>0) {
+		h[c].i() += h[y].i();
+	} else {
+		Interval ga; // see Gradient::chi_bwd
+		if (d[b].i().is_degenerated() && d[c].i().is_degenerated()) {
+			double _b =d[b].i().ub();
+			double _c =d[c].i().ub();
+			if (_b<_c) ga=Interval::pos_reals();
+			else if (_b>_c) ga=Interval::neg_reals();
+			else ga=Interval::zero();
+		} else {
+			ga=Interval::all_reals();
+		}
+
+		Interval j=jump(g[y].i(), t[a].i().mag()+t[b].i().mag()+t[c].i().mag());
+
+		h[a].i() += h[y].i() * ga + j;
+		h[b].i() += h[y].i() * Interval(0,1) + j;
+		h[c].i() += h[y].i() * Interval(0,1) + j;
+	}
+}
+
+void Hessian::div_bwd(int x1, int x2, int y) {
+	const Interval& d1=d[x1].i();
+	const Interval& d2=d[x2].i();
+	Interval d2_2=sqr(d2);
+
+	h[x1].i() += h[y].i()/d2 - g[y].i()*t[x2].i()/d2_2;
+	h[x2].i() += h[y].i()*(-d1)/d2_2 + g[y].i()*(-t[x1].i()/d2_2 + 2.0*d1*t[x2].i()/pow(d2,3));
+}
+
+void Hessian::max_bwd(int x1, int x2, int y) {
+	if (d[x1].i().lb() > d[x2].i().ub()) {
+		h[x1].i() += h[y].i();
+	}
+	else if (d[x2].i().lb() > d[x1].i().ub()) {
+		h[x2].i() += h[y].i();
+	} else {
+		Interval j=jump(g[y].i(), t[x1].i().mag()+t[x2].i().mag());
+		h[x1].i() += h[y].i() * Interval(0,1) + j;
+		h[x2].i() += h[y].i() * Interval(0,1) + j;
+	}
+}
+
+void Hessian::min_bwd(int x1, int x2, int y) {
+	if (d[x1].i().lb() > d[x2].i().ub()) {
+		h[x2].i() += h[y].i();
+	}
+	else if (d[x2].i().lb() > d[x1].i().ub()) {
+		h[x1].i() += h[y].i();
+	} else {
+		Interval j=jump(g[y].i(), t[x1].i().mag()+t[x2].i().mag());
+		h[x1].i() += h[y].i() * Interval(0,1) + j;
+		h[x2].i() += h[y].i() * Interval(0,1) + j;
+	}
+}
+
+void Hessian::atan2_bwd(int x1, int x2, int y) {
+	const Interval& d1=d[x1].i();
+	const Interval& d2=d[x2].i();
+	Interval r=sqr(d1)+sqr(d2);
+	// tangent of r
+	Interval tr=2.0*(d1*t[x1].i()+d2*t[x2].i());
+
+	h[x1].i() += h[y].i()*d2/r + g[y].i()*(t[x2].i()/r - d2*tr/sqr(r));
+	h[x2].i() += h[y].i()*(-d1)/r + g[y].i()*(-t[x1].i()/r + d1*tr/sqr(r));
+}
+
+void Hessian::sign_bwd(int x, int y) {
+	if (d[x].i().contains(0))
+		h[x].i() += h[y].i()*Interval::pos_reals() + jump(g[y].i(), t[x].i().mag());
+	else ; // nothing to do: derivative is zero
+}
+
+void Hessian::abs_bwd(int x, int y) {
+	if (d[x].i().lb()>0) h[x].i() += h[y].i();
+	else if (d[x].i().ub()<0) h[x].i() += -h[y].i();
+	else h[x].i() += Interval(-1,1)*h[y].i() + jump(g[y].i(), t[x].i().mag());
+}
+
+void Hessian::power_bwd(int x, int y, int p) {
+	if (p==0) return; // nothing to do: derivative is zero
+
+	if (p==1) h[x].i() += h[y].i();
+	else unary(x, y, p * pow(d[x].i(), p-1), p * (p-1) * pow(d[x].i(), p-2));
+}
+
+void Hessian::sqrt_bwd(int x, int y) {
+	Interval s=sqrt(d[x].i());
+	unary(x, y, 0.5/s, -0.25/(d[x].i()*s));
+}
+
+void Hessian::tan_bwd(int x, int y) {
+	Interval tx=tan(d[x].i());
+	Interval d1=1.0+sqr(tx);
+	unary(x, y, d1, 2.0*tx*d1);
+}
+
+void Hessian::tanh_bwd(int x, int y) {
+	Interval tx=tanh(d[x].i());
+	Interval d1=1.0-sqr(tx);
+	unary(x, y, d1, -2.0*tx*d1);
+}
+
+void Hessian::acos_bwd(int x, int y) {
+	Interval r=1.0-sqr(d[x].i());
+	Interval s=sqrt(r);
+	unary(x, y, -1.0/s, -d[x].i()/(r*s));
+}
+
+void Hessian::asin_bwd(int x, int y) {
+	Interval r=1.0-sqr(d[x].i());
+	Interval s=sqrt(r);
+	unary(x, y, 1.0/s, d[x].i()/(r*s));
+}
+
+void Hessian::acosh_bwd(int x, int y) {
+	Interval r=sqr(d[x].i())-1.0;
+	Interval s=sqrt(r);
+	unary(x, y, 1.0/s, -d[x].i()/(r*s));
+}
+
+void Hessian::asinh_bwd(int x, int y) {
+	Interval r=1.0+sqr(d[x].i());
+	Interval s=sqrt(r);
+	unary(x, y, 1.0/s, -d[x].i()/(r*s));
+}
+
+void Hessian::floor_bwd(int x, int y) {
+	if (std::floor(d[x].i().ub()) >= d[x].i().lb())
+		h[x].i() += h[y].i()*Interval::pos_reals() + jump(g[y].i(), t[x].i().mag());
+	else ; // nothing to do: derivative is zero
+}
+
+void Hessian::ceil_bwd(int x, int y) {
+	if (std::floor(d[x].i().ub()) >= d[x].i().lb())
+		h[x].i() += h[y].i()*Interval::pos_reals() + jump(g[y].i(), t[x].i().mag());
+	else ; // nothing to do: derivative is zero
+}
+
+void Hessian::saw_bwd(int x, int y) {
+	if (round(d[x].i().lb()) == round(d[x].i().ub()))
+		h[x].i() += h[y].i();
+	else
+		h[x].i() += h[y].i()*Interval(NEG_INFINITY,1) + jump(g[y].i(), t[x].i().mag());
+}
+
+void Hessian::mul_SV_bwd(int x1, int x2, int y) {
+	h[x1].i() += h[y].v()*d[x2].v() + g[y].v()*t[x2].v();
+	h[x2].v() += d[x1].i()*h[y].v() + t[x1].i()*g[y].v();
+}
+
+void Hessian::mul_SM_bwd(int x1, int x2, int y) {
+	for (int i=0; i<d[y].m().nb_rows(); i++)
+		h[x1].i() += h[y].m()[i]*d[x2].m()[i] + g[y].m()[i]*t[x2].m()[i];
+	h[x2].m() += d[x1].i()*h[y].m() + t[x1].i()*g[y].m();
+}
+
+} // namespace ibex
@@ -0,0 +1,199 @@
+/* ============================================================================
+ * I B E X - Hessian matrix (forward-over-reverse)
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_HESSIAN_H__
+#define __IBEX_HESSIAN_H__
+
+#include "ibex_Gradient.h"
+#include "ibex_CompressedJacobian.h"
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Hessian matrix by automatic differentiation (forward-over-reverse).
+ *
+ * The product of the Hessian matrix of f by a vector u is the derivative of
+ * the gradient of f in the direction u. It is calculated on the DAG of f
+ * itself (no symbolic derivative is generated):
+ * - a forward sweep calculates the tangent of each node in the direction u
+ *   (see #CompressedJacobian::tangents(const IntervalVector&)),
+ * - a backward sweep propagates the adjoint g of each node (as in #Gradient)
+ *   together with its tangent h. For y=op(x), g_x+=g_y*op'(x) gives
+ *   h_x += h_y*op'(x) + g_y*op''(x)*t_x.
+ * The cost of a Hessian-vector product is a small multiple of the cost of
+ * a gradient, and the memory is three domains per node. The full matrix
+ * requires one product per variable. The symmetry of the matrix is used to
+ * refine the result (H_ij and H_ji are two enclosures of the same quantity).
+ *
+ * A vector-valued function f is handled through the weighted sum w^T f, which
+ * is the case of the Lagrangian in the Kuhn-Tucker conditions (the weights
+ * are the multipliers).
+ *
+ * The derivatives of nonsmooth operators (abs, max, sign, etc.) are
+ * (-oo,+oo) when the domain contains a point of non-differentiability.
+ * Calls to other functions (apply) and generic operators are not supported
+ * (see #is_supported()).
+ *
+ * For memory saving, the domains of the nodes and their adjoints are shared with
+ * an already existing Gradient object.
+ */
+class Hessian : public BwdAlgorithm {
+
+public:
+	/**
+	 * \brief Build the Hessian algorithm.
+	 */
+	Hessian(Gradient& grad);
+
+	/**
+	 * \brief False if the function contains operations not supported.
+	 */
+	bool is_supported() const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of a real-valued function.
+	 *
+	 * \param v - only update the vth column of H. Default value is -1
+	 *            (means: update all the columns).
+	 */
+	void hessian(const IntervalVector& box, IntervalMatrix& H, int v=-1);
+
+	/**
+	 * \brief Calculate the Hessian matrix of w^T f.
+	 *
+	 * \param w - the weights of the components of f.
+	 * \param v - only update the vth column of H. Default value is -1
+	 *            (means: update all the columns).
+	 */
+	void hessian(const IntervalVector& box, const IntervalVector& w, IntervalMatrix& H, int v=-1);
+
+	/**
+	 * \brief Calculate the product of the Hessian matrix of a real-valued
+	 *        function by \a u.
+	 */
+	void hessian_vector(const IntervalVector& box, const IntervalVector& u, IntervalVector& Hu);
+
+	/**
+	 * \brief Calculate the product of the Hessian matrix of w^T f by \a u.
+	 */
+	void hessian_vector(const IntervalVector& box, const IntervalVector& w, const IntervalVector& u, IntervalVector& Hu);
+
+	/* ====================================== Backward =================================== */
+
+	inline void idx_bwd    (int, int) { }
+	       void idx_cp_bwd (int x, int y);
+	       void vector_bwd (int* x, int y);
+	inline void symbol_bwd (int) { /* nothing to do */ }
+	inline void cst_bwd    (int) { /* nothing to do */ }
+	       void apply_bwd  (int* x, int y);
+	       void chi_bwd    (int a, int b, int c, int y);
+	       void gen2_bwd   (int x1, int x2, int y);
+	inline void add_bwd    (int x1, int x2, int y) { h[x1].i() += h[y].i();  h[x2].i() += h[y].i(); }
+	inline void mul_bwd    (int x1, int x2, int y) { h[x1].i() += h[y].i()*d[x2].i() + g[y].i()*t[x2].i(); h[x2].i() += h[y].i()*d[x1].i() + g[y].i()*t[x1].i(); }
+	inline void sub_bwd    (int x1, int x2, int y) { h[x1].i() += h[y].i();  h[x2].i() += -h[y].i(); }
+	       void div_bwd    (int x1, int x2, int y);
+	       void max_bwd    (int x1, int x2, int y);
+	       void min_bwd    (int x1, int x2, int y);
+	       void atan2_bwd  (int x1, int x2, int y);
+	       void gen1_bwd   (int x, int y);
+	inline void minus_bwd  (int x, int y) { h[x].i() += -1.0*h[y].i(); }
+	inline void minus_V_bwd(int x, int y) { h[x].v() += -1.0*h[y].v(); }
+	inline void minus_M_bwd(int x, int y) { h[x].m() += -1.0*h[y].m(); }
+	inline void trans_V_bwd(int, int) { /* nothing to do because h[x].v() is a reference to h[y].v() */ }
+	inline void trans_M_bwd(int x, int y) { h[x].m() += h[y].m().transpose(); }
+	       void sign_bwd   (int x, int y);
+	       void abs_bwd    (int x, int y);
+	       void power_bwd  (int x, int y, int p);
+	inline void sqr_bwd   (int x, int y) { unary(x, y, 2.0*d[x].i(), Interval(2.0)); }
+	       void sqrt_bwd  (int x, int y);
+	inline void exp_bwd   (int x, int y) { Interval e=exp(d[x].i()); unary(x, y, e, e); }
+	inline void log_bwd   (int x, int y) { unary(x, y, 1.0/d[x].i(), -1.0/sqr(d[x].i())); }
+	inline void cos_bwd   (int x, int y) { unary(x, y, -sin(d[x].i()), -cos(d[x].i())); }
+	inline void sin_bwd   (int x, int y) { unary(x, y, cos(d[x].i()), -sin(d[x].i())); }
+	       void tan_bwd   (int x, int y);
+	inline void cosh_bwd  (int x, int y) { unary(x, y, sinh(d[x].i()), cosh(d[x].i())); }
+	inline void sinh_bwd  (int x, int y) { unary(x, y, cosh(d[x].i()), sinh(d[x].i())); }
+	       void tanh_bwd  (int x, int y);
+	       void acos_bwd  (int x, int y);
+	       void asin_bwd  (int x, int y);
+	inline void atan_bwd  (int x, int y) { unary(x, y, 1.0/(1.0+sqr(d[x].i())), -2.0*d[x].i()/sqr(1.0+sqr(d[x].i()))); }
+	       void acosh_bwd (int x, int y);
+	       void asinh_bwd (int x, int y);
+	inline void atanh_bwd (int x, int y) { unary(x, y, 1.0/(1.0-sqr(d[x].i())), 2.0*d[x].i()/sqr(1.0-sqr(d[x].i()))); }
+	       void floor_bwd (int x, int y);
+	       void ceil_bwd  (int x, int y);
+	       void saw_bwd   (int x, int y);
+
+	inline void add_V_bwd (int x1, int x2, int y) { h[x1].v() += h[y].v();        h[x2].v() += h[y].v(); }
+	inline void add_M_bwd (int x1, int x2, int y) { h[x1].m() += h[y].m();        h[x2].m() += h[y].m(); }
+	       void mul_SV_bwd(int x1, int x2, int y);
+	       void mul_SM_bwd(int x1, int x2, int y);
+	inline void mul_VV_bwd(int x1, int x2, int y) { h[x1].v() += h[y].i()*d[x2].v() + g[y].i()*t[x2].v(); h[x2].v() += h[y].i()*d[x1].v() + g[y].i()*t[x1].v(); }
+	inline void mul_MV_bwd(int x1, int x2, int y) { h[x1].m() += outer_product(h[y].v(),d[x2].v()) + outer_product(g[y].v(),t[x2].v()); h[x2].v() += d[x1].m().transpose()*h[y].v() + t[x1].m().transpose()*g[y].v(); }
+	inline void mul_MM_bwd(int x1, int x2, int y) { h[x1].m() += h[y].m()*d[x2].m().transpose() + g[y].m()*t[x2].m().transpose(); h[x2].m() += d[x1].m().transpose()*h[y].m() + t[x1].m().transpose()*g[y].m(); }
+	inline void mul_VM_bwd(int x1, int x2, int y) { h[x1].v() += d[x2].m()*h[y].v() + t[x2].m()*g[y].v(); h[x2].m() += outer_product(d[x1].v(),h[y].v()) + outer_product(t[x1].v(),g[y].v()); }
+	inline void sub_V_bwd (int x1, int x2, int y) { h[x1].v() += h[y].v(); h[x2].v() -= h[y].v(); }
+	inline void sub_M_bwd (int x1, int x2, int y) { h[x1].m() += h[y].m(); h[x2].m() -= h[y].m(); }
+
+	Function& f;
+	Gradient& _grad;
+	ExprDomain& d;
+	// adjoints (shared with the Gradient object)
+	ExprDomain& g;
+
+	// forward-mode algorithm for the tangents
+	CompressedJacobian fwd;
+
+	// The tangent of each node
+	ExprDomain& t;
+
+	// The tangent of the adjoint of each node
+	ExprDomain h;
+
+private:
+	// y=op(x), with op' and op'' the first and second derivatives
+	void unary(int x, int y, const Interval& d1, const Interval& d2);
+
+	// evaluation and adjoints of w^T f
+	// (return false if the box is outside of the definition domain)
+	bool adjoints(const IntervalVector& box, const IntervalVector& w);
+
+	// Hessian-vector product (after the calculation of the adjoints)
+	void product(const IntervalVector& u, IntervalVector& Hu);
+
+	IntervalVector one;
+	IntervalVector u;
+	IntervalVector col;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline bool Hessian::is_supported() const {
+	return fwd.is_supported();
+}
+
+inline void Hessian::unary(int x, int y, const Interval& d1, const Interval& d2) {
+	h[x].i() += h[y].i()*d1 + g[y].i()*d2*t[x].i();
+}
+
+inline void Hessian::hessian(const IntervalVector& box, IntervalMatrix& H, int v) {
+	hessian(box, one, H, v);
+}
+
+inline void Hessian::hessian_vector(const IntervalVector& box, const IntervalVector& u, IntervalVector& Hu) {
+	hessian_vector(box, one, u, Hu);
+}
+
+} // namespace ibex
+
+#endif // __IBEX_HESSIAN_H__
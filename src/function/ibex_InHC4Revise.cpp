@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Jul 12, 2012
-// Last Update : Jul 12, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_Function.h"
@@ -75,7 +75,7 @@ public:
 
 }
 
-InHC4Revise::InHC4Revise(Eval& e) : f(e.f), eval(e), d(e.d), p_eval(f), p(p_eval.d) {
+InHC4Revise::InHC4Revise(Eval& e) : f(e.f), eval(e), d(e.d), p_eval(e.ctx), p(p_eval.d) {
 
 }
 
@@ -174,7 +174,7 @@ void InHC4Revise::apply_bwd(int* x, int y) {
 	// it will be caught by iproj(...,IntervalVector& x).
 	// (it is a protected function, not called outside of the class
 	// so there is no risk)
-	a.func.inhc4revise().iproj(d[y],d2,p2);
+	eval.ctx.sub(a.func).inhc4revise().iproj(d[y],d2,p2);
 }
 
 } // end namespace ibex
@@ -0,0 +1,142 @@
+/* ============================================================================
+ * I B E X - Native (compiled) code of a function
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_NativeCode.h"
+#include "ibex_Function.h"
+#include "ibex_Expr2Minibex.h"
+
+#include <string>
+#include <sstream>
+
+#ifndef _WIN32 // no dynamic loading under Windows
+#include <dlfcn.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+#ifndef _WIN32
+void* symbol(void* handle, const char* prefix, const char* name) {
+	return dlsym(handle, (string(prefix)+"_"+name).c_str());
+}
+#endif
+
+}
+
+NativeCode::NativeCode(void* handle, int nb_var, int image_dim, fwd_entry eval, bwd_entry proj, fwd_entry jacobian) :
+		nb_var(nb_var), image_dim(image_dim), handle(handle), _eval(eval), _proj(proj), _jacobian(jacobian) {
+
+}
+
+uint64_t NativeCode::expr_hash(const Function& f) {
+	stringstream s;
+	for (int i=0; i<f.nb_arg(); i++) {
+		const ExprSymbol& x=f.arg(i);
+		s << x.name << '[' << x.dim.nb_rows() << "][" << x.dim.nb_cols() << "];";
+	}
+	Expr2Minibex().print(s,f.expr(),false);
+	string str=s.str();
+	return native_code_fnv(str.data(), str.size());
+}
+
+NativeCode* NativeCode::load(const char* filename, const char* prefix, const Function& f) {
+#ifndef _WIN32
+	void* handle=dlopen(filename, RTLD_NOW | RTLD_LOCAL);
+	if (!handle) return NULL;
+
+	typedef int (*int_entry)();
+
+	typedef uint64_t (*hash_entry)();
+
+	int_entry abi       = (int_entry) symbol(handle, prefix, "abi");
+	hash_entry hash     = (hash_entry) symbol(handle, prefix, "hash");
+	int_entry _nb_var    = (int_entry) symbol(handle, prefix, "nb_var");
+	int_entry _image_dim = (int_entry) symbol(handle, prefix, "image_dim");
+	fwd_entry eval      = (fwd_entry) symbol(handle, prefix, "eval");
+	bwd_entry proj      = (bwd_entry) symbol(handle, prefix, "proj");
+	fwd_entry jacobian  = (fwd_entry) symbol(handle, prefix, "jacobian");
+
+	int nb_var=f.nb_var();
+	int image_dim=f.image_dim();
+
+	// note: the hash is checked last (it requires the serialization of f)
+	if (!abi || !hash || !_nb_var || !_image_dim || !eval || !proj || !jacobian
+			|| abi()!=native_code_abi() || _nb_var()!=nb_var || _image_dim()!=image_dim
+			|| hash()!=native_code_hash(expr_hash(f))) {
+		dlclose(handle);
+		return NULL;
+	}
+
+	return new NativeCode(handle, nb_var, image_dim, eval, proj, jacobian);
+#else
+	return NULL;
+#endif
+}
+
+NativeCode::~NativeCode() {
+#ifndef _WIN32
+	dlclose(handle);
+#endif
+}
+
+Interval NativeCode::eval(const IntervalVector& x) const {
+	assert(image_dim==1);
+	Interval y;
+	if (x.is_empty() || !_eval(&x[0], &y))
+		y.set_empty();
+	return y;
+}
+
+IntervalVector NativeCode::eval_vector(const IntervalVector& x) const {
+	IntervalVector y(image_dim);
+	if (x.is_empty() || !_eval(&x[0], &y[0]))
+		y.set_empty();
+	return y;
+}
+
+bool NativeCode::backward(const Domain& y, IntervalVector& x) const {
+	assert(!y.dim.is_matrix());
+
+	if (!x.is_empty()) {
+		if (y.dim.is_scalar() ? _proj(&y.i(), &x[0]) : _proj(&y.v()[0], &x[0]))
+			return false; // as HC4Revise, never proves inactivity
+	}
+	x.set_empty();
+	return false;
+}
+
+void NativeCode::gradient(const IntervalVector& x, IntervalVector& g) const {
+	assert(image_dim==1);
+	if (x.is_empty() || !_jacobian(&x[0], &g[0]))
+		g.set_empty();
+}
+
+void NativeCode::jacobian(const IntervalVector& x, IntervalMatrix& J) const {
+	IntervalVector _J(image_dim*nb_var);
+
+	if (x.is_empty() || !_jacobian(&x[0], &_J[0])) {
+		J.set_empty();
+		return;
+	}
+
+	for (int i=0; i<image_dim; i++) {
+		J[i]=_J.subvector(i*nb_var, (i+1)*nb_var-1);
+		if (J[i].is_empty()) {
+			J.set_empty();
+			return;
+		}
+	}
+}
+
+} // end namespace ibex
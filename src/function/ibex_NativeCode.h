@@ -0,0 +1,216 @@
+/* ============================================================================
+ * I B E X - Native (compiled) code of a function
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_NATIVE_CODE_H__
+#define __IBEX_NATIVE_CODE_H__
+
+#include "ibex_Interval.h"
+#include "ibex_IntervalVector.h"
+#include "ibex_IntervalMatrix.h"
+#include "ibex_Domain.h"
+#include "ibex_Setting.h"
+
+#include <stdint.h>
+
+/**
+ * Version of the interface between the library and the native code
+ * (to be increased each time the signature of the entry points changes).
+ */
+#define IBEX_NATIVE_CODE_VERSION 2
+
+namespace ibex {
+
+class Function;
+
+/**
+ * \ingroup function
+ *
+ * \brief Native code of a function.
+ *
+ * The C++ code of a function generated by #FunctionCodeGen (see also the
+ * ibex_compile_function tool) is compiled into a shared object. This class
+ * is a handle to a shared object loaded in memory.
+ *
+ * The shared object exports the following entry points ("p" is the prefix
+ * given at generation):
+ * <ul>
+ * <li> int p_abi()                                   -> #native_code_abi()
+ * <li> uint64_t p_hash()                             -> #native_code_hash(uint64_t)
+ * <li> int p_nb_var(), int p_image_dim()             -> dimensions
+ * <li> int p_eval(const Interval* x, Interval* y)    -> forward evaluation
+ * <li> int p_proj(const Interval* y, Interval* x)    -> HC4Revise
+ * <li> int p_jacobian(const Interval* x, Interval* J)-> Jacobian matrix (row-major)
+ * </ul>
+ * The hash ties the shared object to the function it was generated from
+ * (a stale object with the same dimensions is rejected), to the release of
+ * Ibex and the interval library it was compiled with, and to the
+ * compilation flags that change the interval arithmetic.
+ *
+ * Each entry point returns 0 if x is outside the definition domain of the
+ * function (or, for p_proj, if the projection is empty), 1 otherwise.
+ *
+ * The native code calls the interval arithmetic of Ibex and therefore
+ * gives the same results as the interpreter (#Eval, #HC4Revise and
+ * #Gradient). The code uses no global memory and can be called from
+ * several threads at the same time.
+ *
+ * \note The symbols of Ibex used by the native code are resolved at
+ * loading time: the executable must either be linked with Ibex as a
+ * shared library or export its symbols (e.g., -rdynamic with gcc).
+ *
+ * \see #Function::load_native(const char*, const char*).
+ */
+class NativeCode {
+public:
+	/**
+	 * \brief Load the native code of a function.
+	 *
+	 * \param filename   - the shared object
+	 * \param prefix     - the prefix of the entry points
+	 * \param f          - the function
+	 *
+	 * \return NULL if the shared object cannot be loaded or
+	 *         if it does not match (entry points, version of the
+	 *         interface, dimensions or hash).
+	 */
+	static NativeCode* load(const char* filename, const char* prefix, const Function& f);
+
+	/**
+	 * \brief Hash code of the expression of a function.
+	 *
+	 * FNV-1a hash of the exact serialization (constants in hexadecimal)
+	 * of the expression of f. The name of the function is not included.
+	 */
+	static uint64_t expr_hash(const Function& f);
+
+	/**
+	 * \brief Unload the shared object.
+	 */
+	~NativeCode();
+
+	/**
+	 * \brief Evaluate a real-valued function.
+	 */
+	Interval eval(const IntervalVector& x) const;
+
+	/**
+	 * \brief Evaluate a vector-valued function.
+	 */
+	IntervalVector eval_vector(const IntervalVector& x) const;
+
+	/**
+	 * \brief Contract x w.r.t. f(x)=y (same as #HC4Revise::proj).
+	 *
+	 * \pre y is a scalar or a vector.
+	 */
+	bool backward(const Domain& y, IntervalVector& x) const;
+
+	/**
+	 * \brief Calculate the gradient of a real-valued function.
+	 */
+	void gradient(const IntervalVector& x, IntervalVector& g) const;
+
+	/**
+	 * \brief Calculate the Jacobian matrix.
+	 */
+	void jacobian(const IntervalVector& x, IntervalMatrix& J) const;
+
+	/**
+	 * \brief Number of variables.
+	 */
+	const int nb_var;
+
+	/**
+	 * \brief Dimension of the image.
+	 */
+	const int image_dim;
+
+private:
+	typedef int (*fwd_entry)(const Interval*, Interval*);
+	typedef int (*bwd_entry)(const Interval*, Interval*);
+
+	NativeCode(void* handle, int nb_var, int image_dim, fwd_entry eval, bwd_entry proj, fwd_entry jacobian);
+
+	NativeCode(const NativeCode&);            // forbidden
+	NativeCode& operator=(const NativeCode&); // forbidden
+
+	void* handle;
+	fwd_entry _eval;
+	bwd_entry _proj;
+	fwd_entry _jacobian;
+};
+
+/**
+ * \brief Hash code (in [0,1000)) of the name of an interval library.
+ */
+constexpr int native_code_lib_hash(const char* lib, int h=0) {
+	return *lib ? native_code_lib_hash(lib+1, (31*h+*lib)%1000) : h;
+}
+
+/**
+ * \brief Signature of the interface, returned by the "abi" entry point.
+ *
+ * Takes into account the version of the interface, the interval library
+ * (Gaol, Filib and SIMD intervals have the same size but are not
+ * interchangeable) and the memory layout of an interval.
+ */
+inline int native_code_abi() {
+	return 1000000*IBEX_NATIVE_CODE_VERSION
+			+ 1000*native_code_lib_hash(_IBEX_INTERVAL_LIB_)
+			+ (int) sizeof(Interval);
+}
+
+/**
+ * \brief FNV-1a hash of n bytes, continued from h.
+ */
+inline uint64_t native_code_fnv(const char* data, size_t n, uint64_t h=14695981039346656037ULL) {
+	for (size_t i=0; i<n; i++) {
+		h ^= (unsigned char) data[i];
+		h *= 1099511628211ULL;
+	}
+	return h;
+}
+
+/**
+ * \brief Compilation flags that change the interval arithmetic.
+ *
+ * With -ffast-math, the compiler does not respect the rounding
+ * modes and assumes that there is no infinity.
+ */
+inline int native_code_flags() {
+	int flags=0;
+#ifdef __FAST_MATH__
+	flags |= 1;
+#endif
+#if defined(__FINITE_MATH_ONLY__) && __FINITE_MATH_ONLY__
+	flags |= 2;
+#endif
+	return flags;
+}
+
+/**
+ * \brief Hash code returned by the "hash" entry point.
+ *
+ * Combines the hash of the expression (see #NativeCode::expr_hash(const Function&)),
+ * embedded in the generated code, with the release of Ibex, the interval
+ * library and the flags (see #native_code_flags()) of the compilation.
+ */
+inline uint64_t native_code_hash(uint64_t expr_hash) {
+	int flags=native_code_flags();
+	uint64_t h=native_code_fnv((const char*) &expr_hash, sizeof(expr_hash));
+	h=native_code_fnv(_IBEX_RELEASE_, sizeof(_IBEX_RELEASE_), h);
+	h=native_code_fnv(_IBEX_INTERVAL_LIB_, sizeof(_IBEX_INTERVAL_LIB_), h);
+	return native_code_fnv((const char*) &flags, sizeof(flags), h);
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_NATIVE_CODE_H__
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Feb 24, 2013
-// Last Update : Feb 24, 2013
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_NumConstraint.h"
@@ -16,24 +16,9 @@
 #include "ibex_P_Struct.h"
 
 #include <sstream>
-#include <mutex>
-
-#ifndef _WIN32 // MinGW does not support mutex
-#include <mutex>
-namespace {
-std::mutex mtx;
-}
-#define LOCK mtx.lock()
-#define UNLOCK mtx.unlock()
-#else
-#define LOCK
-#define UNLOCK
-#endif
 
 using namespace std;
 
-extern void ibexparse_string(const char* syntax);
-
 namespace ibex {
 
 NumConstraint::NumConstraint(const char* filename) : id(next_id()), f(*new Function()), op(EQ), own_f(true) {
@@ -90,7 +75,6 @@ void NumConstraint::build_from_string(const Array<const char*>& _x, const char*
 
 	char* syntax = strdup(s.str().c_str());
 
-	LOCK;
 	try {
 		// TODO: should we allow different simplification level?
 		parser::pstruct = new parser::P_StructSystem(*sys, ExprNode::default_simpl_level);
@@ -102,10 +86,8 @@ void NumConstraint::build_from_string(const Array<const char*>& _x, const char*
 		delete parser::pstruct;
 		parser::pstruct = NULL;
 		free(syntax);
-		UNLOCK;
 		throw e;
 	}
-	UNLOCK;
 
 	build_from_system(*sys);
 	delete sys;
@@ -21,10 +21,24 @@ void LoupFinder::add_property(const IntervalVector& init_box, BoxProperties& pro
 
 }
 
+bool LoupFinder::try_find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop, pair<IntervalVector, double>& p) {
+	try {
+		p=find(box,loup_point,loup,prop);
+		return true;
+	} catch(NotFound&) {
+		return false;
+	}
+}
+
 bool LoupFinder::check(const System& sys, const Vector& pt, double& loup, bool _is_inner) {
+	return check(sys, pt, sys.goal->eval(pt), loup, _is_inner);
+}
+
+bool LoupFinder::check(const System& sys, const Vector& pt, const Interval& goal_pt, double& loup, bool _is_inner) {
 
 	// "res" will contain an upper bound of the criterion
-	double res = sys.goal_ub(pt);
+	// (an empty evaluation means: outside of the definition domain of the goal)
+	double res = goal_pt.is_empty() ? POS_INFINITY : goal_pt.ub();
 
 	// check if f(x) is below the "loup" (the current upper bound).
 	//
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 09, 2017
-// Last update : Feb 13, 2025
+// Last update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_LOUP_FINDER__
@@ -65,6 +65,22 @@ public:
 	 */
 	virtual std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop);
 
+	/**
+	 * \brief Find a new loup in a given box (without exception).
+	 *
+	 * Same as find(...) but return false in case of failure instead
+	 * of raising #NotFound. The optimizer calls this function: throwing an
+	 * exception is costly when most of the boxes contain no feasible point.
+	 *
+	 * By default: call find(...) and catch NotFound. The loup finders of
+	 * Ibex override this function and their find(...) functions are only
+	 * wrappers (a subclass that overrides find(...) must override this
+	 * function too).
+	 *
+	 * \param p - (output) <x{k+1},f(x{k+1})>, in case of success.
+	 */
+	virtual bool try_find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop, std::pair<IntervalVector, double>& p);
+
 	/**
 	 * \brief True if equalities are accepted.
 	 *
@@ -118,6 +134,15 @@ protected:
 	 */
 	bool check(const System& sys, const Vector& pt, double& loup, bool is_inner);
 
+	/**
+	 * \brief Try to reduce the "loup" with a candidate point.
+	 *
+	 * Variant where the goal has already been evaluated at pt.
+	 *
+	 * \param goal_pt - The evaluation of the goal at pt.
+	 */
+	bool check(const System& sys, const Vector& pt, const Interval& goal_pt, double& loup, bool is_inner);
+
 	/**
 	 * \brief Monotonicity analysis.
 	 *
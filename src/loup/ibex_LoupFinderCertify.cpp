@@ -30,21 +30,32 @@ LoupFinderCertify::LoupFinderCertify(const System& sys, LoupFinder& finder) : sy
 
 //pair<IntervalVector, double> LoupCorrection::find(double loup, const Vector& loup_point, double pseudo_loup) {
 std::pair<IntervalVector, double> LoupFinderCertify::find(const IntervalVector& box, const IntervalVector& loup_point, double loup) {
+	pair<IntervalVector,double> p;
+	BoxProperties prop(box);
+	if (!try_find(box,loup_point,loup,prop,p))
+		throw NotFound();
+	return p;
+}
+
+bool LoupFinderCertify::try_find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties&, std::pair<IntervalVector, double>& result) {
 
 	IntervalVector epsbox(box.size());
-	bool pseudo_loup_found=true;
 	pair<IntervalVector,double> p;
 
-	try {
-		p=finder.find(box,loup_point,loup);
+	// note: the properties of the relaxed finder are not
+	// maintained by the optimizer (fresh ones, as with find(...))
+	BoxProperties relaxed_prop(box);
+	bool pseudo_loup_found=finder.try_find(box,loup_point,loup,relaxed_prop,p);
+
+	if (pseudo_loup_found)
 		epsbox = p.first;
-	} catch(NotFound&) {
-		pseudo_loup_found=false;
+	else
 		epsbox=box.mid();
-	}
 
-	if (pseudo_loup_found && !has_equality)
-		return p;
+	if (pseudo_loup_found && !has_equality) {
+		result=p;
+		return true;
+	}
 
 	// Loop until the number of active constraints is less
 	// than the number of variables (we cannot make proofs
@@ -61,17 +72,18 @@ std::pair<IntervalVector, double> LoupFinderCertify::find(const IntervalVector&
 			if (af) delete af;
 			af = new FncActiveCtrs(sys,epsbox.lb(),eps_h,false);
 		} catch(FncActiveCtrs::NothingActive&) {
-			if (pseudo_loup_found)
-				return p;
-			else
-				throw NotFound();
+			if (pseudo_loup_found) {
+				result=p;
+				return true;
+			} else
+				return false;
 		}
 		eps_h /= 2.;
 	} while (af->image_dim() > sys.nb_var && eps_h>min_activity_thershold);
 	if (af->image_dim() > sys.nb_var) {
 		ibex_warning("too many active constraints, cannot prove feasibility -> loup lost!");
 		delete af;
-		throw NotFound();
+		return false;
 	}
 
 	// ====================================================
@@ -124,7 +136,8 @@ std::pair<IntervalVector, double> LoupFinderCertify::find(const IntervalVector&
 				}
 				if (satisfy_inequalities) {
 					delete af;
-					return make_pair(pdc.solution(), res);
+					result=make_pair(pdc.solution(), res);
+					return true;
 				}
 			}
 		}
@@ -132,7 +145,7 @@ std::pair<IntervalVector, double> LoupFinderCertify::find(const IntervalVector&
 
 	//===========================================================
 	delete af;
-	throw NotFound();
+	return false;
 }
 
 } /* namespace ibex */
@@ -45,6 +45,13 @@ public:
 	 */
 	virtual std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup) override;
 
+	/**
+	 * \brief Find a new loup in a given box (without exception).
+	 *
+	 * \see comments in LoupFinder.
+	 */
+	virtual bool try_find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop, std::pair<IntervalVector, double>& p) override;
+
 	/**
 	 * \brief Return true.
 	 */
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 09, 2017
-// Last update : Feb 13, 2025
+// Last update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_LoupFinderDefault.h"
@@ -37,23 +37,30 @@ void LoupFinderDefault::add_property(const IntervalVector& init_box, BoxProperti
 
 }
 
-std::pair<IntervalVector, double> LoupFinderDefault::find(const IntervalVector& box, const IntervalVector& old_loup_point, double old_loup, BoxProperties& prop) {
+std::pair<IntervalVector, double> LoupFinderDefault::find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop) {
+	std::pair<IntervalVector, double> p;
+	if (!try_find(box,loup_point,loup,prop,p))
+		throw NotFound();
+	return p;
+}
+
+bool LoupFinderDefault::try_find(const IntervalVector& box, const IntervalVector& old_loup_point, double old_loup, BoxProperties& prop, std::pair<IntervalVector, double>& res) {
 
 	pair<IntervalVector,double> p=make_pair(old_loup_point, old_loup);
 
 	bool found=false;
 
-	try {
-		p=finder_probing.find(box,p.first,p.second,prop);
+	if (finder_probing.try_find(box,p.first,p.second,prop,res)) {
+		p=res;
 		found=true;
-	} catch(NotFound&) { }
+	}
 
-	try {
-		// TODO
-		// in_x_taylor.set_inactive_ctr(entailed->norm_entailed);
-		p=finder_x_taylor.find(box,p.first,p.second,prop);
+	// TODO
+	// in_x_taylor.set_inactive_ctr(entailed->norm_entailed);
+	if (finder_x_taylor.try_find(box,p.first,p.second,prop,res)) {
+		p=res;
 		found=true;
-	} catch(NotFound&) { }
+	}
 
 	if (found) {
 		//--------------------------------------------------------------------------
@@ -69,9 +76,10 @@ std::pair<IntervalVector, double> LoupFinderDefault::find(const IntervalVector&
 			//cout << "better loup found! " << loup << endl;
 			p=make_pair(loup_point,loup);
 		}
-		return p;
+		res=p;
+		return true;
 	} else
-		throw NotFound();
+		return false;
 }
 
 LoupFinderDefault::~LoupFinderDefault() {
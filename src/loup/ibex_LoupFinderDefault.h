@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 09, 2017
-// Last Update : Feb 13, 2025
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_LOUP_FINDER_DEFAULT_H__
@@ -67,6 +67,13 @@ public:
 	 */
 	virtual std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop) override;
 
+	/**
+	 * \brief Find a new loup in a given box (without exception).
+	 *
+	 * \see comments in LoupFinder.
+	 */
+	virtual bool try_find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop, std::pair<IntervalVector, double>& p) override;
+
 	/**
 	 * \brief Add properties required by finder_probing and finder_x_taylor.
 	 */
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 20, 2019
-// Last Update : Mar 29, 2019
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_LoupFinderDuality.h"
@@ -25,13 +25,8 @@ LoupFinderDuality::LoupFinderDuality(const NormalizedSystem& sys) : sys(sys),
 }
 
 void LoupFinderDuality::add_property(const IntervalVector& init_box, BoxProperties& prop) {
+	// the system cache (see LinearizerDuality)
 	lr.add_property(init_box,prop);
-	//--------------------------------------------------------------------------
-	/* Using system cache seems not interesting. */
-	//	if (/*slope==TAYLOR && */!prop[BxpSystemCache::get_id(sys)]) {
-	//		prop.add(new BxpSystemCache(sys,BxpSystemCache::default_update_ratio));
-	//	}
-	//--------------------------------------------------------------------------
 
 	//--------------------------------------------------------------------------
 	/* Using line search from LP relaxation minimizer seems not interesting. */
@@ -41,12 +36,24 @@ void LoupFinderDuality::add_property(const IntervalVector& init_box, BoxProperti
 	//--------------------------------------------------------------------------
 }
 
-std::pair<IntervalVector, double> LoupFinderDuality::find(const IntervalVector& box, const IntervalVector&, double current_loup, BoxProperties& prop) {
+std::pair<IntervalVector, double> LoupFinderDuality::find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop) {
+	std::pair<IntervalVector, double> p;
+	if (!try_find(box,loup_point,loup,prop,p))
+		throw NotFound();
+	return p;
+}
+
+void LoupFinderDuality::enable_statistics(Statistics& stats, const std::string& prefix) {
+	lp_solver.enable_statistics(stats, prefix+"/Duality");
+	lr.enable_statistics(stats, prefix+"/Duality");
+}
+
+bool LoupFinderDuality::try_find(const IntervalVector& box, const IntervalVector&, double current_loup, BoxProperties& prop, std::pair<IntervalVector, double>& p) {
 
 	int n=sys.nb_var;
 
 	if (box.is_unbounded())
-		throw NotFound();
+		return false;
 
 	lp_solver.clear_constraints();
 	init_box.put(0, box);
@@ -55,12 +62,12 @@ std::pair<IntervalVector, double> LoupFinderDuality::find(const IntervalVector&
 	int count = lr.linearize(box,lp_solver,prop);
 
 	if (count==-1) {
-		throw NotFound();
+		return false;
 	}
 
 	IntervalVector igoal=sys.goal->gradient(lr.point());
 	if (igoal.is_empty()) { // unfortunately, at the midpoint the function is not differentiable
-		throw NotFound(); // not a big deal: wait for another box...
+		return false; // not a big deal: wait for another box...
 	}
 
 	Vector goal=igoal.mid();
@@ -77,16 +84,17 @@ std::pair<IntervalVector, double> LoupFinderDuality::find(const IntervalVector&
 		//the linear solution is mapped to intervals and evaluated
 		Vector loup_point = lp_solver.not_proved_primal_sol().subvector(0,n-1);
 
-		if (!box.contains(loup_point)) throw NotFound();
+		if (!box.contains(loup_point)) return false;
 
 		double new_loup=current_loup;
 
 		if (check(sys,loup_point,new_loup,false)) {
-			return std::make_pair(loup_point,new_loup);
+			p=std::make_pair(loup_point,new_loup);
+			return true;
 		}
 	}
 
-	throw NotFound();
+	return false;
 }
 
 } /* namespace ibex */
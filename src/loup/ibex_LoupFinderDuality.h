@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 20, 2019
-// Last Update : Mar 29, 2019
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_LOUP_FINDER_DUALITY_H__
@@ -51,11 +51,24 @@ public:
 	 */
 	virtual std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop) override;
 
+	/**
+	 * \brief Find a new loup in a given box (without exception).
+	 *
+	 * \see comments in LoupFinder.
+	 */
+	virtual bool try_find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop, std::pair<IntervalVector, double>& p) override;
+
 	/**
 	 * \brief Add properties required by this loup finder.
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop) override;
 
+	/**
+	 * \brief Enable statistics.
+	 * \see #LoupFinder::enable_statistics.
+	 */
+	virtual void enable_statistics(Statistics& stats, const std::string& prefix) override;
+
 	/**
 	 * \brief The NLP problem.
 	 */
@@ -31,6 +31,14 @@ LoupFinderFwdBwd::~LoupFinderFwdBwd() {
 }
 
 std::pair<IntervalVector, double> LoupFinderFwdBwd::find(const IntervalVector& box, const IntervalVector& loup_point, double loup) {
+	std::pair<IntervalVector, double> p;
+	BoxProperties prop(box);
+	if (!try_find(box,loup_point,loup,prop,p))
+		throw NotFound();
+	return p;
+}
+
+bool LoupFinderFwdBwd::try_find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop, std::pair<IntervalVector, double>& p) {
 
 	IntervalVector inbox=box;
 
@@ -54,7 +62,7 @@ std::pair<IntervalVector, double> LoupFinderFwdBwd::find(const IntervalVector& b
 	if (mono_analysis_flag)
 		monotonicity_analysis(sys, inbox, inner_found);
 
-	return LoupFinderProbing(sys).find(inner_found? inbox : box,loup_point,loup);
+	return LoupFinderProbing(sys).try_find(inner_found? inbox : box,loup_point,loup,prop,p);
 }
 
 } /* namespace ibex */
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 14, 2012
-// Last Update : Jul 09, 2017
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_LoupFinderInHC4.h"
@@ -17,7 +17,7 @@ using namespace std;
 
 namespace ibex {
 
-LoupFinderInHC4::LoupFinderInHC4(const System& sys) : sys(sys), goal_ctr(-1) {
+LoupFinderInHC4::LoupFinderInHC4(const System& sys) : sys(sys), goal_ctr(-1), cache_statistics(NULL) {
 	mono_analysis_flag=true;
 //	nb_inhc4=0;
 //	diam_inhc4=0;
@@ -38,15 +38,21 @@ LoupFinderInHC4::LoupFinderInHC4(const System& sys) : sys(sys), goal_ctr(-1) {
 //}
 
 void LoupFinderInHC4::add_property(const IntervalVector& init_box, BoxProperties& prop) {
-	//--------------------------------------------------------------------------
-	/* Using system cache seems not interesting. */
-//	if (!prop[BxpSystemCache::get_id(sys)]) {
-//		prop.add(new BxpSystemCache(sys,BxpSystemCache::default_update_ratio));
-//	}
-	//--------------------------------------------------------------------------
+	BxpSystemCache::add_property(sys, prop, cache_statistics);
+}
+
+void LoupFinderInHC4::enable_statistics(Statistics& stats, const std::string& prefix) {
+	cache_statistics = BxpSystemCache::enable_statistics(sys, stats);
 }
 
 std::pair<IntervalVector, double> LoupFinderInHC4::find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop) {
+	std::pair<IntervalVector, double> p;
+	if (!try_find(box,loup_point,loup,prop,p))
+		throw NotFound();
+	return p;
+}
+
+bool LoupFinderInHC4::try_find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop, std::pair<IntervalVector, double>& res) {
 
 	IntervalVector inbox=box;
 	bool inner_found=true;
@@ -56,11 +62,8 @@ std::pair<IntervalVector, double> LoupFinderInHC4::find(const IntervalVector& bo
 		// ========= get active constraints ===========
 		BitSet* active;
 
-		//--------------------------------------------------------------------------
-		/* Using system cache seems not interesting. */
-		//BxpSystemCache* p=(BxpSystemCache*) prop[BxpSystemCache::get_id(sys)];
-		BxpSystemCache* p=NULL;
-		//--------------------------------------------------------------------------
+		// the evaluation shared with the other operators (if any)
+		const BxpSystemCache* p=BxpSystemCache::get(sys, prop, box);
 
 		if (p!=NULL) {
 			active = &p->active_ctrs();
@@ -96,7 +99,10 @@ std::pair<IntervalVector, double> LoupFinderInHC4::find(const IntervalVector& bo
 				}
 
 				// Quick infeasibility check
-				if (gx[i].is_disjoint(right_cst)) throw NotFound();
+				if (gx[i].is_disjoint(right_cst)) {
+					if (!p) delete active;
+					return false;
+				}
 
 				// *******
 				// Warning: generates components of f_ctrs!!
@@ -126,7 +132,7 @@ std::pair<IntervalVector, double> LoupFinderInHC4::find(const IntervalVector& bo
 	if (mono_analysis_flag)
 		monotonicity_analysis(sys, inbox, inner_found);
 
-	return LoupFinderProbing(sys).find(inner_found? inbox : box, loup_point, loup);
+	return LoupFinderProbing(sys).try_find(inner_found? inbox : box, loup_point, loup, prop, res);
 }
 
 } /* namespace ibex */
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 14, 2012
-// Last Update : Jul 09, 2017
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_LOUP_FINDER_IN_HC4__
@@ -13,6 +13,7 @@
 
 #include "ibex_LoupFinder.h"
 #include "ibex_System.h"
+#include "ibex_StsSystemCache.h"
 
 namespace ibex {
 /**
@@ -50,11 +51,23 @@ public:
 	 */
 	virtual std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop) override;
 
+	/**
+	 * \brief Find a new loup in a given box (without exception).
+	 *
+	 * \see comments in LoupFinder.
+	 */
+	virtual bool try_find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop, std::pair<IntervalVector, double>& p) override;
+
 	/**
 	 * \brief Add properties required by finder_probing and finder_x_taylor.
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop) override;
 
+	/**
+	 * \brief Enable statistics on the system cache.
+	 */
+	virtual void enable_statistics(Statistics& stats, const std::string& prefix) override;
+
 	// statistics on upper bounding
 	//void report();
 
@@ -78,6 +91,11 @@ protected:
 	 */
 	const int goal_ctr;
 
+	/**
+	 * \brief Statistics on the system cache (NULL if disabled).
+	 */
+	StsSystemCache* cache_statistics;
+
 	/** Miscellaneous   for statistics */
 //	int nb_inhc4;
 //	double diam_inhc4;
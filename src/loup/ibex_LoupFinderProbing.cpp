@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 14, 2012
-// Last Update : Jul 09, 2017
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_LoupFinderProbing.h"
@@ -19,6 +19,14 @@ LoupFinderProbing::LoupFinderProbing(const System& sys, int sample_size) : sys(s
 }
 
 std::pair<IntervalVector, double> LoupFinderProbing::find(const IntervalVector& box, const IntervalVector& current_loup_point, double current_loup) {
+	std::pair<IntervalVector, double> p;
+	BoxProperties prop(box);
+	if (!try_find(box,current_loup_point,current_loup,prop,p))
+		throw NotFound();
+	return p;
+}
+
+bool LoupFinderProbing::try_find(const IntervalVector& box, const IntervalVector& current_loup_point, double current_loup, BoxProperties&, std::pair<IntervalVector, double>& p) {
 
 	int n=sys.nb_var;
 	Vector loup_point(n);
@@ -28,13 +36,29 @@ std::pair<IntervalVector, double> LoupFinderProbing::find(const IntervalVector&
 	bool loup_changed=false;
 	bool _is_inner = sys.is_inner(box);
 
-	for(int i=0; i<sample_size; i++) {
+	if (sample_size==1) {
 		pt = box.random();
-		//	cout << " box " << box << " pt " << pt << endl;
 		if (check(sys, pt, loup, _is_inner)) {
 			loup_changed = true;
 			loup_point = pt;
 		}
+	} else {
+		// the goal is evaluated on all the sample points in one sweep
+		std::vector<Vector> sample;
+		sample.reserve(sample_size);
+		for(int i=0; i<sample_size; i++)
+			sample.push_back(box.random());
+
+		std::vector<Interval> goal_sample = sys.goal->eval_batch(sample);
+
+		for(int i=0; i<sample_size; i++) {
+			pt = sample[i];
+			//	cout << " box " << box << " pt " << pt << endl;
+			if (check(sys, pt, goal_sample[i], loup, _is_inner)) {
+				loup_changed = true;
+				loup_point = pt;
+			}
+		}
 	}
 
 	/*=================== "intensification" =================== */
@@ -58,10 +82,11 @@ std::pair<IntervalVector, double> LoupFinderProbing::find(const IntervalVector&
 
 	/*========================================================*/
 
-	if (loup_changed)
-		return std::make_pair(loup_point,loup);
-	else
-		throw NotFound();
+	if (loup_changed) {
+		p=std::make_pair(loup_point,loup);
+		return true;
+	} else
+		return false;
 }
 
 bool LoupFinderProbing::line_probing(Vector& loup_point, double& loup, const IntervalVector& box) {
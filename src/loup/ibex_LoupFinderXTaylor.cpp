@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 12, 2012
-// Last Update : Feb 13, 2025
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_LoupFinderXTaylor.h"
@@ -27,21 +27,29 @@ void LoupFinderXTaylor::add_property(const IntervalVector& init_box, BoxProperti
 
 void LoupFinderXTaylor::enable_statistics(Statistics& stats, const std::string& prefix) {
 	lp_solver.enable_statistics(stats, prefix+"/XTaylor");
+	lr.enable_statistics(stats, prefix+"/XTaylor");
 }
 
-std::pair<IntervalVector, double> LoupFinderXTaylor::find(const IntervalVector& box, const IntervalVector&, double current_loup, BoxProperties& prop) {
+std::pair<IntervalVector, double> LoupFinderXTaylor::find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop) {
+	std::pair<IntervalVector, double> p;
+	if (!try_find(box,loup_point,loup,prop,p))
+		throw NotFound();
+	return p;
+}
+
+bool LoupFinderXTaylor::try_find(const IntervalVector& box, const IntervalVector&, double current_loup, BoxProperties& prop, std::pair<IntervalVector, double>& p) {
 
 	int n=sys.nb_var;
 
 	if (box.is_unbounded())
-		throw NotFound();
+		return false;
 
 	lp_solver.clear_constraints();
 	lp_solver.set_bounds(box);
 
 	IntervalVector ig=sys.goal->gradient(box.mid());
 	if (ig.is_empty()) // unfortunately, at the midpoint the function is not differentiable
-		throw NotFound(); // not a big deal: wait for another box...
+		return false; // not a big deal: wait for another box...
 
 	Vector g=ig.mid();
 
@@ -54,7 +62,7 @@ std::pair<IntervalVector, double> LoupFinderXTaylor::find(const IntervalVector&
 
 	if (count==-1) {
 		lp_solver.clear_constraints();
-		throw NotFound();
+		return false;
 	}
 	LPSolver::Status stat = lp_solver.minimize();
 
@@ -74,11 +82,12 @@ std::pair<IntervalVector, double> LoupFinderXTaylor::find(const IntervalVector&
 		double new_loup=current_loup;
 
 		if (check(sys,loup_point,new_loup,false)) {
-			return std::make_pair(loup_point,new_loup);
+			p=std::make_pair(loup_point,new_loup);
+			return true;
 		}
 	}
 
-	throw NotFound();
+	return false;
 }
 
 } /* namespace ibex */
@@ -4,7 +4,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 15, 2013 (Jordan Ninin)
-// Last update : Feb 13, 2025 (Gilles Chabert)
+// Last update : Oct 18, 2026 (Gilles Chabert)
 //============================================================================
 
 #include "ibex_LPSolver.h"
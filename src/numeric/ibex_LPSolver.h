@@ -4,7 +4,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 15, 2013 (Jordan Ninin)
-// Last update : Feb 13, 2025 (Gilles Chabert)
+// Last update : Oct 18, 2026 (Gilles Chabert)
 //============================================================================
 
 #ifndef __IBEX_LP_SOLVER_H__
@@ -91,6 +91,29 @@ public:
 	//enum class PostProcessing { None, NeumaierShcherbina };
 
 	enum class Mode { Certified, NotCertified };
+
+	/**
+	 * \brief Basis of a linear program.
+	 *
+	 * Status of each column (variable) and each row (constraint,
+	 * including bound constraints) in a basis found by the simplex.
+	 * The values are specific to the underlying LP library.
+	 *
+	 * A basis can be given back to the solver to warm-start the simplex
+	 * on a problem with the same dimensions, typically the relaxation of
+	 * a sub-box. See #get_basis(Basis&) const and #set_basis(const Basis&).
+	 */
+	class Basis {
+	public:
+		/** \brief True if no basis has been stored. */
+		bool empty() const;
+
+		/** \brief Status of the columns. */
+		std::vector<int> col_status;
+
+		/** \brief Status of the rows. */
+		std::vector<int> row_status;
+	};
 	
 	/**
 	 * \brief Build a LPSolver with nb_vars variables.
@@ -143,6 +166,25 @@ public:
 	 */
 	Status minimize();
 
+	/**
+	 * \brief Get the current basis.
+	 *
+	 * This is the basis found by the last call to minimize().
+	 *
+	 * \return false if no basis is available.
+	 */
+	bool get_basis(Basis& basis) const;
+
+	/**
+	 * \brief Set the starting basis of the next call to minimize().
+	 *
+	 * The basis is ignored if its dimensions do not match the current
+	 * number of variables and rows.
+	 *
+	 * \return true if the basis has been set.
+	 */
+	bool set_basis(const Basis& basis);
+
 	/**
 	 * \brief Set the objective function vector.
 	 */
@@ -404,6 +446,12 @@ private:
 /** \brief Stream out \a x. */
 std::ostream& operator<<(std::ostream& os, const LPSolver::Status x);
 
+/*================================== inline implementations ========================================*/
+
+inline bool LPSolver::Basis::empty() const {
+	return col_status.empty();
+}
+
 } // end namespace ibex
 
 #endif /* __IBEX_LP_SOLVER_H__ */
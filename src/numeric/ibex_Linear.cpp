@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 18, 2012
-// Last Update : Aug 29, 2013
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_Linear.h"
@@ -14,6 +14,8 @@
 #include <math.h>
 #include <float.h>
 #include <stack>
+#include <vector>
+#include <algorithm>
 
 #define TOO_LARGE 1e30
 #define TOO_SMALL 1e-10
@@ -338,6 +340,87 @@ void precond(IntervalMatrix& A, IntervalVector& b) {
 	b = C*b;
 }
 
+void precond(SparseIntervalMatrix& A, IntervalVector& b, int block_size) {
+	int n=A.nb_rows();
+	assert(n == A.nb_cols());
+	assert(n == b.size());
+	assert(block_size>=1);
+
+	int nb_blocks=(n+block_size-1)/block_size;
+
+	// inverses of the diagonal blocks
+	vector<Matrix> C;
+
+	// pattern of C*A (row r gets the union of
+	// the patterns of the rows of its block)
+	vector<vector<int> > pattern(n);
+
+	for (int q=0; q<nb_blocks; q++) {
+		int first=q*block_size;
+		int s=std::min(block_size, n-first);
+
+		Matrix Mid(s,s,0.0), Lb(s,s,0.0), Ub(s,s,0.0);
+		vector<int> cols;
+
+		for (int r=first; r<first+s; r++) {
+			for (int k=A.row_begin(r); k<A.row_end(r); k++) {
+				int j=A.col(k);
+				if (j>=first && j<first+s) {
+					Mid[r-first][j-first]=A[k].mid();
+					Lb[r-first][j-first]=A[k].lb();
+					Ub[r-first][j-first]=A[k].ub();
+				}
+				cols.push_back(j);
+			}
+		}
+
+		C.push_back(Matrix(s,s));
+		try { real_inverse(Mid, C.back()); }
+		catch (SingularMatrixException&) {
+			try { real_inverse(Lb, C.back()); }
+			catch (SingularMatrixException&) {
+				real_inverse(Ub, C.back());
+			}
+		}
+
+		sort(cols.begin(), cols.end());
+		cols.erase(unique(cols.begin(), cols.end()), cols.end());
+		for (int r=first; r<first+s; r++)
+			pattern[r]=cols;
+	}
+
+	SparseIntervalMatrix CA(n, n, pattern);
+	IntervalVector Cb(n);
+
+	// position in the current row of CA of each column
+	vector<int> pos(n);
+
+	for (int q=0; q<nb_blocks; q++) {
+		int first=q*block_size;
+		int s=std::min(block_size, n-first);
+		const Matrix& Cq=C[q];
+
+		for (int r=first; r<first+s; r++) {
+			for (int k=CA.row_begin(r); k<CA.row_end(r); k++)
+				pos[CA.col(k)]=k;
+
+			Cb[r]=Interval::zero();
+
+			for (int l=first; l<first+s; l++) {
+				double c=Cq[r-first][l-first];
+				if (c==0) continue;
+				for (int k=A.row_begin(l); k<A.row_end(l); k++)
+					CA[pos[A.col(k)]] += c*A[k];
+				Cb[r] += c*b[l];
+			}
+		}
+	}
+
+	if (A.is_empty()) CA.set_empty();
+	A = CA;
+	b = Cb;
+}
+
 void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio) {
 	int m=(A.nb_rows());
 	int n=(A.nb_cols());
@@ -398,6 +481,69 @@ bool inflating_gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, In
 
 }
 
+void gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio) {
+	int m=(A.nb_rows());
+	int n=(A.nb_cols());
+	assert(x.size()==n);
+	assert(b.size()==m);
+
+	double red;
+	Interval old, proj, tmp;
+	int i;
+
+	do {
+		red = 0;
+		for (int r=0; r<m; r++) {
+			i=r % n; // in case m>n
+			old = x[i];
+			proj = b[r];
+			tmp = Interval::zero(); // if the diagonal entry is not stored
+
+			for (int k=A.row_begin(r); k<A.row_end(r); k++) {
+				if (A.col(k)!=i) proj -= A[k]*x[A.col(k)];
+				else tmp=A[k];
+			}
+
+			bwd_mul(proj,tmp,x[i]);
+
+			if (x[i].is_empty()) { x.set_empty(); return; }
+
+			double gain=old.rel_distance(x[i]);
+			if (gain>red) red=gain;
+		}
+	} while (red >= ratio);
+}
+
+bool inflating_gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist, double mu_max) {
+	int n=(A.nb_rows());
+	assert(n == (A.nb_cols()));
+	assert(n == (x.size()) && n == (b.size()));
+	assert(min_dist>0);
+
+	IntervalVector xold(n);
+	Interval proj, diag;
+	double d=DBL_MAX; // Hausdorff distances between 2 iterations
+	double dold;
+	double mu; // ratio of dist(x_k,x_{k-1)) / dist(x_{k-1},x_{k-2}).
+	do {
+		dold = d;
+		xold = x;
+		for (int i=0; i<n; i++) {
+			proj = b[i];
+			diag = Interval::zero();
+			for (int k=A.row_begin(i); k<A.row_end(i); k++) {
+				if (A.col(k)!=i) proj -= A[k]*x[A.col(k)];
+				else diag=A[k];
+			}
+			if (!diag.contains(0)) x[i] = proj/diag;
+			else x[i] = Interval::all_reals();
+		}
+		d=distance(xold,x);
+		mu=d/dold;
+	} while (mu<mu_max && d>min_dist);
+	return (mu<mu_max);
+}
+
 void hansen_bliek(const IntervalMatrix& A, const IntervalVector& B, IntervalVector& x) {
 	int n=A.nb_rows();
 	assert(n == A.nb_cols()); // throw NotSquareMatrixException();
@@ -5,13 +5,14 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 17, 2012
-// Last Update : Aug 29, 2013
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_LINEAR_H__
 #define __IBEX_LINEAR_H__
 
 #include "ibex_IntervalMatrix.h"
+#include "ibex_SparseIntervalMatrix.h"
 #include "ibex_LinearException.h"
 
 /** \file */
@@ -178,6 +179,26 @@ void precond(IntervalMatrix& A, IntervalVector& b);
  */
 void precond(IntervalMatrix& A);
 
+/**
+ * \brief Block-diagonal preconditioning of a sparse system \f$[A]x=[b]\f$.
+ *
+ * <br> The midpoint inverse of a sparse matrix is dense in general. In order
+ * to keep [A] sparse, the preconditioning matrix C is the block-diagonal matrix
+ * whose blocks are the inverses of the diagonal blocks of \c Mid([A]) (or, in case of
+ * failure, \c Inf([A]) or \c Sup([A])). The rows of the kth block of C[A] are
+ * combinations of the rows of the kth block of [A] so that the fill-in is limited
+ * by the size of the blocks. With block_size=1, this is a diagonal (Jacobi)
+ * preconditioning.
+ *
+ * \param A (in/output)- The square interval matrix [A] to be replaced by C[A].
+ * \param b (in/output)- The interval vector [b] to be replaced by C[b].
+ * \param block_size   - The size of the diagonal blocks (the last block may be smaller).
+ *
+ * \throw SingularMatrixException if a diagonal block could not be inverted.
+ *                                In this case, A and b are not modified.
+ */
+void precond(SparseIntervalMatrix& A, IntervalVector& b, int block_size=8);
+
 /**
  * \brief Gauss-Seidel algorithm.
  *
@@ -196,6 +217,14 @@ void precond(IntervalMatrix& A);
  */
 void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
 
+/**
+ * \brief Gauss-Seidel algorithm (sparse version).
+ *
+ * Same as #gauss_seidel(const IntervalMatrix&, const IntervalVector&, IntervalVector&, double)
+ * but each sweep only visits the entries of the pattern of A.
+ */
+void gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
+
 /**
  * \brief Gauss-Seidel algorithm (inflating variant).<br>
  *
@@ -215,6 +244,13 @@ void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVect
  */
 bool inflating_gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist=1e-12, double mu_max_divergence=1.0);
 
+/**
+ * \brief Gauss-Seidel algorithm (inflating and sparse variant).
+ *
+ * \see #inflating_gauss_seidel(const IntervalMatrix&, const IntervalVector&, IntervalVector&, double, double).
+ */
+bool inflating_gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist=1e-12, double mu_max_divergence=1.0);
+
 /**
  * \brief Hansen-Bliek algorithm.
  *
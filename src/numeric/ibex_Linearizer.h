@@ -13,6 +13,7 @@
 #include "ibex_IntervalVector.h"
 #include "ibex_LPSolver.h"
 #include "ibex_BoxProperties.h"
+#include "ibex_Statistics.h"
 
 namespace ibex {
 
@@ -58,6 +59,16 @@ public:
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop);
 
+	/**
+	 * \brief Enable statistics.
+	 *
+	 * \param stats    The collection of all statistics
+	 * \param prefix   Prefix for the name associated to this linearizer (for reporting)
+	 *
+	 * By default: does nothing.
+	 */
+	virtual void enable_statistics(Statistics& stats, const std::string& prefix);
+
 	/**
 	 * \brief Delete this.
 	 */
@@ -91,6 +102,10 @@ inline void Linearizer::add_property(const IntervalVector& init_box, BoxProperti
 
 }
 
+inline void Linearizer::enable_statistics(Statistics& stats, const std::string& prefix) {
+
+}
+
 inline int Linearizer::linearize(const IntervalVector& box, LPSolver& lp_solver, BoxProperties& prop) {
 	return linearize(box, lp_solver);
 }
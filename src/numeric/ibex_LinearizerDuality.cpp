@@ -5,6 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 29, 2019
+// Last update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_LinearizerDuality.h"
@@ -16,10 +17,18 @@ using namespace std;
 namespace ibex {
 
 LinearizerDuality::LinearizerDuality(const NormalizedSystem& sys, slope_formula slope) :
-			Linearizer(sys.nb_var), sys(sys), slope(slope), pt(sys.nb_var) {
+			Linearizer(sys.nb_var), sys(sys), slope(slope), pt(sys.nb_var), cache_statistics(NULL) {
 
 }
 
+void LinearizerDuality::add_property(const IntervalVector& init_box, BoxProperties& prop) {
+	BxpSystemCache::add_property(sys, prop, cache_statistics);
+}
+
+void LinearizerDuality::enable_statistics(Statistics& stats, const std::string& prefix) {
+	cache_statistics = BxpSystemCache::enable_statistics(sys, stats);
+}
+
 int LinearizerDuality::linearize(const IntervalVector& box, LPSolver& lp_solver)  {
 	BoxProperties prop(box);
 	return linearize(box, lp_solver, prop);
@@ -27,10 +36,11 @@ int LinearizerDuality::linearize(const IntervalVector& box, LPSolver& lp_solver)
 
 int LinearizerDuality::linearize(const IntervalVector& box, LPSolver& lp_solver, BoxProperties& prop)  {
 	// ========= get active constraints ===========
-	/* Using system cache seems not interesting. */
-	//BxpSystemCache* cache=(BxpSystemCache*) prop[BxpSystemCache::get_id(sys)];
-	BxpSystemCache* cache=NULL;
-	//--------------------------------------------------------------------------
+	// The set of active constraints is shared with other
+	// operators through the system cache.
+	// Note: the Hansen matrix is calculated at pt, not at the
+	// midpoint of the box, so it cannot be read from the cache.
+	const BxpSystemCache* cache=BxpSystemCache::get(sys, prop, box);
 
 	BitSet* active;
 
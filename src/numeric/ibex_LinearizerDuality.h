@@ -5,6 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 29, 2019
+// Last update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_LINEARIZER_DUALITY_H__
@@ -12,6 +13,7 @@
 
 #include "ibex_Linearizer.h"
 #include "ibex_NormalizedSystem.h"
+#include "ibex_BxpSystemCache.h"
 
 namespace ibex {
 
@@ -58,6 +60,18 @@ public:
 	 */
 	virtual int linearize(const IntervalVector& box, LPSolver& lp_solver, BoxProperties& prop) override;
 
+	/**
+	 * \brief Add the system cache (see #BxpSystemCache).
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop) override;
+
+	/**
+	 * \brief Enable statistics (of the system cache).
+	 *
+	 * \see #Linearizer::enable_statistics.
+	 */
+	virtual void enable_statistics(Statistics& stats, const std::string& prefix) override;
+
 	/**
 	 * \brief Return the point chosen in the last call to linearize(...)
 	 *
@@ -82,6 +96,11 @@ protected:
 	 * \brief Chosen point
 	 */
 	Vector pt;
+
+	/**
+	 * Statistics of the system cache (NULL if disabled)
+	 */
+	StsSystemCache* cache_statistics;
 };
 
 /*============================================ inline implementation ============================================ */
@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert, Ignacio Araya, Bertrand Neveu
  * Created     : July 01th, 2012
- * Updated     : July 18th, 2017
+ * Updated     : Oct 18th, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "ibex_LinearizerXTaylor.h"
@@ -38,7 +38,7 @@ LinearizerXTaylor::LinearizerXTaylor(const System& _sys, approx_mode _mode, corn
 			Linearizer(_sys.nb_var), sys(_sys),
 			m(sys.f_ctrs.image_dim()), goal_ctr(-1 /*tmp*/),
 			mode(_mode), slope(_slope),
-			inf(new bool[n]), lp_solver(NULL), cache(NULL) {
+			inf(new bool[n]), lp_solver(NULL), cache(NULL), cache_statistics(NULL) {
 
 	if (dynamic_cast<const ExtendedSystem*>(&sys)) {
 		((int&) goal_ctr)=((const ExtendedSystem&) sys).goal_ctr();
@@ -63,12 +63,11 @@ LinearizerXTaylor::~LinearizerXTaylor() {
 }
 
 void LinearizerXTaylor::add_property(const IntervalVector& init_box, BoxProperties& prop) {
-	//--------------------------------------------------------------------------
-	/* Using system cache seems not interesting. */
-	//	if (/*mode==RELAX && slope==TAYLOR && */!prop[BxpSystemCache::get_id(sys)]) {
-	//		prop.add(new BxpSystemCache(sys,BxpSystemCache::default_update_ratio));
-	//	}
-	//--------------------------------------------------------------------------
+	BxpSystemCache::add_property(sys, prop, cache_statistics);
+}
+
+void LinearizerXTaylor::enable_statistics(Statistics& stats, const std::string& prefix) {
+	cache_statistics = BxpSystemCache::enable_statistics(sys, stats);
 }
 
 int LinearizerXTaylor::linearize(const IntervalVector& box, LPSolver& _lp_solver)  {
@@ -82,11 +81,9 @@ int LinearizerXTaylor::linearize(const IntervalVector& box, LPSolver& _lp_solver
 	// ========= get active constraints ===========
 	BitSet* active;
 
-	//--------------------------------------------------------------------------
-	/* Using system cache seems not interesting. */
-	//cache=(BxpSystemCache*) prop[BxpSystemCache::get_id(sys)];
-	cache=NULL;
-	//--------------------------------------------------------------------------
+	// The set of active constraints and the Jacobian matrix
+	// are shared with other operators through the system cache.
+	cache=BxpSystemCache::get(sys, prop, box);
 
 	if (cache!=NULL) {
 		active = &cache->active_ctrs();
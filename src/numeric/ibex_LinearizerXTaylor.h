@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert, Ignacio Araya, Bertrand Neveu
  * Created     : July 01th, 2012
- * Updated     : July 18th, 2017
+ * Updated     : Oct 18th, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __IBEX_LINEARIZER_X_TAYLOR__
@@ -94,10 +94,17 @@ public:
 	virtual int linearize(const IntervalVector& box, LPSolver& lp_solver, BoxProperties& prop) override;
 
 	/**
-	 * \brief Add BxpActiveCtrs
+	 * \brief Add the system cache (see #BxpSystemCache).
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop) override;
 
+	/**
+	 * \brief Enable statistics (of the system cache).
+	 *
+	 * \see #Linearizer::enable_statistics.
+	 */
+	virtual void enable_statistics(Statistics& stats, const std::string& prefix) override;
+
 private:
 
 	/**
@@ -186,7 +193,12 @@ private:
 	/**
 	 * Current system cache (NULL if none)
 	 */
-	BxpSystemCache* cache;
+	const BxpSystemCache* cache;
+
+	/**
+	 * Statistics of the system cache (NULL if disabled)
+	 */
+	StsSystemCache* cache_statistics;
 };
 
 } // end namespace ibex
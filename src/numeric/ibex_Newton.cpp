@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 24, 2012
-// Last Update : May 24, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_Newton.h"
@@ -20,6 +20,7 @@ namespace ibex {
 
 double default_newton_prec=1e-07;
 double default_gauss_seidel_ratio=1e-04;
+double default_newton_sparse_density=0.05;
 
 
 namespace {
@@ -32,6 +33,161 @@ namespace {
 //	mid = box.mid();
 //	Fmid=f.eval_vector(mid);
 //
+
+/*
+ * The pattern of the Jacobian matrix if the sparse Newton
+ * iteration is to be used, NULL otherwise.
+ *
+ * Note: the pattern is only calculated once per function.
+ */
+const SparseIntervalMatrix* sparse_pattern(const Fnc& f, const VarSet* vars) {
+	if (vars || f.image_dim()!=f.nb_var() || default_newton_sparse_density<=0)
+		return NULL;
+
+	const SparseIntervalMatrix& J=f.cached_jacobian_pattern();
+
+	return J.density()<default_newton_sparse_density ? &J : NULL;
+}
+
+/*
+ * Contracting Newton with sparse matrices (no parameters).
+ *
+ * Same iteration as the dense one except that the Hansen matrix
+ * is sparse and the preconditioning is block-diagonal.
+ *
+ * Return false if the preconditioning failed at the first
+ * iteration (nothing done in this case).
+ */
+bool sparse_newton(const Fnc& f, const SparseIntervalMatrix& pattern, IntervalVector& box, double prec, double ratio_gauss_seidel, bool& reducted) {
+	int n=f.nb_var();
+
+	SparseIntervalMatrix J(pattern);
+	IntervalVector y(n);
+	IntervalVector y1(n);
+	IntervalVector mid(n);
+	IntervalVector Fmid(n);
+	double gain;
+	bool first=true;
+
+	reducted=false;
+
+	y1 = box.mid();
+
+	do {
+		J = pattern;
+		f.hansen_matrix(box,box.mid(),J);
+
+		if (J.is_empty()) break;
+
+		mid = box.mid();
+
+		Fmid = f.eval_vector(mid);
+
+		y = mid-box;
+		if (y==y1) break;
+		y1=y;
+
+		try {
+			precond(J, Fmid);
+		} catch (LinearException& ) {
+			assert(!reducted);
+			if (first) return false;
+			break;
+		}
+
+		first=false;
+
+		gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
+
+		if (y.is_empty()) {
+			reducted=true;
+			box.set_empty();
+			break;
+		}
+
+		IntervalVector box2=mid-y;
+
+		if ((box2 &= box).is_empty()) {
+			reducted=true;
+			box.set_empty();
+			break;
+		}
+		gain = box.maxdelta(box2);
+
+		if (gain >= prec) reducted = true;
+
+		box=box2;
+	}
+	while (gain >= prec);
+
+	return true;
+}
+
+/*
+ * Inflating Newton with sparse matrices (no parameters).
+ *
+ * box_existence and box_unicity are only set in case of success.
+ */
+bool sparse_inflating_newton(const Fnc& f, const SparseIntervalMatrix& pattern, const IntervalVector& full_box, IntervalVector& box_existence, IntervalVector& box_unicity, int k_max, double mu_max, double delta, double chi) {
+	int n=f.nb_var();
+
+	int k=0;
+	bool success=false;
+
+	SparseIntervalMatrix J(pattern);
+	IntervalVector mid(n);
+	IntervalVector Fmid(n);
+	IntervalVector y(n);
+
+	IntervalVector box = full_box;
+	IntervalVector unicity(n);
+
+	while (k<k_max) {
+
+		J = pattern;
+		f.hansen_matrix(box, box.mid(), J);
+
+		if (J.is_empty()) break;
+
+		mid = box.mid();
+
+		Fmid=f.eval_vector(mid);
+
+		y = mid-box;
+
+		try {
+			precond(J, Fmid);
+		} catch(LinearException&) {
+			break;
+		}
+
+		if (!inflating_gauss_seidel(J, Fmid, y, 1e-12, mu_max)) {
+			break;
+		}
+
+		IntervalVector box2=mid-y;
+
+		if (box2.is_subset(box)) {
+
+			assert(!box2.is_empty());
+
+			if (!success) unicity = box;
+
+			success=true;
+		}
+
+		box = success? box2 : box2.inflate(delta,chi);
+
+		k++;
+	}
+
+	if (success) {
+		box_existence = box;
+		box_unicity = unicity;
+	}
+	return success;
+}
+
 }
 
 bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double prec, double ratio_gauss_seidel) {
@@ -39,6 +195,16 @@ bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double p
 	int m=f.image_dim();
 	assert(full_box.size()==f.nb_var());
 
+	const SparseIntervalMatrix* pattern=sparse_pattern(f,vars);
+
+	if (pattern) {
+		bool reducted;
+		bool done=sparse_newton(f,*pattern,full_box,prec,ratio_gauss_seidel,reducted);
+		// otherwise: the block preconditioning failed
+		// --> resort to the dense iteration
+		if (done) return reducted;
+	}
+
 	IntervalMatrix J(m, n);
 
 	IntervalVector* p=NULL;      // Parameter box
@@ -160,6 +326,15 @@ bool inflating_newton(const Fnc& f, const VarSet* vars, const IntervalVector& fu
 		return false;
 	}
 
+	const SparseIntervalMatrix* pattern=sparse_pattern(f,vars);
+
+	if (pattern) {
+		bool success=sparse_inflating_newton(f,*pattern,full_box,box_existence,box_unicity,k_max,mu_max,delta,chi);
+		// otherwise: the block preconditioning is weaker than the
+		// midpoint inverse --> try again with the dense iteration
+		if (success) return true;
+	}
+
 	int k=0;
 	bool success=false;
 
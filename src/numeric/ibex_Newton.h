@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 24, 2012
-// Last Update : May 24, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_NEWTON_H__
@@ -26,6 +26,21 @@ _IBEX_DLL_PORT_ extern double default_newton_prec;
  */
 _IBEX_DLL_PORT_ extern double default_gauss_seidel_ratio;
 
+/**
+ * \brief Default density threshold for the sparse Newton iteration
+ *
+ * When the function has no parameter (no VarSet), is square and the density of
+ * the pattern of its Jacobian matrix (see #Fnc::jacobian_pattern()) is below
+ * this value, the Newton iterations work with sparse matrices
+ * (see #SparseIntervalMatrix): sparse Hansen matrix, block-diagonal
+ * preconditioning and sparse Gauss-Seidel. Set to 0 to always use dense matrices.
+ *
+ * Since the block-diagonal preconditioning is weaker than the midpoint inverse,
+ * #inflating_newton resorts to the dense iteration if the sparse one fails, and
+ * so does #newton if the preconditioning fails. Default value is 0.05.
+ */
+_IBEX_DLL_PORT_ extern double default_newton_sparse_density;
+
 /** \ingroup numeric
  *
  * \brief Multivariate Newton operator (contracting).
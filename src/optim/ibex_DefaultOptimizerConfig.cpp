@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Dec 11, 2014
-// Last Update : Oct 14, 2019
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_DefaultOptimizerConfig.h"
@@ -72,6 +72,11 @@ DefaultOptimizerConfig::DefaultOptimizerConfig(const System& sys, double rel_eps
 	set_eps_x(eps_x);
 }
 
+DefaultOptimizerConfig::DefaultOptimizerConfig(const System& sys, const DefaultOptimizerConfig& other) :
+		OptimizerConfig(other), sys(sys), eps_h(other.eps_h), rigor(other.rigor), inHC4(other.inHC4),
+		kkt(other.kkt), random_seed(other.random_seed) {
+}
+
 DefaultOptimizerConfig::~DefaultOptimizerConfig() {
 
 }
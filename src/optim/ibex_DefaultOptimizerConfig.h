@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Dec 11, 2014
-// Last Update : Oct 14, 2019
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_DEFAULT_OPTIMIZER_CONFIG_H__
@@ -44,6 +44,17 @@ public:
 							double eps_h, bool rigor, bool inHC4, bool kkt,
 							double random_seed, const Vector& eps_x);
 
+	/**
+	 * \brief Create a configuration with the same settings as \a other.
+	 *
+	 * Typically used to build one configuration per thread
+	 * (see #ParallelOptimizer).
+	 *
+	 * \param sys         - The system to optimize (in general,
+	 *                      a copy of the system of \a other).
+	 */
+	DefaultOptimizerConfig(const System& sys, const DefaultOptimizerConfig& other);
+
 	/**
 	 * \brief Delete this.
 	 */
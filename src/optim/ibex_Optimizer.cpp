@@ -4,13 +4,13 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 14, 2012
-// Last Update : Feb 13, 2025
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_Optimizer.h"
 #include "ibex_Timer.h"
+#include "ibex_Pool.h"
 #include "ibex_Function.h"
-#include "ibex_NoBisectableVariableException.h"
 #include "ibex_BxpOptimData.h"
 #include "ibex_CovOptimData.h"
 
@@ -48,13 +48,17 @@ Optimizer::Optimizer(int n, Ctc& ctc, Bsc& bsc, LoupFinder& finder,
                 						n(n), goal_var(goal_var),
 										ctc(ctc), bsc(bsc), loup_finder(finder), buffer(buffer),
 										eps_x(n, eps_x), rel_eps_f(rel_eps_f), abs_eps_f(abs_eps_f),
-										trace(0), timeout(-1), extended_COV(true), anticipated_upper_bounding(true),
+										trace(0), timeout(-1), extended_COV(true), anticipated_upper_bounding(true), pool_allocation(false), real_time(false),
 										status(SUCCESS),
 										uplo(NEG_INFINITY), uplo_of_epsboxes(POS_INFINITY), loup(POS_INFINITY),
 										loup_point(IntervalVector::empty(n)), initial_loup(POS_INFINITY), loup_changed(false),
 										time(0), nb_cells(0), cov(NULL) {
 
 	if (trace) cout.precision(12);
+
+#ifndef _WIN32
+	output_lock=NULL;
+#endif
 	
 	if (enable_statistics) {
 		statistics = new Statistics();
@@ -79,11 +83,16 @@ Optimizer::Optimizer(OptimizerConfig& config) :
 		config.get_abs_eps_f(),
 		config.with_statistics()) {
 
-	(Vector&) eps_x				= config.get_eps_x();
+	if (config.get_eps_x().size()==1) // not initialized (same value for all the variables)
+		(Vector&) eps_x			= Vector(n, config.get_eps_x()[0]);
+	else
+		(Vector&) eps_x			= config.get_eps_x();
 	trace						= config.get_trace();
 	timeout						= config.get_timeout();
 	extended_COV				= config.with_extended_cov();
 	anticipated_upper_bounding	= config.with_anticipated_upper_bounding();
+	pool_allocation				= config.with_pool_allocation();
+	real_time					= config.with_real_time();
 }
 
 Optimizer::~Optimizer() {
@@ -111,13 +120,18 @@ double Optimizer::compute_ymax() {
 
 bool Optimizer::update_loup(const IntervalVector& box, BoxProperties& prop) {
 
-	try {
+	pair<IntervalVector,double> p;
+
+	if (loup_finder.try_find(box,loup_point,loup,prop,p)) {
 
-		pair<IntervalVector,double> p=loup_finder.find(box,loup_point,loup,prop);
 		loup_point = p.first;
 		loup = p.second;
 
 		if (trace) {
+#ifndef _WIN32
+			unique_lock<mutex> lock;
+			if (output_lock) lock=unique_lock<mutex>(*output_lock);
+#endif
 			cout << "                    ";
 			cout << "\033[32m loup= " << loup << "\033[0m" << endl;
 //			cout << " loup point=";
@@ -128,9 +142,8 @@ bool Optimizer::update_loup(const IntervalVector& box, BoxProperties& prop) {
 		}
 		return true;
 
-	} catch(LoupFinder::NotFound&) {
+	} else
 		return false;
-	}
 }
 
 //bool Optimizer::update_entailed_ctr(const IntervalVector& box) {
@@ -196,6 +209,10 @@ void Optimizer::update_uplo_of_epsboxes(double ymin) {
 	if (uplo_of_epsboxes > ymin) {
 		uplo_of_epsboxes = ymin;
 		if (trace) {
+#ifndef _WIN32
+			unique_lock<mutex> lock;
+			if (output_lock) lock=unique_lock<mutex>(*output_lock);
+#endif
 			cout << " unprocessable tiny box: now uplo<=" << setprecision(12) <<  uplo_of_epsboxes << " uplo=" << uplo << endl;
 		}
 	}
@@ -277,7 +294,7 @@ void Optimizer::contract_and_bound(Cell& c) {
 
 	/*====================================================================*/
 	// Note: there are three different cases of "epsilon" box,
-	// - NoBisectableVariableException raised by the bisector (---> see optimize(...)) which
+	// - no bisectable variable according to the bisector (---> see optimize(...)) which
 	//   is independent from the optimizer
 	// - the width of the box is less than the precision given to the optimizer ("eps_x" for
 	//   the original variables and "abs_eps_f" for the goal variable)
@@ -422,7 +439,9 @@ void Optimizer::start(const CovOptimData& data, double obj_init_bound) {
 }
 
 Optimizer::Status Optimizer::optimize() {
-	Timer timer;
+	Pool::Scope pool(pool_allocation);
+
+	Timer timer(real_time? Timer::REAL_TIME : Timer::CPU_TIME);
 	timer.start();
 
 	update_uplo();
@@ -435,9 +454,10 @@ Optimizer::Status Optimizer::optimize() {
 			Cell *c = buffer.top();
 			if (trace >= 2) cout << " current box " << c->box << endl;
 
-			try {
+			pair<Cell*,Cell*> new_cells;
+
+			if (bsc.try_bisect(*c,new_cells)) {
 
-				pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
 				buffer.pop();
 				delete c; // deletes the cell.
 
@@ -474,11 +494,11 @@ Optimizer::Status Optimizer::optimize() {
 					if (get_obj_rel_prec()<rel_eps_f || get_obj_abs_prec()<abs_eps_f)
 						break;
 
-				if (timeout>0) timer.check(timeout); // TODO: not reentrant, JN: done
-				time = timer.get_time();
+				// the clock is only read from time to time (cells can be very cheap)
+				if (timeout>0) timer.check_amortized(timeout);
 
 			}
-			catch (NoBisectableVariableException& ) {
+			else { // no bisectable variable
 				update_uplo_of_epsboxes((c->box)[goal_var].lb());
 				buffer.pop();
 				delete c; // deletes the cell.
@@ -490,23 +510,36 @@ Optimizer::Status Optimizer::optimize() {
 	 	timer.stop();
 	 	time = timer.get_time();
 
-		// No solution found and optimization stopped with empty buffer
-		// before the required precision is reached => means infeasible problem
-	 	if (uplo_of_epsboxes == NEG_INFINITY)
-	 		status = UNBOUNDED_OBJ;
-	 	else if (uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==initial_loup && abs_eps_f==0 && rel_eps_f==0)))
-	 		status = INFEASIBLE;
-	 	else if (loup==initial_loup)
-	 		status = NO_FEASIBLE_FOUND;
-	 	else if (get_obj_rel_prec()>rel_eps_f && get_obj_abs_prec()>abs_eps_f)
-	 		status = UNREACHED_PREC;
-	 	else
-	 		status = SUCCESS;
+	 	compute_status();
 	}
 	catch (TimeOutException& ) {
+		timer.stop();
+		time = timer.get_time();
 		status = TIME_OUT;
 	}
 
+	fill_cov();
+
+	return status;
+}
+
+void Optimizer::compute_status() {
+	// No solution found and optimization stopped with empty buffer
+	// before the required precision is reached => means infeasible problem
+	if (uplo_of_epsboxes == NEG_INFINITY)
+		status = UNBOUNDED_OBJ;
+	else if (uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==initial_loup && abs_eps_f==0 && rel_eps_f==0)))
+		status = INFEASIBLE;
+	else if (loup==initial_loup)
+		status = NO_FEASIBLE_FOUND;
+	else if (get_obj_rel_prec()>rel_eps_f && get_obj_abs_prec()>abs_eps_f)
+		status = UNREACHED_PREC;
+	else
+		status = SUCCESS;
+}
+
+void Optimizer::fill_cov() {
+
 	/* TODO: cannot retrieve variable names here. */
 	for (int i=0; i<(extended_COV ? n+1 : n); i++)
 		cov->data->_optim_var_names.push_back(string(""));
@@ -520,6 +553,9 @@ Optimizer::Status Optimizer::optimize() {
 	cov->data->_optim_nb_cells += nb_cells;
 	cov->data->_optim_loup_point = loup_point;
 
+	// the boxes are either stored in the COV structure or directly written in the output file
+	CovOptimData::Writer* writer = output_file.empty()? NULL : new CovOptimData::Writer(output_file.c_str(), cov->n);
+
 	// for conversion between original/extended boxes
 	IntervalVector tmp(extended_COV ? n+1 : n);
 
@@ -527,24 +563,26 @@ Optimizer::Status Optimizer::optimize() {
 	if (extended_COV) {
 		write_ext_box(loup_point, tmp);
 		tmp[goal_var] = Interval(uplo,loup);
-		cov->add(tmp);
 	}
 	else {
-		cov->add(loup_point);
+		tmp = loup_point;
 	}
+	if (writer) writer->add(tmp); else cov->add(tmp);
 
 	while (!buffer.empty()) {
 		Cell* cell=buffer.top();
 		if (extended_COV)
-			cov->add(cell->box);
-		else {
+			tmp = cell->box;
+		else
 			read_ext_box(cell->box,tmp);
-			cov->add(tmp);
-		}
+		if (writer) writer->add(tmp); else cov->add(tmp);
 		delete buffer.pop();
 	}
 
-	return status;
+	if (writer) {
+		writer->set_data(*cov);
+		delete writer; // closes the file
+	}
 }
 
 namespace {
@@ -635,7 +673,7 @@ void Optimizer::report() {
 		cout << endl;
 	}
 
-	cout << " cpu time used:\t\t\t" << time << "s";
+	cout << (real_time? " real time used:\t\t" : " cpu time used:\t\t\t") << time << "s";
 	if (cov->time()!=time)
 		cout << " [total=" << cov->time() << "]";
 	cout << endl;
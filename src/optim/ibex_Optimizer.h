@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 14, 2012
-// Last Update : Feb 13, 2025
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_OPTIMIZER_H__
@@ -14,6 +14,10 @@
 #include "ibex_OptimizerConfig.h"
 #include "ibex_CovOptimData.h"
 
+#ifndef _WIN32 // MinGW does not support threads
+#include <mutex>
+#endif
+
 namespace ibex {
 
 /**
@@ -288,7 +292,7 @@ public:
 	/**
 	 * \brief Time limit.
 	 *
-	 * Maximum CPU time used by the strategy.
+	 * Maximum CPU time (or real time, see #real_time) used by the strategy.
 	 * This parameter allows to bound time consumption.
 	 * The value can be fixed by the user.
 	 */
@@ -304,6 +308,19 @@ public:
 	 */
 	bool extended_COV; // TODO: should be set in OptimizerConfig
 
+	/**
+	 * \brief COV file where the results are written.
+	 *
+	 * If not empty, the loup-point and the remaining cells of the buffer
+	 * are directly written in the file at the end of optimize(...)
+	 * (see CovOptimData::Writer) instead of being copied in the COV
+	 * structure. In this case, the data returned by #get_data() contains
+	 * no box (only the optimization information).
+	 *
+	 * Default value: empty.
+	 */
+	std::string output_file;
+
 	/**
 	 * \brief Whether anticipated upper bounding has to be applied.
 	 *
@@ -318,6 +335,22 @@ public:
 	 */
 	bool anticipated_upper_bounding; // TODO: should be set in OptimizerConfig
 
+	/**
+	 * \brief Whether cells, boxes and box properties are allocated
+	 * in a pool during the search (see #ibex::Pool).
+	 *
+	 * Default value: false.
+	 */
+	bool pool_allocation;
+
+	/**
+	 * \brief Whether the running time (and the timeout) is the elapsed
+	 * real time instead of the CPU time.
+	 *
+	 * Default value: false.
+	 */
+	bool real_time;
+
 protected:
 	/*
 	 * \brief Initialize the optimizer from a single box.
@@ -332,7 +365,21 @@ protected:
 	/**
 	 * \brief Run the optimizer (once started).
 	 */
-	Status optimize();
+	virtual Status optimize();
+
+	/**
+	 * \brief Set the status once the search is over (time out excepted).
+	 */
+	void compute_status();
+
+	/**
+	 * \brief Store the results in the COV structure
+	 *        (or in the output file, see #output_file).
+	 *
+	 * The loup-point is stored first and the remaining
+	 * cells of the buffer are moved (and deleted) afterwards.
+	 */
+	void fill_cov();
 
 	/**
 	 * \brief Main procedure for processing a box.
@@ -412,6 +459,8 @@ protected:
 
 private:
 
+	friend class ParallelOptimizer;
+
 	Optimizer(const Optimizer&); // forbidden
 
 	/** Currently entailed constraints */
@@ -449,6 +498,14 @@ private:
 	/** True if loup has changed in the last call to handle_cell(..) */
 	bool loup_changed;
 
+#ifndef _WIN32
+	/**
+	 * \brief Lock of the trace
+	 *        (NULL if the optimizer is not run by several threads).
+	 */
+	std::mutex* output_lock;
+#endif
+
 	/* CPU running time of the current optimization. */
 	double time;
 
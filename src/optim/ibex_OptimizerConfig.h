@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Dec 11, 2014
-// Last Update : Feb 13, 2025
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_OPTIMIZER_CONFIG_H__
@@ -119,6 +119,25 @@ public:
 	 */
 	void set_statistics(bool statistics);
 
+	/**
+	 * \brief Set whether cells, boxes and box properties are
+	 * allocated in a pool (see #ibex::Pool).
+	 *
+	 * This reduces the number of calls to the system allocator
+	 * (and memory fragmentation) on long runs.
+	 *
+	 * Default value: false.
+	 */
+	void set_pool_allocation(bool pool_allocation);
+
+	/**
+	 * \brief Set whether the running time (and the timeout) is the
+	 * elapsed real time instead of the CPU time.
+	 *
+	 * Default value: false.
+	 */
+	void set_real_time(bool real_time);
+
 	/** see #set_rel_eps_f(). */
 	double get_rel_eps_f() const;
 
@@ -146,6 +165,12 @@ public:
 	/** see #set_statistics(). */
 	bool with_statistics() const;
 
+	/** see #set_pool_allocation(). */
+	bool with_pool_allocation() const;
+
+	/** see #set_real_time(). */
+	bool with_real_time() const;
+
 	/** Default goal relative precision: 1e-3. */
 	static constexpr double default_rel_eps_f = 1e-03;
 
@@ -167,6 +192,12 @@ public:
 	/** Default anticipated upper bounding : true (enabled). */
 	static constexpr bool default_anticipated_UB = true;
 
+	/** Default pool allocation: false (disabled). */
+	static constexpr bool default_pool_allocation = false;
+
+	/** Default clock: CPU time (real time disabled). */
+	static constexpr bool default_real_time = false;
+
 protected:
 
 	friend class Optimizer;
@@ -196,6 +227,8 @@ protected:
 	bool extended_COV;
 	bool anticipated_UB;
 	bool statistics;
+	bool pool_allocation;
+	bool real_time;
 };
 
 inline OptimizerConfig::OptimizerConfig() : eps_x(1) {
@@ -206,6 +239,8 @@ inline OptimizerConfig::OptimizerConfig() : eps_x(1) {
 	timeout        = OptimizerConfig::default_timeout;
 	extended_COV   = OptimizerConfig::default_extended_cov;
 	anticipated_UB = OptimizerConfig::default_anticipated_UB;
+	pool_allocation = OptimizerConfig::default_pool_allocation;
+	real_time      = OptimizerConfig::default_real_time;
 }
 
 inline void OptimizerConfig::set_rel_eps_f(double _rel_eps_f)     { rel_eps_f = _rel_eps_f; }
@@ -224,6 +259,10 @@ inline void OptimizerConfig::set_anticipated_upper_bounding(bool _antipated_UB)
 
 inline void OptimizerConfig::set_statistics(bool _statistics)     { statistics = _statistics; }
 
+inline void OptimizerConfig::set_pool_allocation(bool _pool_allocation) { pool_allocation = _pool_allocation; }
+
+inline void OptimizerConfig::set_real_time(bool _real_time)       { real_time = _real_time; }
+
 inline double OptimizerConfig::get_rel_eps_f() const                 { return rel_eps_f; }
 
 inline double OptimizerConfig::get_abs_eps_f() const                 { return abs_eps_f; }
@@ -240,6 +279,10 @@ inline bool OptimizerConfig::with_anticipated_upper_bounding() const { return an
 
 inline bool OptimizerConfig::with_statistics() const                 { return statistics; }
 
+inline bool OptimizerConfig::with_pool_allocation() const            { return pool_allocation; }
+
+inline bool OptimizerConfig::with_real_time() const                  { return real_time; }
+
 } /* namespace ibex */
 
 #endif /* __IBEX_OPTIMIZER_CONFIG_H__ */
@@ -0,0 +1,350 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelOptimizer.cpp
+// Author      : Gilles Chabert, Bertrand Neveu
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ParallelOptimizer.h"
+#include "ibex_Pool.h"
+#include "ibex_Random.h"
+
+#ifndef _WIN32
+#include <thread>
+#include <chrono>
+#include <exception>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+#ifndef _WIN32
+namespace {
+
+void atomic_min(atomic<double>& a, double x) {
+	double cur=a.load();
+	while (x<cur && !a.compare_exchange_weak(cur,x)) { }
+}
+
+}
+#endif
+
+ParallelOptimizer::ParallelOptimizer(Array<OptimizerConfig>& configs) : Optimizer(configs[0]),
+		nb_threads(configs.size()), random_seed(RNG::get_seed()), workers(configs.size()), shared_loup_point(n) {
+
+	workers.set_ref(0,*this);
+
+	for (int w=1; w<nb_threads; w++)
+		workers.set_ref(w,*new Optimizer(configs[w]));
+
+#ifndef _WIN32
+	buffer_lock = new mutex[nb_threads];
+	current_lb = new atomic<double>[nb_threads];
+#endif
+}
+
+ParallelOptimizer::~ParallelOptimizer() {
+	for (int w=1; w<nb_threads; w++)
+		delete &workers[w];
+
+#ifndef _WIN32
+	delete[] buffer_lock;
+	delete[] current_lb;
+#endif
+}
+
+Cell* ParallelOptimizer::import_cell(int w, Cell* c) {
+	Optimizer& o=workers[w];
+
+	Cell* c2=new Cell(c->box, c->bisected_var, c->depth);
+	delete c;
+
+	// same as when a search is restarted from a COV
+	o.buffer.add_property(c2->box, c2->prop);
+	o.bsc.add_property(c2->box, c2->prop);
+	o.ctc.add_property(c2->box, c2->prop);
+	o.loup_finder.add_property(c2->box, c2->prop);
+
+	return c2;
+}
+
+#ifdef _WIN32
+
+Optimizer::Status ParallelOptimizer::optimize() {
+	// no thread support: the master works alone.
+	return Optimizer::optimize();
+}
+
+#else
+
+void ParallelOptimizer::sync_loup(int w) {
+	Optimizer& o=workers[w];
+
+	if (o.loup < shared_loup) {
+		// share the new loup
+		lock_guard<mutex> lock(loup_lock);
+		if (o.loup < shared_loup) {
+			shared_loup = o.loup;
+			shared_loup_point = o.loup_point;
+		} else {
+			o.loup = shared_loup;
+			o.loup_point = shared_loup_point;
+		}
+	} else if (shared_loup < o.loup) {
+		// retrieve the loup found by another worker
+		lock_guard<mutex> lock(loup_lock);
+		o.loup = shared_loup;
+		o.loup_point = shared_loup_point;
+	} else
+		return;
+
+	// all the cells with a lower bound greater than
+	// (loup - goal_prec) are removed and deleted.
+	double ymax=o.compute_ymax();
+
+	lock_guard<mutex> lock(buffer_lock[w]);
+	unsigned int size=o.buffer.size();
+	o.buffer.contract(ymax);
+	nb_pending -= size-o.buffer.size();
+}
+
+Cell* ParallelOptimizer::steal(int w) {
+	for (int i=1; i<nb_threads; i++) {
+		int v=(w+i)%nb_threads;
+		Cell* c=NULL;
+		{
+			lock_guard<mutex> lock(buffer_lock[v]);
+			if (!workers[v].buffer.empty()) {
+				c=workers[v].buffer.pop();
+				// note: must be visible before the lock is released
+				current_lb[w]=c->box[goal_var].lb();
+			}
+		}
+		if (c) return import_cell(w,c);
+	}
+	return NULL;
+}
+
+void ParallelOptimizer::handle_subcell(int w, Cell* c) {
+	Optimizer& o=workers[w];
+
+	o.contract_and_bound(*c);
+
+	if (c->box.is_empty()) {
+		delete c;
+	} else {
+		nb_pending++;
+		lock_guard<mutex> lock(buffer_lock[w]);
+		o.buffer.push(c);
+	}
+}
+
+double ParallelOptimizer::global_uplo() {
+	double lb=shared_uplo_of_epsboxes;
+
+	for (int w=0; w<nb_threads; w++)
+		buffer_lock[w].lock();
+
+	for (int w=0; w<nb_threads; w++) {
+		if (!workers[w].buffer.empty() && workers[w].buffer.minimum() < lb)
+			lb=workers[w].buffer.minimum();
+		if (current_lb[w] < lb)
+			lb=current_lb[w];
+	}
+
+	for (int w=0; w<nb_threads; w++)
+		buffer_lock[w].unlock();
+
+	return lb;
+}
+
+void ParallelOptimizer::run_worker(int w) {
+	Optimizer& o=workers[w];
+
+	// otherwise all the workers would draw the same sequence
+	if (w>0) RNG::srand(random_seed+w);
+
+	// free lists are local to each thread
+	Pool::Scope pool(o.pool_allocation);
+
+	long iter=0;
+
+	while (!stop) {
+
+		sync_loup(w);
+
+		Cell* c=NULL;
+		{
+			lock_guard<mutex> lock(buffer_lock[w]);
+			if (!o.buffer.empty()) {
+				c=o.buffer.pop();
+				current_lb[w]=c->box[goal_var].lb();
+			}
+		}
+
+		if (!c) c=steal(w);
+
+		if (!c) {
+			if (nb_pending==0) break; // search is over
+			this_thread::yield();
+			continue;
+		}
+
+		o.loup_changed=false;
+
+		if (o.trace >= 2) {
+			lock_guard<mutex> lock(output_mutex);
+			cout << " current box " << c->box << endl;
+		}
+
+		pair<Cell*,Cell*> new_cells;
+
+		if (o.bsc.try_bisect(*c,new_cells)) {
+			delete c;
+
+			o.nb_cells+=2;
+
+			handle_subcell(w, new_cells.first);
+			handle_subcell(w, new_cells.second);
+		}
+		else { // no bisectable variable
+			o.update_uplo_of_epsboxes((c->box)[goal_var].lb());
+			delete c;
+		}
+
+		// note: must be done before current_lb is reset
+		atomic_min(shared_uplo_of_epsboxes, o.uplo_of_epsboxes);
+
+		current_lb[w]=POS_INFINITY;
+		nb_pending--;
+
+		if (o.uplo_of_epsboxes == NEG_INFINITY)
+			stop=true;
+
+		if (o.loup_changed) {
+			sync_loup(w);
+
+			if (o.compute_ymax() <= NEG_INFINITY) {
+				if (o.trace) {
+					lock_guard<mutex> lock(output_mutex);
+					cout << " infinite value for the minimum " << endl;
+				}
+				stop=true;
+			}
+		}
+
+		// useless to check precision on objective if 'anticipated_upper_bounding'
+		// is true. The global uplo is calculated from time to time, by the master only.
+		if (w==0 && !anticipated_upper_bounding && ++iter % 64 == 0) {
+			double new_uplo=global_uplo();
+			if (new_uplo > uplo) uplo = new_uplo;
+			if (get_obj_rel_prec()<rel_eps_f || get_obj_abs_prec()<abs_eps_f)
+				stop=true;
+		}
+
+		if (timeout>0 && chrono::duration<double>(chrono::steady_clock::now()-start_time).count() >= timeout) {
+			time_out=true;
+			stop=true;
+		}
+	}
+}
+
+Optimizer::Status ParallelOptimizer::optimize() {
+
+	if (nb_threads==1)
+		return Optimizer::optimize();
+
+	start_time = chrono::steady_clock::now();
+
+	// The other workers start with the same state as the master
+	for (int w=1; w<nb_threads; w++) {
+		Optimizer& o=workers[w];
+		o.buffer.flush();
+		o.buffer.contract(loup);
+		o.loup = loup;
+		o.loup_point = loup_point;
+		o.initial_loup = initial_loup;
+		o.uplo = uplo;
+		o.uplo_of_epsboxes = POS_INFINITY;
+		o.nb_cells = 0;
+		o.output_lock = &output_mutex;
+	}
+	output_lock = &output_mutex;
+
+	shared_loup = loup;
+	shared_loup_point = loup_point;
+	shared_uplo_of_epsboxes = uplo_of_epsboxes;
+
+	for (int w=0; w<nb_threads; w++)
+		current_lb[w] = POS_INFINITY;
+
+	nb_pending = buffer.size();
+	stop = false;
+	time_out = false;
+
+	vector<exception_ptr> errors(nb_threads);
+
+	auto run = [this,&errors](int w) {
+		try {
+			run_worker(w);
+		} catch(...) {
+			errors[w]=current_exception();
+			stop=true;
+		}
+	};
+
+	vector<thread> threads;
+	for (int w=1; w<nb_threads; w++)
+		threads.push_back(thread(run,w));
+
+	run(0);
+
+	for (vector<thread>::iterator it=threads.begin(); it!=threads.end(); ++it)
+		it->join();
+
+	for (int w=0; w<nb_threads; w++)
+		workers[w].output_lock = NULL;
+
+	time = chrono::duration<double>(chrono::steady_clock::now()-start_time).count();
+
+	for (int w=0; w<nb_threads; w++)
+		if (errors[w]) rethrow_exception(errors[w]);
+
+	// Gather the results of all the workers in the master
+	loup = shared_loup;
+	loup_point = shared_loup_point;
+
+	for (int w=1; w<nb_threads; w++) {
+		Optimizer& o=workers[w];
+
+		nb_cells += o.nb_cells;
+
+		if (o.uplo_of_epsboxes < uplo_of_epsboxes)
+			uplo_of_epsboxes = o.uplo_of_epsboxes;
+
+		// remaining cells (if the search has been interrupted)
+		while (!o.buffer.empty())
+			buffer.push(import_cell(0,o.buffer.pop()));
+	}
+
+	buffer.contract(compute_ymax());
+
+	update_uplo();
+
+	if (time_out)
+		status = TIME_OUT;
+	else
+		compute_status();
+
+	fill_cov();
+
+	return status;
+}
+
+#endif
+
+} // end namespace ibex
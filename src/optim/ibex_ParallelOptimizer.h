@@ -0,0 +1,200 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelOptimizer.h
+// Author      : Gilles Chabert, Bertrand Neveu
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_OPTIMIZER_H__
+#define __IBEX_PARALLEL_OPTIMIZER_H__
+
+#include "ibex_Optimizer.h"
+#include "ibex_Array.h"
+
+#ifndef _WIN32 // MinGW does not support threads
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#endif
+
+namespace ibex {
+
+/**
+ * \ingroup optim
+ *
+ * \brief Multi-threaded global optimizer.
+ *
+ * This optimizer runs the same branch & bound algorithm as #Optimizer
+ * but with several worker threads.
+ *
+ * Each worker has its own operators (contractor, bisector, loup finder and
+ * cell buffer), given by its own configuration. The operators of Ibex are not
+ * thread-safe so each configuration must be built on a separate copy of the
+ * system (see System(const System&, copy_mode)).
+ *
+ * A worker processes the cells of its own buffer. When its buffer is empty,
+ * it steals the best cell of another worker. The loup and the loup-point are
+ * shared: as soon as a worker finds a new loup, all the other workers contract
+ * their buffer with it.
+ *
+ * The first configuration is the one of the "master" worker (the
+ * optimizer itself). All the results (status, uplo, loup, COV data, etc.)
+ * are retrieved as for #Optimizer.
+ *
+ * \note The time reported (and the timeout) is the elapsed real time,
+ *       not the CPU time (which is the sum over the threads).
+ */
+class ParallelOptimizer : public Optimizer {
+
+public:
+
+	/**
+	 * \brief Create a parallel optimizer.
+	 *
+	 * \param configs - One configuration per worker thread (at least one).
+	 *                  All the configurations must have the same parameters
+	 *                  (precision, timeout, etc.).
+	 */
+	ParallelOptimizer(Array<OptimizerConfig>& configs);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	virtual ~ParallelOptimizer();
+
+	/**
+	 * \brief Run the optimization (see #Optimizer).
+	 */
+	using Optimizer::optimize;
+
+	/**
+	 * \brief Number of worker threads.
+	 */
+	const int nb_threads;
+
+	/**
+	 * \brief Seed of the random number generators of the workers.
+	 *
+	 * The random number generator is local to each thread (see #RNG):
+	 * the worker w>0 is seeded with random_seed+w when it starts. The
+	 * worker 0 runs in the calling thread and keeps its generator.
+	 *
+	 * Set by default to the seed of the calling thread when *this
+	 * is built (see DefaultOptimizerConfig::set_random_seed).
+	 */
+	int random_seed;
+
+protected:
+
+	/**
+	 * \brief Run the optimizer (once started) with all the threads.
+	 */
+	virtual Status optimize() override;
+
+	/**
+	 * \brief Main loop of the worker thread of index \a w.
+	 */
+	void run_worker(int w);
+
+	/**
+	 * \brief Steal a cell in the buffer of another worker.
+	 *
+	 * \return NULL if all the other buffers are empty.
+	 */
+	Cell* steal(int w);
+
+	/**
+	 * \brief Rebuild a cell coming from another worker for the worker \a w.
+	 *
+	 * The properties (Bxp) of a cell are specific to the operators
+	 * of a worker, so they are recreated from scratch. The cell \a c
+	 * is deleted.
+	 */
+	Cell* import_cell(int w, Cell* c);
+
+	/**
+	 * \brief Contract and push the subcell \a c (worker \a w).
+	 */
+	void handle_subcell(int w, Cell* c);
+
+	/**
+	 * \brief Retrieve the shared loup if it is better than the loup of worker \a w
+	 * or share the loup of \a w if it is better.
+	 */
+	void sync_loup(int w);
+
+	/**
+	 * \brief Calculate the current uplo over all the workers.
+	 */
+	double global_uplo();
+
+	/**
+	 * The worker optimizers (the first one is *this).
+	 */
+	Array<Optimizer> workers;
+
+	/**
+	 * Shared loup-point.
+	 */
+	IntervalVector shared_loup_point;
+
+#ifndef _WIN32
+	/**
+	 * Lock of the buffer of each worker.
+	 */
+	std::mutex* buffer_lock;
+
+	/**
+	 * Lock of the shared loup-point.
+	 */
+	std::mutex loup_lock;
+
+	/**
+	 * Shared loup, so that it can be read without lock.
+	 */
+	std::atomic<double> shared_loup;
+
+	/**
+	 * Shared lower bound of the small boxes taken by the precision.
+	 */
+	std::atomic<double> shared_uplo_of_epsboxes;
+
+	/**
+	 * Lower bound of the cell currently processed by each worker
+	 * (+oo if none).
+	 */
+	std::atomic<double>* current_lb;
+
+	/**
+	 * Number of cells alive (in the buffers or being processed).
+	 */
+	std::atomic<long> nb_pending;
+
+	/**
+	 * Whether the search must be interrupted.
+	 */
+	std::atomic<bool> stop;
+
+	/**
+	 * Whether the time limit has been reached.
+	 */
+	std::atomic<bool> time_out;
+
+	/**
+	 * Starting time (real time).
+	 */
+	std::chrono::steady_clock::time_point start_time;
+
+	/**
+	 * Lock of the trace (shared by all the workers).
+	 */
+	std::mutex output_mutex;
+#endif
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_PARALLEL_OPTIMIZER_H__
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Mar 19, 2014
-// Last Update : Mar 19, 2014
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_UnconstrainedLocalSearch.h"
@@ -44,6 +44,19 @@ void UnconstrainedLocalSearch::update_B_SR1(Matrix& Bk, const Vector& sk, const
 	if ((tmp!=0)&&( fabs((r*r)/tmp)<=1.e8)) Bk += (1/tmp)*outer_product(r,r);
 }
 
+Matrix UnconstrainedLocalSearch::init_B(const Vector& x0) {
+	if (!f.hessian_calculator().is_supported())
+		return Matrix::eye(n);
+
+	IntervalMatrix H(n,n);
+	f.hessian(x0,H);
+
+	if (H.is_empty() || H.is_unbounded())
+		return Matrix::eye(n);
+	else
+		return H.mid();
+}
+
 UnconstrainedLocalSearch::ReturnCode UnconstrainedLocalSearch::minimize(const Vector& x0, Vector& xk, double eps, int max_iter) {
 	// parameter for the stopping criterion
 	this->eps = eps;
@@ -78,10 +91,11 @@ UnconstrainedLocalSearch::ReturnCode UnconstrainedLocalSearch::minimize(const Ve
 		//  cout << " [minimize] xk= " << xk1 << endl;
 
 		// Initialize the quadratic approximation at the initial point x0
-		// like in the quasi-Newton algorithm
+		// like in the quasi-Newton algorithm (but with the true Hessian
+		// matrix, which is then updated by the SR1 formula)
 		double fk=_mid(f.eval(xk1));
 		Vector gk=_mid(f.gradient(xk1));
-		Matrix Bk=Matrix::eye(n);
+		Matrix Bk=init_B(xk1);
 		//  cout << " [minimize] gk= " << gk << endl;
 
 		// initialize the current point
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 19, 2014
-// Last Update : Mar 19, 2014
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_UNCONSTRAINED_LOCAL_SEARCH_H__
@@ -146,6 +146,16 @@ private:
 	 */
 	void update_B_SR1(Matrix& Bk, const Vector& sk, const Vector& gk, const Vector& gk1);
 
+	/**
+	 * \brief Initial approximation B_0 of the Hessian
+	 *
+	 * The Hessian matrix of f at x0 (calculated by automatic
+	 * differentiation). The identity matrix is returned if the
+	 * Hessian is not available (unsupported operators or x0 on
+	 * a point of non-differentiability).
+	 */
+	Matrix init_B(const Vector& x0);
+
 	/*
 	 * \brief Return the midpoint if the interval is not empty,
 	 * throw a InvalidPointException otherwise.
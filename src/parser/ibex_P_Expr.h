@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 25, 2012
-// Last Update : May 05, 2016
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_PARSER_EXPR_H__
@@ -19,7 +19,8 @@
 #include <vector>
 #include <cassert>
 
-_IBEX_DLL_PORT_ extern int ibex_lineno;
+// line number of the current parsing (one per thread)
+extern thread_local int ibex_lineno;
 
 namespace ibex {
 
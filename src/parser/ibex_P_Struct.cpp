@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Sep 9, 2012
-// Last Update : Nov 3, 2019
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_P_Struct.h"
@@ -18,19 +18,23 @@
 
 using namespace std;
 
-extern char* ibextext;
-extern int ibex_lineno;
+extern char* ibexget_text(void* scanner);
 
 // note: do not confuse with ibex_error in tools/ibex_Exception.h
 void ibexerror (const string& msg) {
-	throw ibex::SyntaxError(msg, ibextext, ibex_lineno);
+	void* scanner=ibex::parser::pstruct? ibex::parser::pstruct->scanner : NULL;
+	throw ibex::SyntaxError(msg, scanner? ibexget_text(scanner) : NULL, ibex_lineno);
+}
+
+void ibexerror (void* scanner, const char* msg) {
+	throw ibex::SyntaxError(msg, ibexget_text(scanner), ibex_lineno);
 }
 
 
 namespace ibex {
 namespace parser {
 
-P_Struct* pstruct;
+thread_local P_Struct* pstruct;
 
 void init_symbol_domain(const char* destname, Domain& dest, const Domain& src) {
 	if (src.dim==dest.dim) {
@@ -68,10 +72,17 @@ void init_function_by_copy(Function& dest, const Function& src) {
 	dest.init(x,y,src.name);
 }
 
-P_Struct::P_Struct() : func_scope(NULL), current_scope(&scopes) { }
+P_Struct::P_Struct() : scanner(NULL), func_scope(NULL), current_scope(&scopes)
+#ifndef _WIN32
+, prev_locale((locale_t) 0)
+#endif
+{ }
 
 P_Struct::~P_Struct() {
 	// destructor of P_Scope will destroy pending scopes in case of parsing error
+#ifndef _WIN32
+	if (prev_locale) uselocale(prev_locale);
+#endif
 }
 
 P_Scope& P_Struct::scope() {
@@ -80,8 +91,18 @@ P_Scope& P_Struct::scope() {
 
 void P_Struct::begin() {
 	ibex_lineno=-1;
+#ifndef _WIN32
+	// to accept the dot (instead of the french coma) with numeric numbers.
+	// The locale is only changed for the current thread (setlocale is not thread-safe).
+	static const locale_t c_locale=newlocale(LC_NUMERIC_MASK, "C", (locale_t) 0);
+	if (!c_locale)
+		ibexerror("platform does not support \"C\" locale");
+	locale_t prev=uselocale(c_locale);
+	if (!prev_locale) prev_locale=prev;
+#else
 	if (!setlocale(LC_NUMERIC, "C")) // to accept the dot (instead of the french coma) with numeric numbers
 		ibexerror("platform does not support \"C\" locale");
+#endif
 
 	ibex_lineno=1;
 }
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Sep 9, 2012
-// Last Update : Nov 3, 2019
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_PARSER_STRUCT_H__
@@ -18,12 +18,27 @@
 #include "ibex_System.h"
 
 #include <stack>
+#include <stdio.h>
 
-int ibexlex(void);
+#ifndef _WIN32
+#include <locale.h>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+#endif
 
 // note: do not confuse with ibex_error in tools/ibex_Exception.h
 void ibexerror (const std::string& msg);
 
+// error reported by the (pure) parser
+void ibexerror (void* scanner, const char* msg);
+
+// parse a Minibex file with the current pstruct
+void ibexparse_file(FILE* fd);
+
+// parse a Minibex string with the current pstruct
+void ibexparse_string(const char* syntax);
+
 namespace ibex {
 
 namespace parser {
@@ -82,6 +97,12 @@ public:
 	 */
 	P_Source source;
 
+	/**
+	 * The lexer of the current parsing
+	 * (set by ibexparse_file/ibexparse_string).
+	 */
+	void* scanner;
+
 protected:
 	/*
 	 * The stack of all scopes
@@ -104,6 +125,14 @@ protected:
 	 * Current stack of scopes.
 	 */
 	P_Scope* current_scope;
+
+#ifndef _WIN32
+	/**
+	 * Locale of the thread before parsing
+	 * (restored by the destructor).
+	 */
+	locale_t prev_locale;
+#endif
 };
 
 
@@ -111,9 +140,12 @@ protected:
 /**
  * ================================================
  * \brief Main parser structure
+ *
+ * There is one per thread, so that different
+ * threads can parse at the same time.
  * ================================================
  */
-_IBEX_DLL_PORT_ extern P_Struct* pstruct;
+extern thread_local P_Struct* pstruct;
 
 
 
@@ -0,0 +1,229 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSep.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ParallelSep.h"
+#include "ibex_SetNode.h"
+
+#ifndef _WIN32
+#include <thread>
+#include <exception>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+ParallelSep::ParallelSep(Array<Sep>& _seps) : Sep(_seps[0].nb_var),
+		nb_threads(_seps.size()), seps(_seps.size()) {
+
+	for (int w=0; w<nb_threads; w++)
+		seps.set_ref(w,_seps[w]);
+
+#ifndef _WIN32
+	queue = new deque<Task*>[nb_threads];
+	queue_lock = new mutex[nb_threads];
+#endif
+}
+
+ParallelSep::~ParallelSep() {
+#ifndef _WIN32
+	delete[] queue;
+	delete[] queue_lock;
+#endif
+}
+
+void ParallelSep::separate(IntervalVector& x_in, IntervalVector& x_out) {
+	seps[0].separate(x_in, x_out);
+}
+
+void ParallelSep::contract(Set& set, double eps) {
+	set.root = run(set.root, false, set.Rn, eps);
+}
+
+void ParallelSep::contract(SetInterval& iset, double eps, BoolInterval status1, BoolInterval status2) {
+	for (int w=0; w<nb_threads; w++) {
+		seps[w]._status1=status1;
+		seps[w]._status2=status2;
+	}
+
+	try {
+		iset.root = run(iset.root, true, iset.Rn, eps);
+	} catch(SetInterval::NoSet& e) {
+		delete iset.root;
+		iset.root = NULL;
+	}
+
+	// Restore default values
+	for (int w=0; w<nb_threads; w++) {
+		seps[w]._status1=YES;
+		seps[w]._status2=NO;
+	}
+}
+
+#ifdef _WIN32
+
+SetNode* ParallelSep::run(SetNode* root, bool iset, const IntervalVector& box, double eps) {
+	// no thread support: the first worker works alone.
+	return root->inter(iset, box, seps[0], eps);
+}
+
+bool ParallelSep::fork(bool, SetNode*&, const IntervalVector&, SetNode*&, const IntervalVector&, Sep&, double) {
+	return false;
+}
+
+#else
+
+namespace {
+
+// maximal number of pending tasks in the queue of a worker
+// (beyond, the recursion is not split anymore)
+const size_t MAX_QUEUED = 2;
+
+// the parallel separator and the index of the worker
+// running in the current thread (NULL/-1 if none)
+thread_local ParallelSep* current_sep = NULL;
+thread_local int current_worker = -1;
+
+}
+
+struct ParallelSep::Task {
+	Task(bool iset, SetNode* node, const IntervalVector& box, double eps) :
+		iset(iset), node(node), box(box), eps(eps), done(false) { }
+
+	bool iset;
+	SetNode* node;
+	const IntervalVector& box;
+	double eps;
+	exception_ptr error;
+	atomic<bool> done;
+};
+
+void ParallelSep::execute(int w, Task* t) {
+	try {
+		t->node = t->node->inter(t->iset, t->box, seps[w], t->eps);
+	} catch(...) {
+		t->error = current_exception();
+	}
+	t->done = true;
+}
+
+ParallelSep::Task* ParallelSep::steal(int w) {
+	for (int i=1; i<nb_threads; i++) {
+		int v=(w+i)%nb_threads;
+		lock_guard<mutex> lock(queue_lock[v]);
+		if (!queue[v].empty()) {
+			Task* t=queue[v].front();
+			queue[v].pop_front();
+			return t;
+		}
+	}
+	return NULL;
+}
+
+bool ParallelSep::fork(bool iset, SetNode*& left, const IntervalVector& leftbox,
+		SetNode*& right, const IntervalVector& rightbox, Sep& sep, double eps) {
+
+	ParallelSep* p=current_sep;
+	if (!p) return false;
+
+	int w=current_worker;
+
+	Task t(iset, right, rightbox, eps);
+	{
+		lock_guard<mutex> lock(p->queue_lock[w]);
+		if (p->queue[w].size()>=MAX_QUEUED) return false;
+		p->queue[w].push_back(&t);
+	}
+
+	exception_ptr error;
+	try {
+		left = left->inter(iset, leftbox, sep, eps);
+	} catch(...) {
+		error = current_exception();
+	}
+
+	// ================ join =================
+	bool stolen;
+	{
+		lock_guard<mutex> lock(p->queue_lock[w]);
+		// the tasks pushed after t have all been joined
+		stolen = p->queue[w].empty() || p->queue[w].back()!=&t;
+		if (!stolen) p->queue[w].pop_back();
+	}
+
+	if (!stolen)
+		p->execute(w, &t);
+	else {
+		// help the other workers while waiting
+		while (!t.done) {
+			Task* t2=p->steal(w);
+			if (t2) p->execute(w, t2);
+			else this_thread::yield();
+		}
+	}
+
+	if (error) rethrow_exception(error);
+	if (t.error) rethrow_exception(t.error);
+
+	right = t.node;
+	return true;
+}
+
+void ParallelSep::run_worker(int w) {
+	current_sep = this;
+	current_worker = w;
+
+	while (!finished) {
+		Task* t=steal(w);
+		if (t) execute(w, t);
+		else this_thread::yield();
+	}
+
+	current_sep = NULL;
+	current_worker = -1;
+}
+
+SetNode* ParallelSep::run(SetNode* root, bool iset, const IntervalVector& box, double eps) {
+
+	if (nb_threads==1)
+		return root->inter(iset, box, seps[0], eps);
+
+	finished = false;
+
+	vector<thread> threads;
+	for (int w=1; w<nb_threads; w++)
+		threads.push_back(thread(&ParallelSep::run_worker, this, w));
+
+	current_sep = this;
+	current_worker = 0;
+
+	exception_ptr error;
+	try {
+		root = root->inter(iset, box, seps[0], eps);
+	} catch(...) {
+		error = current_exception();
+	}
+
+	current_sep = NULL;
+	current_worker = -1;
+
+	finished = true;
+
+	for (vector<thread>::iterator it=threads.begin(); it!=threads.end(); ++it)
+		it->join();
+
+	if (error) rethrow_exception(error);
+
+	return root;
+}
+
+#endif
+
+} // namespace ibex
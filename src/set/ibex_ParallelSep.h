@@ -0,0 +1,155 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSep.h
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_SEP_H__
+#define __IBEX_PARALLEL_SEP_H__
+
+#include "ibex_Sep.h"
+#include "ibex_Array.h"
+
+#ifndef _WIN32 // MinGW does not support threads
+#include <mutex>
+#include <atomic>
+#include <deque>
+#endif
+
+namespace ibex {
+
+class SetNode;
+
+/**
+ * \ingroup iset
+ *
+ * \brief Multi-threaded separator-driven paving.
+ *
+ * Contracts a set (or an i-set) with several worker threads.
+ *
+ * The recursion of the paving (see #Sep::contract(Set&,double)) is
+ * split in tasks: when a node is bisected, the left subnode is processed by the
+ * current thread and the right one is pushed in the task queue of the thread,
+ * where it can be stolen by an idle worker (work-stealing). Since the
+ * subtree obtained for a node only depends on the node, the resulting tree is
+ * identical to the one obtained by the sequential algorithm (whatever the
+ * number of threads), as long as the separators are deterministic.
+ *
+ * Each worker has its own separator. The operators of Ibex are not thread-safe
+ * so each separator must be built on a separate copy of the functions (see
+ * Function(const Function&, copy_mode) or System(const System&, copy_mode)).
+ *
+ * The separator of the first worker is also used when this object is
+ * used as a simple separator (#separate(IntervalVector&, IntervalVector&)).
+ */
+class ParallelSep : public Sep {
+public:
+
+	/**
+	 * \brief Create a parallel separator.
+	 *
+	 * \param seps - One separator per worker thread (at least one).
+	 *               All the separators must represent the same set.
+	 */
+	ParallelSep(Array<Sep>& seps);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	virtual ~ParallelSep();
+
+	/**
+	 * \brief Separate a box (with the first separator).
+	 */
+	virtual void separate(IntervalVector& x_in, IntervalVector& x_out);
+
+	/**
+	 * \brief Contract a set (with all the threads).
+	 *
+	 * \see #Sep::contract(Set&, double).
+	 */
+	virtual void contract(Set& set, double eps);
+
+	/**
+	 * \brief Contract an i-set (with all the threads).
+	 *
+	 * \see #Sep::contract(SetInterval&, double, BoolInterval, BoolInterval).
+	 */
+	virtual void contract(SetInterval& iset, double eps, BoolInterval status1=YES, BoolInterval status2=NO);
+
+	/**
+	 * \brief Number of worker threads.
+	 */
+	const int nb_threads;
+
+	/**
+	 * \brief Intersect two sibling nodes in parallel.
+	 *
+	 * Called by SetNode::inter_children(...). If the current
+	 * thread is a worker of a parallel contraction, the right node is
+	 * processed as a new task and the function returns true. Otherwise,
+	 * nothing is done and the function returns false.
+	 */
+	static bool fork(bool iset, SetNode*& left, const IntervalVector& leftbox,
+			SetNode*& right, const IntervalVector& rightbox, Sep& sep, double eps);
+
+protected:
+
+	/**
+	 * \brief Run the contraction of a root node with all the threads.
+	 */
+	SetNode* run(SetNode* root, bool iset, const IntervalVector& box, double eps);
+
+	/**
+	 * The separators of the workers.
+	 */
+	Array<Sep> seps;
+
+#ifndef _WIN32
+	struct Task;
+
+	/**
+	 * \brief Main loop of the worker thread of index \a w (w>0).
+	 */
+	void run_worker(int w);
+
+	/**
+	 * \brief Execute a task (in the worker \a w).
+	 */
+	void execute(int w, Task* t);
+
+	/**
+	 * \brief Steal a task in the queue of another worker.
+	 *
+	 * \return NULL if all the other queues are empty.
+	 */
+	Task* steal(int w);
+
+	/**
+	 * The task queue of each worker. Tasks are pushed and popped
+	 * at the back by the owner and stolen at the front.
+	 */
+	std::deque<Task*>* queue;
+
+	/**
+	 * Lock of the queue of each worker.
+	 */
+	std::mutex* queue_lock;
+
+	/**
+	 * Whether the contraction is over.
+	 */
+	std::atomic<bool> finished;
+#endif
+
+private:
+	ParallelSep(const ParallelSep&); // forbidden
+};
+
+} // namespace ibex
+
+#endif // __IBEX_PARALLEL_SEP_H__
@@ -85,7 +85,7 @@ public:
 	 * \param eps - The separator is applied recursively on the set. This parameter
 	 *              is a precision for controlling the recursivity.
 	 */
-	void contract(Set& set, double eps);
+	virtual void contract(Set& set, double eps);
 
 	/**
 	 * \brief Contract an i-set with this separator.
@@ -100,7 +100,7 @@ public:
 	 * \param eps - The separator is applied recursively on the i-set. This parameter
 	 *              is a precision for controlling the recursivity.
 	 */
-	void contract(SetInterval& iset, double eps, BoolInterval status1=YES, BoolInterval status2=NO);
+	virtual void contract(SetInterval& iset, double eps, BoolInterval status1=YES, BoolInterval status2=NO);
 
 	/**
 	 * \brief Delete *this.
@@ -121,6 +121,7 @@ public:
   BoolInterval status2() const;
 
 private:
+    friend class ParallelSep;
 
     BoolInterval _status1;
     BoolInterval _status2;
@@ -5,17 +5,20 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Mar 3, 2015
-// Last Update : Jul 05, 2016
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_SepQInter.h"
 #include "ibex_QInter.h"
+#include "ibex_ParallelFor.h"
 
 namespace ibex {
 
-SepQInter::SepQInter(const Array<Sep>& list, int q) :
+SepQInter::SepQInter(const Array<Sep>& list, int q, int nb_threads) :
 	Sep(list[0].nb_var),
 	list(list),
+	nb_threads(nb_threads),
+	max_grid_cells(POS_INFINITY),
 	boxes_in(list.size(), list[0].nb_var),
 	boxes_out(list.size(), list[0].nb_var)
 	{ this->set_q(q); }
@@ -26,18 +29,20 @@ void SepQInter::separate(IntervalVector& xin, IntervalVector& xout) {
 	Array<IntervalVector> refs_out(list.size());
 
 
-	for (int i=0; i<list.size(); i++) {
+	parallel_for(list.size(), nb_threads, [&](int i) {
 		boxes_in[i]=xin;
 		boxes_out[i]=xout;
 
 		list[i].separate(boxes_in[i], boxes_out[i]);
+	});
 
+	for (int i=0; i<list.size(); i++) {
 		refs_in.set_ref(i,boxes_in[i]);
 		refs_out.set_ref(i,boxes_out[i]);
 	}
 
-	xin &= qinter(refs_in,q+1);
-  xout &= qinter(refs_out, list.size() - q);
+	xin &= qinter(refs_in, q+1, max_grid_cells);
+	xout &= qinter(refs_out, list.size() - q, max_grid_cells);
 
 }
 
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 22, 2015
-// Last Update : Jul 05, 2016
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_SEP_QINTER_H__
@@ -25,6 +25,8 @@ namespace ibex {
  * Algebra of Separators with Application to Path Planning".
  * Engineering Applications of Artificial Intelligence volume 33, pp. 141-147.
  *
+ * The q-intersections are calculated as in #CtcQInter and the
+ * sub-separators can be called in parallel.
  */
 
 class SepQInter : public Sep {
@@ -35,8 +37,10 @@ public:
 	 * \param list : list of separators
 	 * 				The list itself is not kept by reference.
 	 * \param q : the nunmber of constrains that can be relaxed
+	 * \param nb_threads : the number of threads used to call the sub-separators.
+	 *                     The sub-separators must not share data (see #CtcQInter).
 	 */
-    SepQInter(const Array<Sep>& list, int q = 0);
+    SepQInter(const Array<Sep>& list, int q = 0, int nb_threads = 1);
 
 
   /**
@@ -59,6 +63,16 @@ public:
 	 */
 	int get_q();
 
+	/**
+	 * \brief The number of threads.
+	 */
+	int nb_threads;
+
+	/**
+	 * \brief Maximal number of cells of the grid algorithm (see #CtcQInter).
+	 */
+	double max_grid_cells;
+
 protected:
   /**
    * \brief boxes_in : stores in boxes for each contraction
@@ -13,6 +13,7 @@
 #include "ibex_Heap.h"
 #include "ibex_CellStack.h"
 #include "ibex_SepFwdBwd.h"
+#include "ibex_ParallelSep.h"
 #include "ibex_String.h"
 #include "ibex_Id.h"
 #include "ibex_Bxp.h"
@@ -59,18 +60,65 @@ Set::Set(const IntervalVector& box, BoolInterval status) : root(NULL), Rn(box.si
 	}
 }
 
-Set::Set(Function& f, CmpOp op, double eps) : root(new SetLeaf(YES)), Rn(f.nb_var()) {
+namespace {
+
+// Contract a set with one separator per thread, each built on
+// its own copy of the function (the first one uses f itself).
+void parallel_contract(Set& set, const Function& f, CmpOp op, double eps, int nb_threads) {
+	Array<NumConstraint> ctrs(nb_threads);
+	Array<Sep> seps(nb_threads);
+
+	for (int w=0; w<nb_threads; w++) {
+		ctrs.set_ref(w, w==0 ? *new NumConstraint(f,op) : *new NumConstraint(*new Function(f,Function::COPY),op,true));
+		seps.set_ref(w, *new SepFwdBwd(ctrs[w]));
+	}
+
+	ParallelSep(seps).contract(set,eps);
+
+	for (int w=0; w<nb_threads; w++) {
+		delete &seps[w];
+		delete &ctrs[w];
+	}
+}
+
+}
+
+Set::Set(Function& f, CmpOp op, double eps, int nb_threads) : root(new SetLeaf(YES)), Rn(f.nb_var()) {
+	if (nb_threads>1) {
+		parallel_contract(*this,f,op,eps,nb_threads);
+		return;
+	}
 	NumConstraint ctr(f,op);
 	SepFwdBwd sep(ctr);
 	sep.contract(*this,eps);
 }
 
-Set::Set(NumConstraint& ctr, double eps) : root(new SetLeaf(YES)), Rn(ctr.f.nb_var()) {
+Set::Set(NumConstraint& ctr, double eps, int nb_threads) : root(new SetLeaf(YES)), Rn(ctr.f.nb_var()) {
+	if (nb_threads>1) {
+		parallel_contract(*this,ctr.f,ctr.op,eps,nb_threads);
+		return;
+	}
 	SepFwdBwd sep(ctr);
 	sep.contract(*this,eps);
 }
 
-Set::Set(const System& sys, double eps) : root(new SetLeaf(YES)), Rn(sys.nb_var) {
+Set::Set(const System& sys, double eps, int nb_threads) : root(new SetLeaf(YES)), Rn(sys.nb_var) {
+	if (nb_threads>1) {
+		Array<System> systems(nb_threads);
+		Array<Sep> seps(nb_threads);
+		for (int w=0; w<nb_threads; w++) {
+			systems.set_ref(w, w==0 ? (System&) sys : *new System(sys,System::COPY));
+			seps.set_ref(w, *new SepFwdBwd(systems[w]));
+		}
+
+		ParallelSep(seps).contract(*this,eps);
+
+		for (int w=0; w<nb_threads; w++) {
+			delete &seps[w];
+			if (w>0) delete &systems[w];
+		}
+		return;
+	}
 	SepFwdBwd sep(sys);
 	sep.contract(*this,eps);
 }
@@ -49,18 +49,25 @@ public:
 
 	/**
 	 * \brief Build the set (f(x) op 0).
+	 *
+	 * \param nb_threads - number of threads (see #ParallelSep). The
+	 *                     resulting set does not depend on this number.
 	 */
-	Set(Function& f, CmpOp op, double eps);
+	Set(Function& f, CmpOp op, double eps, int nb_threads=1);
 
 	/**
 	 * \brief Build the set from a constraint.
+	 *
+	 * \param nb_threads - number of threads (see #ParallelSep).
 	 */
-	Set(NumConstraint& ctr, double eps);
+	Set(NumConstraint& ctr, double eps, int nb_threads=1);
 
 	/**
 	 * \brief Build the set from a system of constraints.
+	 *
+	 * \param nb_threads - number of threads (see #ParallelSep).
 	 */
-	Set(const System& sys, double eps);
+	Set(const System& sys, double eps, int nb_threads=1);
 
 	/*
 	 * \brief Delete this
@@ -136,6 +143,8 @@ public:
 
 protected:
 	friend class Sep;
+	friend class SetFlat;
+	friend class ParallelSep;
 
 	/**
 	 * \brief Inflate a box by one float.
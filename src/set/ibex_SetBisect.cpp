@@ -123,9 +123,8 @@ SetNode* SetBisect::inter(bool iset, const IntervalVector& nodebox, Sep& sep, do
 
 	SetBisect* bis = (SetBisect*) this2;
 
-	bis->left = bis->left->inter(iset, left_box(nodebox), sep, eps);
+	inter_children(iset, bis->left, left_box(nodebox), bis->right, right_box(nodebox), sep, eps);
 	bis->left->father = bis;
-	bis->right = bis->right->inter(iset,right_box(nodebox), sep, eps);
 	bis->right->father = bis;
 
 	// status of children may have changed --> try merge or update status
@@ -156,11 +155,14 @@ BoolInterval SetBisect::is_superset(const IntervalVector& nodebox, const Interva
 		// superset on the right side if the answer with the left side is "NO") when
 		// we write:
 		//
-		// left->is_superset(left_box(nodebox),box) & right->is_superset(right_box(nodebox),box);
+		// left->is_superset(left_box(nodebox),box) && right->is_superset(right_box(nodebox),box);
+		//
+		// Note: this is a logical AND, not an intersection (a child that does
+		// not intersect the box returns YES).
 
 		BoolInterval l_res=left->is_superset(left_box(nodebox),box);
 		if (l_res==NO) return NO;
-		else return l_res & right->is_superset(right_box(nodebox),box);
+		else return l_res && right->is_superset(right_box(nodebox),box);
 	}
 }
 
@@ -0,0 +1,243 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SetFlat.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_SetFlat.h"
+#include "ibex_SetBisect.h"
+#include "ibex_UnknownFileException.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stack>
+
+#ifndef _WIN32 // no mmap under Windows
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const uint32_t ENDIANNESS = 0x01020304;
+
+// signature, version, endianness, dimension, (unused), number of nodes
+const size_t HEADER_SIZE = SetFlat::SIGNATURE_LENGTH + 4*sizeof(uint32_t) + sizeof(uint64_t);
+
+}
+
+SetFlat::SetFlat(const Set& set) : n(set.Rn.size()), size(0), _nodes(NULL), buf(NULL), map_addr(NULL), map_size(0) {
+
+	vector<Node> v;
+
+	// pairs (node, index of the father if the node is a right child, -1 otherwise)
+	std::stack<pair<const SetNode*,int64_t> > s;
+	s.push(make_pair(set.root,-1));
+
+	while (!s.empty()) {
+		const SetNode* node=s.top().first;
+		int64_t father=s.top().second;
+		s.pop();
+
+		if (v.size()>=UINT32_MAX)
+			ibex_error("SetFlat: too many nodes");
+
+		if (father!=-1) v[father].right=(uint32_t) v.size();
+
+		Node nd;
+		if (node->is_leaf()) {
+			nd.pt=0;
+			nd.var=-1;
+			nd.right=(uint32_t) ((const SetLeaf*) node)->status;
+		} else {
+			const SetBisect* b=(const SetBisect*) node;
+			nd.pt=b->pt;
+			nd.var=b->var;
+			nd.right=0; // set when the right child is reached
+			s.push(make_pair(b->right,(int64_t) v.size()));
+			s.push(make_pair(b->left,-1));
+		}
+		v.push_back(nd);
+	}
+
+	size=v.size();
+	buf=new Node[size];
+	memcpy(buf, v.data(), size*sizeof(Node));
+	_nodes=buf;
+}
+
+SetFlat::SetFlat(const char* filename) : n(0), size(0), _nodes(NULL), buf(NULL), map_addr(NULL), map_size(0) {
+
+	char header[HEADER_SIZE];
+
+#ifndef _WIN32
+	int fd=open(filename, O_RDONLY);
+	if (fd==-1) throw UnknownFileException(filename);
+	struct stat st;
+	if (fstat(fd, &st)==-1 || (size_t) st.st_size<HEADER_SIZE) {
+		close(fd);
+		ibex_error("SetFlat: invalid file");
+	}
+	map_size=(size_t) st.st_size;
+	map_addr=mmap(NULL, map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map_addr==MAP_FAILED) {
+		map_addr=NULL;
+		ibex_error("SetFlat: cannot map file");
+	}
+	memcpy(header, map_addr, HEADER_SIZE);
+	size_t file_size=map_size;
+#else
+	FILE* fd=fopen(filename, "rb");
+	if (!fd) throw UnknownFileException(filename);
+	if (fread(header, 1, HEADER_SIZE, fd)!=HEADER_SIZE) {
+		fclose(fd);
+		ibex_error("SetFlat: invalid file");
+	}
+	fseek(fd, 0, SEEK_END);
+	size_t file_size=(size_t) ftell(fd);
+#endif
+
+	const char* p=header;
+	bool ok=strncmp(p, SIGNATURE, SIGNATURE_LENGTH)==0;
+	p+=SIGNATURE_LENGTH;
+	uint32_t u[4];
+	memcpy(u, p, sizeof(u));
+	p+=sizeof(u);
+	uint64_t nb;
+	memcpy(&nb, p, sizeof(uint64_t));
+
+	ok = ok && u[0]==FORMAT_VERSION && u[1]==ENDIANNESS && nb>0
+			&& file_size==HEADER_SIZE+nb*sizeof(Node);
+
+	if (!ok) {
+#ifndef _WIN32
+		munmap(map_addr, map_size);
+		map_addr=NULL;
+#else
+		fclose(fd);
+#endif
+		ibex_error("SetFlat: invalid file");
+	}
+
+	n=(int) u[2];
+	size=(size_t) nb;
+
+#ifndef _WIN32
+	_nodes=(const Node*) ((const char*) map_addr+HEADER_SIZE);
+#else
+	buf=new Node[size];
+	fseek(fd, HEADER_SIZE, SEEK_SET);
+	ok=fread(buf, sizeof(Node), size, fd)==size;
+	fclose(fd);
+	if (!ok) {
+		delete[] buf;
+		ibex_error("SetFlat: invalid file");
+	}
+	_nodes=buf;
+#endif
+}
+
+SetFlat::~SetFlat() {
+	if (buf) delete[] buf;
+#ifndef _WIN32
+	if (map_addr) munmap(map_addr, map_size);
+#endif
+}
+
+void SetFlat::save(const char* filename) const {
+	FILE* fd=fopen(filename, "wb");
+	if (!fd) throw UnknownFileException(filename);
+
+	char header[HEADER_SIZE];
+	char* p=header;
+	memcpy(p, SIGNATURE, SIGNATURE_LENGTH);
+	p+=SIGNATURE_LENGTH;
+	uint32_t u[4] = { FORMAT_VERSION, ENDIANNESS, (uint32_t) n, 0 };
+	memcpy(p, u, sizeof(u));
+	p+=sizeof(u);
+	uint64_t nb=size;
+	memcpy(p, &nb, sizeof(uint64_t));
+
+	bool ok = fwrite(header, 1, HEADER_SIZE, fd)==HEADER_SIZE
+			&& fwrite(_nodes, sizeof(Node), size, fd)==size;
+	ok &= fclose(fd)==0;
+
+	if (!ok) ibex_error("SetFlat: cannot write file");
+}
+
+BoolInterval SetFlat::is_superset(const IntervalVector& box) const {
+	vector<uint32_t> stack;
+	return is_superset(box, stack);
+}
+
+BoolInterval SetFlat::is_superset(const IntervalVector& box, vector<uint32_t>& stack) const {
+	assert(box.size()==n);
+
+	// like in Set: leaves that do not intersect the box are ignored
+	if (box.is_empty()) return YES;
+
+	BoolInterval res=YES;
+
+	stack.clear();
+	stack.push_back(0);
+
+	while (!stack.empty()) {
+		uint32_t i=stack.back();
+		stack.pop_back();
+		const Node& nd=_nodes[i];
+
+		if (nd.var<0) {
+			res = res && (BoolInterval) nd.right;
+			if (res==NO) return NO;
+		} else {
+			// the box intersects the node box, so it intersects
+			// the left (right) box iff lb<=pt (ub>=pt).
+			const Interval& xi=box[nd.var];
+			if (xi.ub()>=nd.pt) stack.push_back(nd.right);
+			if (xi.lb()<=nd.pt) stack.push_back(i+1);
+		}
+	}
+	return res;
+}
+
+BoolInterval SetFlat::contains(const Vector& pt) const {
+	assert(pt.size()==n);
+
+	uint32_t i=0;
+	while (_nodes[i].var>=0) {
+		const Node& nd=_nodes[i];
+		double x=pt[nd.var];
+		if (x<nd.pt) i++;
+		else if (x>nd.pt) i=nd.right;
+		else return is_superset(IntervalVector(pt)); // on the boundary
+	}
+	return (BoolInterval) _nodes[i].right;
+}
+
+void SetFlat::contains(const Matrix& points, BoolInterval* res) const {
+	assert(points.nb_cols()==n);
+
+	for (int k=0; k<points.nb_rows(); k++)
+		res[k]=contains(points[k]);
+}
+
+void SetFlat::is_superset(const IntervalMatrix& boxes, BoolInterval* res) const {
+	assert(boxes.nb_cols()==n);
+
+	vector<uint32_t> stack;
+
+	for (int k=0; k<boxes.nb_rows(); k++)
+		res[k]=is_superset(boxes[k], stack);
+}
+
+} // namespace ibex
@@ -0,0 +1,196 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SetFlat.h
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_SET_FLAT_H__
+#define __IBEX_SET_FLAT_H__
+
+#include "ibex_Set.h"
+#include "ibex_IntervalMatrix.h"
+
+#include <vector>
+#include <stdint.h>
+
+namespace ibex {
+
+/**
+ * \ingroup iset
+ *
+ * \brief Flat (read-only) representation of a set.
+ *
+ * The tree of a #Set is stored in a single array of nodes,
+ * in pre-order: the left child of a bisection node is the next node
+ * in the array and the right child is given by its index. A node takes
+ * 16 bytes and there is no pointer.
+ *
+ * The same array is written in a file by #save(const char*), so that
+ * a set can be loaded by mapping the file in memory (mmap) without
+ * any deserialization: the loading time does not depend on the
+ * number of nodes. Under Windows, the file is read in memory.
+ *
+ * The format is tied to the endianness of the machine.
+ *
+ * Only membership queries are supported (the set cannot be modified).
+ */
+class SetFlat {
+public:
+
+	/**
+	 * \brief Node of the tree.
+	 *
+	 * For a leaf, var is -1 and right is the status (BoolInterval).
+	 */
+	typedef struct {
+		double pt;
+		int32_t var;
+		uint32_t right;
+	} Node;
+
+	/**
+	 * \brief Version of the format.
+	 */
+	static constexpr unsigned int FORMAT_VERSION = 1;
+
+	/**
+	 * \brief Signature at the beginning of a file.
+	 */
+	static constexpr const char* SIGNATURE = "IBEX-SET";
+
+	/**
+	 * \brief Length of the signature.
+	 */
+	static constexpr size_t SIGNATURE_LENGTH = 8;
+
+	/**
+	 * \brief Build the flat representation of a set.
+	 */
+	explicit SetFlat(const Set& set);
+
+	/**
+	 * \brief Load a set from a file written by #save(const char*).
+	 *
+	 * \throw UnknownFileException if the file cannot be opened.
+	 */
+	explicit SetFlat(const char* filename);
+
+	/**
+	 * \brief Delete this (unmap the file, if any).
+	 */
+	~SetFlat();
+
+	/**
+	 * \brief Save the set into a file.
+	 */
+	void save(const char* filename) const;
+
+	/**
+	 * \brief Dimension of the set.
+	 */
+	int nb_var() const;
+
+	/**
+	 * \brief Number of nodes (bisections and leaves).
+	 */
+	size_t nb_nodes() const;
+
+	/**
+	 * \brief The nodes.
+	 */
+	const Node* nodes() const;
+
+	/**
+	 * \brief YES only if this set is a superset of the box.
+	 *
+	 * The result is the logical AND of the status of all the leaves
+	 * that intersect the box: YES if all the leaves are inside, NO if
+	 * one leaf is outside, MAYBE otherwise.
+	 */
+	BoolInterval is_superset(const IntervalVector& box) const;
+
+	/**
+	 * \brief Membership of a point.
+	 *
+	 * Status of the leaf containing the point. Same as
+	 * #is_superset(const IntervalVector&) with a degenerated box
+	 * (which matters only for a point on the boundary of two leaves).
+	 */
+	BoolInterval contains(const Vector& pt) const;
+
+	/**
+	 * \brief Membership of several points.
+	 *
+	 * \param points - one point per row
+	 * \param res    - (output) res[i] is the membership of points[i].
+	 *                 Must be of size points.nb_rows().
+	 */
+	void contains(const Matrix& points, BoolInterval* res) const;
+
+	/**
+	 * \brief Inclusion of several boxes.
+	 *
+	 * \param boxes - one box per row
+	 * \param res   - (output) res[i] is the result of #is_superset(const IntervalVector&)
+	 *                for boxes[i]. Must be of size boxes.nb_rows().
+	 */
+	void is_superset(const IntervalMatrix& boxes, BoolInterval* res) const;
+
+protected:
+
+	/**
+	 * \brief Same as is_superset(box) with a stack given by the caller.
+	 */
+	BoolInterval is_superset(const IntervalVector& box, std::vector<uint32_t>& stack) const;
+
+	/**
+	 * Dimension.
+	 */
+	int n;
+
+	/**
+	 * Number of nodes.
+	 */
+	size_t size;
+
+	/**
+	 * The nodes (either in #buf or in the mapped file).
+	 */
+	const Node* _nodes;
+
+	/**
+	 * Nodes allocated in memory (NULL if the file is mapped).
+	 */
+	Node* buf;
+
+	/**
+	 * Address and size of the mapped file (NULL if none).
+	 */
+	void* map_addr;
+	size_t map_size;
+
+private:
+	SetFlat(const SetFlat&); // forbidden
+	SetFlat& operator=(const SetFlat&); // forbidden
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int SetFlat::nb_var() const {
+	return n;
+}
+
+inline size_t SetFlat::nb_nodes() const {
+	return size;
+}
+
+inline const SetFlat::Node* SetFlat::nodes() const {
+	return _nodes;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_SET_FLAT_H__
@@ -78,6 +78,7 @@ public:
 	};
 
 	friend class Sep;
+	friend class ParallelSep;
 };
 
 std::ostream& operator<<(std::ostream& os, const Set& set);
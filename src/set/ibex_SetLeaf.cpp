@@ -258,13 +258,11 @@ SetNode* SetLeaf::inter(bool iset, const IntervalVector& nodebox, Sep& sep, doub
 				double pt=p.first[var].ub();
 				assert(box[var].interior_contains(pt));
 
-				SetNode* left = new SetLeaf(status);
-				SetNode* right = new SetLeaf(status);
-
 				SetBisect* bis = new SetBisect(var, pt);
-				bis->left = left->inter(iset, p.first, sep, eps);
+				bis->left = new SetLeaf(status);
+				bis->right = new SetLeaf(status);
+				inter_children(iset, bis->left, p.first, bis->right, p.second, sep, eps);
 				bis->left->father = bis;
-				bis->right = right->inter(iset, p.second, sep, eps);
 				bis->right->father = bis;
 				root4=bis->try_merge();
 			} else {
@@ -10,6 +10,7 @@
 #include "ibex_SetNode.h"
 #include "ibex_SetLeaf.h"
 #include "ibex_SetBisect.h"
+#include "ibex_ParallelSep.h"
 
 using namespace std;
 
@@ -23,6 +24,15 @@ SetNode::~SetNode() {
 
 }
 
+void SetNode::inter_children(bool iset, SetNode*& left, const IntervalVector& leftbox,
+		SetNode*& right, const IntervalVector& rightbox, Sep& sep, double eps) {
+
+	if (!ParallelSep::fork(iset, left, leftbox, right, rightbox, sep, eps)) {
+		left = left->inter(iset, leftbox, sep, eps);
+		right = right->inter(iset, rightbox, sep, eps);
+	}
+}
+
 
 namespace {
 
@@ -111,6 +111,15 @@ public:
 	 */
 	virtual SetNode* contract_no_diff(BoolInterval status, const IntervalVector& nodebox, const IntervalVector& box)=0;
 
+	/**
+	 * \brief Intersection of two sibling nodes with an (i-)set represented implicitly by a Sep
+	 *
+	 * Same as calling inter(iset, leftbox, sep, eps) on left and inter(iset, rightbox, sep, eps)
+	 * on right, except that the two calls may be run in parallel (see #ParallelSep).
+	 */
+	static void inter_children(bool iset, SetNode*& left, const IntervalVector& leftbox,
+			SetNode*& right, const IntervalVector& rightbox, Sep& sep, double eps);
+
 };
 
 } // namespace ibex
@@ -0,0 +1,273 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSolver.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ParallelSolver.h"
+#include "ibex_Pool.h"
+#include "ibex_Random.h"
+
+#ifndef _WIN32
+#include <thread>
+#include <exception>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+ParallelSolver::ParallelSolver(const System& sys, Array<Solver>& solvers) :
+		Solver(sys, solvers[0].ctc, solvers[0].bsc, solvers[0].buffer, solvers[0].eps_x_min, solvers[0].eps_x_max),
+		nb_threads(solvers.size()), random_seed(RNG::get_seed()), workers(solvers.size()) {
+
+	workers.set_ref(0,*this);
+
+	for (int w=1; w<nb_threads; w++)
+		workers.set_ref(w,solvers[w]);
+
+#ifndef _WIN32
+	buffer_lock = new mutex[nb_threads];
+#endif
+}
+
+ParallelSolver::~ParallelSolver() {
+#ifndef _WIN32
+	delete[] buffer_lock;
+#endif
+}
+
+Cell* ParallelSolver::import_cell(int w, Cell* c) {
+	Solver& s=workers[w];
+
+	Cell* c2=new Cell(c->box, c->bisected_var, c->depth);
+	delete c;
+
+	// same as when a search is restarted from a COV
+	s.buffer.add_property(c2->box, c2->prop);
+	s.bsc.add_property(c2->box, c2->prop);
+	s.ctc.add_property(c2->box, c2->prop);
+
+	return c2;
+}
+
+void ParallelSolver::gather(int w) {
+	const CovSolverData& data=*workers[w].manif;
+
+	size_t nb_inner=data.nb_inner();
+
+	for (size_t i=0; i<nb_inner; i++)
+		add_box(CovSolverData::SOLUTION, data.inner(i));
+
+	// note: inner boxes are also counted as solutions
+	// (without unicity box), see CovManifold::add_inner
+	for (size_t i=nb_inner; i<data.nb_solution(); i++)
+		add_box(CovSolverData::SOLUTION, data.solution(i), &data.unicity(i-nb_inner), &data.solution_varset(i-nb_inner));
+
+	for (size_t i=0; i<data.nb_boundary(); i++)
+		add_box(CovSolverData::BOUNDARY, data.boundary(i), NULL, &data.boundary_varset(i));
+
+	for (size_t i=0; i<data.nb_unknown(); i++)
+		add_box(CovSolverData::UNKNOWN, data.unknown(i));
+}
+
+#ifdef _WIN32
+
+Solver::Status ParallelSolver::solve(bool stop_at_first) {
+	// no thread support: the master works alone.
+	return Solver::solve(stop_at_first);
+}
+
+#else
+
+Cell* ParallelSolver::steal(int w) {
+	for (int i=1; i<nb_threads; i++) {
+		int v=(w+i)%nb_threads;
+		Cell* c=NULL;
+		{
+			lock_guard<mutex> lock(buffer_lock[v]);
+			if (!workers[v].buffer.empty())
+				c=workers[v].buffer.pop();
+		}
+		if (c) return import_cell(w,c);
+	}
+	return NULL;
+}
+
+void ParallelSolver::run_worker(int w) {
+	Solver& s=workers[w];
+
+	// otherwise all the workers would draw the same sequence
+	if (w>0) RNG::srand(random_seed+w);
+
+	// free lists are local to each thread
+	Pool::Scope pool(s.pool_allocation);
+
+	CovSolverData::BoxStatus status;
+	pair<Cell*,Cell*> new_cells;
+
+	while (!stop) {
+
+		Cell* c=NULL;
+		{
+			lock_guard<mutex> lock(buffer_lock[w]);
+			if (!s.buffer.empty())
+				c=s.buffer.pop();
+		}
+
+		if (!c) c=steal(w);
+
+		if (!c) {
+			if (nb_pending==0) break; // search is over
+			this_thread::yield();
+			continue;
+		}
+
+		if (s.trace==2) {
+			lock_guard<mutex> lock(output_mutex);
+			cout << " current box " << c->box << endl;
+		}
+
+		if (s.process(*c, status, new_cells)==CELL_SPLIT) {
+			// note: must be counted before the parent cell is removed
+			nb_pending+=2;
+			{
+				lock_guard<mutex> lock(buffer_lock[w]);
+				s.buffer.push(new_cells.second);
+				s.buffer.push(new_cells.first);
+			}
+			unsigned int total=(shared_nb_cells+=2);
+			if (cell_limit >=0 && total>=cell_limit) {
+				cell_overflow=true;
+				stop=true;
+			}
+		}
+
+		delete c;
+		nb_pending--;
+
+		// note: the CPU time is the time of the process (all the threads).
+		// The clock is only read from time to time (cells can be very cheap)
+		// and each worker has its own timer (see solve).
+		if (time_limit>0) {
+			try {
+				s.timer.check_amortized(time_limit);
+			} catch(TimeOutException&) {
+				time_out=true;
+				stop=true;
+			}
+		}
+	}
+}
+
+Solver::Status ParallelSolver::solve(bool stop_at_first) {
+
+	if (nb_threads==1 || stop_at_first)
+		return Solver::solve(stop_at_first);
+
+	// The other workers start with the same parameters as the master
+	for (int w=1; w<nb_threads; w++) {
+		Solver& s=workers[w];
+		s.buffer.flush();
+		if (s.manif) delete s.manif;
+		s.manif = new CovSolverData(n, m, nb_ineq);
+		s.solve_init_box = solve_init_box;
+		s.params = params;
+		s.boundary_test = boundary_test;
+		s.trace = trace;
+		s.pool_allocation = pool_allocation;
+		// same clock and same starting time as the master
+		s.timer = timer;
+		// the boxes are directly written in the output file of the master
+		s.writer = writer;
+		s.output_lock = &output_mutex;
+	}
+	output_lock = &output_mutex;
+
+	nb_pending = buffer.size();
+	shared_nb_cells = nb_cells;
+	stop = false;
+	time_out = false;
+	cell_overflow = false;
+
+	vector<exception_ptr> errors(nb_threads);
+
+	auto run = [this,&errors](int w) {
+		try {
+			run_worker(w);
+		} catch(...) {
+			errors[w]=current_exception();
+			stop=true;
+		}
+	};
+
+	vector<thread> threads;
+	for (int w=1; w<nb_threads; w++)
+		threads.push_back(thread(run,w));
+
+	run(0);
+
+	for (vector<thread>::iterator it=threads.begin(); it!=threads.end(); ++it)
+		it->join();
+
+	for (int w=0; w<nb_threads; w++) {
+		workers[w].output_lock = NULL;
+		if (w>0) workers[w].writer = NULL;
+	}
+
+	timer.stop();
+	time = timer.get_time();
+
+	for (int w=0; w<nb_threads; w++)
+		if (errors[w]) rethrow_exception(errors[w]);
+
+	// Gather the results of all the workers in the master
+	for (int w=1; w<nb_threads; w++) {
+		Solver& s=workers[w];
+
+		gather(w);
+
+		// remaining cells (if the search has been interrupted)
+		while (!s.buffer.empty()) {
+			Cell* c=s.buffer.pop();
+			if (trace >=1) cout << " [pending] " << c->box << endl;
+			add_box(CovSolverData::PENDING, c->box);
+			delete c;
+		}
+	}
+
+	flush();
+
+	nb_cells = shared_nb_cells;
+
+	Solver::Status final_status;
+
+	if (time_out)
+		final_status=TIME_OUT;
+	else if (cell_overflow)
+		final_status=CELL_OVERFLOW;
+	else if (nb_boxes(CovSolverData::UNKNOWN)>0)
+		final_status=NOT_ALL_VALIDATED;
+	else if (nb_boxes(CovSolverData::SOLUTION)==0 && nb_boxes(CovSolverData::BOUNDARY)==0)
+		final_status=INFEASIBLE;
+	else
+		final_status=SUCCESS;
+
+	manif->set_solver_status(final_status);
+
+	manif->set_time(manif->time() + time);
+
+	manif->set_nb_cells(manif->nb_cells() + nb_cells);
+
+	close_output();
+
+	return final_status;
+}
+
+#endif
+
+} // end namespace ibex
@@ -0,0 +1,185 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSolver.h
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_SOLVER_H__
+#define __IBEX_PARALLEL_SOLVER_H__
+
+#include "ibex_Solver.h"
+#include "ibex_System.h"
+#include "ibex_Array.h"
+
+#ifndef _WIN32 // MinGW does not support threads
+#include <mutex>
+#include <atomic>
+#endif
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Multi-threaded solver.
+ *
+ * This solver runs the same branch & prune algorithm as #Solver
+ * but with several worker threads.
+ *
+ * Each worker has its own operators (contractor, bisector and cell buffer),
+ * given by its own solver. The operators of Ibex are not thread-safe so each
+ * solver must be built on a separate copy of the system (see
+ * System(const System&, copy_mode)).
+ *
+ * A worker processes the cells of its own buffer. When its buffer is empty,
+ * it steals a cell of another worker. The covering boxes found by a worker are
+ * appended to its own manifold (no lock is required) and all the manifolds
+ * are gathered at the end of the search. With an output file (see
+ * #output_file), the boxes are directly written in the file by all the
+ * workers, under a lock. The set of boxes obtained is the same
+ * as with a sequential search, up to ordering, as long as the operators do not
+ * depend on the order in which cells are processed (this is not the case of
+ * adaptive contractors like #CtcAcid). The cell limit and the time limit are
+ * global (all the workers stop as soon as one is reached).
+ *
+ * The first worker is the solver itself: it uses the operators of the first
+ * solver given in argument. The parameters (time limit, boundary test,
+ * forced parameters, etc.) are those of the parallel solver, except the
+ * precisions which must be the same for all the solvers.
+ *
+ * The interactive mode (see #next(CovSolverData::BoxStatus&, const IntervalVector**))
+ * and the "stop at first" mode are sequential: only the first worker is used.
+ *
+ * The trace (see #trace) is printed by all the workers, under the same lock
+ * as the output file.
+ *
+ * \note The CPU time (and the time limit) is the CPU time of the process,
+ *       i.e., the sum over the threads. With several threads, the elapsed
+ *       real time is usually more relevant: set #real_time to true (this is
+ *       what ibexsolve does with --threads).
+ */
+class ParallelSolver : public Solver {
+
+public:
+
+	/**
+	 * \brief Create a parallel solver.
+	 *
+	 * \param sys     - The system to be solved
+	 * \param solvers - One solver per worker thread (at least one). The
+	 *                  first solver must be built on sys and the others
+	 *                  on copies of sys.
+	 */
+	ParallelSolver(const System& sys, Array<Solver>& solvers);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	virtual ~ParallelSolver();
+
+	/**
+	 * \brief Solve the system (see #Solver).
+	 */
+	using Solver::solve;
+
+	/**
+	 * \brief Number of worker threads.
+	 */
+	const int nb_threads;
+
+	/**
+	 * \brief Seed of the random number generators of the workers.
+	 *
+	 * The random number generator is local to each thread (see #RNG):
+	 * the worker w>0 is seeded with random_seed+w when it starts. The
+	 * worker 0 runs in the calling thread and keeps its generator.
+	 *
+	 * Set by default to the seed of the calling thread when *this
+	 * is built (the seed given to DefaultSolver).
+	 */
+	int random_seed;
+
+protected:
+
+	/**
+	 * \brief Run the solver (once started) with all the threads.
+	 */
+	virtual Status solve(bool stop_at_first) override;
+
+	/**
+	 * \brief Main loop of the worker thread of index \a w.
+	 */
+	void run_worker(int w);
+
+	/**
+	 * \brief Steal a cell in the buffer of another worker.
+	 *
+	 * \return NULL if all the other buffers are empty.
+	 */
+	Cell* steal(int w);
+
+	/**
+	 * \brief Rebuild a cell coming from another worker for the worker \a w.
+	 *
+	 * The properties (Bxp) of a cell are specific to the operators
+	 * of a worker, so they are recreated from scratch. The cell \a c
+	 * is deleted.
+	 */
+	Cell* import_cell(int w, Cell* c);
+
+	/**
+	 * \brief Gather the manifold of the worker \a w into the manifold
+	 * of the solver.
+	 */
+	void gather(int w);
+
+	/**
+	 * The worker solvers (the first one is *this).
+	 */
+	Array<Solver> workers;
+
+#ifndef _WIN32
+	/**
+	 * Lock of the buffer of each worker.
+	 */
+	std::mutex* buffer_lock;
+
+	/**
+	 * Number of cells alive (in the buffers or being processed).
+	 */
+	std::atomic<long> nb_pending;
+
+	/**
+	 * Total number of cells created by all the workers.
+	 */
+	std::atomic<unsigned int> shared_nb_cells;
+
+	/**
+	 * Whether the search must be interrupted.
+	 */
+	std::atomic<bool> stop;
+
+	/**
+	 * Whether the time limit has been reached.
+	 */
+	std::atomic<bool> time_out;
+
+	/**
+	 * Whether the cell limit has been reached.
+	 */
+	std::atomic<bool> cell_overflow;
+
+	/**
+	 * Lock of the output file and the trace (shared by all the workers).
+	 */
+	std::mutex output_mutex;
+#endif
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_PARALLEL_SOLVER_H__
@@ -5,14 +5,14 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 13, 2012
-// Last Update : Oct 01, 2017
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_Solver.h"
 #include "ibex_Newton.h"
-#include "ibex_NoBisectableVariableException.h"
 #include "ibex_LinearException.h"
 #include "ibex_CovSolverData.h"
+#include "ibex_Pool.h"
 
 #include <cassert>
 
@@ -20,20 +20,20 @@ using namespace std;
 
 namespace ibex {
 
-namespace {
-	class EmptyBoxException : Exception { };
-}
-
 Solver::Solver(const System& sys, Ctc& ctc, Bsc& bsc, CellBuffer& buffer,
 		const Vector& eps_x_min, const Vector& eps_x_max) :
 		  ctc(ctc), bsc(bsc), buffer(buffer), eps_x_min(eps_x_min), eps_x_max(eps_x_max),
-		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0),
+		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0), pool_allocation(false), real_time(false),
 		  solve_init_box(sys.box), eqs(NULL), ineqs(NULL),
 		  params(sys.nb_var,BitSet::empty(sys.nb_var),false) /* no forced parameter by default */,
-		  manif(NULL), time(0), old_time(0), nb_cells(0), old_nb_cells(0) {
+		  manif(NULL), writer(NULL), time(0), old_time(0), nb_cells(0), old_nb_cells(0) {
 
 	assert(sys.box.size()==ctc.nb_var);
 
+#ifndef _WIN32
+	output_lock=NULL;
+#endif
+
 	int nb_eq=0;
 
 	// count the dimension of equalities
@@ -75,6 +75,11 @@ Solver::~Solver() {
 		}
 	}
 
+	if (writer) {
+		close_output();
+		delete writer;
+	}
+
 	if (manif) delete manif;
 }
 
@@ -86,6 +91,8 @@ void Solver::start(const IntervalVector& init_box) {
 
 	manif = new CovSolverData(n, m, nb_ineq, CovManifold::EQU_ONLY, eqs? eqs->var_names() : ineqs->var_names());
 
+	open_output();
+
 	Cell* root=new Cell(init_box);
 
 	// add data required by the bisector
@@ -104,6 +111,7 @@ void Solver::start(const IntervalVector& init_box) {
 	nb_cells = 1;
 	manif->set_nb_cells(0);
 
+	timer.clock = real_time? Timer::REAL_TIME : Timer::CPU_TIME;
 	timer.restart();
 }
 
@@ -117,18 +125,20 @@ void Solver::start(const CovSolverData& data) {
 	// not calculated with the same Minibex file.
 	manif->var_names() = eqs? eqs->var_names() : ineqs->var_names();
 
+	open_output();
+
 	// just copy inner, solution and boundary boxes
 	for (size_t i=0; i<data.nb_inner(); i++)
-		manif->add_inner(data.inner(i));
+		add_box(CovSolverData::SOLUTION, data.inner(i));
 
 	for (size_t i=0; i<data.nb_solution(); i++)
 		if (m==n)
-			manif->add_solution(data.solution(i), data.unicity(i));
+			add_box(CovSolverData::SOLUTION, data.solution(i), &data.unicity(i));
 		else
-			manif->add_solution(data.solution(i), data.unicity(i), data.solution_varset(i));
+			add_box(CovSolverData::SOLUTION, data.solution(i), &data.unicity(i), &data.solution_varset(i));
 
 	for (size_t i=0; i<data.nb_boundary(); i++)
-		manif->add_boundary(data.boundary(i), data.boundary_varset(i));
+		add_box(CovSolverData::BOUNDARY, data.boundary(i), NULL, &data.boundary_varset(i));
 
 	// the unknown and pending boxes have to be processed
 	for (size_t i=0; i<data.CovManifold::nb_unknown(); i++) {
@@ -156,6 +166,7 @@ void Solver::start(const CovSolverData& data) {
 	nb_cells=0; // no new cell created!
 	manif->set_nb_cells(data.nb_cells());
 
+	timer.clock = real_time? Timer::REAL_TIME : Timer::CPU_TIME;
 	timer.restart();
 }
 
@@ -166,11 +177,14 @@ void Solver::start(const char* input_paving) {
 
 bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol) {
 
+	Pool::Scope pool(pool_allocation);
+
 	while (!buffer.empty()) {
 
 		if (time_limit >0) {
 			try {
-				timer.check(time_limit);
+				// the clock is only read from time to time (cells can be very cheap)
+				timer.check_amortized(time_limit);
 			}
 			catch(TimeOutException& e) {
 				flush();
@@ -183,74 +197,72 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 
 		Cell* c=buffer.top();
 
-		ContractContext context(c->prop);
+		pair<Cell*,Cell*> new_cells;
 
-		int v=c->bisected_var; // last bisected var.
-
-		if (v!=-1) { // not the root node :  impact set to the last bisected variable only
-			context.impact = BitSet::singleton(n,v);
+		switch (process(*c, status, new_cells)) {
+		case CELL_DISCARDED:
+			delete buffer.pop();
+			continue;
+		case CELL_COVERED:
+			delete buffer.pop();
+			if (sol) *sol=writer? &writer->last() : &(*manif)[manif->size()-1];
+			return true;
+		case CELL_SPLIT:
+			delete buffer.pop();
+			// note: more natural to push first the second, so that
+			// solutions in a 1-dimensional problem come in increasing order
+			buffer.push(new_cells.second);
+			buffer.push(new_cells.first);
+			nb_cells+=2;
+			if (cell_limit >=0 && nb_cells>=cell_limit) {
+				flush();
+				if (sol) *sol=NULL;
+				throw CellLimitException();
+			}
 		}
+	}
 
-		try {
-			ctc.contract(c->box,context);
-
-			if (c->box.is_empty()) throw EmptyBoxException();
+	if (sol) *sol=NULL;
+	return false;
+}
 
-			// 2nd condition: certification is performed at
-			// each intermediate step only if the system is under constrained
-			if (m<n && !is_too_large(c->box)) {
-				// note: cannot return PENDING status
-				status=check_sol(c->box);
-				if (status!=CovSolverData::UNKNOWN) { // <=> solution or boundary
-					delete buffer.pop();
-					if (sol) *sol=&(*manif)[manif->size()-1];
-					return true;
-				} // otherwise: continue search...
-			} // else: otherwise: continue search...
+Solver::CellOutcome Solver::process(Cell& c, CovSolverData::BoxStatus& status, pair<Cell*,Cell*>& new_cells) {
 
-			try {
-				if (is_too_small(c->box))
-					throw NoBisectableVariableException();
-
-				// next line may also throw NoBisectableVariableException
-				pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
-
-				delete buffer.pop();
-				// note: more natural to push first the second, so that
-				// solutions in a 1-dimensional problem come in increasing order
-				buffer.push(new_cells.second);
-				buffer.push(new_cells.first);
-				nb_cells+=2;
-				if (cell_limit >=0 && nb_cells>=cell_limit) {
-					flush();
-					if (sol) *sol=NULL;
-					throw CellLimitException();
-				}
-			}
+	ContractContext context(c.prop);
 
-			catch (NoBisectableVariableException&) {
-				status=check_sol(c->box);
-				if (status==CovSolverData::UNKNOWN) {
-					if (trace >=1) cout << " [unknown] " << c->box << endl;
-					manif->add_unknown(c->box);
-				}
-				delete buffer.pop();
-				if (sol) *sol=&(*manif)[manif->size()-1];
-				return true;
-			}
-		}
-		catch (EmptyBoxException&) {
-			delete buffer.pop();
-			//impact.remove(v); // note: in case of the root node, we should clear the bitset
-			// instead but since the search is over, the impact is not used anymore.
-			// JN: that make a bug with Mingw
+	int v=c.bisected_var; // last bisected var.
 
-			continue;
-		}
+	if (v!=-1) { // not the root node :  impact set to the last bisected variable only
+		context.impact = BitSet::singleton(n,v);
 	}
 
-	if (sol) *sol=NULL;
-	return false;
+	ctc.contract(c.box,context);
+
+	if (c.box.is_empty()) return CELL_DISCARDED;
+
+	// 2nd condition: certification is performed at
+	// each intermediate step only if the system is under constrained
+	if (m<n && !is_too_large(c.box)) {
+		// note: cannot return PENDING status
+		if (!check_sol(c.box,status))
+			return CELL_DISCARDED;
+		if (status!=CovSolverData::UNKNOWN) // <=> solution or boundary
+			return CELL_COVERED;
+		// otherwise: continue search...
+	} // else: otherwise: continue search...
+
+	if (!is_too_small(c.box) && bsc.try_bisect(c,new_cells))
+		return CELL_SPLIT;
+
+	// no bisectable variable
+	if (!check_sol(c.box,status))
+		return CELL_DISCARDED;
+
+	if (status==CovSolverData::UNKNOWN) {
+		if (trace >=1) trace_box("unknown", c.box);
+		add_box(CovSolverData::UNKNOWN, c.box);
+	}
+	return CELL_COVERED;
 }
 
 Solver::Status Solver::solve(const IntervalVector& init_box, bool stop_at_first) {
@@ -270,10 +282,12 @@ Solver::Status Solver::solve(const char* init_paving, bool stop_at_first) {
 
 Solver::Status Solver::solve(bool stop_at_first) {
 
+	Pool::Scope pool(pool_allocation);
+
 	Solver::Status final_status;
 
 	// initialization...
-	if (manif->nb_inner()==0 && manif->nb_solution()==0 && manif->nb_boundary()==0)
+	if (nb_boxes(CovSolverData::SOLUTION)==0 && nb_boxes(CovSolverData::BOUNDARY)==0)
 		final_status = INFEASIBLE;
 	else
 		final_status = SUCCESS;
@@ -309,10 +323,14 @@ Solver::Status Solver::solve(bool stop_at_first) {
 
 	manif->set_nb_cells(manif->nb_cells() + nb_cells);
 
+	close_output();
+
 	return final_status;
 }
 
-bool Solver::check_ineq(const IntervalVector& box) {
+bool Solver::check_ineq(const IntervalVector& box, bool& inner) {
+	inner=true;
+
   	if (!ineqs || ineqs->nb_ctr==0)
 	  return true;
 
@@ -331,33 +349,44 @@ bool Solver::check_ineq(const IntervalVector& box) {
 		case GT  : right_cst=Interval::pos_reals();  break;
 		}
 		if (y[i].is_disjoint(right_cst)) {
-			throw EmptyBoxException();
+			return false;
 		}
 		else if (!y[i].is_subset(right_cst)) {
 			not_inner=true;
 		}
 	}
 
-	return !not_inner;
+	inner=!not_inner;
+	return true;
 }
 
-CovSolverData::BoxStatus Solver::check_sol(const IntervalVector& box) {
+bool Solver::check_sol(const IntervalVector& box, CovSolverData::BoxStatus& status) {
+
+	bool inner;
 
 	if (!eqs) {
-		if (check_ineq(box)) {
-			if (trace >=1) cout << " [solution] " << box << endl;
-			manif->add_inner(box);
-			return CovSolverData::SOLUTION;
+		if (!check_ineq(box,inner))
+			return false;
+
+		if (inner) {
+			if (trace >=1) trace_box("solution", box);
+			add_box(CovSolverData::SOLUTION, box);
+			status=CovSolverData::SOLUTION;
+			return true;
 		} else if (is_boundary(box)) {
-			manif->add_boundary(box);
-			return CovSolverData::BOUNDARY;
-		} else
-			return CovSolverData::UNKNOWN;
+			add_box(CovSolverData::BOUNDARY, box);
+			status=CovSolverData::BOUNDARY;
+			return true;
+		} else {
+			status=CovSolverData::UNKNOWN;
+			return true;
+		}
 	} else {
 
 		if (m>n) {
 			// Certification not implemented for over-constrained systems
-			return CovSolverData::UNKNOWN;
+			status=CovSolverData::UNKNOWN;
+			return true;
 		}
 
 		IntervalVector existence(box);
@@ -371,16 +400,19 @@ CovSolverData::BoxStatus Solver::check_sol(const IntervalVector& box) {
 				varset=get_newton_vars(eqs->f_ctrs,box.mid(),params);
 
 				if (!inflating_newton(eqs->f_ctrs, varset, box, existence, unicity)) {
-					return CovSolverData::UNKNOWN;
+					status=CovSolverData::UNKNOWN;
+					return true;
 				}
 
 			} catch(SingularMatrixException& e) {
-				return CovSolverData::UNKNOWN;
+				status=CovSolverData::UNKNOWN;
+				return true;
 			}
 		} else {
 			// ====== well-constrained =========
 			if (!inflating_newton(eqs->f_ctrs, box.mid(), existence, unicity)) {
-				return CovSolverData::UNKNOWN;
+				status=CovSolverData::UNKNOWN;
+				return true;
 			}
 		}
 
@@ -389,12 +421,15 @@ CovSolverData::BoxStatus Solver::check_sol(const IntervalVector& box) {
 		// Note that the following line also tests the case of an existence box outside
 		// the initial box of the search
 		if (box.is_disjoint(existence)) {
-			throw EmptyBoxException();
+			return false;
 		}
 
 		bool solution = existence.is_subset(solve_init_box);
 
-		solution &= check_ineq(existence);
+		if (!check_ineq(existence,inner))
+			return false;
+
+		solution &= inner;
 
 		if (eqs && n==m) {
 			// Check if the solution is new, that is, that the solution is not included in the unicity
@@ -412,16 +447,20 @@ CovSolverData::BoxStatus Solver::check_sol(const IntervalVector& box) {
 		}
 
 		if (solution) {
-			if (trace >=1) cout << " [solution] " << existence << endl;
-			manif->add_solution(existence, unicity, varset);
-			return CovSolverData::SOLUTION;
+			if (trace >=1) trace_box("solution", existence);
+			add_box(CovSolverData::SOLUTION, existence, &unicity, &varset);
+			status=CovSolverData::SOLUTION;
+			return true;
 		} else {
 			if (is_boundary(existence)) {
-				if (trace >=1) cout << " [boundary] " << existence << endl;
-				manif->add_boundary(existence, varset);
-				return CovSolverData::BOUNDARY;
-			} else
-				return CovSolverData::UNKNOWN;
+				if (trace >=1) trace_box("boundary", existence);
+				add_box(CovSolverData::BOUNDARY, existence, NULL, &varset);
+				status=CovSolverData::BOUNDARY;
+				return true;
+			} else {
+				status=CovSolverData::UNKNOWN;
+				return true;
+			}
 		}
 	}
 }
@@ -483,11 +522,83 @@ bool Solver::is_too_large(const IntervalVector& box) {
 	return false;
 }
 
+namespace {
+
+template<class C>
+void add_box(C& cov, CovSolverData::BoxStatus status, const IntervalVector& box, const IntervalVector* unicity, const VarSet* varset) {
+	switch (status) {
+	case CovSolverData::SOLUTION:
+		if (!unicity)    cov.add_inner(box);
+		else if (varset) cov.add_solution(box, *unicity, *varset);
+		else             cov.add_solution(box, *unicity);
+		break;
+	case CovSolverData::BOUNDARY:
+		if (varset) cov.add_boundary(box, *varset);
+		else        cov.add_boundary(box);
+		break;
+	case CovSolverData::UNKNOWN:
+		cov.add_unknown(box);
+		break;
+	case CovSolverData::PENDING:
+		cov.add_pending(box);
+	}
+}
+
+}
+
+void Solver::add_box(CovSolverData::BoxStatus status, const IntervalVector& box, const IntervalVector* unicity, const VarSet* varset) {
+#ifndef _WIN32
+	unique_lock<mutex> lock;
+	if (output_lock) lock=unique_lock<mutex>(*output_lock);
+#endif
+	if (writer)
+		ibex::add_box(*writer, status, box, unicity, varset);
+	else
+		ibex::add_box(*manif, status, box, unicity, varset);
+}
+
+void Solver::trace_box(const char* status, const IntervalVector& box) {
+#ifndef _WIN32
+	unique_lock<mutex> lock;
+	if (output_lock) lock=unique_lock<mutex>(*output_lock);
+#endif
+	cout << " [" << status << "] " << box << endl;
+}
+
+size_t Solver::nb_boxes(CovSolverData::BoxStatus status) const {
+	switch (status) {
+	case CovSolverData::SOLUTION: return writer? writer->nb_solution() : manif->nb_solution();
+	case CovSolverData::BOUNDARY: return writer? writer->nb_boundary() : manif->nb_boundary();
+	case CovSolverData::UNKNOWN:  return writer? writer->nb_unknown()  : manif->nb_unknown();
+	default:                      return writer? writer->nb_pending()  : manif->nb_pending();
+	}
+}
+
+void Solver::open_output() {
+	if (writer) {
+		close_output();
+		delete writer;
+		writer=NULL;
+	}
+
+	if (!output_file.empty())
+		writer=new CovSolverData::Writer(output_file.c_str(), n, m, nb_ineq, CovManifold::EQU_ONLY, manif->var_names());
+}
+
+void Solver::close_output() {
+	if (!writer) return;
+
+	writer->set_solver_status(manif->solver_status());
+	writer->set_time(manif->time());
+	writer->set_nb_cells(manif->nb_cells());
+	writer->close();
+}
+
 void Solver::flush() {
 	while (!buffer.empty()) {
 		Cell* cell=buffer.top();
-		if (trace >=1) cout << " [pending] " << cell->box << endl;
-		manif->add_pending(cell->box);
+		if (trace >=1) trace_box("pending", cell->box);
+		add_box(CovSolverData::PENDING, cell->box);
 		delete buffer.pop();
 	}
 }
@@ -543,18 +654,18 @@ void Solver::report() {
 	cout << white() << endl;
 
 	cout << " number of solution boxes:\t";
-	if (manif->nb_solution()==0) cout << "--"; else cout << manif->nb_solution();
+	if (nb_boxes(CovSolverData::SOLUTION)==0) cout << "--"; else cout << nb_boxes(CovSolverData::SOLUTION);
 	cout << endl;
 	cout << " number of boundary boxes:\t";
-	if (manif->nb_boundary()==0) cout << "--"; else cout << manif->nb_boundary();
+	if (nb_boxes(CovSolverData::BOUNDARY)==0) cout << "--"; else cout << nb_boxes(CovSolverData::BOUNDARY);
 	cout << endl;
 	cout << " number of unknown boxes:\t";
-	if (manif->nb_unknown()==0) cout << "--"; else cout << manif->nb_unknown();
+	if (nb_boxes(CovSolverData::UNKNOWN)==0) cout << "--"; else cout << nb_boxes(CovSolverData::UNKNOWN);
 	cout << endl;
 	cout << " number of pending boxes:\t";
-	if (manif->nb_pending()==0) cout << "--"; else cout << manif->nb_pending();
+	if (nb_boxes(CovSolverData::PENDING)==0) cout << "--"; else cout << nb_boxes(CovSolverData::PENDING);
 	cout << endl;
-	cout << " cpu time used:\t\t\t" << time << "s";
+	cout << (real_time? " real time used:\t\t" : " cpu time used:\t\t\t") << time << "s";
 	if (manif->time()!=time)
 		cout << " [total=" << manif->time() << "]";
 	cout << endl;
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 13, 2012
-// Last Update : Oct 01, 2017
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_SOLVER_H__
@@ -22,6 +22,11 @@
 #include "ibex_CovSolverData.h"
 
 #include <vector>
+#include <string>
+
+#ifndef _WIN32 // MinGW does not support threads
+#include <mutex>
+#endif
 
 namespace ibex {
 
@@ -84,7 +89,7 @@ public:
 	/**
 	 * \brief Destructor.
 	 */
-	~Solver();
+	virtual ~Solver();
 
 	/**
 	 * \brief Solve the system (non-interactive mode).
@@ -174,7 +179,8 @@ public:
 	 *              is the address of the last element added in the CovSolverData
 	 *              structure.
 	 *              *sol is set to NULL if search is over, time is out or the number
-	 *              of cells exceeds the limit.
+	 *              of cells exceeds the limit. With an output file (see #output_file),
+	 *              *sol is the last box written, which is overwritten at the next call.
 	 *
 	 * \throw CellLimitException or TimeOutException
 	 */
@@ -188,7 +194,8 @@ public:
 	/**
 	 * \brief Get the "solutions" (output boxes).
 	 *
-	 * \return the output boxes of the last call to solve(...).
+	 * \return the output boxes of the last call to solve(...)
+	 *         (none if they are written in an output file).
 	 */
 	const CovSolverData& get_data() const;
 
@@ -252,7 +259,7 @@ public:
 	boundary_test_strength boundary_test;
 
 	/**
-	 * \brief Maximum CPU time used by the solver.
+	 * \brief Maximum CPU time (or real time, see #real_time) used by the solver.
 	 *
 	 * This parameter allows to bound running time.
 	 * The value can be fixed by the user. By default, it is -1 (no limit).
@@ -279,29 +286,114 @@ public:
 	 */
 	int trace;
 
+	/**
+	 * \brief Whether cells, boxes and box properties are allocated
+	 * in a pool during the search (see #ibex::Pool).
+	 *
+	 * By default, false.
+	 */
+	bool pool_allocation;
+
+	/**
+	 * \brief Whether the running time (and the time limit) is the elapsed
+	 * real time instead of the CPU time.
+	 *
+	 * By default, false.
+	 */
+	bool real_time;
+
+	/**
+	 * \brief COV file where the output boxes are written during the search.
+	 *
+	 * If not empty, the boxes are appended to the file as and when they are
+	 * found (see CovSolverData::Writer) instead of being stored in memory,
+	 * which allows to handle huge numbers of boxes. The file is closed at the
+	 * end of solve(...). In this case, the data returned by #get_data()
+	 * contains no box (only the solver status, time and number of cells).
+	 *
+	 * By default, empty.
+	 */
+	std::string output_file;
 
 protected:
 	/**
 	 * \brief Call "next" until search is over.
 	 *
 	 */
-	Status solve(bool stop_at_first);
+	virtual Status solve(bool stop_at_first);
+
+	/**
+	 * \brief Outcome of the processing of a cell.
+	 *
+	 * CELL_DISCARDED: the box contains no solution.
+	 * CELL_COVERED:   a covering box (solution, boundary or unknown)
+	 *                 has been added in the manifold.
+	 * CELL_SPLIT:     the cell has been bisected.
+	 */
+	typedef enum { CELL_DISCARDED, CELL_COVERED, CELL_SPLIT } CellOutcome;
+
+	/**
+	 * \brief Process a cell: contraction, certification and bisection.
+	 *
+	 * The cell is neither removed from the buffer nor deleted.
+	 *
+	 * \param c         - the cell
+	 * \param status    - (output) status of the covering box (if CELL_COVERED)
+	 * \param new_cells - (output) the two subcells (if CELL_SPLIT)
+	 */
+	CellOutcome process(Cell& c, CovSolverData::BoxStatus& status, std::pair<Cell*,Cell*>& new_cells);
 
 	/*
 	 * \brief Check if a box is solution/boundary and
 	 *        if it is the case, add it in the manifold
 	 *        (CovSolverData structure).
 	 *
-	 * \throw EmptyBoxException if it is proven that there
-	 *        is no solution inside the box.
+	 * \param box    - input box
+	 * \param status - (output) status of the box (if the return value is true)
 	 *
-	 * \param box - input box
+	 * \return false if it is proven that there is no solution
+	 *         inside the box.
 	 *
 	 * If the status of the return box is SOLUTION, the box may have
 	 * slightly changed (due to inflating Newton) and the actual "solution"
 	 * is stored in the existence box.
 	 */
-	CovSolverData::BoxStatus check_sol(const IntervalVector& box);
+	bool check_sol(const IntervalVector& box, CovSolverData::BoxStatus& status);
+
+	/**
+	 * \brief Add a covering box in the manifold (or in the output file).
+	 *
+	 * \param status  - status of the box. A SOLUTION box without unicity box
+	 *                  is an inner box.
+	 * \param box     - the box (the existence box for a solution)
+	 * \param unicity - the unicity box of a solution (NULL if inner box)
+	 * \param varset  - the parameters of a solution/boundary box (NULL if none)
+	 */
+	void add_box(CovSolverData::BoxStatus status, const IntervalVector& box, const IntervalVector* unicity=NULL, const VarSet* varset=NULL);
+
+	/**
+	 * \brief Print a covering box (trace mode).
+	 *
+	 * \param status - status of the box, printed in brackets.
+	 */
+	void trace_box(const char* status, const IntervalVector& box);
+
+	/**
+	 * \brief Number of boxes with a given status (in the manifold or in the output file).
+	 *
+	 * Inner boxes are counted as SOLUTION boxes.
+	 */
+	size_t nb_boxes(CovSolverData::BoxStatus status) const;
+
+	/**
+	 * \brief Open the output file (if any).
+	 */
+	void open_output();
+
+	/**
+	 * \brief Close the output file (if any).
+	 */
+	void close_output();
 
 	/**
 	 * \brief Check if the box is "BOUNDARY"
@@ -319,7 +411,15 @@ protected:
 	 */
 	bool is_too_small(const IntervalVector& box);
 
-	bool check_ineq(const IntervalVector& box);
+	/**
+	 * \brief Check the inequalities on a box.
+	 *
+	 * \param inner - (output) true if the box satisfies all the inequalities
+	 *
+	 * \return false if it is proven that some inequality is violated
+	 *         everywhere in the box.
+	 */
+	bool check_ineq(const IntervalVector& box, bool& inner);
 
 	/**
 	 * \brief Check if time is out.
@@ -366,6 +466,19 @@ protected:
 	 */
 	CovSolverData* manif;
 
+	/**
+	 * \brief Writer of the output file (NULL if none).
+	 */
+	CovSolverData::Writer* writer;
+
+#ifndef _WIN32
+	/**
+	 * \brief Lock of the manifold, the output file and the trace
+	 *        (NULL if the solver is not run by several threads).
+	 */
+	std::mutex* output_lock;
+#endif
+
 	/*
 	 * \brief CPU running time used to obtain this manifold.
 	 */
@@ -387,6 +500,9 @@ protected:
 	 * \brief Number of cells of the previous call.
 	 */
 	unsigned int old_nb_cells;
+
+private:
+	friend class ParallelSolver;
 };
 
 /*============================================ inline implementation ============================================ */
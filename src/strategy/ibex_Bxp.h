@@ -5,13 +5,14 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 01, 2018
-// Last update : Jul 09, 2018
+// Last update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_IntervalVector.h"
 #include "ibex_BitSet.h"
 #include "ibex_Bisection.h"
 #include "ibex_BoxEvent.h"
+#include "ibex_Pool.h"
 
 #include <sstream>
 
@@ -86,6 +87,16 @@ public:
 	 */
 	virtual ~Bxp();
 
+	/**
+	 * \brief Allocate a property (in the pool, if enabled: see #ibex::Pool).
+	 */
+	static void* operator new(size_t size);
+
+	/**
+	 * \brief Release a property (in the pool, if enabled: see #ibex::Pool).
+	 */
+	static void operator delete(void* p, size_t size);
+
 	/**
 	 * \brief Identifying number.
 	 */
@@ -108,6 +119,14 @@ inline Bxp::Bxp(long id) : id(id) {
 inline Bxp::~Bxp() {
 }
 
+inline void* Bxp::operator new(size_t size) {
+	return Pool::alloc(size);
+}
+
+inline void Bxp::operator delete(void* p, size_t size) {
+	Pool::free(p, size);
+}
+
 inline std::string Bxp::to_string() const {
 	std::stringstream ss;
 	ss << '[' << id << ']';
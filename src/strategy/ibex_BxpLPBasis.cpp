@@ -0,0 +1,34 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpLPBasis.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_BxpLPBasis.h"
+
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+BxpLPBasis* BxpLPBasis::copy(const IntervalVector& box, const BoxProperties& prop) const {
+	BxpLPBasis* b=new BxpLPBasis(id, basis.size());
+	b->basis=basis;
+	return b;
+}
+
+string BxpLPBasis::to_string() const {
+	stringstream ss;
+	ss << '[' << id << "] BxpLPBasis ";
+	int nb=0;
+	for (size_t k=0; k<basis.size(); k++)
+		if (!basis[k].empty()) nb++;
+	ss << nb << '/' << basis.size() << " bases";
+	return ss.str();
+}
+
+} /* namespace ibex */
@@ -0,0 +1,84 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpLPBasis.h
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_BXP_LP_BASIS_H__
+#define __IBEX_BXP_LP_BASIS_H__
+
+#include "ibex_Bxp.h"
+#include "ibex_LPSolver.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Store the optimal bases of linear programs on a relaxation.
+ *
+ * An operator may solve several LPs on the same relaxation with
+ * different objectives (e.g., #CtcPolytopeHull minimizes and maximizes
+ * each variable). The optimal basis of each LP found by the simplex
+ * in a node is inherited by the sub-nodes (after bisection) and used
+ * to warm-start the same LP on the relaxation of the sub-boxes, as
+ * long as the relaxation keeps the same dimensions. The optimal basis
+ * of the parent is usually much closer to the optimum than the basis
+ * of the LP solved before with another objective.
+ *
+ * The property is identified by the operator that solves the linear
+ * programs (e.g., #CtcPolytopeHull), each operator having its own basis.
+ */
+class BxpLPBasis : public Bxp {
+public:
+
+	/**
+	 * \brief Build empty bases.
+	 *
+	 * \param id    - the identifier, given by the owner of the LPs
+	 * \param nb_lp - the number of LPs
+	 */
+	BxpLPBasis(long id, int nb_lp);
+
+	/**
+	 * \brief Copy the property
+	 *
+	 * The bases are copied.
+	 */
+	virtual BxpLPBasis* copy(const IntervalVector& box, const BoxProperties& prop) const override;
+
+	/**
+	 * \brief Update the property after box modification.
+	 *
+	 * Does nothing: the bases of a box remain good
+	 * starting points for a sub-box.
+	 */
+	virtual void update(const BoxEvent& event, const BoxProperties& prop) override;
+
+	/**
+	 * \brief To string
+	 */
+	virtual std::string to_string() const override;
+
+	/**
+	 * \brief The basis of each LP (empty if none).
+	 */
+	std::vector<LPSolver::Basis> basis;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline BxpLPBasis::BxpLPBasis(long id, int nb_lp) : Bxp(id), basis(nb_lp) {
+}
+
+inline void BxpLPBasis::update(const BoxEvent& event, const BoxProperties& prop) {
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_BXP_LP_BASIS_H__ */
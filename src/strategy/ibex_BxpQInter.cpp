@@ -0,0 +1,34 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpQInter.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_BxpQInter.h"
+
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+BxpQInter* BxpQInter::copy(const IntervalVector& box, const BoxProperties& prop) const {
+	return new BxpQInter(*this); // the set is shared
+}
+
+void BxpQInter::discard(int i) {
+	if (discarded.use_count()>1)
+		discarded=std::make_shared<BitSet>(*discarded);
+	discarded->add(i);
+}
+
+string BxpQInter::to_string() const {
+	stringstream ss;
+	ss << '[' << id << "] BxpQInter " << nb_discarded() << " discarded";
+	return ss.str();
+}
+
+} /* namespace ibex */
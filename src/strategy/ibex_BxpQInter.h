@@ -0,0 +1,105 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpQInter.h
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_BXP_QINTER_H__
+#define __IBEX_BXP_QINTER_H__
+
+#include "ibex_Bxp.h"
+
+#include <memory>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Sub-operators of a q-intersection discarded in a box.
+ *
+ * A sub-contractor (or a measurement) of a q-intersection whose
+ * result is disjoint from the q-intersection cannot be satisfied
+ * in any sub-box: it is discarded and no longer called in
+ * the sub-nodes.
+ *
+ * The property is identified by the q-intersection operator
+ * (e.g., #CtcQInter), each operator having its own set.
+ *
+ * The set is shared by the copies of the property until it is
+ * modified (the properties are copied for every sub-operator call,
+ * and the set has as many elements as sub-operators).
+ */
+class BxpQInter : public Bxp {
+public:
+
+	/**
+	 * \brief Build the property (nothing discarded).
+	 *
+	 * \param id - the identifier, given by the q-intersection operator
+	 * \param p  - the number of sub-operators
+	 */
+	BxpQInter(long id, int p);
+
+	/**
+	 * \brief Copy the property
+	 */
+	virtual BxpQInter* copy(const IntervalVector& box, const BoxProperties& prop) const override;
+
+	/**
+	 * \brief Update the property after box modification.
+	 *
+	 * Does nothing: a sub-operator discarded
+	 * in a box is discarded in any sub-box.
+	 */
+	virtual void update(const BoxEvent& event, const BoxProperties& prop) override;
+
+	/**
+	 * \brief To string
+	 */
+	virtual std::string to_string() const override;
+
+	/**
+	 * \brief True if the ith sub-operator is discarded.
+	 */
+	bool is_discarded(int i) const;
+
+	/**
+	 * \brief Number of discarded sub-operators.
+	 */
+	int nb_discarded() const;
+
+	/**
+	 * \brief Discard the ith sub-operator.
+	 */
+	void discard(int i);
+
+protected:
+	/**
+	 * The indices of the discarded sub-operators.
+	 */
+	std::shared_ptr<BitSet> discarded;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline BxpQInter::BxpQInter(long id, int p) : Bxp(id), discarded(new BitSet(p)) {
+}
+
+inline void BxpQInter::update(const BoxEvent& event, const BoxProperties& prop) {
+}
+
+inline bool BxpQInter::is_discarded(int i) const {
+	return (*discarded)[i];
+}
+
+inline int BxpQInter::nb_discarded() const {
+	return discarded->size();
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_BXP_QINTER_H__ */
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jun 23, 2017
-// Last Update : Jul 29, 2018
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_BxpSystemCache.h"
@@ -31,12 +31,12 @@ namespace {
 	}
 }
 
-BxpSystemCache::BxpSystemCache(const System& sys, double update_ratio/*, int goal_var*/) :
+BxpSystemCache::BxpSystemCache(const System& sys, double update_ratio, StsSystemCache* stats) :
 		Bxp(get_id(sys)), sys(sys), nb_var(sys.nb_var),
-		update_ratio(update_ratio), cache(IntervalVector::empty(sys.nb_var)),
+		update_ratio(update_ratio), statistics(stats), cache(IntervalVector::empty(sys.nb_var)),
 		goal_eval_updated(false), _goal_gradient(sys.nb_var), goal_gradient_updated(false),
 		_ctrs_eval(sys.f_ctrs.image_dim() /* note: =1 if unconstrained */), ctr_eval_updated(false),
-		_ctrs_jacobian(sys.f_ctrs.image_dim(), exists(sys.f_ctrs)? sys.nb_var : 1),
+		_ctrs_jacobian(1,1) /* allocated on first use (properties are copied at each node) */,
 		ctr_jacobian_updated(false),
 		active(BitSet::empty(sys.f_ctrs.image_dim())), // default value (empty bitset) important for unconstrained systems
 		active_ctr_updated(false), active_ctr_jacobian_updated(false) /*, goal_var(goal_var) */ {
@@ -53,7 +53,26 @@ BxpSystemCache::BxpSystemCache(const System& sys, double update_ratio/*, int goa
 }
 
 BxpSystemCache* BxpSystemCache::copy(const IntervalVector& box, const BoxProperties& prop) const {
-	return new BxpSystemCache(sys, update_ratio);
+	return new BxpSystemCache(sys, update_ratio, statistics);
+}
+
+void BxpSystemCache::add_property(const System& sys, BoxProperties& prop, StsSystemCache* stats) {
+	if (!prop[get_id(sys)])
+		prop.add(new BxpSystemCache(sys, default_update_ratio, stats));
+}
+
+const BxpSystemCache* BxpSystemCache::get(const System& sys, const BoxProperties& prop, const IntervalVector& box) {
+	const BxpSystemCache* cache=(const BxpSystemCache*) prop[get_id(sys)];
+	if (cache) cache->sync(box);
+	return cache;
+}
+
+StsSystemCache* BxpSystemCache::enable_statistics(const System& sys, Statistics& stats) {
+	stringstream ss;
+	ss << "System cache (system n°" << sys.id << ")";
+	StsSystemCache* sts=(StsSystemCache*) stats.find(ss.str());
+	if (!sts) stats.add(sts=new StsSystemCache(ss.str()));
+	return sts;
 }
 
 long BxpSystemCache::get_id(const System& sys) {
@@ -73,6 +92,17 @@ std::string BxpSystemCache::to_string() const {
 }
 
 void BxpSystemCache::update(const BoxEvent& e, const BoxProperties& prop) {
+	if (e.type==BoxEvent::CONTRACT)
+		check(e.box, true, &e.impact);
+	else
+		check(e.box, false, NULL);
+}
+
+void BxpSystemCache::sync(const IntervalVector& box) const {
+	check(box, false, NULL);
+}
+
+void BxpSystemCache::check(const IntervalVector& box, bool contract, const BitSet* impact) const {
 
 	bool close = true;     // is the new box close to the cache?
 	bool included = true;  // is the new box included in the cache?
@@ -81,25 +111,31 @@ void BxpSystemCache::update(const BoxEvent& e, const BoxProperties& prop) {
 	// Should be fixed by making loup finders working on the
 	// extended box directly?
 	// ------------------------ HACK -----------------------
-	IntervalVector box(nb_var);
-	if (e.box.size()>nb_var) {
-		for (int i=0; i<nb_var; i++) { // skip goal variable
-			box[i]=e.box[i];
-		}
-	} else {
-		box=e.box;
-	}
+	// If box.size()>nb_var, the last component (goal
+	// variable) is skipped.
 	// -----------------------------------------------------
 
 	if (box.is_empty()) {
 		if (!cache.is_empty()) close=false;
 	} else if (cache.is_empty()) {
-		if (!box.is_empty()) included=false;
+		included=false;
+	} else if (impact && impact->size()<nb_var) {
+		// Incremental check: only the impacted variables
+		// may have been modified.
+		for (BitSet::const_iterator it=impact->begin(); it!=impact->end(); ++it) {
+			int j=it;
+			if (j>=nb_var) continue; // skip goal variable
+			if ((update_ratio==0 && cache[j]!=box[j])
+					|| cache[j].rel_distance(box[j])>update_ratio) {
+				close = false;
+				break;
+			}
+		}
 	} else {
 
 		for (int j=0; j<nb_var; j++) {
 
-			if (e.type!=BoxEvent::CONTRACT && !box[j].is_subset(cache[j])) {
+			if (!contract && !box[j].is_subset(cache[j])) {
 				included=false;
 				break;
 			}
@@ -113,7 +149,11 @@ void BxpSystemCache::update(const BoxEvent& e, const BoxProperties& prop) {
 
 	if (!close || !included) {
 
-		cache = box;
+		if (box.is_empty())
+			cache.set_empty();
+		else
+			for (int j=0; j<nb_var; j++)
+				cache[j]=box[j];
 
 		// mark interval computations as "to be updated"
 		if (sys.goal) {
@@ -152,9 +192,11 @@ void BxpSystemCache::update(const BoxEvent& e, const BoxProperties& prop) {
 
 Interval BxpSystemCache::goal_eval() const {
 	if (!goal_eval_updated) {
+		miss(StsSystemCache::GOAL_EVAL);
 		_goal_eval = sys.goal->eval(cache);
 		goal_eval_updated=true;
-	}
+	} else
+		hit(StsSystemCache::GOAL_EVAL);
 	return _goal_eval;
 
 }
@@ -167,9 +209,11 @@ IntervalVector BxpSystemCache::goal_gradient() const {
 
 void BxpSystemCache::goal_gradient(IntervalVector& g) const {
 	if (!goal_gradient_updated) {
+		miss(StsSystemCache::GOAL_GRADIENT);
 		sys.goal->gradient(cache,_goal_gradient);
 		goal_gradient_updated=true;
-	}
+	} else
+		hit(StsSystemCache::GOAL_GRADIENT);
 	g=_goal_gradient;
 }
 
@@ -181,11 +225,13 @@ IntervalVector BxpSystemCache::ctrs_eval() const {
 
 void BxpSystemCache::ctrs_eval(IntervalVector& ev) const {
 	if (!ctr_eval_updated) {
+		miss(StsSystemCache::CTRS_EVAL);
 		// maybe, we could avoid evaluating active constraints
 		// here when they are up-to-date
 		_ctrs_eval = sys.f_ctrs.eval_vector(cache);
 		ctr_eval_updated=true;
-	}
+	} else
+		hit(StsSystemCache::CTRS_EVAL);
 	ev = _ctrs_eval;
 }
 
@@ -197,12 +243,22 @@ IntervalMatrix BxpSystemCache::ctrs_jacobian() const {
 
 void BxpSystemCache::ctrs_jacobian(IntervalMatrix& J) const {
 	if (!ctr_jacobian_updated) {
+		miss(StsSystemCache::CTRS_JACOBIAN);
+		alloc_jacobian();
 		sys.f_ctrs.jacobian(cache,_ctrs_jacobian);
 		ctr_jacobian_updated=true;
-	}
+		// the rows of the active constraints are up-to-date as well
+		active_ctr_jacobian_updated=true;
+	} else
+		hit(StsSystemCache::CTRS_JACOBIAN);
 	J=_ctrs_jacobian;
 }
 
+void BxpSystemCache::alloc_jacobian() const {
+	if (_ctrs_jacobian.nb_rows()!=sys.f_ctrs.image_dim() || _ctrs_jacobian.nb_cols()!=nb_var)
+		_ctrs_jacobian.resize(sys.f_ctrs.image_dim(), nb_var);
+}
+
 namespace {
 
 bool __is_inactive(const Interval& gx, CmpOp op) {
@@ -221,9 +277,12 @@ bool __is_inactive(const Interval& gx, CmpOp op) {
 
 BitSet& BxpSystemCache::active_ctrs() const {
 	if (active_ctr_updated) {
+		hit(StsSystemCache::ACTIVE_CTRS);
 		return active;
 	}
 
+	miss(StsSystemCache::ACTIVE_CTRS);
+
 	if (cache.is_empty()) {
 		active.clear();
 		_ctrs_eval.set_empty();
@@ -236,7 +295,7 @@ BitSet& BxpSystemCache::active_ctrs() const {
 	// are now inactive
 	IntervalVector res(active.size());
 
-	if (!ctr_eval_updated) { // use the cache if possible!
+	if (!ctr_eval_updated && !active.empty()) { // use the cache if possible!
 
 		res = sys.f_ctrs.eval_vector(cache, active);
 
@@ -283,6 +342,8 @@ IntervalMatrix BxpSystemCache::active_ctrs_jacobian() const {
 	IntervalMatrix J(b.size(),nb_var);
 
 	if (!active_ctr_jacobian_updated) {
+		miss(StsSystemCache::CTRS_JACOBIAN);
+		alloc_jacobian();
 		J=sys.f_ctrs.jacobian(cache,b);
 
 		int c;
@@ -292,6 +353,7 @@ IntervalMatrix BxpSystemCache::active_ctrs_jacobian() const {
 		}
 		active_ctr_jacobian_updated=true;
 	} else {
+		hit(StsSystemCache::CTRS_JACOBIAN);
 		int c;
 		for (int i=0; i<b.size(); i++) {
 			c=(i==0? b.min() : b.next(c));
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jun 23, 2017
-// Last Update : Jul 29, 2018
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_BXP_SYSTEM_CACHE_H__
@@ -15,6 +15,8 @@
 #include "ibex_Map.h"
 #include "ibex_System.h"
 #include "ibex_BoxProperties.h"
+#include "ibex_Statistics.h"
+#include "ibex_StsSystemCache.h"
 
 namespace ibex {
 
@@ -26,6 +28,15 @@ namespace ibex {
  * This class stores in a cache typical interval computations
  * based on a system, like the evaluation of goal/constraints, etc.
  *
+ * The cache is shared by all the operators working on the same system
+ * in a node of the search (bisectors, linearizers, loup finders, etc.),
+ * so that, e.g., the Jacobian matrix of the constraints is computed only
+ * once for a given box. The computations are invalidated when the box is
+ * modified significantly (see #update_ratio) as indicated by box events:
+ * for a contraction, only the impacted variables are checked.
+ *
+ * An operator retrieves the cache of its system with #get(...) which
+ * also synchronizes the cache with the box the operator is working on.
  */
 class BxpSystemCache : public Bxp {
 public:
@@ -46,7 +57,36 @@ public:
 	 *                       to a single point". See Interval::rel_distance(...).
 	 *
 	 */
-	BxpSystemCache(const System& sys, double update_ratio);
+	BxpSystemCache(const System& sys, double update_ratio, StsSystemCache* stats=NULL);
+
+	/**
+	 * \brief Add the cache of a system to box properties.
+	 *
+	 * Does nothing if the cache already exists.
+	 *
+	 * \param stats - Statistics to be filled (may be NULL).
+	 *                See #enable_statistics(const System&, Statistics&).
+	 */
+	static void add_property(const System& sys, BoxProperties& prop, StsSystemCache* stats=NULL);
+
+	/**
+	 * \brief Get the cache of a system in box properties.
+	 *
+	 * The cache is synchronized with \a box (see #sync(const IntervalVector&)).
+	 *
+	 * \return the cache or NULL if the properties do not contain it.
+	 */
+	static const BxpSystemCache* get(const System& sys, const BoxProperties& prop, const IntervalVector& box);
+
+	/**
+	 * \brief Enable statistics of the cache of a system.
+	 *
+	 * The statistics are shared by all the operators working on
+	 * the same system.
+	 *
+	 * \return the statistics (to be given to #add_property(...)).
+	 */
+	static StsSystemCache* enable_statistics(const System& sys, Statistics& stats);
 
 	/**
 	 * \brief Copy the property
@@ -65,6 +105,16 @@ public:
 	 */
 	virtual void update(const BoxEvent& event, const BoxProperties& prop) override;
 
+	/**
+	 * \brief Synchronize the cache with a box.
+	 *
+	 * Same as an update with a BoxEvent::CHANGE event: the computations
+	 * are kept only if the box is included in the stored box and close to it.
+	 * This is a guard for operators that may be called on a box
+	 * which has been modified without notification.
+	 */
+	void sync(const IntervalVector& box) const;
+
 	/**
 	 * \brief To string
 	 *
@@ -153,7 +203,7 @@ public:
 	const System& sys;
 
 	/**
-	 * Set to 0.01
+	 * Set to 0.1
 	 */
 	static constexpr double default_update_ratio = 0.1;
 
@@ -174,6 +224,11 @@ protected:
 	 */
 	double update_ratio;
 
+	/**
+	 * Statistics (NULL if disabled).
+	 */
+	StsSystemCache* statistics;
+
 	/**
 	 * The stored box.
 	 */
@@ -205,6 +260,24 @@ protected:
 	int goal_var;
 
 	static Map<long,long,false>& ids();
+
+	/*
+	 * Check the new box and invalidate the computations if necessary.
+	 * If impact is not NULL, the box is assumed to be included in the
+	 * cache and only the components in impact are checked.
+	 */
+	void check(const IntervalVector& box, bool contract, const BitSet* impact) const;
+
+	/*
+	 * Allocate the Jacobian matrix (on first use).
+	 */
+	void alloc_jacobian() const;
+
+	/*
+	 * Record a hit or a miss in the statistics.
+	 */
+	void hit(StsSystemCache::Computation c) const;
+	void miss(StsSystemCache::Computation c) const;
 };
 
 /*================================== inline implementations ========================================*/
@@ -213,6 +286,14 @@ inline bool BxpSystemCache::is_active_ctrs_uptodate() const {
 	return active_ctr_updated;
 }
 
+inline void BxpSystemCache::hit(StsSystemCache::Computation c) const {
+	if (statistics) statistics->add_hit(c);
+}
+
+inline void BxpSystemCache::miss(StsSystemCache::Computation c) const {
+	if (statistics) statistics->add_miss(c);
+}
+
 } /* namespace ibex */
 
 #endif /* __IBEX_BXP_SYSTEM_CACHE_H__ */
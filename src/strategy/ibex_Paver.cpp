@@ -109,7 +109,7 @@ SubPaving* Paver::pave(const IntervalVector& init_box) {
 
 		contract(*c, paving);
 
-		timer.check(timeout);
+		timer.check_amortized(timeout);
 		check_capacity(paving);
 
 		if (c->box.is_empty()) delete buffer.pop();
@@ -23,6 +23,12 @@ void Statistics::add(Sts* stats) {
 	data.push_back(stats);
 }
 
+Sts* Statistics::find(const string& op_name) const {
+	for (vector<Sts*>::const_iterator it = data.begin(); it!=data.end(); ++it)
+		if ((*it)->name()==op_name) return *it;
+	return NULL;
+}
+
 ostream& operator<<(ostream& os, const Statistics& s) {
 	for (vector<Sts*>::const_iterator it = s.data.begin(); it!=s.data.end(); ++it)
 		os << (*it)->report() << endl;
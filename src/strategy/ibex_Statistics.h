@@ -40,6 +40,15 @@ public:
 	 * 				I am responsible of deleting it.
 	 */
 	void add(Sts* stats);
+
+	/**
+	 * \brief Get statistics by name.
+	 *
+	 * Allows several operators to share the same statistics.
+	 *
+	 * \return the statistics object with this name or NULL if none.
+	 */
+	Sts* find(const std::string& op_name) const;
 	
 	friend std::ostream& operator<<(std::ostream& os, const Statistics&);
 
@@ -42,6 +42,11 @@ public:
 	 * \brief Add a new call to this operator in the stats.
 	 */
 	void add_call();
+
+	/**
+	 * \brief Name of the operator.
+	 */
+	const std::string& name() const;
 	
 	/**
 	 * \brief Report statistics.
@@ -62,6 +67,8 @@ inline Sts::Sts(const std::string& op_name) : op_name(op_name), nb_calls(0) { }
 
 inline void Sts::add_call() { nb_calls++; }
 
+inline const std::string& Sts::name() const { return op_name; }
+
 } /* namespace ibex */
 
 #endif /* __IBEX_STS_H__ */
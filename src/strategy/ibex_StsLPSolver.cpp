@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Feb, 13, 2025
-// Last Update : Feb, 13, 2025
+// Last Update : Oct, 18, 2026
 //============================================================================
 
 #include "ibex_StsLPSolver.h"
@@ -14,12 +14,14 @@ using namespace std;
 
 namespace ibex {
 	
-StsLPSolver::StsLPSolver(const string& op_name) : Sts(op_name) {
+StsLPSolver::StsLPSolver(const string& op_name) : Sts(op_name), iterations(0), warm_starts(0) {
 }
 
 string StsLPSolver::report() const {
 	string s = "\t[" + op_name + "]\n";
 	s+= "\t  called:\t" + to_string(nb_calls) + " time(s) \n";
+	s+= "\t  iterations:\t" + to_string(iterations) + "\n";
+	s+= "\t  warm starts:\t" + to_string(warm_starts) + "\n";
 	s+= "\t  failed:";
 	if (other_status.empty()) s += "\tnever\n";
 	else {
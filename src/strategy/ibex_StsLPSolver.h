@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Feb, 13, 2025
-// Last Update : Feb, 13, 2025
+// Last Update : Oct, 18, 2026
 //============================================================================
 
 #ifndef __IBEX_STS_LP_SOLVER_H__
@@ -44,13 +44,61 @@ public:
 	 */
 	void add_unexpected_status(int other_status);
 
+	/**
+	 * \brief Add simplex iterations (of one call).
+	 */
+	void add_iterations(long int n);
+
+	/**
+	 * \brief Add a warm start (a call starting from a given basis).
+	 */
+	void add_warm_start();
+
+	/**
+	 * \brief Total number of simplex iterations.
+	 */
+	long int nb_iterations() const;
+
+	/**
+	 * \brief Number of warm starts.
+	 */
+	long int nb_warm_starts() const;
+
 protected:
+	/*
+	 * Total number of simplex iterations.
+	 */
+	long int iterations;
+
+	/*
+	 * Number of warm starts.
+	 */
+	long int warm_starts;
+
 	/*
 	 * Maps an internal status to the number of its occurrences.
 	 */
 	std::map<int, unsigned int> other_status;
 };
 
+/*================================== inline implementations ========================================*/
+
+inline void StsLPSolver::add_iterations(long int n) {
+	iterations += n;
+}
+
+inline void StsLPSolver::add_warm_start() {
+	warm_starts++;
+}
+
+inline long int StsLPSolver::nb_iterations() const {
+	return iterations;
+}
+
+inline long int StsLPSolver::nb_warm_starts() const {
+	return warm_starts;
+}
+
 } /* namespace ibex */
 
 #endif /* __IBEX_STS_LP_SOLVER_H__ */
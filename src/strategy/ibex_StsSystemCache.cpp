@@ -0,0 +1,47 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_StsSystemCache.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_StsSystemCache.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const char* computation_name[StsSystemCache::NB_COMPUTATIONS] = {
+		"goal evaluation",
+		"goal gradient",
+		"constraints evaluation",
+		"constraints jacobian",
+		"active constraints"
+};
+
+}
+
+StsSystemCache::StsSystemCache(const string& op_name) : Sts(op_name) {
+	for (int c=0; c<NB_COMPUTATIONS; c++) {
+		hits[c]=0;
+		misses[c]=0;
+	}
+}
+
+string StsSystemCache::report() const {
+	string s = "\t[" + op_name + "]\n";
+	s+= "\t  called:\t" + to_string(nb_calls) + " time(s) \n";
+	for (int c=0; c<NB_COMPUTATIONS; c++) {
+		if (hits[c]+misses[c]==0) continue;
+		s+= "\t  " + string(computation_name[c]) + ":\t" + to_string(hits[c]) + " hit(s), "
+				+ to_string(misses[c]) + " miss(es)\n";
+	}
+	return s;
+}
+
+} // namespace ibex
@@ -0,0 +1,96 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_StsSystemCache.h
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_STS_SYSTEM_CACHE_H__
+#define __IBEX_STS_SYSTEM_CACHE_H__
+
+#include "ibex_Sts.h"
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Statistics of a system cache.
+ *
+ * Number of hits/misses of each computation
+ * stored in a system cache (see #BxpSystemCache).
+ */
+class StsSystemCache : public Sts {
+public:
+
+	/**
+	 * \brief Computations stored in the cache.
+	 */
+	typedef enum { GOAL_EVAL, GOAL_GRADIENT, CTRS_EVAL, CTRS_JACOBIAN, ACTIVE_CTRS } Computation;
+
+	/**
+	 * \brief Number of computations.
+	 */
+	static const int NB_COMPUTATIONS = 5;
+
+	/**
+	 * \brief Build statistics for a system cache.
+	 */
+	StsSystemCache(const std::string& op_name="System cache");
+
+	/**
+	 * \brief Report statistics.
+	 */
+	virtual std::string report() const override;
+
+	/**
+	 * \brief A computation has been found in the cache.
+	 */
+	void add_hit(Computation c);
+
+	/**
+	 * \brief A computation has not been found in the cache.
+	 */
+	void add_miss(Computation c);
+
+	/**
+	 * \brief Number of hits of a computation.
+	 */
+	long int nb_hits(Computation c) const;
+
+	/**
+	 * \brief Number of misses of a computation.
+	 */
+	long int nb_misses(Computation c) const;
+
+protected:
+	long int hits[NB_COMPUTATIONS];
+	long int misses[NB_COMPUTATIONS];
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void StsSystemCache::add_hit(Computation c) {
+	add_call();
+	hits[c]++;
+}
+
+inline void StsSystemCache::add_miss(Computation c) {
+	add_call();
+	misses[c]++;
+}
+
+inline long int StsSystemCache::nb_hits(Computation c) const {
+	return hits[c];
+}
+
+inline long int StsSystemCache::nb_misses(Computation c) const {
+	return misses[c];
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_STS_SYSTEM_CACHE_H__ */
@@ -277,6 +277,17 @@ bool FncActiveCtrs::rejection_test(const IntervalVector& x) const {
 
 	assert(sys.goal);
 
+	if (fact) {
+		IntervalMatrix J=((Fnc*) fact)->jacobian(x);
+		return rejection_test(x, sys.goal->gradient(x), &J);
+	} else
+		return rejection_test(x, sys.goal->gradient(x), NULL);
+}
+
+bool FncActiveCtrs::rejection_test(const IntervalVector& x, const IntervalVector& goal_gradient, const IntervalMatrix* jacobian) const {
+
+	assert(sys.goal);
+
 	int n=sys.nb_var;
 
 	int m=active_ctr.size() + 1; // +1 because we add the gradient of f
@@ -286,12 +297,14 @@ bool FncActiveCtrs::rejection_test(const IntervalVector& x) const {
 	IntervalMatrix B(n, m);
 
 	// Gradient of objective
-	B.put(0, 0, sys.goal->gradient(x), false); // init
+	B.put(0, 0, goal_gradient, false); // init
 
-	if (fact)
+	if (fact) {
+		assert(jacobian && jacobian->nb_rows()==active_ctr.size());
 		// Gradients of active constraints
 		// note: the order does not matter here (ineq_first ignored)
-		B.put(0, 1,((Fnc*) fact)->jacobian(x).transpose());
+		B.put(0, 1, jacobian->transpose());
+	}
 
 	// To be more efficient, we know that if the jth
 	// column is a bound constraint on the ith variable,
@@ -146,6 +146,16 @@ public:
 	 */
 	bool rejection_test(const IntervalVector& x) const;
 
+	/**
+	 * \brief First-order rejection test.
+	 *
+	 * Variant where the gradient of the goal and the Jacobian matrix of the
+	 * active constraints (in the order of #active_ctr, NULL if there is no
+	 * active constraint) have already been calculated, over \a x or any
+	 * superset of \a x.
+	 */
+	bool rejection_test(const IntervalVector& x, const IntervalVector& goal_gradient, const IntervalMatrix* jacobian) const;
+
 	/*
 	 * Original system
 	 */
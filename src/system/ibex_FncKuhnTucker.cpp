@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Apr 26, 2017
-// Last Update : Jul 11, 2019
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include <stdlib.h>
@@ -17,31 +17,18 @@ using namespace std;
 
 namespace ibex {
 
-FncKuhnTucker::FncKuhnTucker(const NormalizedSystem& sys, Function& _df, Function** _dg, const IntervalVector& current_box, const BitSet* _active) :
+FncKuhnTucker::FncKuhnTucker(const NormalizedSystem& sys, const IntervalVector& current_box, const BitSet* _active) :
 								Fnc(1,1), sys(sys), n(sys.nb_var), nb_mult(0), // **tmp**
-								act(NULL), df(_df), nothing(BitSet::empty(1)) {
+								act(NULL), nothing(BitSet::empty(1)) {
 
 	assert(sys.goal);
 
 	try {
-		// ***************************************************
-		// Unfortunately, if we want to give the symbolic
-		// derivatives of contraints to FncActiveCtrs, we have
-		// to build again a matrix-valued function from _dg
-		// (not done).
-		// ***************************************************
 		if (_active)
 			act = new FncActiveCtrs(sys,current_box,*_active,true);
 		else
 			act = new FncActiveCtrs(sys,current_box,true);
 
-		dg.resize(act->active_ctr.size());
-
-		unsigned int i=0; // index of a constraint in the active set
-		for (BitSet::const_iterator c=act->active_ctr.begin(); c!=act->active_ctr.end(); ++c) {
-			dg.set_ref(i++,*_dg[c]);
-		}
-
 		(int&) nb_mult = act->image_dim() +1 ; // +1 because of objective
 
 	} catch (FncActiveCtrs::NothingActive&) {
@@ -83,7 +70,7 @@ IntervalVector FncKuhnTucker::eval_vector(const IntervalVector& x_lambda, const
 	int l=lambda0; // multipliers indices counter. The first multiplier is lambda0.
 
 	// vector corresponding to the "gradient expression" lambda_0*dg + lambda_1*dg_1 + ... (init
-	IntervalVector grad=x_lambda[l] * df.eval_vector(x); // init
+	IntervalVector grad=x_lambda[l] * sys.goal->gradient(x); // init
 
 	// normalization equation lambda_0 + ... = 1.0
 	res[lambda0] = x_lambda[lambda0] - 1.0; // init
@@ -148,9 +135,10 @@ void FncKuhnTucker::jacobian(const IntervalVector& x_lambda, IntervalMatrix& J,
 	int l=lambda0; // mutipliers indices counter. The first multiplier is lambda0.
 
 	// matrix corresponding to the "Hessian expression" lambda_0*d^2f+lambda_1*d^2g_1+...=0
+	// (only the vth column if v<n)
 	IntervalMatrix hessian(n,n);
-	if (v==-1 || v<n) hessian = x_lambda[l] * df.jacobian(x,v); // init
-	if (v==-1 || v==l) J.put(0, l, df.eval_vector(x), false);
+	if (v==-1 || v<n) sys.goal->hessian(x, IntervalVector(1,x_lambda[l]), hessian, v); // init
+	if (v==-1 || v==l) J.put(0, l, sys.goal->gradient(x), false);
 
 	// normalization equation (init)
 	if (v==-1) {
@@ -162,8 +150,7 @@ void FncKuhnTucker::jacobian(const IntervalVector& x_lambda, IntervalMatrix& J,
 		J[lambda0][lambda0]=1.0;
 
 	if (!act) {
-		if (v==-1 || v<n)
-			J.put(0,0,hessian);
+		put_hessian(hessian, J, v);
 		return;
 	}
 
@@ -173,24 +160,49 @@ void FncKuhnTucker::jacobian(const IntervalVector& x_lambda, IntervalMatrix& J,
 	if ((v==-1 || v>=n) && !act->ineq.empty())
 		gx = sys.f_ctrs.eval_vector(x,act->active_ctr.compose(act->ineq));
 
+	// original indices of the active (in)equalities
+	BitSet ineq_ctr=act->ineq.empty()? BitSet::empty(1) : act->active_ctr.compose(act->ineq);
+	BitSet eq_ctr=act->eq.empty()? BitSet::empty(1) : act->active_ctr.compose(act->eq);
+
+	// gradients dg_i([x]) of the active (in)equalities
+	// (only the vth column if v<n)
+	IntervalMatrix dg(act->active_ctr.empty()? 1 : act->active_ctr.size(), n);
+
+	if (!act->active_ctr.empty() && (v==-1 || v<n)) {
+		sys.f_ctrs.jacobian(x, dg, act->active_ctr, v);
+
+		// contribution of the (in)equalities to the "Hessian expression".
+		// Note: the inactive constraints are not differentiated at all
+		// (with a zero weight, a constraint undefined on x would give
+		// an empty matrix since 0*empty is empty).
+		IntervalVector w(act->active_ctr.size());
+		int l2=l;
+		for (BitSet::const_iterator i=act->ineq.begin(); i!=act->ineq.end(); ++i) w[i]=x_lambda[l2++];
+		for (BitSet::const_iterator i=act->eq.begin(); i!=act->eq.end(); ++i)     w[i]=x_lambda[l2++];
+
+		IntervalMatrix hessian_ctrs(n,n);
+		sys.f_ctrs.hessian(x, w, hessian_ctrs, act->active_ctr, v);
+		hessian += hessian_ctrs;
+	}
+
 	IntervalVector dgi(n); // store dg_i([x]) (used in several places)
 
-	for (BitSet::const_iterator i=act->ineq.begin(); i!=act->ineq.end(); ++i) {
+	BitSet::const_iterator c=ineq_ctr.begin();
+
+	for (BitSet::const_iterator i=act->ineq.begin(); i!=act->ineq.end(); ++i, ++c) {
 		if (v==-1) {
-			hessian += x_lambda[l] * dg[i].jacobian(x);
-			dgi=dg[i].eval_vector(x);
+			dgi=dg[i];
 			J.put(0, l, dgi, false);
 			J.put(l, 0, (x_lambda[l]*dgi), true);
 			J.put(l, n, Vector::zeros(nb_mult), true);
 			J[l][l] = gx[l-n-1]; // maybe a counter for inequalities would be clearer
 			J[lambda0][l] = 1.0;
 		} else if (v==l) {
-			J.put(0, l, dg[i].eval_vector(x), false);
+			J.put(0, l, ctr_gradient(x, c), false);
 			J[l][l] = gx[l-n-1];
 			J[lambda0][l] = 1.0;
 		} else if (v<n) {
-			hessian += x_lambda[l] * dg[i].jacobian(x,v);
-			J[l][v] = x_lambda[l]*dg[i].eval(v,x);
+			J[l][v] = x_lambda[l]*dg[i][v];
 		} else {
 			J[l][v] = 0;
 		}
@@ -198,21 +210,21 @@ void FncKuhnTucker::jacobian(const IntervalVector& x_lambda, IntervalMatrix& J,
 		l++;
 	}
 
-	for (BitSet::const_iterator i=act->eq.begin(); i!=act->eq.end(); ++i) {
+	c=eq_ctr.begin();
+
+	for (BitSet::const_iterator i=act->eq.begin(); i!=act->eq.end(); ++i, ++c) {
 		if (v==-1) {
-			hessian += x_lambda[l] * dg[i].jacobian(x,v);
-			dgi=dg[i].eval_vector(x);
+			dgi=dg[i];
 			J.put(0, l, dgi, false);
 			J.put(l, 0, dgi, true);
 			J.put(l, n, Vector::zeros(nb_mult), true);
 			J[lambda0][l] = 2*x_lambda[l];
 		} else if (v==l) {
-			J.put(0, l, dg[i].eval_vector(x), false);
+			J.put(0, l, ctr_gradient(x, c), false);
 			J[l][l] = 0;
 			J[lambda0][l] = 2*x_lambda[l];
 		} else if (v<n) {
-			hessian += x_lambda[l] * dg[i].jacobian(x,v);
-			J[l][v] = dg[i].eval(v,x);
+			J[l][v] = dg[i][v];
 		} else {
 			J[l][v] = 0;
 		}
@@ -278,8 +290,21 @@ void FncKuhnTucker::jacobian(const IntervalVector& x_lambda, IntervalMatrix& J,
 
 	assert(l==nb_mult+n);
 
-	if (v==-1 || v<n)
+	put_hessian(hessian, J, v);
+}
+
+IntervalVector FncKuhnTucker::ctr_gradient(const IntervalVector& x, int c) const {
+	IntervalMatrix dgc(1,n);
+	sys.f_ctrs.jacobian(x, dgc, BitSet::singleton(sys.f_ctrs.image_dim(),c));
+	return dgc[0];
+}
+
+void FncKuhnTucker::put_hessian(const IntervalMatrix& hessian, IntervalMatrix& J, int v) const {
+	if (v==-1)
 		J.put(0,0,hessian);
+	else if (v<n)
+		for (int i=0; i<n; i++)
+			J[i][v]=hessian[i][v];
 }
 
 
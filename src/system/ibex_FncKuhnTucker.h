@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Apr 26, 2017
-// Last Update : Jul 11, 2019
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_FNC_KUHN_TUCKER_H__
@@ -87,16 +87,15 @@ public:
 	/**
 	 * \brief Build the KKT conditions function for a given box.
 	 *
+	 * The gradients and the Hessian matrices of the objective and the constraints
+	 * are calculated by automatic differentiation on the functions of the
+	 * system (see #Function::hessian(const IntervalVector&, const IntervalVector&, IntervalMatrix&, int)).
+	 *
 	 * \param sys -    Original NLP
-	 * \param df -     Symbolic gradient of the objective
-	 * \param dg -     Symbolic gradient of constraints. NULL if unconstrained problem.
-	 * 			       Note: we ask an array of functions and not just a single matrix-valued
-	 *                 function, because Ibex does not handle differentiation of matrix function
-	 *                 (would require tensors)
 	 * \param box -    current box (not to be confused with the system "box", i.e., bounding constraints).
 	 *                 The current box is precisely used to determine active constraints.
  	 */
-	FncKuhnTucker(const NormalizedSystem& sys, Function& df, Function** dg, const IntervalVector& box);
+	FncKuhnTucker(const NormalizedSystem& sys, const IntervalVector& box);
 
 	/**
 	 * \brief Build the KKT conditions function for a given box.
@@ -104,15 +103,13 @@ public:
 	 * This variant allows to decide which constraints has to be activated.
 	 *
 	 * \param sys -    see other constructor.
-	 * \param df -     see other constructor.
-	 * \param dg -     see other constructor.
 	 * \param box -    current box (not to be confused with the system "box", i.e., bounding constraints).
 	 *                 The current box is used to determine active bound constraints (the active inequalities
 	 *                 being given in argument).
 	 * \param active - (potentially) active inequalities on the box. Must be indices of the
 	 *                 components of sys.f_ctrs.
  	 */
-	FncKuhnTucker(const NormalizedSystem& sys, Function& df, Function** dg, const IntervalVector& box, const BitSet& active);
+	FncKuhnTucker(const NormalizedSystem& sys, const IntervalVector& box, const BitSet& active);
 
 	/**
 	 * \brief Delete this.
@@ -176,6 +173,16 @@ public:
 	 */
 	bool rejection_test(const IntervalVector& x) const;
 
+	/**
+	 * \brief First-order rejection test.
+	 *
+	 * Variant with precalculated gradient of the goal and Jacobian matrix
+	 * of the active constraints.
+	 *
+	 * \see #FncActiveCtrs::rejection_test(const IntervalVector&, const IntervalVector&, const IntervalMatrix*) const.
+	 */
+	bool rejection_test(const IntervalVector& x, const IntervalVector& goal_gradient, const IntervalMatrix* jacobian) const;
+
 	/**
 	 * \brief Multiplier initial domain
 	 *
@@ -230,13 +237,15 @@ public:
 	const int nb_mult;
 
 protected:
-	FncKuhnTucker(const NormalizedSystem& sys, Function& df, Function** dg, const IntervalVector& box, const BitSet* active);
+	FncKuhnTucker(const NormalizedSystem& sys, const IntervalVector& box, const BitSet* active);
 
-	FncActiveCtrs* act;            // function of active constraints
+	// gradient of the cth constraint of the system
+	IntervalVector ctr_gradient(const IntervalVector& x, int c) const;
 
-	Function& df;                  // gradient of objective function
+	// copy the "Hessian expression" (or only its vth column) in J
+	void put_hessian(const IntervalMatrix& hessian, IntervalMatrix& J, int v) const;
 
-	Array<Function> dg;            // gradients of active (in)equalities
+	FncActiveCtrs* act;            // function of active constraints
 
 	BitSet nothing;                // for the case where nothing is active.
 };
@@ -245,12 +254,12 @@ protected:
  	 	 	 	 	 	 	 inline implementation
   ============================================================================*/
 
-inline FncKuhnTucker::FncKuhnTucker(const NormalizedSystem& sys, Function& df, Function** dg, const IntervalVector& box, const BitSet& active) :
-		FncKuhnTucker(sys,df,dg,box,&active) {
+inline FncKuhnTucker::FncKuhnTucker(const NormalizedSystem& sys, const IntervalVector& box, const BitSet& active) :
+		FncKuhnTucker(sys,box,&active) {
 }
 
-inline FncKuhnTucker::FncKuhnTucker(const NormalizedSystem& sys, Function& df, Function** dg, const IntervalVector& box) :
-		FncKuhnTucker(sys,df,dg,box,NULL) {
+inline FncKuhnTucker::FncKuhnTucker(const NormalizedSystem& sys, const IntervalVector& box) :
+		FncKuhnTucker(sys,box,NULL) {
 }
 
 inline bool FncKuhnTucker::qualified() const {
@@ -261,6 +270,10 @@ inline bool FncKuhnTucker::rejection_test(const IntervalVector& x) const {
 	return act? act->rejection_test(x) : false;
 }
 
+inline bool FncKuhnTucker::rejection_test(const IntervalVector& x, const IntervalVector& goal_gradient, const IntervalMatrix* jacobian) const {
+	return act? act->rejection_test(x, goal_gradient, jacobian) : false;
+}
+
 inline const BitSet& FncKuhnTucker::active() const      { return act? act->active_ctr : nothing; }
 
 inline const BitSet& FncKuhnTucker::eq() const          { return act? act->eq : nothing; }
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jun 12, 2012
-// Last Update : Apr 08, 2019
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_System.h"
@@ -18,27 +18,11 @@
 #include "ibex_Domain.h"
 #include "ibex_Exception.h"
 #include "ibex_String.h"
+#include "ibex_SystemCache.h"
 
 #include <stdio.h>
 #include <sstream>
 
-#ifndef _WIN32 // MinGW does not support mutex
-#include <mutex>
-namespace {
-std::mutex mtx;
-}
-#define LOCK mtx.lock()
-#define UNLOCK mtx.unlock()
-#else
-#define LOCK
-#define UNLOCK
-#endif
-
-extern int ibexparse();
-extern void ibexparse_string(const char* syntax);
-//extern int ibex_lineno;
-extern void ibexrestart(FILE *);
-extern FILE* ibexin;
 
 using namespace std;
 
@@ -83,9 +67,19 @@ System::System(const char* filename, int simpl_level) : id(next_id()), nb_var(0)
 	load(fd, simpl_level);
 }
 
+System::System(const char* filename, int simpl_level, bool cache, bool create_cache) : id(next_id()), nb_var(0), nb_ctr(0), goal(NULL), ops(NULL), box(1) /* tmp */ {
+	if (cache && SystemCache::read(*this, filename, simpl_level))
+		return;
+
+	FILE *fd;
+	if ((fd = fopen(filename, "r")) == NULL) throw UnknownFileException(filename);
+	load(fd, simpl_level);
+
+	if (cache && create_cache) SystemCache::write(*this, filename, simpl_level); // ignore failure
+}
+
 System::System(int n, const char* syntax, int simpl_level) : id(next_id()), nb_var(n), /* NOT TMP (required by parser) */
 		                                    nb_ctr(0), goal(NULL), ops(NULL), box(1) /* tmp */ {
-	LOCK;
 	try {
 		parser::pstruct = new parser::P_StructChoco(*this, simpl_level);
 		ibexparse_string(syntax);
@@ -94,10 +88,8 @@ System::System(int n, const char* syntax, int simpl_level) : id(next_id()), nb_v
 	} catch(SyntaxError& e) {
 		delete parser::pstruct;
 		parser::pstruct = NULL;
-		UNLOCK;
 		throw e;
 	}
-	UNLOCK;
 }
 
 System::System(const System& sys, copy_mode mode) : id(next_id()), nb_var(0), nb_ctr(0), goal(NULL), ops(NULL), box(1) {
@@ -221,19 +213,9 @@ void System::load(FILE* fd, int simpl_level) {
 
 	if (!fd) throw SyntaxError("Invalid file");
 
-	LOCK;
-		
-	ibexrestart(fd);
-
-	if (ibexin == fd) {
-		rewind(fd);
-	}
-
-	ibexin = fd;
-
 	try {
 		parser::pstruct = new parser::P_StructSystem(*this, simpl_level);
-		ibexparse();
+		ibexparse_file(fd);
 		delete parser::pstruct;
 		parser::pstruct = NULL;
 	}
@@ -242,13 +224,10 @@ void System::load(FILE* fd, int simpl_level) {
 		delete parser::pstruct;
 		parser::pstruct = NULL;
 		fclose(fd);
-		UNLOCK;
 		throw e;
 	}
 
 	fclose(fd);
-
-	UNLOCK;
 }
 
 System::~System() {
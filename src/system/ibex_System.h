@@ -55,6 +55,19 @@ public:
 	 */
 	System(const char* filename, int simpl_level=ExprNode::default_simpl_level);
 
+	/**
+	 * \brief Load a system from a file, through a binary cache.
+	 *
+	 * If \a cache is true and a valid cache of the file exists
+	 * (see #SystemCache), the system is loaded from the cache,
+	 * which skips parsing and symbolic simplification. Otherwise,
+	 * the file is parsed and, if \a create_cache is true, the cache
+	 * is (re)built (if possible).
+	 *
+	 * If \a cache is false, same as #System(const char*, int).
+	 */
+	System(const char* filename, int simpl_level, bool cache, bool create_cache=true);
+
 	/**
 	 * \brief Load a stand-alone conjunction of constraints
 	 * from a string.
@@ -293,6 +306,7 @@ protected:
 private:
 	friend class parser::P_SysGenerator;
 	friend class NumConstraint; // NumConstraint requires to build a temporary system for parsing a string
+	friend class SystemCache;
 
 	void load(FILE* file, int simpl_level);
 
@@ -0,0 +1,769 @@
+/* ============================================================================
+ * I B E X - Precompiled (binary) cache of a system
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_SystemCache.h"
+#include "ibex_System.h"
+#include "ibex_Expr.h"
+#include "ibex_ExprOperators.h"
+#include "ibex_SyntaxError.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include <unordered_map>
+
+#ifndef _WIN32 // no mmap under Windows
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+constexpr unsigned int SystemCache::FORMAT_VERSION;
+
+constexpr const char* SystemCache::SIGNATURE;
+
+constexpr size_t SystemCache::SIGNATURE_LENGTH;
+
+namespace {
+
+// to detect a cache written on a platform with a different endianness
+const uint32_t ENDIANNESS = 0x01020304;
+
+// FNV-1a hash
+const uint64_t FNV_OFFSET = 14695981039346656037ULL;
+const uint64_t FNV_PRIME  = 1099511628211ULL;
+
+uint64_t fnv(const char* data, size_t size, uint64_t h=FNV_OFFSET) {
+	for (size_t i=0; i<size; i++) {
+		h ^= (unsigned char) data[i];
+		h *= FNV_PRIME;
+	}
+	return h;
+}
+
+// raised when the cache is corrupted
+class InvalidCache { };
+
+/*
+ * Header of the file:
+ *
+ *   signature       (SIGNATURE_LENGTH bytes)
+ *   format version  (uint32)
+ *   endianness      (uint32)
+ *   source checksum (uint64)
+ *   simpl. level    (int32)
+ *   payload size    (uint64)
+ *   payload checksum(uint64)
+ *
+ * The payload follows.
+ */
+const size_t HEADER_SIZE = SystemCache::SIGNATURE_LENGTH + 2*sizeof(uint32_t) + sizeof(uint64_t) + sizeof(int32_t) + 2*sizeof(uint64_t);
+
+class Writer {
+public:
+	template<typename T>
+	void put(T x) {
+		buf.append((const char*) &x, sizeof(T));
+	}
+
+	void put_str(const char* s) {
+		int32_t n=s? (int32_t) strlen(s) : -1;
+		put(n);
+		if (n>0) buf.append(s, n);
+	}
+
+	void put_dim(const Dim& d) {
+		put((int32_t) d.nb_rows());
+		put((int32_t) d.nb_cols());
+	}
+
+	void put_itv(const Interval& x) {
+		if (x.is_empty()) { // written as [1,0]
+			put(1.0);
+			put(0.0);
+		} else {
+			put(x.lb());
+			put(x.ub());
+		}
+	}
+
+	void put_domain(const Domain& d) {
+		put_dim(d.dim);
+		switch (d.dim.type()) {
+		case Dim::SCALAR:     put_itv(d.i()); break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR: for (int i=0; i<d.v().size(); i++) put_itv(d.v()[i]); break;
+		case Dim::MATRIX:     for (int i=0; i<d.m().nb_rows(); i++)
+		                        for (int j=0; j<d.m().nb_cols(); j++) put_itv(d.m()[i][j]);
+		                      break;
+		}
+	}
+
+	string buf;
+};
+
+class Reader {
+public:
+	Reader(const char* p, const char* end) : p(p), end(end) { }
+
+	template<typename T>
+	T get() {
+		if (p+sizeof(T)>end) throw InvalidCache();
+		T x;
+		memcpy(&x, p, sizeof(T));
+		p+=sizeof(T);
+		return x;
+	}
+
+	// return a string allocated with malloc (or NULL)
+	char* get_str() {
+		int32_t n=get<int32_t>();
+		if (n<0) return NULL;
+		if (p+n>end) throw InvalidCache();
+		char* s=(char*) malloc(n+1);
+		memcpy(s, p, n);
+		s[n]='\0';
+		p+=n;
+		return s;
+	}
+
+	Dim get_dim() {
+		int32_t r=get<int32_t>();
+		int32_t c=get<int32_t>();
+		if (r<1 || c<1) throw InvalidCache();
+		return Dim::matrix(r,c);
+	}
+
+	Interval get_itv() {
+		double lb=get<double>();
+		double ub=get<double>();
+		return lb>ub ? Interval::empty_set() : Interval(lb,ub);
+	}
+
+	// the domain is allocated with new
+	Domain* get_domain() {
+		Domain* d=new Domain(get_dim());
+		try {
+			switch (d->dim.type()) {
+			case Dim::SCALAR:     d->i()=get_itv(); break;
+			case Dim::ROW_VECTOR:
+			case Dim::COL_VECTOR: for (int i=0; i<d->v().size(); i++) d->v()[i]=get_itv(); break;
+			case Dim::MATRIX:     for (int i=0; i<d->m().nb_rows(); i++)
+			                        for (int j=0; j<d->m().nb_cols(); j++) d->m()[i][j]=get_itv();
+			                      break;
+			}
+		} catch(InvalidCache&) {
+			delete d;
+			throw;
+		}
+		return d;
+	}
+
+	const char* p;
+	const char* end;
+};
+
+// address of the data of a domain (shared by the references to the domain)
+const void* data(const Domain& d) {
+	switch (d.dim.type()) {
+	case Dim::SCALAR:     return &d.i();
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR: return &d.v();
+	default:              return &d.m();
+	}
+}
+
+typedef unordered_map<const void*,int> MutableIndex;
+
+/*
+ * Write the arguments and the expression of a function.
+ *
+ * The nodes are written by increasing height so that the
+ * subexpressions of a node are read before the node itself.
+ * A subexpression is referred to by its position in the file.
+ */
+bool write_function(Writer& w, const Function& f, const MutableIndex& mutables) {
+	w.put_str(f.name);
+
+	w.put((int32_t) f.nb_arg());
+	for (int i=0; i<f.nb_arg(); i++) {
+		w.put_str(f.arg(i).name);
+		w.put_dim(f.arg(i).dim);
+	}
+
+	const ExprSubNodes& nodes=f.nodes;
+	int size=nodes.size();
+	w.put((int32_t) size);
+
+	// position in the file of a node
+	#define POS(e) ((int32_t) (size-1-nodes.rank(e)))
+
+	for (int i=size-1; i>=0; i--) {
+		const ExprNode& e=nodes[i];
+		ExprNode::ExprTypeId type=e.type_id();
+		w.put((int32_t) type);
+
+		switch(type) {
+		case ExprNode::NumExprSymbol:
+			w.put((int32_t) ((const ExprSymbol&) e).key);
+			break;
+		case ExprNode::NumExprConstant: {
+			const ExprConstant& c=(const ExprConstant&) e;
+			if (c.is_mutable()) {
+				MutableIndex::const_iterator it=mutables.find(data(c.get()));
+				if (it==mutables.end()) return false; // mutable constant not in the system
+				w.put((int32_t) it->second);
+			} else {
+				w.put((int32_t) -1);
+				w.put_domain(c.get());
+			}
+			break;
+		}
+		case ExprNode::NumExprIndex: {
+			const ExprIndex& idx=(const ExprIndex&) e;
+			w.put(POS(idx.expr));
+			w.put((int32_t) idx.index.first_row());
+			w.put((int32_t) idx.index.last_row());
+			w.put((int32_t) idx.index.first_col());
+			w.put((int32_t) idx.index.last_col());
+			break;
+		}
+		case ExprNode::NumExprApply:
+			return false;
+		case ExprNode::NumExprVector:
+		case ExprNode::NumExprChi: {
+			const ExprNAryOp& n=(const ExprNAryOp&) e;
+			if (type==ExprNode::NumExprVector)
+				w.put((int32_t) ((const ExprVector&) e).orient);
+			w.put((int32_t) n.nb_args);
+			for (int j=0; j<n.nb_args; j++)
+				w.put(POS(n.arg(j)));
+			break;
+		}
+		case ExprNode::NumExprGenericBinaryOp:
+		case ExprNode::NumExprAdd:
+		case ExprNode::NumExprMul:
+		case ExprNode::NumExprSub:
+		case ExprNode::NumExprDiv:
+		case ExprNode::NumExprMax:
+		case ExprNode::NumExprMin:
+		case ExprNode::NumExprAtan2: {
+			const ExprBinaryOp& b=(const ExprBinaryOp&) e;
+			if (type==ExprNode::NumExprGenericBinaryOp)
+				w.put_str(((const ExprGenericBinaryOp&) e).name);
+			w.put(POS(b.left));
+			w.put(POS(b.right));
+			break;
+		}
+		default: {
+			const ExprUnaryOp& u=(const ExprUnaryOp&) e;
+			if (type==ExprNode::NumExprGenericUnaryOp)
+				w.put_str(((const ExprGenericUnaryOp&) e).name);
+			else if (type==ExprNode::NumExprPower)
+				w.put((int32_t) ((const ExprPower&) e).expon);
+			w.put(POS(u.expr));
+		}
+		}
+	}
+	#undef POS
+	return true;
+}
+
+/*
+ * Read the arguments and the expression of a function.
+ *
+ * If x is not empty, the arguments are checked against x
+ * (instead of being created).
+ *
+ * In case of failure, everything allocated by this function
+ * (name, new arguments, nodes) is deleted and InvalidCache
+ * is raised.
+ */
+void read_function(Reader& r, const vector<Domain*>& mutables, Array<const ExprSymbol>& x, const ExprNode*& y, char*& name) {
+	bool new_args=x.is_empty();
+
+	name=NULL;
+
+	// nodes created so far
+	vector<const ExprNode*> nodes;
+
+	// delete everything created so far
+	auto cleanup = [&]() {
+		// note: the nodes are not shared with other expressions
+		// except the symbols (deleted below if created here)
+		for (vector<const ExprNode*>::iterator it=nodes.begin(); it!=nodes.end(); ++it)
+			if (!dynamic_cast<const ExprSymbol*>(*it)) delete (ExprNode*) *it;
+
+		if (new_args) {
+			for (int i=0; i<x.size(); i++)
+				delete &x[i];
+			x.clear();
+		}
+
+		free(name);
+		name=NULL;
+	};
+
+	auto read = [&]() {
+		name=r.get_str();
+
+		int nb_arg=r.get<int32_t>();
+		if (nb_arg<0 || (!new_args && nb_arg!=x.size())) throw InvalidCache();
+
+		for (int i=0; i<nb_arg; i++) {
+			char* arg_name=r.get_str();
+			Dim d;
+			try {
+				d=r.get_dim();
+			} catch(InvalidCache&) {
+				free(arg_name);
+				throw;
+			}
+			if (new_args)
+				x.add(ExprSymbol::new_(arg_name ? arg_name : "", d));
+			free(arg_name);
+			if (!new_args && x[i].dim!=d)
+				throw InvalidCache();
+		}
+
+		int size=r.get<int32_t>();
+		if (size<1) throw InvalidCache();
+
+		nodes.reserve(size);
+
+		// get the node at a given position (must have been read)
+		auto node = [&]() -> const ExprNode& {
+			int pos=r.get<int32_t>();
+			if (pos<0 || pos>=(int) nodes.size()) throw InvalidCache();
+			return *nodes[pos];
+		};
+
+		for (int current=0; current<size; current++) {
+			ExprNode::ExprTypeId type=(ExprNode::ExprTypeId) r.get<int32_t>();
+			const ExprNode* e;
+
+			switch(type) {
+			case ExprNode::NumExprSymbol: {
+				int key=r.get<int32_t>();
+				if (key<0 || key>=nb_arg) throw InvalidCache();
+				e=&x[key];
+				break;
+			}
+			case ExprNode::NumExprConstant: {
+				int m=r.get<int32_t>();
+				if (m>=(int) mutables.size()) throw InvalidCache();
+				if (m>=0)
+					e=&ExprConstant::new_mutable(*mutables[m]);
+				else {
+					Domain* d=r.get_domain();
+					e=&ExprConstant::new_(*d);
+					delete d;
+				}
+				break;
+			}
+			case ExprNode::NumExprIndex: {
+				const ExprNode& sub=node();
+				int i1=r.get<int32_t>();
+				int i2=r.get<int32_t>();
+				int j1=r.get<int32_t>();
+				int j2=r.get<int32_t>();
+				if (i1<0 || i1>i2 || i2>=sub.dim.nb_rows() || j1<0 || j1>j2 || j2>=sub.dim.nb_cols()) throw InvalidCache();
+				e=&ExprIndex::new_(sub, DoubleIndex(sub.dim,i1,i2,j1,j2));
+				break;
+			}
+			case ExprNode::NumExprVector:
+			case ExprNode::NumExprChi: {
+				int orient = type==ExprNode::NumExprVector ? r.get<int32_t>() : 0;
+				int n=r.get<int32_t>();
+				if (n<1 || (type==ExprNode::NumExprChi && n!=3)) throw InvalidCache();
+				Array<const ExprNode> args(n);
+				for (int j=0; j<n; j++)
+					args.set_ref(j,node());
+				if (type==ExprNode::NumExprVector)
+					e=&ExprVector::new_(args, orient==ExprVector::ROW ? ExprVector::ROW : ExprVector::COL);
+				else
+					e=&ExprChi::new_(args);
+				break;
+			}
+			case ExprNode::NumExprGenericBinaryOp: {
+				char* op=r.get_str();
+				if (!op) throw InvalidCache();
+				try {
+					const ExprNode& l=node();
+					const ExprNode& r2=node();
+					e=&ExprGenericBinaryOp::new_(op,l,r2);
+				} catch(...) {
+					free(op);
+					throw;
+				}
+				free(op);
+				break;
+			}
+			case ExprNode::NumExprAdd:   { const ExprNode& l=node(); e=&ExprAdd::new_(l,node());   break; }
+			case ExprNode::NumExprMul:   { const ExprNode& l=node(); e=&ExprMul::new_(l,node());   break; }
+			case ExprNode::NumExprSub:   { const ExprNode& l=node(); e=&ExprSub::new_(l,node());   break; }
+			case ExprNode::NumExprDiv:   { const ExprNode& l=node(); e=&ExprDiv::new_(l,node());   break; }
+			case ExprNode::NumExprMax:   { const ExprNode& l=node(); e=&ExprMax::new_(l,node());   break; }
+			case ExprNode::NumExprMin:   { const ExprNode& l=node(); e=&ExprMin::new_(l,node());   break; }
+			case ExprNode::NumExprAtan2: { const ExprNode& l=node(); e=&ExprAtan2::new_(l,node()); break; }
+			case ExprNode::NumExprGenericUnaryOp: {
+				char* op=r.get_str();
+				if (!op) throw InvalidCache();
+				try {
+					e=&ExprGenericUnaryOp::new_(op,node());
+				} catch(...) {
+					free(op);
+					throw;
+				}
+				free(op);
+				break;
+			}
+			case ExprNode::NumExprPower: {
+				int expon=r.get<int32_t>();
+				e=&ExprPower::new_(node(),expon);
+				break;
+			}
+			case ExprNode::NumExprMinus: e=&ExprMinus::new_(node()); break;
+			case ExprNode::NumExprTrans: e=&ExprTrans::new_(node()); break;
+			case ExprNode::NumExprSign:  e=&ExprSign::new_(node());  break;
+			case ExprNode::NumExprAbs:   e=&ExprAbs::new_(node());   break;
+			case ExprNode::NumExprSqr:   e=&ExprSqr::new_(node());   break;
+			case ExprNode::NumExprSqrt:  e=&ExprSqrt::new_(node());  break;
+			case ExprNode::NumExprExp:   e=&ExprExp::new_(node());   break;
+			case ExprNode::NumExprLog:   e=&ExprLog::new_(node());   break;
+			case ExprNode::NumExprCos:   e=&ExprCos::new_(node());   break;
+			case ExprNode::NumExprSin:   e=&ExprSin::new_(node());   break;
+			case ExprNode::NumExprTan:   e=&ExprTan::new_(node());   break;
+			case ExprNode::NumExprCosh:  e=&ExprCosh::new_(node());  break;
+			case ExprNode::NumExprSinh:  e=&ExprSinh::new_(node());  break;
+			case ExprNode::NumExprTanh:  e=&ExprTanh::new_(node());  break;
+			case ExprNode::NumExprAcos:  e=&ExprAcos::new_(node());  break;
+			case ExprNode::NumExprAsin:  e=&ExprAsin::new_(node());  break;
+			case ExprNode::NumExprAtan:  e=&ExprAtan::new_(node());  break;
+			case ExprNode::NumExprAcosh: e=&ExprAcosh::new_(node()); break;
+			case ExprNode::NumExprAsinh: e=&ExprAsinh::new_(node()); break;
+			case ExprNode::NumExprAtanh: e=&ExprAtanh::new_(node()); break;
+			case ExprNode::NumExprFloor: e=&ExprFloor::new_(node()); break;
+			case ExprNode::NumExprCeil:  e=&ExprCeil::new_(node());  break;
+			case ExprNode::NumExprSaw:   e=&ExprSaw::new_(node());   break;
+			default: throw InvalidCache(); // including ExprApply
+			}
+			nodes.push_back(e);
+		}
+	};
+
+	try {
+		read();
+	} catch(InvalidCache&) {
+		cleanup();
+		throw;
+	} catch(SyntaxError&) { // unknown generic operator
+		cleanup();
+		throw InvalidCache();
+	} catch(DimException&) { // inconsistent dimensions
+		cleanup();
+		throw InvalidCache();
+	}
+
+	y=nodes.back();
+}
+
+#ifdef _WIN32
+// read a whole file (when mmap is not available)
+bool read_file(const char* filename, string& content) {
+	FILE* fd=fopen(filename, "rb");
+	if (!fd) return false;
+	char buf[65536];
+	size_t n;
+	while ((n=fread(buf, 1, sizeof(buf), fd))>0)
+		content.append(buf, n);
+	bool ok=!ferror(fd);
+	fclose(fd);
+	return ok;
+}
+#endif
+
+} // end anonymous namespace
+
+string SystemCache::filename(const char* source) {
+	return string(source)+".cache";
+}
+
+bool SystemCache::checksum(const char* filename, uint64_t& sum) {
+	FILE* fd=fopen(filename, "rb");
+	if (!fd) return false;
+	sum=FNV_OFFSET;
+	char buf[65536];
+	size_t n;
+	while ((n=fread(buf, 1, sizeof(buf), fd))>0)
+		sum=fnv(buf, n, sum);
+	bool ok=!ferror(fd);
+	fclose(fd);
+	return ok;
+}
+
+bool SystemCache::write(const System& sys, const char* source, int simpl_level, const char* cache) {
+
+	uint64_t source_sum;
+	if (!checksum(source, source_sum)) return false;
+
+	Writer w;
+
+	w.put((int32_t) sys.nb_var);
+	w.put((int32_t) sys.nb_ctr);
+
+	// =========== mutable constants ==============
+	SymbolMap<Domain*>& constants=((System&) sys).mutable_constants;
+	MutableIndex mutables;
+	w.put((int32_t) constants.size());
+	for (IBEXMAP(Domain*)::iterator it=constants.begin(); it!=constants.end(); ++it) {
+		mutables.insert(make_pair(data(*it->second), (int) mutables.size()));
+		w.put_str(it->first);
+		w.put_domain(*it->second);
+	}
+
+	// =========== variables and domains ==============
+	w.put((int32_t) sys.args.size());
+	for (int i=0; i<sys.args.size(); i++) {
+		w.put_str(sys.args[i].name);
+		w.put_dim(sys.args[i].dim);
+	}
+	for (int i=0; i<sys.nb_var; i++)
+		w.put_itv(sys.box[i]);
+
+	// =========== goal ==============
+	w.put((int32_t) (sys.goal!=NULL));
+	if (sys.goal && !write_function(w, *sys.goal, mutables)) return false;
+
+	// =========== constraints ==============
+	for (int i=0; i<sys.nb_ctr; i++) {
+		w.put((int32_t) sys.ctrs[i].op);
+		if (!write_function(w, sys.ctrs[i].f, mutables)) return false;
+	}
+
+	// =========== main function ==============
+	if (sys.nb_ctr>0) {
+		if (!write_function(w, sys.f_ctrs, mutables)) return false;
+		w.put((int32_t) sys.f_ctrs.image_dim());
+		for (int i=0; i<sys.f_ctrs.image_dim(); i++)
+			w.put((int32_t) sys.ops[i]);
+	}
+
+	Writer header;
+	header.buf.append(SIGNATURE, SIGNATURE_LENGTH);
+	header.put((uint32_t) FORMAT_VERSION);
+	header.put(ENDIANNESS);
+	header.put(source_sum);
+	header.put((int32_t) simpl_level);
+	header.put((uint64_t) w.buf.size());
+	header.put(fnv(w.buf.data(), w.buf.size()));
+	assert(header.buf.size()==HEADER_SIZE);
+
+	// Write in a temporary file first and rename it, so that a
+	// process (or a thread) never reads a partially written cache.
+	string cache_file = cache ? string(cache) : filename(source);
+	string tmp_file = cache_file+".tmp";
+
+	FILE* fd=fopen(tmp_file.c_str(), "wb");
+	if (!fd) return false;
+	bool ok = fwrite(header.buf.data(), 1, header.buf.size(), fd)==header.buf.size()
+	       && fwrite(w.buf.data(), 1, w.buf.size(), fd)==w.buf.size();
+	ok &= fclose(fd)==0;
+
+#ifdef _WIN32
+	if (ok) remove(cache_file.c_str()); // rename fails if the file exists
+#endif
+	ok = ok && rename(tmp_file.c_str(), cache_file.c_str())==0;
+	if (!ok) remove(tmp_file.c_str());
+	return ok;
+}
+
+bool SystemCache::read(System& sys, const char* source, int simpl_level, const char* cache) {
+
+	string cache_file = cache ? string(cache) : filename(source);
+
+	// =========== map the file in memory ==============
+#ifndef _WIN32
+	int fd=open(cache_file.c_str(), O_RDONLY);
+	if (fd==-1) return false;
+	struct stat st;
+	if (fstat(fd, &st)==-1 || (size_t) st.st_size<HEADER_SIZE) {
+		close(fd);
+		return false;
+	}
+	size_t size=(size_t) st.st_size;
+	void* addr=mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (addr==MAP_FAILED) return false;
+	const char* begin=(const char*) addr;
+#else
+	string content;
+	if (!read_file(cache_file.c_str(), content) || content.size()<HEADER_SIZE) return false;
+	size_t size=content.size();
+	const char* begin=content.data();
+#endif
+
+	bool ok=false;
+	Reader r(begin, begin+size);
+
+	// the system read from the cache (see below)
+	int nb_var, nb_ctr;
+	vector<Domain*> mutables;
+	vector<string> mutable_names;
+	Array<const ExprSymbol> args;
+	vector<Interval> box;
+	Function* goal=NULL;
+	vector<NumConstraint*> ctrs;
+	const ExprNode* f_ctrs=NULL;
+	char* f_ctrs_name=NULL;
+	vector<CmpOp> ops;
+
+	try {
+		// =========== check the header ==============
+		if (strncmp(begin, SIGNATURE, SIGNATURE_LENGTH)!=0) throw InvalidCache();
+		r.p+=SIGNATURE_LENGTH;
+		if (r.get<uint32_t>()!=FORMAT_VERSION) throw InvalidCache();
+		if (r.get<uint32_t>()!=ENDIANNESS) throw InvalidCache();
+		uint64_t sum=r.get<uint64_t>();
+		if (r.get<int32_t>()!=simpl_level) throw InvalidCache();
+		uint64_t payload_size=r.get<uint64_t>();
+		uint64_t payload_sum=r.get<uint64_t>();
+		if (payload_size!=size-HEADER_SIZE) throw InvalidCache();
+		if (fnv(r.p, payload_size)!=payload_sum) throw InvalidCache();
+
+		uint64_t source_sum;
+		if (!checksum(source, source_sum) || source_sum!=sum) throw InvalidCache();
+
+		// From now on, the content is the one written by write(...):
+		// a failure is not expected anymore. Still, everything is
+		// first read in temporaries and sys is only modified at the
+		// end, so that sys is left uninitialized in case of failure.
+
+		nb_var=r.get<int32_t>();
+		nb_ctr=r.get<int32_t>();
+		if (nb_var<0 || nb_ctr<0) throw InvalidCache();
+
+		// =========== mutable constants ==============
+		int nb_cst=r.get<int32_t>();
+		for (int i=0; i<nb_cst; i++) {
+			char* name=r.get_str();
+			if (!name) throw InvalidCache();
+			string _name(name);
+			free(name);
+			for (vector<string>::iterator it=mutable_names.begin(); it!=mutable_names.end(); ++it)
+				if (*it==_name) throw InvalidCache();
+			mutables.push_back(r.get_domain());
+			mutable_names.push_back(_name);
+		}
+
+		// =========== variables and domains ==============
+		int nb_arg=r.get<int32_t>();
+		for (int i=0; i<nb_arg; i++) {
+			char* name=r.get_str();
+			Dim d;
+			try {
+				d=r.get_dim();
+			} catch(InvalidCache&) {
+				free(name);
+				throw;
+			}
+			args.add(ExprSymbol::new_(name ? name : "", d));
+			free(name);
+		}
+		for (int i=0; i<nb_var; i++)
+			box.push_back(r.get_itv());
+
+		// =========== goal ==============
+		if (r.get<int32_t>()) {
+			Array<const ExprSymbol> x;
+			const ExprNode* y;
+			char* name;
+			read_function(r, mutables, x, y, name);
+			goal = new Function(x, *y, name);
+			free(name);
+		}
+
+		// =========== constraints ==============
+		for (int i=0; i<nb_ctr; i++) {
+			CmpOp op=(CmpOp) r.get<int32_t>();
+			Array<const ExprSymbol> x;
+			const ExprNode* y;
+			char* name;
+			read_function(r, mutables, x, y, name);
+			ctrs.push_back(new NumConstraint(*new Function(x, *y, name), op, true));
+			free(name);
+		}
+
+		// =========== main function ==============
+		if (nb_ctr>0) {
+			read_function(r, mutables, args, f_ctrs, f_ctrs_name);
+			int m=r.get<int32_t>();
+			if (m!=f_ctrs->dim.size()) throw InvalidCache();
+			for (int i=0; i<m; i++)
+				ops.push_back((CmpOp) r.get<int32_t>());
+		}
+
+		ok=true;
+
+	} catch(InvalidCache&) {
+		if (f_ctrs) cleanup(Array<const ExprNode>(*f_ctrs), false);
+		free(f_ctrs_name);
+		for (vector<NumConstraint*>::iterator it=ctrs.begin(); it!=ctrs.end(); ++it)
+			delete *it;
+		if (goal) delete goal;
+		for (int i=0; i<args.size(); i++)
+			delete &args[i];
+		for (vector<Domain*>::iterator it=mutables.begin(); it!=mutables.end(); ++it)
+			delete *it;
+	}
+
+	if (ok) {
+		// =========== commit ==============
+		for (size_t i=0; i<mutables.size(); i++)
+			sys.mutable_constants.insert_new(mutable_names[i].c_str(), mutables[i]);
+
+		sys.args.resize(args.size());
+		for (int i=0; i<args.size(); i++)
+			sys.args.set_ref(i, args[i]);
+
+		(int&) sys.nb_var = nb_var;
+		(int&) sys.nb_ctr = nb_ctr;
+		sys.box.resize(nb_var);
+		for (int i=0; i<nb_var; i++)
+			sys.box[i]=box[i];
+
+		sys.goal = goal;
+
+		sys.ctrs.resize(nb_ctr);
+		for (int i=0; i<nb_ctr; i++)
+			sys.ctrs.set_ref(i, *ctrs[i]);
+
+		if (nb_ctr>0) {
+			sys.f_ctrs.init(sys.args, *f_ctrs, f_ctrs_name);
+			free(f_ctrs_name);
+			sys.ops = new CmpOp[ops.size()];
+			for (size_t i=0; i<ops.size(); i++)
+				sys.ops[i]=ops[i];
+		}
+	}
+
+#ifndef _WIN32
+	munmap(addr, size);
+#endif
+	return ok;
+}
+
+} // end namespace ibex
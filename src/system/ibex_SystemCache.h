@@ -0,0 +1,108 @@
+/* ============================================================================
+ * I B E X - Precompiled (binary) cache of a system
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_SYSTEM_CACHE_H__
+#define __IBEX_SYSTEM_CACHE_H__
+
+#include <string>
+#include <stdint.h>
+
+namespace ibex {
+
+class System;
+
+/**
+ * \ingroup system
+ *
+ * \brief Precompiled (binary) cache of a system.
+ *
+ * Loading a system from a Minibex file requires parsing, symbolic
+ * simplification and DAG construction. For large models, this takes
+ * a significant time at every start of a program. This class stores
+ * a binary snapshot of a fully built system (variables, domains, mutable
+ * constants, goal, constraints and the DAG of the main function) in a
+ * file, from which the system can be rebuilt directly: the expressions are
+ * recreated node by node, without parsing nor simplification. Only the
+ * compilation of the functions (linear in the size of the expressions)
+ * is performed again.
+ *
+ * The cache is tied to the source file by a checksum of its content
+ * and to the simplification level used for building the system. It is
+ * ignored if the checksum, the simplification level or the format version
+ * (#FORMAT_VERSION) do not match. The file is read with mmap (except
+ * under Windows).
+ *
+ * Expressions with calls to external functions (#ExprApply) are not
+ * supported (no cache is written in this case).
+ *
+ * \see #System(const char*, int, bool).
+ */
+class SystemCache {
+public:
+	/**
+	 * \brief Version of the format.
+	 */
+	static constexpr unsigned int FORMAT_VERSION = 1;
+
+	/**
+	 * \brief Signature at the beginning of a cache file.
+	 */
+	static constexpr const char* SIGNATURE = "IBEX-SYS";
+
+	/**
+	 * \brief Length of the signature.
+	 */
+	static constexpr size_t SIGNATURE_LENGTH = 8;
+
+	/**
+	 * \brief Name of the cache file of a source file.
+	 *
+	 * The source file name followed by ".cache".
+	 */
+	static std::string filename(const char* source);
+
+	/**
+	 * \brief Checksum of the content of a file.
+	 *
+	 * \return false if the file cannot be read.
+	 */
+	static bool checksum(const char* filename, uint64_t& sum);
+
+	/**
+	 * \brief Write the cache of a system.
+	 *
+	 * \param sys         - the system, built from the source file
+	 * \param source      - the source (Minibex) file
+	 * \param simpl_level - the simplification level used for building sys
+	 * \param cache       - the cache file. By default, see #filename(const char*).
+	 *
+	 * \return false if the cache cannot be written (unsupported
+	 *         expression or file that cannot be created).
+	 */
+	static bool write(const System& sys, const char* source, int simpl_level, const char* cache=NULL);
+
+	/**
+	 * \brief Load a system from the cache.
+	 *
+	 * \param sys         - an uninitialized system (see #System::System())
+	 * \param source      - the source (Minibex) file
+	 * \param simpl_level - the expected simplification level
+	 * \param cache       - the cache file. By default, see #filename(const char*).
+	 *
+	 * \return false if there is no valid cache for the source file
+	 *         (in which case sys is left uninitialized).
+	 */
+	static bool read(System& sys, const char* source, int simpl_level, const char* cache=NULL);
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_SYSTEM_CACHE_H__
@@ -11,23 +11,90 @@
 
 #include "ibex_DirectedHyperGraph.h"
 #include <iterator>
+#include <algorithm>
+
+using namespace std;
 
 namespace ibex {
 
-std::ostream& operator<<(std::ostream& os, const DirectedHyperGraph& g) {
+namespace {
+
+/*
+ * Build the adjacency lists of both sides of a bipartite graph
+ * from its arcs (ctr,var), in CSR format.
+ *
+ * Duplicated arcs are removed. Since the arcs are sorted, each list
+ * is sorted as well.
+ */
+void build_csr(int m, int n, vector<pair<int,int> >& arcs,
+		int*& ctr_start, int*& ctr_adj, int*& var_start, int*& var_adj) {
+
+	sort(arcs.begin(), arcs.end());
+	arcs.erase(unique(arcs.begin(), arcs.end()), arcs.end());
+
+	int nb_arcs=(int) arcs.size();
+
+	ctr_start = new int[m+1];
+	var_start = new int[n+1];
+	ctr_adj   = new int[nb_arcs];
+	var_adj   = new int[nb_arcs];
+
+	for (int i=0; i<=m; i++) ctr_start[i]=0;
+	for (int j=0; j<=n; j++) var_start[j]=0;
+
+	// count
+	for (int k=0; k<nb_arcs; k++) {
+		assert(arcs[k].first>=0 && arcs[k].first<m);
+		assert(arcs[k].second>=0 && arcs[k].second<n);
+		ctr_start[arcs[k].first+1]++;
+		var_start[arcs[k].second+1]++;
+	}
+
+	// prefix sums
+	for (int i=0; i<m; i++) ctr_start[i+1]+=ctr_start[i];
+	for (int j=0; j<n; j++) var_start[j+1]+=var_start[j];
+
+	// fill (arcs are sorted by constraint, so each
+	// list of constraints is filled in increasing order)
+	int* var_pos = new int[n];
+	for (int j=0; j<n; j++) var_pos[j]=var_start[j];
+
+	for (int k=0; k<nb_arcs; k++) {
+		ctr_adj[k]=arcs[k].second;
+		var_adj[var_pos[arcs[k].second]++]=arcs[k].first;
+	}
+
+	delete[] var_pos;
+
+	arcs.clear();
+	vector<pair<int,int> >().swap(arcs); // release memory
+}
+
+}
+
+void DirectedHyperGraph::freeze() {
+	if (_frozen) return;
+
+	build_csr(m, n, input_arcs, ctr_input_start, ctr_input_adj, var_output_start, var_output_adj);
+	build_csr(m, n, output_arcs, ctr_output_start, ctr_output_adj, var_input_start, var_input_adj);
+
+	_frozen=true;
+}
+
+ostream& operator<<(ostream& os, const DirectedHyperGraph& g) {
 	for (int c=0; c<g.m; c++) {
 		os << "ctr " << c << " input=( ";
-		copy(g.input_vars(c).begin(), g.input_vars(c).end(), std::ostream_iterator<int>(os, " "));
+		copy(g.input_vars(c).begin(), g.input_vars(c).end(), ostream_iterator<int>(os, " "));
 		os << ") output=( ";
-		copy(g.output_vars(c).begin(), g.output_vars(c).end(), std::ostream_iterator<int>(os, " "));
+		copy(g.output_vars(c).begin(), g.output_vars(c).end(), ostream_iterator<int>(os, " "));
 		os << ")\n";
 	}
 
 	for (int v=0; v<g.n; v++) {
 		os << "var " << v << " input=( ";
-		copy(g.input_ctrs(v).begin(), g.input_ctrs(v).end(), std::ostream_iterator<int>(os, " "));
+		copy(g.input_ctrs(v).begin(), g.input_ctrs(v).end(), ostream_iterator<int>(os, " "));
 		os << ") output=( ";
-		copy(g.output_ctrs(v).begin(), g.output_ctrs(v).end(), std::ostream_iterator<int>(os, " "));
+		copy(g.output_ctrs(v).begin(), g.output_ctrs(v).end(), ostream_iterator<int>(os, " "));
 		os << ")\n";
 	}
 	return os;
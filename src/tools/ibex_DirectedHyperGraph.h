@@ -13,7 +13,9 @@
 #define __IBEX_DIRECTED_HYPER_GRAPH_H__
 
 #include <iostream>
-#include <set>
+#include <vector>
+#include <utility>
+#include <cassert>
 
 namespace ibex {
 
@@ -21,16 +23,53 @@ namespace ibex {
  * \ingroup tools
  * \brief Directed hyper-graph.
  *
+ * The graph is built in two phases. Arcs are first added with
+ * #add_arc(int, int, bool). The graph is then frozen with #freeze():
+ * the adjacency lists are compacted into arrays (compressed sparse
+ * row format) so that the traversal of the graph, as in a propagation
+ * loop, makes no memory allocation. The adjacency lists are sorted
+ * in increasing order.
+ *
  */
 class DirectedHyperGraph {
 public:
+	/**
+	 * \brief A list of adjacent vertices (variables or constraints).
+	 *
+	 * Points to the internal arrays of the graph (no copy). Can be
+	 * traversed with a range-based for loop.
+	 */
+	class Adj {
+	public:
+		/** \brief First element. */
+		const int* begin() const { return first; }
+
+		/** \brief Past-the-end element. */
+		const int* end() const { return last; }
+
+		/** \brief Number of elements. */
+		int size() const { return (int) (last-first); }
+
+		/** \brief True if the list is empty. */
+		bool empty() const { return first==last; }
+
+		/** \brief The ith element. */
+		int operator[](int i) const { return first[i]; }
+
+	private:
+		friend class DirectedHyperGraph;
+		Adj(const int* first, const int* last) : first(first), last(last) { }
+		const int* first;
+		const int* last;
+	};
+
 	/**
 	 * \brief Build a new directed hyper-graph.
 	 *
 	 */
 	DirectedHyperGraph(int nb_ctr, int nb_var);
 
-		/**
+	/**
 	 * \brief Delete the graph.
 	 */
 	~DirectedHyperGraph();
@@ -51,34 +90,50 @@ public:
 	 * \param incoming True iff \a var is an incoming variable
 	 * (the arc is var->ctr). Otherwise, \a var is outgoing (the
 	 * arc is var<-ctr).
+	 *
+	 * \pre the graph is not frozen.
 	 */
 	void add_arc(int ctr, int var, bool incoming);
 
+	/**
+	 * \brief Build the adjacency lists.
+	 *
+	 * No arc can be added afterwards.
+	 */
+	void freeze();
+
+	/**
+	 * \brief True if the graph is frozen.
+	 */
+	bool frozen() const;
+
 	/**
 	 * \brief Return the input variables of a constraint \a ctr.
 	 *
+	 *  \pre the graph is frozen.
 	 */
-	 const std::set<int>& input_vars(int ctr) const;
+	 Adj input_vars(int ctr) const;
 
 	/**
 	 * \brief Return the output variables of a constraint \a ctr.
 	 *
+	 *  \pre the graph is frozen.
 	 */
-	 const std::set<int>& output_vars(int ctr) const;
+	 Adj output_vars(int ctr) const;
 
 	/**
 	 * \brief Return the input constraints of a variable \a var.
 	 *
-	 *  \pre 0 <= \a var < #nb_var().
+	 *  \pre 0 <= \a var < #nb_var(). <br> The graph is frozen.
 	 */
-	 const std::set<int>& input_ctrs(int var) const;
+	 Adj input_ctrs(int var) const;
 
 	/**
 	 * \brief Return the output constraints of a variable \a var.
 	 *
-	 *  \pre 0 <= \a var < #nb_var().
+	 *  \pre 0 <= \a var < #nb_var(). <br> The graph is frozen.
 	 */
-	 const std::set<int>& output_ctrs(int var) const;
+	 Adj output_ctrs(int var) const;
 
 	/**
 	 * \brief Display the internal structure (matrix & tables).
@@ -92,26 +147,39 @@ private:
 
 	const int m;
 	const int n;
-	std::set<int> *ctr_input_adj;
-	std::set<int> *ctr_output_adj;
-	std::set<int> *var_input_adj;
-	std::set<int> *var_output_adj;
+
+	// arcs (ctr,var) added so far (cleared by freeze)
+	std::vector<std::pair<int,int> > input_arcs;
+	std::vector<std::pair<int,int> > output_arcs;
+
+	bool _frozen;
+
+	// adjacency lists in CSR format: the list of the ith
+	// constraint (resp. variable) is xxx_adj[xxx_start[i]...xxx_start[i+1]-1]
+	int *ctr_input_start,  *ctr_input_adj;
+	int *ctr_output_start, *ctr_output_adj;
+	int *var_input_start,  *var_input_adj;
+	int *var_output_start, *var_output_adj;
 };
 
 
 /*================================== inline implementations ========================================*/
 
-inline DirectedHyperGraph::DirectedHyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var) {
-	ctr_input_adj = new std::set<int>[m];
-	ctr_output_adj = new std::set<int>[m];
-	var_input_adj = new std::set<int>[n];
-	var_output_adj = new std::set<int>[n];
+inline DirectedHyperGraph::DirectedHyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var), _frozen(false),
+		ctr_input_start(NULL),  ctr_input_adj(NULL),
+		ctr_output_start(NULL), ctr_output_adj(NULL),
+		var_input_start(NULL),  var_input_adj(NULL),
+		var_output_start(NULL), var_output_adj(NULL) {
 }
 
 inline DirectedHyperGraph::~DirectedHyperGraph() {
+	delete[] ctr_input_start;
 	delete[] ctr_input_adj;
+	delete[] ctr_output_start;
 	delete[] ctr_output_adj;
+	delete[] var_input_start;
 	delete[] var_input_adj;
+	delete[] var_output_start;
 	delete[] var_output_adj;
 }
 
@@ -124,29 +192,35 @@ inline int DirectedHyperGraph::nb_var() const {
 }
 
 inline void DirectedHyperGraph::add_arc(int ctr, int var, bool incoming) {
-	if (incoming) {
-		ctr_input_adj[ctr].insert(var);
-		var_output_adj[var].insert(ctr);
-	} else {
-		ctr_output_adj[ctr].insert(var);
-		var_input_adj[var].insert(ctr);
-	}
+	assert(!_frozen);
+	if (incoming)
+		input_arcs.push_back(std::make_pair(ctr,var));
+	else
+		output_arcs.push_back(std::make_pair(ctr,var));
+}
+
+inline bool DirectedHyperGraph::frozen() const {
+	return _frozen;
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_vars(int ctr) const {
-	return ctr_input_adj[ctr];
+inline DirectedHyperGraph::Adj DirectedHyperGraph::input_vars(int ctr) const {
+	assert(_frozen);
+	return Adj(ctr_input_adj+ctr_input_start[ctr], ctr_input_adj+ctr_input_start[ctr+1]);
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_vars(int ctr) const {
-	return ctr_output_adj[ctr];
+inline DirectedHyperGraph::Adj DirectedHyperGraph::output_vars(int ctr) const {
+	assert(_frozen);
+	return Adj(ctr_output_adj+ctr_output_start[ctr], ctr_output_adj+ctr_output_start[ctr+1]);
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_ctrs(int var) const {
-	return var_input_adj[var];
+inline DirectedHyperGraph::Adj DirectedHyperGraph::input_ctrs(int var) const {
+	assert(_frozen);
+	return Adj(var_input_adj+var_input_start[var], var_input_adj+var_input_start[var+1]);
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_ctrs(int var) const {
-	return var_output_adj[var];
+inline DirectedHyperGraph::Adj DirectedHyperGraph::output_ctrs(int var) const {
+	assert(_frozen);
+	return Adj(var_output_adj+var_output_start[var], var_output_adj+var_output_start[var+1]);
 }
 
 } // namespace ibex
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Sep 12, 2014
-// Last Update : Dec 25, 2017
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_DOUBLE_HEAP_H__
@@ -145,26 +145,20 @@ protected:
 	mutable int current_heap_id;
 
 	/**
-	 * Used in the contract function by recursivity
-	 *
-	 * \param heap: the new heap1 under construction (will
-	 *        eventually replace the current heap1).
+	 * The data of each element (the elements in the heaps
+	 * are identifiers, i.e., indices in this array).
 	 */
-	void contract_rec(double new_loup, HeapNode<T>* node, SharedHeap<T>& heap, bool percolate);
+	std::vector<T*> data;
+
+	/** The identifiers of removed elements (that can be reused) */
+	std::vector<unsigned int> free_elts;
 
 private:
-	/**
-	 * Erase all the subnodes of node (including itself) in the first heap
-	 * and manage the impact on the second heap.
-	 * If "percolate" is true, the second heap is left in a correct state.
-	 * Otherwise, the second heap has a binary tree structure but not sorted
-	 * anymore. Therefore, "sort" should be called on the second heap.
-	 *
-	 * So the heap structure is maintained for the second heap
-	 * but not the first one. The reason is that this function is called
-	 * either by "contract" or "flush". "contract" will build a new heap from scratch.
-	 */
-	void erase_subnodes(HeapNode<T>* node, bool percolate);
+	/** Create a new element (return its identifier). */
+	unsigned int new_elt(T* d);
+
+	/** Free an element (return its data). */
+	T* free_elt(unsigned int elt);
 
 	std::ostream& print(std::ostream& os) const;
 };
@@ -177,19 +171,22 @@ DoubleHeap<T>::DoubleHeap(CostFunc<T>& cost1, bool update_cost1_when_sorting, Co
 		 nb_nodes(0), heap1(new SharedHeap<T>(cost1,update_cost1_when_sorting,0)),
 		              heap2(new SharedHeap<T>(cost2,update_cost2_when_sorting,1)),
 		              critpr(critpr), current_heap_id(0) {
-
+	heap1->data = &data;
+	heap2->data = &data;
 }
 
 template<class T>
 DoubleHeap<T>::DoubleHeap(const DoubleHeap &dhcp, bool deep_copy) :
-nb_nodes(dhcp.nb_nodes), heap1(NULL), heap2(NULL), critpr(dhcp.critpr), current_heap_id(dhcp.current_heap_id) {
-	heap1 = new SharedHeap<T>(*dhcp.heap1, 2, deep_copy);
-	std::vector<HeapElt<T>*> p = heap1->elt();
-	heap2 = new SharedHeap<T>(dhcp.heap2->costf, dhcp.heap2->update_cost_when_sorting, dhcp.heap2->heap_id);
-
-	while(!p.empty()) {
-		heap2->push_elt(p.back());
-		p.pop_back();
+nb_nodes(dhcp.nb_nodes), heap1(new SharedHeap<T>(*dhcp.heap1)), heap2(new SharedHeap<T>(*dhcp.heap2)),
+critpr(dhcp.critpr), current_heap_id(dhcp.current_heap_id), data(dhcp.data), free_elts(dhcp.free_elts) {
+
+	// the heaps have the same structure (same identifiers at the same positions)
+	heap1->data = &data;
+	heap2->data = &data;
+
+	if (deep_copy) {
+		for (typename std::vector<T*>::iterator it=data.begin(); it!=data.end(); ++it)
+			if (*it) *it = new T(**it);
 	}
 }
 
@@ -203,22 +200,41 @@ DoubleHeap<T>::~DoubleHeap() {
 
 template<class T>
 void DoubleHeap<T>::flush() {
-	if (nb_nodes>0) {
-		heap1->clear(SharedHeap<T>::NODE);
-		heap2->clear(SharedHeap<T>::NODE_ELT_DATA);
-		nb_nodes=0;
-	}
+	for (typename std::vector<T*>::iterator it=data.begin(); it!=data.end(); ++it)
+		if (*it) delete *it;
+	clear();
 }
 
 template<class T>
 void DoubleHeap<T>::clear() {
-	if (nb_nodes>0) {
-		heap1->clear(SharedHeap<T>::NODE);
-		heap2->clear(SharedHeap<T>::NODE_ELT);
-		nb_nodes=0;
+	heap1->clear();
+	heap2->clear();
+	data.clear();
+	free_elts.clear();
+	nb_nodes=0;
+}
+
+template<class T>
+inline unsigned int DoubleHeap<T>::new_elt(T* d) {
+	if (free_elts.empty()) {
+		data.push_back(d);
+		return data.size()-1;
+	} else {
+		unsigned int elt=free_elts.back();
+		free_elts.pop_back();
+		data[elt]=d;
+		return elt;
 	}
 }
 
+template<class T>
+inline T* DoubleHeap<T>::free_elt(unsigned int elt) {
+	T* d=data[elt];
+	data[elt]=NULL;
+	free_elts.push_back(elt);
+	return d;
+}
+
 template<class T>
 unsigned int DoubleHeap<T>::size() const {
 	assert(heap1->size()==heap2->size());
@@ -230,60 +246,43 @@ void DoubleHeap<T>::contract(double new_loup1) {
 
 	if (nb_nodes==0) return;
 
-	SharedHeap<T>* copy1 = new SharedHeap<T>(heap1->costf, heap1->update_cost_when_sorting, 0);
+	// The costs are assumed to be up-to-date for the 1st heap.
+	// The nodes to be removed are first marked in both heaps
+	// and then removed in one pass (this is faster than removing
+	// nodes one by one, even if the heaps have to be rebuilt).
+	std::vector<bool> removed1(heap1->size(),false);
+	std::vector<bool> removed2(heap2? heap2->size() : 0,false);
+	bool removed=false;
+
+	for (unsigned int i=0; i<heap1->size(); i++) {
+		if (heap1->nodes[i].crit > new_loup1) {
+			unsigned int elt=heap1->nodes[i].elt;
+			removed1[i]=true;
+			if (heap2) removed2[heap2->pos[elt]]=true;
+			delete free_elt(elt);
+			removed=true;
+		}
+	}
 
-	contract_rec(new_loup1, heap1->root, *copy1, !heap2->update_cost_when_sorting);
+	if (removed) {
+		heap1->erase_nodes(removed1);
+		heap1->heapify();
+		if (heap2) heap2->erase_nodes(removed2);
+	}
 
-	heap1->root = copy1->root;
-	heap1->nb_nodes = copy1->size();
-	nb_nodes = copy1->size();
-	copy1->root = NULL;
-	copy1->nb_nodes=0;// avoid to delete heap1 with copy1
-	delete copy1;
+	// if the costs of the second heap have to be
+	// recalculated, this is done now (sort also
+	// rebuilds the heap).
+	if (heap2 && (removed || heap2->update_cost_when_sorting))
+		heap2->sort();
 
-	if (heap2->update_cost_when_sorting) heap2->sort();
+	nb_nodes = heap1->size();
 
-	assert(nb_nodes==heap2->size());
-	assert(nb_nodes==heap1->size());
+	assert(!heap2 || nb_nodes==heap2->size());
 	assert(heap1->heap_state());
 	assert(!heap2 || heap2->heap_state());
 }
 
-
-template<class T>
-void DoubleHeap<T>::contract_rec(double new_loup1, HeapNode<T>* node, SharedHeap<T>& heap, bool percolate) {
-
-	// the cost are assumed to be up-to-date for the 1st heap
-	if (node->is_sup(new_loup1, 0)) {
-		// we must remove from the other heap all the sub-nodes
-		if (heap2) erase_subnodes(node, percolate);
-	} else {
-		heap.push_elt(node->elt);
-		if (node->left)	 contract_rec(new_loup1, node->left, heap, percolate);
-		if (node->right) contract_rec(new_loup1, node->right, heap, percolate);
-
-		delete node;
-	}
-}
-
-template<class T>
-void DoubleHeap<T>::erase_subnodes(HeapNode<T>* node, bool percolate) {
-	if (node->left)	erase_subnodes(node->left, percolate);
-	if (node->right) erase_subnodes(node->right, percolate);
-
-	if (!percolate)
-		// there is no need to update the order now in the second heap
-		// since all costs will have to be recalculated.
-		// The heap2 will be sorted at the end (see contract)
-		heap2->erase_node_no_percolate(node->elt->holder[1]);
-	else
-		heap2->erase_node(node->elt->holder[1]);
-
-	if (node->elt->data) delete node->elt->data;
-	delete node->elt;
-	delete node;
-}
-
 template<class T>
 bool DoubleHeap<T>::empty() const {
 	// if one buffer is empty, the other is also empty
@@ -291,17 +290,12 @@ bool DoubleHeap<T>::empty() const {
 }
 
 template<class T>
-void DoubleHeap<T>::push(T* data) {
-	HeapElt<T>* elt;
-	if (heap2) {
-		elt = new HeapElt<T>(data, heap1->cost(*data), heap2->cost(*data));
-	} else {
-		elt = new HeapElt<T>(data, heap1->cost(*data));
-	}
+void DoubleHeap<T>::push(T* d) {
+	unsigned int elt=new_elt(d);
 
 	// the data is put into the first heap
-	heap1->push_elt(elt);
-	if (heap2) heap2->push_elt(elt);
+	heap1->push_elt(elt, heap1->cost(*d));
+	if (heap2) heap2->push_elt(elt, heap2->cost(*d));
 
 	nb_nodes++;
 }
@@ -313,17 +307,15 @@ T* DoubleHeap<T>::pop() {
 	//std::cout << " \n\n Heap1=" << (*heap1);
 
 	// Select the heap
-	HeapElt<T>* elt;
+	unsigned int elt;
 	if (current_heap_id==0) {
 		elt = heap1->pop_elt();
-		if (heap2) heap2->erase_node(elt->holder[1]);
+		if (heap2) heap2->erase_elt(elt);
 	} else {
 		elt = heap2->pop_elt();
-		heap1->erase_node(elt->holder[0]);
+		heap1->erase_elt(elt);
 	}
-	T* data = elt->data;
-	elt->data=NULL; // avoid the data to be deleted with the element
-	delete elt;
+	T* d = free_elt(elt);
 
 	nb_nodes--;
 
@@ -338,7 +330,7 @@ T* DoubleHeap<T>::pop() {
 		current_heap_id=1;
 	}
 
-	return data;
+	return d;
 }
 
 template<class T>
@@ -400,10 +392,10 @@ std::ostream& DoubleHeap<T>::print(std::ostream& os) const{
 		os<<std::endl;
 	} else {
 		os << "First Heap:  "<<std::endl;
-		heap1->print(os);
+		os << *heap1;
 		os<<std::endl;
 		os << "Second Heap: "<<std::endl;
-		heap2->print(os);
+		os << *heap2;
 		os<<std::endl;
 	}
 	return os;
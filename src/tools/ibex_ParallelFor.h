@@ -0,0 +1,89 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelFor.h
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_FOR_H__
+#define __IBEX_PARALLEL_FOR_H__
+
+#include <exception>
+
+#ifndef _WIN32 // MinGW does not support threads
+#include <thread>
+#include <atomic>
+#include <vector>
+#endif
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ *
+ * \brief Call f(i) for all i in [0,n) with several threads.
+ *
+ * The indices are distributed dynamically by chunks of consecutive
+ * indices: the threads take the next chunk as soon as they are done with
+ * their current one. The calling thread takes part in the loop.
+ *
+ * The calls f(i) must not share data (or only read-only data).
+ *
+ * If a call throws an exception, the remaining chunks are skipped and
+ * the exception is rethrown in the calling thread once all the threads are
+ * terminated.
+ *
+ * Without thread support (_WIN32), the loop is sequential.
+ *
+ * \param chunk - the number of indices of a chunk
+ */
+template<class F>
+void parallel_for(int n, int nb_threads, F f, int chunk=16);
+
+/*================================== inline implementations ========================================*/
+
+template<class F>
+void parallel_for(int n, int nb_threads, F f, int chunk) {
+#ifndef _WIN32
+	if (nb_threads>1 && n>chunk) {
+		std::atomic<int> next(0);
+		std::atomic<bool> failed(false);
+		std::vector<std::exception_ptr> error(nb_threads);
+
+		auto run = [&](int w) {
+			try {
+				int i;
+				while (!failed && (i=next.fetch_add(chunk)) < n) {
+					for (int end=i+chunk<n? i+chunk : n; i<end; i++)
+						f(i);
+				}
+			} catch(...) {
+				error[w]=std::current_exception();
+				failed=true;
+			}
+		};
+
+		std::vector<std::thread> threads;
+		for (int w=1; w<nb_threads; w++)
+			threads.push_back(std::thread(run, w));
+
+		run(0);
+
+		for (std::vector<std::thread>::iterator it=threads.begin(); it!=threads.end(); ++it)
+			it->join();
+
+		for (int w=0; w<nb_threads; w++)
+			if (error[w]) std::rethrow_exception(error[w]);
+
+		return;
+	}
+#endif
+	for (int i=0; i<n; i++)
+		f(i);
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_PARALLEL_FOR_H__
@@ -0,0 +1,102 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Pool.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Pool.h"
+
+#include <new>
+
+namespace ibex {
+
+namespace {
+
+const size_t NB_LISTS = Pool::MAX_SIZE/Pool::GRAIN;
+
+// A free block (the "next" pointer is stored in the block itself)
+struct Block {
+	Block* next;
+};
+
+// Free lists of the current thread (list n°i contains blocks of size (i+1)*GRAIN).
+// Note: these variables are trivially destructible so that they can still be
+// accessed after the thread_exit object below is destroyed.
+thread_local Block* free_lists[NB_LISTS];
+
+thread_local bool pool_enabled = false;
+
+// Gives the blocks back to the system when the thread terminates.
+struct ThreadExit {
+	bool registered;
+	~ThreadExit() {
+		pool_enabled = false;
+		Pool::release();
+	}
+};
+
+thread_local ThreadExit thread_exit;
+
+// index of the free list for a given size
+// (the size must be in ]0,MAX_SIZE]).
+inline size_t list_index(size_t size) {
+	return (size-1)/Pool::GRAIN;
+}
+
+} // end anonymous namespace
+
+void* Pool::alloc(size_t size) {
+	if (size==0 || size>MAX_SIZE)
+		return ::operator new(size);
+
+	size_t i=list_index(size);
+
+	if (pool_enabled && free_lists[i]) {
+		Block* b=free_lists[i];
+		free_lists[i]=b->next;
+		return b;
+	}
+
+	// The size is rounded so that the block can be
+	// recycled later for any size of the same list.
+	return ::operator new((i+1)*GRAIN);
+}
+
+void Pool::free(void* p, size_t size) {
+	if (!p) return;
+
+	if (!pool_enabled || size==0 || size>MAX_SIZE) {
+		::operator delete(p);
+		return;
+	}
+
+	size_t i=list_index(size);
+	Block* b=(Block*) p;
+	b->next=free_lists[i];
+	free_lists[i]=b;
+}
+
+void Pool::enable(bool enabled) {
+	// ensures the free lists will be released at thread exit
+	if (enabled) thread_exit.registered=true;
+	pool_enabled = enabled;
+}
+
+bool Pool::enabled() {
+	return pool_enabled;
+}
+
+void Pool::release() {
+	for (size_t i=0; i<NB_LISTS; i++) {
+		while (free_lists[i]) {
+			Block* b=free_lists[i];
+			free_lists[i]=b->next;
+			::operator delete(b);
+		}
+	}
+}
+
+} // end namespace ibex
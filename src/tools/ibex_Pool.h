@@ -0,0 +1,125 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Pool.h
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_POOL_H__
+#define __IBEX_POOL_H__
+
+#include <cstddef>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ *
+ * \brief Pool of memory blocks (free lists).
+ *
+ * A search (solver, optimizer) creates and destroys millions of objects
+ * of the same few sizes: cells, boxes (arrays of intervals) and box
+ * properties. When pool allocation is enabled, a block released with
+ * #free() is not given back to the system but kept in a free list (one list
+ * per size) and recycled by the next call to #alloc() with a similar size.
+ *
+ * Pool allocation is enabled <b>per thread</b> (see #enable() or #Scope) and
+ * free lists are local to each thread, so that no synchronization is required.
+ * Blocks are always obtained from the global operator new, which means that a
+ * block can be released in a different thread (e.g., a cell stolen by another
+ * worker in a parallel search) or when the pool is disabled: this is always safe.
+ *
+ * Only blocks up to #MAX_SIZE bytes are pooled. The size of a block
+ * is rounded up to a multiple of #GRAIN bytes.
+ *
+ * This allocator is used by #ibex::Cell, #ibex::Bxp and #ibex::IntervalVector.
+ */
+class Pool {
+public:
+
+	/**
+	 * \brief Allocate a block of (at least) \a size bytes.
+	 *
+	 * The block is taken from the free list of the
+	 * current thread if pool allocation is enabled.
+	 */
+	static void* alloc(size_t size);
+
+	/**
+	 * \brief Release a block allocated with #alloc(size).
+	 *
+	 * The block is put in the free list of the current
+	 * thread if pool allocation is enabled.
+	 */
+	static void free(void* p, size_t size);
+
+	/**
+	 * \brief Enable/disable pool allocation in the current thread.
+	 */
+	static void enable(bool enabled);
+
+	/**
+	 * \brief Whether pool allocation is enabled in the current thread.
+	 */
+	static bool enabled();
+
+	/**
+	 * \brief Give back all the blocks of the free lists of the current thread.
+	 *
+	 * Automatically called when a thread terminates and at the end
+	 * of a scope where pool allocation was enabled (see #Scope).
+	 */
+	static void release();
+
+	/**
+	 * \brief Enable/disable pool allocation in the current thread, in a scope.
+	 *
+	 * The previous state is restored when the object is destroyed.
+	 * If pool allocation was disabled before, the free lists are
+	 * also released.
+	 *
+	 * \code
+	 * {
+	 *    Pool::Scope pool(true);
+	 *    // cells/boxes are pooled here
+	 * }
+	 * \endcode
+	 */
+	class Scope {
+	public:
+		explicit Scope(bool enabled);
+		~Scope();
+	private:
+		Scope(const Scope&);              // forbidden
+		Scope& operator=(const Scope&);   // forbidden
+		const bool was_enabled;
+		const bool enabled;
+	};
+
+	/**
+	 * \brief Granularity of block sizes (in bytes).
+	 */
+	static const size_t GRAIN = 16;
+
+	/**
+	 * \brief Maximal size of a pooled block (in bytes).
+	 */
+	static const size_t MAX_SIZE = 2048;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline Pool::Scope::Scope(bool enabled) : was_enabled(Pool::enabled()), enabled(enabled) {
+	Pool::enable(enabled);
+}
+
+inline Pool::Scope::~Scope() {
+	Pool::enable(was_enabled);
+	if (enabled && !was_enabled) Pool::release();
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_POOL_H__
@@ -59,10 +59,10 @@ namespace ibex {
 const uint32_t RNG::x0 = 123456789;
 const uint32_t RNG::y0 = 362436069;
 const uint32_t RNG::z0 = 521288629;
-uint32_t RNG::x = 123456789;
-uint32_t RNG::y = 362436069;
-uint32_t RNG::z = 521288629;
-uint32_t RNG::seed = 0;
+thread_local uint32_t RNG::x = 123456789;
+thread_local uint32_t RNG::y = 362436069;
+thread_local uint32_t RNG::z = 521288629;
+thread_local uint32_t RNG::seed = 0;
 
 void RNG::srand()
 {
@@ -68,6 +68,11 @@ namespace ibex {
 		 */
 		static void srand(int s);
 
+		/** \brief Get the seed of the current thread
+		 *  \return The last seed set by #srand(int) in the current thread (0 by default).
+		 */
+		static int get_seed() { return (int) seed; }
+
 		/** \brief Get a random integer as uint32
 		 * This function serves to obtain a random number \c
 		 * \return An integer in the interval [0,UINT32_MAX].
@@ -90,7 +95,8 @@ namespace ibex {
 
 	private:
 		static const uint32_t x0,y0,z0;
-		static uint32_t x,y,z,seed;
+		// thread-local: each thread has its own sequence (see ParallelOptimizer)
+		static thread_local uint32_t x,y,z,seed;
 	};
 }
 
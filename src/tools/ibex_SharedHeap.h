@@ -1,11 +1,11 @@
 //============================================================================
-//                                  I B E X                                   
+//                                  I B E X
 // File        : ibex_SharedHeap.h
 // Author      : Gilles Chabert, Jordan Ninin, Dominique Monnet
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Dec 23, 2014
-// Last Update : Dec 25, 2017
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_SHARED_HEAP_H__
@@ -14,14 +14,35 @@
 #include <iostream>
 #include <cassert>
 #include <stack>
-#include "ibex_Heap.h" // just for the declaration of CostFunc<T>
+#include <vector>
+#include "ibex_Heap.h" // for the declaration of CostFunc<T> and HEAP_ARITY
 
 namespace ibex {
 
-template<class T> class HeapNode;
-template<class T> class HeapElt;
 template<class T> class DoubleHeap;
 
+/**
+ * \ingroup strategy
+ *
+ * \brief Shared heap node (internal)
+ *
+ * Class to be used by SharedHeap only.
+ *
+ * A node is a slot of the array of a heap. It contains
+ * the identifier of an element and its cost, so that
+ * comparisons do not require to access the element.
+ */
+class HeapNode {
+public:
+	/** Create a node from an element and its cost. */
+	HeapNode(unsigned int elt, double crit) : crit(crit), elt(elt) { }
+
+	/** the cost of the element (for this heap). */
+	double crit;
+
+	/** the identifier of the stored element. */
+	unsigned int elt;
+};
 
 /**
  * \brief Shared heap (internal)
@@ -29,8 +50,8 @@ template<class T> class DoubleHeap;
  * Class to be used by DoubleHeap only.
  *
  * Important remark: no function of this class creates or
- * destroy an element (HeapElt). Therefore, there is no
- * impact on the other shared heaps.
+ * destroy an element. Therefore, there is no impact on the
+ * other shared heaps.
  *
  * It is the role of DoubleHeap to manage shared heap
  * synchronization.
@@ -42,6 +63,16 @@ template<class T> class DoubleHeap;
  *       the element with the minimal "cost" (criterion).</li>
  *  <li> #push() is also in logarithmic time.</li>
  *  </ul>
+ *
+ * The heap is a HEAP_ARITY-ary tree stored in a contiguous array:
+ * the children of the node n°i are the nodes n°HEAP_ARITY*i+1, ...,
+ * n°HEAP_ARITY*i+HEAP_ARITY.
+ *
+ * An element is an integer identifier, given by the DoubleHeap (which
+ * also stores the data of the elements). The position of each element
+ * in the array is recorded (in another array indexed by identifiers),
+ * so that an element popped from a heap can be removed from the other
+ * heap in logarithmic time.
  */
 template<class T>
 class SharedHeap  {
@@ -57,30 +88,18 @@ public:
 	 */
 	SharedHeap(CostFunc<T>& cost, bool update_cost_when_sorting, int id);
 
-	/** Constructor by copy */
-	SharedHeap(const SharedHeap<T>& heap, int nb_crit, bool deep_copy);
-
-	/** \brief Delete this.
-	 *
-	 * Data is not deleted. Call #clear(NODE_ELT_DATA) before. */
-	virtual ~SharedHeap();
-
 	/** \brief Return the size of the buffer. */
 	unsigned int size() const;
 
 	/** \brief Return true if the buffer is empty. */
 	bool empty() const;
 
-	typedef enum { NODE, NODE_ELT, NODE_ELT_DATA } clear_mode;
-
 	/**
 	 * \brief Clear the heap.
 	 *
-	 * NODE:          only nodes are deleted
-	 * NODE_ELT:      nodes and elements are deleted
-	 * NODE_ELT_DATA: nodes, elements and data are deleted
+	 * Data is not deleted.
 	 */
-	void clear(clear_mode mode=NODE_ELT_DATA);
+	void clear();
 
 	/**
 	 * \brief Return the next box (but does not pop it).
@@ -96,18 +115,13 @@ public:
 	double minimum() const;
 
 	/**
-	 * \brief update the cost and sort all the heap
-	 * complexity: o(nb_nodes*log(nb_nodes))
+	 * \brief Update the costs (if update_cost_when_sorting is true)
+	 * and rebuild the heap.
 	 *
-	 * \param update_cost: if true, costs are all recalculated
+	 * Complexity: o(nb_nodes)
 	 */
 	void sort();
 
-	/**
-	 * \brief Count the number of nodes pushed since
-	 *         the object is created. */
-	unsigned int nb_nodes;
-
 	/**
 	 * \brief Cost function associated to this heap
 	 */
@@ -123,8 +137,14 @@ protected:
 	/** The "cost" of an element. */
 	double cost(const T& data) const;
 
-	/** The root of the heap */
-	HeapNode<T>* root;
+	/** The nodes (the root is nodes[0]) */
+	std::vector<HeapNode> nodes;
+
+	/** The position of each element in "nodes" */
+	std::vector<unsigned int> pos;
+
+	/** The data of each element (belongs to the DoubleHeap) */
+	const std::vector<T*>* data;
 
 	/** Whether the cost function is called again inside sort. */
 	bool update_cost_when_sorting;
@@ -134,51 +154,59 @@ protected:
 	 *
 	 * Complexity: O(log(nb_nodes))
 	 */
-	HeapElt<T>* pop_elt();
+	unsigned int pop_elt();
 
 	/**
-	 * Push an element
+	 * Push an element with its cost.
 	 *
 	 * Complexity: O(log(nb_nodes))
 	 */
-	void push_elt(HeapElt<T>* elt);
+	void push_elt(unsigned int elt, double crit);
 
 	/**
-	 * Percolate (or "heapify") from the node \var node downto the bottom.
+	 * Remove an element (anywhere in the heap).
+	 *
+	 * Complexity: O(log(nb_nodes))
 	 */
-	void percolate_down(HeapNode<T>* node);
+	void erase_elt(unsigned int elt);
 
 	/**
-	 * Percolate (or "heapify") from the node \var node upto the root.
+	 * Percolate (or "heapify") from the node n°i downto the bottom.
 	 */
-	void percolate_up(HeapNode<T>* node);
+	void percolate_down(unsigned int i);
 
 	/**
-	 * \brief Remove a node and update the heap in consequence.
-	 *
-	 * (call percolate_down and percolate_up).
+	 * Percolate (or "heapify") from the node n°i upto the root.
 	 */
-	void erase_node(HeapNode<T>* node);
+	void percolate_up(unsigned int i);
 
 	/**
-	 * \brief Remove a node.
+	 * \brief Remove the node n°i and update the heap in consequence.
 	 *
-	 * The last node is actually removed and its element is put in place
-	 * of the node element, except if the node is the last.
+	 * The last node is put in place of the removed node and
+	 * then percolated up or down.
+	 */
+	void erase_node(unsigned int i);
+
+	/**
+	 * \brief Remove the nodes marked in "removed" (in one pass) and
+	 * update the positions of the remaining elements.
 	 *
-	 * The heap is not updated after (the new node is not at its right place
-	 * anymore and the heap is in undefined state).
+	 * The heap is not in a correct state after (call heapify).
 	 *
-	 * Complexity: O(1)
+	 * Complexity: O(nb_nodes)
 	 */
-	HeapNode<T>* erase_node_no_percolate(HeapNode<T>* node);
+	void erase_nodes(const std::vector<bool>& removed);
 
 	/**
-	 * \brief Access to the ith node, rank by largest-first order.
+	 * \brief Restore the heap property for the whole array.
+	 *
+	 * The positions of the elements are assumed to be
+	 * up-to-date (only the moved nodes are updated).
 	 *
-	 * \param i - the node number
+	 * Complexity: O(nb_nodes)
 	 */
-	HeapNode<T>* get_node(unsigned int i) const;
+	void heapify();
 
 	/**
 	 * \brief Streams out the heap
@@ -191,231 +219,54 @@ protected:
 	/**
 	 * \brief Check if the heap is well-formed
 	 */
-	bool heap_state();
-
-	/** Return a list of all the elements */
-	std::vector<HeapElt<T>*> elt();
+	bool heap_state() const;
 
 private:
-
-	/** Used in the sort function (proceed by recursivity) */
-	void sort_rec(HeapNode<T>* node, SharedHeap<T>& heap);
-
-	void elt_rec(HeapNode<T>* cur, std::vector<HeapElt<T>*>& elm_vect);
-
-	void clear_subnodes(HeapNode<T>* node, clear_mode mode);
+	/** Put the node "node" at position n°i */
+	void place(const HeapNode& node, unsigned int i);
 };
 
 
-
-/**
- * \ingroup strategy
- *
- * \brief Shared heap node (internal)
- *
- * Class to be used by DoubleHeap only.
- */
-template<class T>
-class HeapNode {
-
-private:
-	friend class SharedHeap<T>;
-	friend class DoubleHeap<T>;
-
-	/** Create a node from an element and the father node. */
-	explicit HeapNode(HeapElt<T>* elt, int heap_id, HeapNode<T>* father);
-
-	/** Constructor by copy. */
-	explicit HeapNode(const HeapNode& node, HeapNode<T>* father, int heap_id, int nb_crit, bool deep_copy);
-
-	/** Delete the node and all its sons */
-	//~HeapNode() ;
-
-	/** the stored element. */
-	HeapElt<T>* elt;
-
-	/** Right sub-node */
-	HeapNode<T>* right;
-
-	/** Left sub-node */
-	HeapNode<T>* left;
-
-	/** Father node. */
-	HeapNode<T>* father;
-
-	/** Compare the heap_id-cost of this node to "node". */
-	bool is_sup(HeapNode<T>* node, int heap_id) const;
-
-	/** Compare the heap_id-cost of this node to the value "d". */
-	bool is_sup(double d, int heap_id) const;
-
-	/** Switch the elements between *this and node */
-	void switch_elt(HeapNode<T>* node, int heap_id);
-
-	template<class U>
-	friend std::ostream& operator<<(std::ostream& os, const HeapNode<U>& node);
-
-	template<class U>
-	friend std::ostream& operator<<(std::ostream& os, const SharedHeap<U>& heap);
-
-};
-
-/**
- * \ingroup strategy
- *
- * \brief Shared heap element (internal)
- *
- * Class to be used by DoubleHeap only.
- */
-template<class T>
-class HeapElt {
-
-private:
-	friend class HeapNode<T>;
-	friend class SharedHeap<T>;
-	friend class DoubleHeap<T>;
-
-	/** Create an CellHeapElt with a data and its criteria */
-	//CellHeapElt(int nb_crit, T* elt, double *crit);
-
-	/** Create an HeapElt with a data and one criterion */
-	explicit HeapElt(T* data, double crit_1);
-
-	/** Create an HeapElt with a data and two criteria */
-	explicit HeapElt(T* data, double crit_1, double crit_2);
-
-    /** Copy constructor (not holders) **/
-	explicit HeapElt(const HeapElt<T>& elt, int nb_crit, bool deep_copy);
-
-	/** Delete the element (*not the data*) */
-	~HeapElt() ;
-
-	/**
-	 * Compare the criterion of a given heap with the value d.
-	 * Return true if the criterion is greater.
-	 */
-	bool is_sup(double d, int heap_id) const;
-
-	/** the stored data. */
-	T* data;
-
-//	/** The number of different heaps this element belongs to */
-//	int nb_heaps;
-
-	/** the criteria of the stored data (one for each heap this
-	 * element belongs to). */
-	double *crit;
-
-	/** The node that holds this element, for each heap. */
-	HeapNode<T>** holder;
-
-	template<class U>
-	friend std::ostream& operator<<(std::ostream& os, const HeapElt<U>& node) ;
-
-	template<class U>
-	friend std::ostream& operator<<(std::ostream& os, const SharedHeap<U>& heap);
-};
-
-
-
 /*================================== inline implementations ========================================*/
 
 
 template<class T>
-SharedHeap<T>::SharedHeap(CostFunc<T>& cost, bool update_cost, int id) : nb_nodes(0), costf(cost), heap_id(id), root(NULL), update_cost_when_sorting(update_cost) {
-
-}
-
-template<class T>
-SharedHeap<T>::SharedHeap(const SharedHeap<T>& heap, int nb_crit, bool deep_copy) :
- nb_nodes(heap.nb_nodes), costf(heap.costf), heap_id(heap.heap_id), root(NULL), update_cost_when_sorting(heap.update_cost_when_sorting) {
-	if (heap.root != NULL)
-		root = new HeapNode<T>(*(heap.root), NULL, heap_id, nb_crit, deep_copy);
-}
-
-template<class T>
-std::vector<HeapElt<T>*> SharedHeap<T>::elt() {
-    std::vector<HeapElt<T>*> elm_vect;
-    elt_rec(root, elm_vect);
-    return elm_vect;
-}
+SharedHeap<T>::SharedHeap(CostFunc<T>& cost, bool update_cost, int id) : costf(cost), heap_id(id), data(NULL), update_cost_when_sorting(update_cost) {
 
-template<class T>
-void SharedHeap<T>::elt_rec(HeapNode<T>* cur, std::vector<HeapElt<T>*> &elm_vect) {
-    if(cur != NULL) {
-    	elm_vect.push_back(cur->elt);
-        elt_rec(cur->right, elm_vect);
-        elt_rec(cur->left, elm_vect);
-    }
 }
 
 template<class T>
-SharedHeap<T>::~SharedHeap() {
-	clear(NODE_ELT);
-}
-
-template<class T>
-void SharedHeap<T>::clear(clear_mode mode) {
-	if (nb_nodes>0) {
-		clear_subnodes(root, mode);
-		nb_nodes=0;
-		root=NULL;
-	}
-}
-
-template<class T>
-void SharedHeap<T>::clear_subnodes(HeapNode<T>* node, clear_mode mode) {
-	if (node->left)	clear_subnodes(node->left, mode);
-	if (node->right) clear_subnodes(node->right, mode);
-
-	if (mode==NODE_ELT)
-		delete node->elt;
-	else if (mode==NODE_ELT_DATA) {
-		if (node->elt->data)
-			delete node->elt->data;
-		delete node->elt;
-	}
-
-	delete node;
+void SharedHeap<T>::clear() {
+	nodes.clear();
 }
 
 template<class T>
 inline double SharedHeap<T>::minimum() const {
-	return root->elt->crit[heap_id];
+	return nodes[0].crit;
 }
 
 template<class T>
 unsigned int SharedHeap<T>::size() const {
-	return nb_nodes;
+	return nodes.size();
 }
 
 template<class T>
 bool SharedHeap<T>::empty() const {
-	return (nb_nodes==0);
+	return nodes.empty();
 }
 
 template<class T>
 T* SharedHeap<T>::top() const {
-	return root->elt->data;
+	return (*data)[nodes[0].elt];
 }
 
-
 template<class T>
 void SharedHeap<T>::sort() {
-	if (nb_nodes==0) return;
-
-	SharedHeap<T>* heap_tmp = new SharedHeap<T>(costf, update_cost_when_sorting, heap_id);
-
-	// recursive sort : o(n*log(n))
-	sort_rec(root, *heap_tmp);
-
-	root = heap_tmp->root;
-	nb_nodes = heap_tmp->size();
-
-	heap_tmp->root = NULL;
-	heap_tmp->nb_nodes=0;
-	delete heap_tmp; 	// warning: delete all sub-nodes
+	if (update_cost_when_sorting)
+		for (std::vector<HeapNode>::iterator it=nodes.begin(); it!=nodes.end(); ++it)
+			it->crit = cost(*(*data)[it->elt]);
 
+	heapify();
 }
 
 template<class T>
@@ -424,347 +275,143 @@ inline double SharedHeap<T>::cost(const T& data) const {
 }
 
 template<class T>
-void SharedHeap<T>::sort_rec(HeapNode<T>* node, SharedHeap<T>& heap) {
-
-	if (update_cost_when_sorting)
-		node->elt->crit[heap_id] = cost(*(node->elt->data));
-
-	heap.push_elt(node->elt);
-	if (node->left)	 sort_rec(node->left, heap);
-	if (node->right) sort_rec(node->right, heap);
-
-	delete node;
+inline void SharedHeap<T>::place(const HeapNode& node, unsigned int i) {
+	nodes[i]=node;
+	pos[node.elt]=i;
 }
 
 template<class T>
-void SharedHeap<T>::push_elt(HeapElt<T>* elt) {
-
-	if (nb_nodes==0) {
-		root = new HeapNode<T>(elt,heap_id,NULL);
-		nb_nodes++;
-	} else {
-		nb_nodes++;
-		// calculate height
-		int height = 0;
-		int aux = nb_nodes;
-		while(aux>1) { aux /= 2; height++;	}
-
-		// pt = pointer on the current element
-		HeapNode<T> * pt = root;
-		for (int pos=height-1; pos>0; pos--) {
-			if ( nb_nodes & (1 << pos)) {  // test the "pos"th bit of the integer nb_nodes
-				pt = pt->right;
-			} else {
-				pt = pt->left;
-			}
-		}
-		HeapNode<T>* tmp= new HeapNode<T>(elt,heap_id,pt);
-		if (nb_nodes%2==0) { pt->left =tmp; }
-		else               { pt->right=tmp; }
-
-		percolate_up(tmp);
-	}
+void SharedHeap<T>::push_elt(unsigned int elt, double crit) {
+	if (elt>=pos.size()) pos.resize(elt+1);
+	nodes.push_back(HeapNode(elt,crit));
+	pos[elt]=nodes.size()-1;
+	percolate_up(nodes.size()-1);
 }
 
 template<class T>
-HeapNode<T> * SharedHeap<T>::get_node(unsigned int i) const {
-	assert(i<nb_nodes);
-	assert(nb_nodes>0);
-
-	// GET THE LAST ELEMENT and delete the associated node
-	// calculate height
-	int height = 0;
-	unsigned int aux = i+1;
-	while(aux>1) { aux /= 2; height++; }
-	//std::cout << "height of "<<i<<"  = " << height <<std::endl;
-	// pt = pointer on the current element
-	HeapNode<T>* pt = root;
-	for (int pos=height-1; pos>=0; pos--) {
-		if ( (i+1) & (1 << pos)) {  // test the "pos"th bit of the integer nb_nodes
-			//std::cout << "Right ";
-			pt = pt->right;
-		} else {
-			//std::cout << "Left ";
-			pt = pt->left;
-		}
-	}
-	return pt;
+unsigned int SharedHeap<T>::pop_elt() {
+	assert(!nodes.empty());
+	unsigned int elt = nodes[0].elt;
+	erase_node(0);
+	return elt;
 }
 
 template<class T>
-HeapElt<T>* SharedHeap<T>::pop_elt() {
-	assert(nb_nodes>0);
-	HeapElt<T>* c_return = root->elt;
-	erase_node(root);
-	return c_return;
+void SharedHeap<T>::erase_elt(unsigned int elt) {
+	erase_node(pos[elt]);
 }
 
-// erase a node and update the order
 template<class T>
-void SharedHeap<T>::erase_node(HeapNode<T>* node) {
-	assert(node);
-	assert(nb_nodes>0);
+void SharedHeap<T>::erase_node(unsigned int i) {
+	assert(i<nodes.size());
 
-	if (erase_node_no_percolate(node)) {
-		percolate_down(node);
-		percolate_up(node);
-	}
-}
+	HeapNode last=nodes.back();
+	nodes.pop_back();
 
-// erase a node without updating the order
-template<class T>
-HeapNode<T>* SharedHeap<T>::erase_node_no_percolate(HeapNode<T>* node) {
-	assert(nb_nodes>0);
-
-	if (nb_nodes==1) {
-		assert(node==root);
-		root->elt=NULL;
-		delete root;
-		root = NULL;
-		node = NULL; // return NULL
-	} else {
-		// Get the last element and delete the associated node without destroying the HeapElt
-		HeapNode<T>* last = get_node(nb_nodes-1);
-
-		// elt points on the last node data, that we will put in place of the deleted node
-		HeapElt<T>* elt = last->elt;
-
-		if (nb_nodes%2==0)	{ last->father->left =NULL; }
-		else 				{ last->father->right=NULL; }
-
-		// to avoid the element to be deleted with the node pt
-		last->elt = NULL;
-
-		if (node!=last) { // if the node to be deleted is not the last
-			node->elt = elt;
-			node->elt->holder[heap_id] = node;
-		} else {
-			node = NULL; // return NULL
-		}
-		delete last;
-	}
-	nb_nodes--;
-	return node;
-}
+	if (i==nodes.size()) return; // the node was the last one
 
-template<class T>
-void SharedHeap<T>::percolate_up(HeapNode<T>* node) {
-	assert(node);
+	place(last,i);
 
-	while (node->father && node->father->is_sup(node,heap_id)) {
-		node->switch_elt(node->father,heap_id);
-		node = node->father;
-	}
-}
-
-template<class T>
-void SharedHeap<T>::percolate_down(HeapNode<T>* node) {
-	assert(node);
-
-	// PERMUTATION to maintain the order in the heap when going down
-	bool b=true;
-	while (b && (node->left)) {
-		if (node->right) {
-			if (node->is_sup(node->left,heap_id)) {
-				if (node->right->is_sup(node->left,heap_id)) {
-					// left is the smallest
-					node->switch_elt(node->left,heap_id);
-					node = node->left;  // next
-				} else {
-					// right is the smallest
-					node->switch_elt(node->right,heap_id);
-					node = node->right;  // next
-				}
-			} else {
-				if (node->is_sup(node->right,heap_id)) {
-					// right is the smallest
-					node->switch_elt(node->right,heap_id);
-					node = node->right;  // next
-				} else { // current node is the smallest among the 3: stop
-					b=false;
-				}
-			}
-		} else { // no more right child but there is a left child
-			if (node->is_sup(node->left,heap_id)) {
-				// left is the smallest
-				node->switch_elt(node->left,heap_id);
-				node = node->left;  // next
-			} else { // current node is the smallest among the 3: stop (and we must have reached the bottom of the heap)
-				b=false;
-			}
-		}
-	}
+	if (i>0 && nodes[(i-1)/HEAP_ARITY].crit > last.crit)
+		percolate_up(i);
+	else
+		percolate_down(i);
 }
 
 template<class T>
-bool SharedHeap<T>::heap_state() {
-
-	if (empty()) return true;
+void SharedHeap<T>::erase_nodes(const std::vector<bool>& removed) {
+	assert(removed.size()==nodes.size());
 
-	std::stack<HeapNode<T>* > s;
-	s.push(root);
-	while (!s.empty()) {
-		HeapNode<T>* node=s.top();
-		s.pop();
-		if (node->right && (!node->left)) {
-			//std::cerr << "node with only right child" << std::endl;
-			return false;
-		}
-		if (node->left) {
-			if (node->is_sup(node->left,heap_id)) {
-				//std::cerr << "node elt:" << node->elt->crit[heap_id] << " node left:" <<  node->left->elt->crit[heap_id] << std::endl;
-				return false;
-			}
-			else s.push(node->left);
-		}
-		if (node->right) {
-			if (node->is_sup(node->right,heap_id)) {
-				//std::cerr << "node elt:" << node->elt->crit[heap_id] << " node left:" <<  node->right->elt->crit[heap_id] << std::endl;
-				return false;
-			}
-			else s.push(node->right);
-		}
+	unsigned int j=0;
+	for (unsigned int i=0; i<nodes.size(); i++) {
+		if (removed[i]) continue;
+		if (j<i) place(nodes[i],j);
+		j++;
 	}
-	return true;
+	nodes.erase(nodes.begin()+j, nodes.end());
 }
 
 template<class T>
-HeapNode<T>::HeapNode(HeapElt<T>* elt, int heap_id, HeapNode<T>* father): elt(elt), right(NULL), left(NULL), father(father) {
-	elt->holder[heap_id] = this;
-}
-
+void SharedHeap<T>::percolate_up(unsigned int i) {
+	assert(i<nodes.size());
 
+	// the node is moved only once, at the end
+	HeapNode node=nodes[i];
 
-template<class T>
-HeapNode<T>::HeapNode(const HeapNode& node, HeapNode<T>* father, int heap_id, int nb_crit, bool deep_copy) :
-	elt(new HeapElt<T>(*(node.elt), nb_crit, deep_copy)),
-	right(NULL), left(NULL), father(father) {
-
-	elt->holder[heap_id] = this;
-
-	if (node.right != NULL) {
-		right = new HeapNode(*(node.right), this, heap_id, nb_crit, deep_copy);
+	while (i>0) {
+		unsigned int father=(i-1)/HEAP_ARITY;
+		if (!(nodes[father].crit > node.crit)) break;
+		place(nodes[father],i);
+		i=father;
 	}
-	if (node.left != NULL) {
-		left = new HeapNode(*(node.left), this, heap_id, nb_crit, deep_copy);
-	}
-}
-
-//template<class T>
-//HeapNode<T>::~HeapNode() {
-//	// warning: delete all sub-nodes
-//
-//	if (elt) {
-//		// Next loop will allow us to call the destructor
-//		// on other holders of the same element "elt"
-//		// They will not try to delete twice "elt".
-//		for (int i=0; i<elt->nb_heaps; i++) {
-//			if (elt->holder[i]!=this) // skip myself
-//				elt->holder[i]->elt=NULL;
-//		}
-//		delete elt;
-//	}
-//
-//	if (right) 	delete right;
-//	if (left)  	delete left;
-//}
-
-template<class T>
-bool HeapNode<T>::is_sup(HeapNode<T>* node, int heap_id) const {
-	return elt->is_sup(node->elt->crit[heap_id],heap_id);
-}
-
-template<class T>
-bool HeapNode<T>::is_sup(double d, int heap_id) const {
-	return elt->is_sup(d,heap_id);
+	place(node,i);
 }
 
 template<class T>
-void HeapNode<T>::switch_elt(HeapNode<T>* node, int heap_id) {
+void SharedHeap<T>::percolate_down(unsigned int i) {
+	assert(i<nodes.size());
 
-	elt->holder[heap_id] = node;
-	node->elt->holder[heap_id] = this;
+	const unsigned int n=nodes.size();
+	HeapNode node=nodes[i];
 
-	HeapElt<T> * elt_tmp = elt;
-	elt = node->elt;
-	node->elt = elt_tmp;
+	while (true) {
+		unsigned int first=HEAP_ARITY*i+1;
+		if (first>=n) break;
+		unsigned int end=first+HEAP_ARITY<n ? first+HEAP_ARITY : n;
 
-}
-
-//////////////////////////////////////////////////////////////////////////////////////
-/** create an node with a data and its criterion */
-//CellHeapElt::CellHeapElt(int nb_crit,T* data, double *crit_in) : data(data), crit(new double[nb_crit]), indice(new unsigned int[nb_crit]){
-//	for (int i=0;i<nb_crit;i++) {
-//		crit[i] = crit_in[i];
-//		indice[i] = 0;
-//	}
-//}
-
-template<class T>
-HeapElt<T>::HeapElt(T* data, double crit_1) : data(data), /*nb_heaps(1),*/ crit(new double[1]), holder(new HeapNode<T>*[1]){
-	crit[0] = crit_1;
-	holder[0] = NULL;
-}
+		// look for the smallest child
+		unsigned int min=first;
+		for (unsigned int j=first+1; j<end; j++)
+			if (nodes[j].crit < nodes[min].crit) min=j;
 
-template<class T>
-HeapElt<T>::HeapElt(T* data, double crit_1, double crit_2) : data(data), /*nb_heaps(2),*/ crit(new double[2]), holder(new HeapNode<T>*[2]){
-	crit[0] = crit_1;
-	crit[1] = crit_2;
-	holder[0] = NULL;
-	holder[1] = NULL;
+		if (!(node.crit > nodes[min].crit)) break;
+		place(nodes[min],i);
+		i=min;
+	}
+	place(node,i);
 }
 
 template<class T>
-HeapElt<T>::HeapElt(const HeapElt<T>& elt, int nb_crit, bool deep) : data(NULL), crit(new double[nb_crit]), holder(new HeapNode<T>*[nb_crit]) {
-	for(int i=0; i<nb_crit; i++) {
-        crit[i] = elt.crit[i];
-        holder[i] = NULL;
-    }
-    if (deep) {
-    	data = new T(*(elt.data));
-    } else {
-    	data = elt.data;
-    }
-}
+void SharedHeap<T>::heapify() {
+	if (nodes.size()<2) return;
 
-template<class T>
-HeapElt<T>::~HeapElt() {
-	delete [] crit;
-	delete [] holder;
+	// Floyd's algorithm: percolate down all the internal nodes, from the last one.
+	for (unsigned int i=(nodes.size()-2)/HEAP_ARITY+1; i>0; i--)
+		percolate_down(i-1);
 }
 
 template<class T>
-bool HeapElt<T>::is_sup(double d, int ind_crit) const {
-	return (crit[ind_crit] > d);
-}
+bool SharedHeap<T>::heap_state() const {
 
-template<class T>
-std::ostream& operator<<(std::ostream& os, const HeapElt<T>& elt) {
-	os << "{ crit[0]= " << (elt.crit[0]) << ": "<< *(elt.data)<<" } ";
-	return os;
-}
-
-template<class T>
-std::ostream& operator<<(std::ostream& os, const HeapNode<T>& node) {
-	os  <<*(node.elt) << " ";
-	if (node.left)  os <<  *(node.left);
-	if (node.right) os <<  *(node.right);
-	return os;
+	for (unsigned int i=0; i<nodes.size(); i++) {
+		if (pos[nodes[i].elt]!=i) {
+			//std::cerr << "bad position for node " << i << std::endl;
+			return false;
+		}
+		if (i>0 && nodes[(i-1)/HEAP_ARITY].crit > nodes[i].crit) {
+			//std::cerr << "node " << i << " smaller than its father" << std::endl;
+			return false;
+		}
+	}
+	return true;
 }
 
 template<class T>
 std::ostream& operator<<(std::ostream& os, const SharedHeap<T>& heap) {
-	if (!heap.root) return os << "(empty heap)";
+	if (heap.empty()) return os << "(empty heap)";
 	os << std::endl;
-	std::stack<std::pair<HeapNode<T>*,int> > s;
-	s.push(std::pair<HeapNode<T>*,int>(heap.root,0));
+	std::stack<std::pair<unsigned int,int> > s;
+	s.push(std::pair<unsigned int,int>(0,0));
 	while (!s.empty()) {
-		std::pair<HeapNode<T>*,int> p=s.top();
+		std::pair<unsigned int,int> p=s.top();
 		s.pop();
 		for (int i=0; i<p.second; i++) os << "   ";
-		os  << (p.first->elt->crit[heap.heap_id]) << std::endl;
-		if (p.first->right) s.push(std::pair<HeapNode<T>*,int>(p.first->right,p.second+1));
-		if (p.first->left) s.push(std::pair<HeapNode<T>*,int>(p.first->left,p.second+1));
+		os << heap.nodes[p.first].crit << std::endl;
+		// push the children in reverse order (so that the first one is displayed first)
+		for (unsigned int j=HEAP_ARITY; j>0; j--) {
+			unsigned int child=HEAP_ARITY*p.first+j;
+			if (child<heap.nodes.size()) s.push(std::pair<unsigned int,int>(child,p.second+1));
+		}
 	}
 	return os;
 }
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 13, 2012
-// Last Update : May 13, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "ibex_Timer.h"
@@ -18,30 +18,39 @@ static int ____IGNORE___ = (StaticTimer::start(), 0);
 
 StaticTimer::Time StaticTimer::local_time = 0;
 
-Timer::Timer(): start_time(0.0), active(false) {
-}
-
+constexpr double Timer::check_interval;
+constexpr double Timer::check_fraction;
+constexpr unsigned int Timer::max_period;
 
+Timer::Timer(clock_type clock): clock(clock), start_time(0.0), active(false), period(1), countdown(1), last_check(0.0) {
+}
 
+double Timer::get_clock() const {
+	return clock==CPU_TIME ? StaticTimer::get_localtime() : StaticTimer::get_realtime();
+}
 
 void Timer::start(){
 	if (active==false) {
 		active = true;
-		start_time = StaticTimer::get_localtime();
+		start_time = get_clock();
+		period = countdown = 1;
+		last_check = 0;
 	}
 }
 
 void Timer::stop(){
 	active = false;
-	start_time = (StaticTimer::get_localtime() - start_time);
+	start_time = (get_clock() - start_time);
 }
 void Timer::restart() {
-	start_time= StaticTimer::get_localtime();
+	start_time= get_clock();
 	active =true;
+	period = countdown = 1;
+	last_check = 0;
 }
 double Timer::get_time() {
 	if (active) {
-		return (StaticTimer::get_localtime() - start_time);
+		return (get_clock() - start_time);
 	} else {
 		return start_time;
 	}
@@ -50,6 +59,34 @@ void Timer::check(double timeout) {
 	if (Timer::get_time() >= timeout) throw TimeOutException();
 }
 
+void Timer::check_now(double timeout) {
+	double t=get_time();
+
+	if (t >= timeout) {
+		countdown = 1; // next call will also throw
+		throw TimeOutException();
+	}
+
+	// adapt the period to the measured time per call so that the clock
+	// is read every check_interval seconds (roughly) and never later than
+	// a small fraction of the timeout. The period is recomputed at each
+	// reading, so that it follows a growing cost per call (e.g., deeper
+	// nodes in a search). Note: the CPU time has a limited resolution
+	// (often 1ms or more) so that t-last_check can be 0 even after a lot
+	// of calls: the period is then just doubled.
+	double interval=timeout*check_fraction < check_interval ? timeout*check_fraction : check_interval;
+	double elapsed=t-last_check;
+
+	if (elapsed<=0) {
+		if (period < max_period) period*=2;
+	} else {
+		double n=period*interval/elapsed;
+		period = n<1 ? 1 : (n>max_period ? max_period : (unsigned int) n);
+	}
+
+	last_check = t;
+	countdown = period;
+}
 
 	/////////////////////////////////////////////////////////////////////
 
@@ -234,6 +271,23 @@ void StaticTimer::start() {
 }
 
 
+StaticTimer::Time StaticTimer::get_realtime() {
+#ifndef _WIN32
+	struct timespec ts;
+#ifdef CLOCK_MONOTONIC_COARSE
+	// much cheaper (no system call) but with a resolution of a few ms
+	clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+#else
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+	return (Time) ts.tv_sec + (Time) ts.tv_nsec / 1000000000.0;
+#else
+	struct mytimeval tv;
+	mygettimeofday(&tv);
+	return (Time) tv.tv_sec + (Time) tv.tv_usec / 1000000.0;
+#endif
+}
+
 StaticTimer::Time StaticTimer::get_localtime () {
 
 #ifndef _WIN32
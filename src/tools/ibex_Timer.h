@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 13, 2012
-// Last Update : May 13, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_TIMER_H__
@@ -17,6 +17,7 @@
 #include <sys/time.h>
 #include <sys/resource.h>
 #include <unistd.h>
+#include <time.h>
 
 #else
 /* A time value that is accurate to the nearest
@@ -41,19 +42,88 @@ class TimeOutException : public Exception { };
 /** \ingroup tools
  *
  * \brief Timer.
+ *
+ * The timer measures either the CPU time of the process (user+system
+ * time) or the elapsed real time (monotonic wall clock).
  */
 class Timer {
  public:
-	Timer();
+	/**
+	 * \brief Type of clock.
+	 *
+	 * CPU_TIME:  CPU time of the process.
+	 * REAL_TIME: elapsed real time.
+	 */
+	typedef enum { CPU_TIME, REAL_TIME } clock_type;
+
+	/**
+	 * \brief Create a timer (CPU time by default).
+	 */
+	Timer(clock_type clock=CPU_TIME);
 
 	void start();
 	void stop();
 	void restart();
 	double get_time();
+
+	/**
+	 * \brief Throw a TimeOutException if the time is greater than timeout.
+	 *
+	 * The clock is read at each call.
+	 */
 	void check(double timeout);
+
+	/**
+	 * \brief Same as #check(double) but only reads the clock from time to time.
+	 *
+	 * This function is meant to be called in a loop (e.g., once per cell
+	 * in a search): reading the clock is a system call (in particular for
+	 * the CPU time) which is not negligible when iterations are cheap.
+	 * The clock is read every n calls, where n is recomputed at each
+	 * reading from the measured time per call so that the clock is read
+	 * roughly every #check_interval seconds (or every #check_fraction of
+	 * the timeout, if smaller), with n at most #max_period.
+	 * The timeout may therefore be detected a bit late (of the order of
+	 * #check_interval).
+	 */
+	void check_amortized(double timeout);
+
+	/**
+	 * \brief The type of clock.
+	 *
+	 * Can only be changed when the timer is not running.
+	 */
+	clock_type clock;
+
+	/**
+	 * \brief Target time interval between two readings of
+	 * the clock in #check_amortized(double) (set to 0.001s).
+	 */
+	static constexpr double check_interval = 0.001;
+
+	/**
+	 * \brief Maximal time interval between two readings of the clock
+	 * in #check_amortized(double), relatively to the timeout (set to 1%).
+	 */
+	static constexpr double check_fraction = 0.01;
+
+	/**
+	 * \brief Maximal number of calls between two readings of the
+	 * clock in #check_amortized(double) (set to 1024).
+	 */
+	static constexpr unsigned int max_period = 1024;
+
 private:
-	  double start_time;
-	  bool active;
+	double get_clock() const;
+	void check_now(double timeout);
+
+	double start_time;
+	bool active;
+
+	// for check_amortized
+	unsigned int period;    // current number of calls between two readings
+	unsigned int countdown; // number of calls before next reading
+	double last_check;      // time at last reading
 };
 
 /** \ingroup tools
@@ -71,6 +141,8 @@ class StaticTimer {
 
   static Time get_localtime();
 
+  static Time get_realtime();
+
   static Time local_time;
 
 #ifdef _WIN32
@@ -88,5 +160,11 @@ class StaticTimer {
 #endif
 };
 
+/*================================== inline implementations ========================================*/
+
+inline void Timer::check_amortized(double timeout) {
+	if (--countdown==0) check_now(timeout);
+}
+
 } // end namespace ibex
 #endif // __IBEX_TIMER_H__
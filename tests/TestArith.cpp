@@ -11,8 +11,10 @@
 
 #include "TestArith.h"
 #include "ibex_Linear.h"
+#include "ibex_Setting.h"
 #include "utils.h"
 #include <float.h>
+#include <cstring>
 #define _USE_MATH_DEFINES
 #include <cmath>
 
@@ -669,6 +671,26 @@ void TestArith::bwd_pow15() { checkbwd_pow(Interval(-27,-8), Interval(-1,-1), In
 void TestArith::bwd_pow16() { checkbwd_pow(Interval(-27,-8), Interval(-4,-4), Interval::empty_set(), 3); }
 void TestArith::bwd_pow17() { checkbwd_pow(Interval(0,1), Interval(-10,10), Interval(-10,10), -2); }
 
+// interval exponent (only implemented with the SIMD library)
+void TestArith::bwd_pow18() {
+	if (strcmp(_IBEX_INTERVAL_LIB_,"simd")!=0) return;
+
+	Interval x1(1,3), x2(2,2);
+	CPPUNIT_ASSERT(bwd_pow(Interval(4,4),x1,x2));
+	CPPUNIT_ASSERT(x1.contains(2));
+	CPPUNIT_ASSERT(x1.diam()<1e-10);
+	CPPUNIT_ASSERT(x2==Interval(2,2));
+
+	x1=Interval(2,2); x2=Interval(0,10);
+	CPPUNIT_ASSERT(bwd_pow(Interval(8,16),x1,x2));
+	CPPUNIT_ASSERT(x2.is_superset(Interval(3,4)));
+	CPPUNIT_ASSERT(x2.is_subset(Interval(3-1e-10,4+1e-10)));
+
+	x1=Interval(1,3); x2=Interval(2,2);
+	CPPUNIT_ASSERT(!bwd_pow(Interval(10,20),x1,x2));
+	CPPUNIT_ASSERT(x1.is_empty() && x2.is_empty());
+}
+
 void TestArith::check_div2(const Interval& x, const Interval& y, const Interval& out1, const Interval& out2) {
 	Interval _out1,_out2;
 	div2(x,y,_out1,_out2);
@@ -0,0 +1,221 @@
+//============================================================================
+//                                  I B E X
+// File        : TestBoxBatch.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "TestBoxBatch.h"
+#include "ibex_BoxBatch.h"
+#include "ibex_CovList.h"
+#include "ibex_Random.h"
+
+#include <cstdio>
+#include <vector>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+IntervalVector rand_box(int n) {
+	IntervalVector b(n);
+	for (int i=0; i<n; i++) {
+		double c=RNG::rand(-10,10);
+		b[i]=Interval(c,c+RNG::rand(0,5));
+	}
+	return b;
+}
+
+} // end anonymous namespace
+
+void TestBoxBatch::storage01() {
+	for (int n=1; n<=9; n++) {
+		BoxBatch batch(n);
+		CPPUNIT_ASSERT(batch.stride()%4==0 && batch.stride()>=n);
+		vector<IntervalVector> boxes;
+		for (int i=0; i<20; i++) {
+			boxes.push_back(rand_box(n));
+			CPPUNIT_ASSERT(batch.push_back(boxes.back())==i);
+		}
+		CPPUNIT_ASSERT(batch.size()==20);
+		for (int i=0; i<20; i++)
+			CPPUNIT_ASSERT(batch[i]==boxes[i]);
+
+		batch.remove(3);
+		CPPUNIT_ASSERT(batch.size()==19);
+		CPPUNIT_ASSERT(batch[3]==boxes[19]);
+
+		BoxBatch batch2(batch);
+		CPPUNIT_ASSERT(batch2.size()==19);
+		CPPUNIT_ASSERT(batch2[0]==boxes[0]);
+		CPPUNIT_ASSERT(batch2.push_back(batch,1)==19);
+		CPPUNIT_ASSERT(batch2[19]==boxes[1]);
+	}
+}
+
+void TestBoxBatch::empty01() {
+	BoxBatch batch(5);
+	IntervalVector x(5,Interval(0,1));
+	batch.push_back(x);
+	x[3].set_empty();
+	batch.push_back(x);
+	batch.push_back(IntervalVector::empty(5));
+
+	CPPUNIT_ASSERT(!batch.is_empty(0));
+	CPPUNIT_ASSERT(batch.is_empty(1));
+	CPPUNIT_ASSERT(batch.is_empty(2));
+	CPPUNIT_ASSERT(batch[1].is_empty());
+	CPPUNIT_ASSERT(batch.max_diam(1)==0);
+	CPPUNIT_ASSERT(batch.diam(2)==Vector::zeros(5));
+
+	// the empty box is a subset of any box
+	CPPUNIT_ASSERT(batch.is_subset(1,batch,0));
+	CPPUNIT_ASSERT(!batch.is_subset(0,batch,1));
+	CPPUNIT_ASSERT(!batch.intersects(0,batch,2));
+
+	// the empty box does not intersect (-oo,+oo)^n
+	batch.push_back(IntervalVector(5));
+	CPPUNIT_ASSERT(!batch.intersects(2,batch,3));
+	CPPUNIT_ASSERT(!batch.intersects(3,batch,2));
+	CPPUNIT_ASSERT(!batch.intersects(2,batch,2));
+	CPPUNIT_ASSERT(batch.intersects(3,batch,3));
+	CPPUNIT_ASSERT(batch.intersects(3,batch,0)==IntervalVector(5).intersects(batch[0]));
+
+	batch.set_empty(0);
+	CPPUNIT_ASSERT(batch.is_empty(0));
+}
+
+void TestBoxBatch::inter_hull01() {
+	for (int n=1; n<=9; n++) {
+		BoxBatch batch(n);
+		vector<IntervalVector> boxes;
+		for (int i=0; i<20; i++) {
+			boxes.push_back(rand_box(n));
+			batch.push_back(boxes.back());
+		}
+
+		IntervalVector hull=IntervalVector::empty(n);
+		for (int i=0; i<20; i++) hull |= boxes[i];
+		CPPUNIT_ASSERT(batch.hull()==hull);
+
+		for (int i=0; i<19; i++) {
+			BoxBatch b(batch);
+			IntervalVector x=boxes[i] & boxes[i+1];
+			CPPUNIT_ASSERT(b.inter(i,batch,i+1)==!x.is_empty());
+			CPPUNIT_ASSERT(b.intersects(i+1,batch,i)==!x.is_empty());
+			CPPUNIT_ASSERT(b[i]==x);
+			CPPUNIT_ASSERT(b.is_empty(i)==x.is_empty());
+
+			b.hull(i+1,batch,i);
+			CPPUNIT_ASSERT(b[i+1]==(boxes[i] | boxes[i+1]));
+		}
+
+		IntervalVector y=rand_box(n);
+		batch.inter(y);
+		for (int i=0; i<20; i++)
+			CPPUNIT_ASSERT(batch[i]==(boxes[i] & y));
+	}
+}
+
+void TestBoxBatch::subset01() {
+	for (int n=1; n<=9; n++) {
+		BoxBatch batch(n);
+		IntervalVector x=rand_box(n);
+		IntervalVector y=x;
+		y[n-1]=y[n-1].mid();
+		batch.push_back(x);
+		batch.push_back(y);
+		CPPUNIT_ASSERT(batch.is_subset(1,batch,0));
+		CPPUNIT_ASSERT(!batch.is_subset(0,batch,1));
+		CPPUNIT_ASSERT(batch.is_subset(0,batch,0));
+		CPPUNIT_ASSERT(batch.intersects(0,batch,1));
+	}
+}
+
+void TestBoxBatch::diam_mid01() {
+	for (int n=1; n<=9; n++) {
+		BoxBatch batch(n);
+		for (int i=0; i<20; i++) {
+			IntervalVector x=rand_box(n);
+			batch.push_back(x);
+			CPPUNIT_ASSERT(batch.diam(i)==x.diam());
+			CPPUNIT_ASSERT(batch.max_diam(i)==x.max_diam());
+			CPPUNIT_ASSERT(almost_eq(IntervalVector(batch.mid(i)),IntervalVector(x.mid()),1e-12));
+			CPPUNIT_ASSERT(almost_eq(IntervalVector(batch.rad(i)),IntervalVector(x.rad()),1e-12));
+			CPPUNIT_ASSERT(x.contains(batch.mid(i)));
+		}
+	}
+}
+
+void TestBoxBatch::unbounded01() {
+	IntervalVector x(6);
+	x[0]=Interval::all_reals();
+	x[1]=Interval::pos_reals();
+	x[2]=Interval::neg_reals();
+	x[3]=Interval(-2,2);
+	x[4]=Interval(1,POS_INFINITY);
+	x[5]=Interval(3);
+	BoxBatch batch(6);
+	batch.push_back(x);
+	CPPUNIT_ASSERT(batch.mid(0)==x.mid());
+	CPPUNIT_ASSERT(batch.diam(0)==x.diam());
+	CPPUNIT_ASSERT(batch.max_diam(0)==POS_INFINITY);
+	CPPUNIT_ASSERT(batch.rad(0)==x.rad());
+}
+
+void TestBoxBatch::find01() {
+	for (int n=1; n<=9; n++) {
+		BoxBatch batch(n);
+		vector<IntervalVector> boxes;
+		for (int i=0; i<20; i++) {
+			boxes.push_back(rand_box(n));
+			batch.push_back(boxes.back());
+		}
+		for (int i=0; i<20; i++) {
+			Vector pt=boxes[i].mid();
+			int j=batch.find(pt);
+			CPPUNIT_ASSERT(j>=0 && j<=i && boxes[j].contains(pt));
+			for (int k=0; k<j; k++)
+				CPPUNIT_ASSERT(!boxes[k].contains(pt));
+			CPPUNIT_ASSERT(batch.find(pt,i+1)==-1 || boxes[batch.find(pt,i+1)].contains(pt));
+		}
+		CPPUNIT_ASSERT(batch.find(Vector(n,100.0))==-1);
+	}
+}
+
+void TestBoxBatch::cov01() {
+	CovList cov(3);
+	for (int i=0; i<10; i++)
+		cov.add(rand_box(3));
+
+	BoxBatch batch(3);
+	cov.boxes(batch);
+	CPPUNIT_ASSERT(batch.size()==10);
+	for (int i=0; i<10; i++)
+		CPPUNIT_ASSERT(batch[i]==cov[i]);
+
+	CovList cov2(3);
+	cov2.add(batch);
+	CPPUNIT_ASSERT(cov2.size()==10);
+	for (int i=0; i<10; i++)
+		CPPUNIT_ASSERT(cov2[i]==cov[i]);
+
+	char filename[]="test_boxbatch.cov";
+	cov.save(filename);
+	CovList::Reader reader(filename);
+	BoxBatch batch2(3);
+	CPPUNIT_ASSERT(reader.next(batch2,4)==4);
+	CPPUNIT_ASSERT(reader.next(batch2,4)==4);
+	CPPUNIT_ASSERT(reader.next(batch2,4)==2);
+	CPPUNIT_ASSERT(reader.next(batch2,4)==0);
+	CPPUNIT_ASSERT(batch2.size()==10);
+	for (int i=0; i<10; i++)
+		CPPUNIT_ASSERT(batch2[i]==cov[i]);
+	remove(filename);
+}
+
+} // end namespace
@@ -0,0 +1,50 @@
+/* ============================================================================
+ * I B E X - Box batch Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_BOX_BATCH_H__
+#define __TEST_BOX_BATCH_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestBoxBatch : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestBoxBatch);
+	CPPUNIT_TEST(storage01);
+	CPPUNIT_TEST(empty01);
+	CPPUNIT_TEST(inter_hull01);
+	CPPUNIT_TEST(subset01);
+	CPPUNIT_TEST(diam_mid01);
+	CPPUNIT_TEST(unbounded01);
+	CPPUNIT_TEST(find01);
+	CPPUNIT_TEST(cov01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void storage01();
+	void empty01();
+	void inter_hull01();
+	void subset01();
+	void diam_mid01();
+	void unbounded01();
+	void find01();
+	void cov01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestBoxBatch);
+
+} // end namespace
+
+#endif // __TEST_BOX_BATCH_H__
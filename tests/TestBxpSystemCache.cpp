@@ -13,6 +13,7 @@
 
 #include "ibex_BxpSystemCache.h"
 #include "ibex_SystemFactory.h"
+#include "ibex_LinearizerDuality.h"
 
 using namespace std;
 
@@ -321,5 +322,112 @@ void TestBxpSystemCache::active_ctrs_jacobian() {
 	CPPUNIT_ASSERT(J[1][1]==2*Interval(0,8));
 }
 
+void TestBxpSystemCache::impact() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_goal(x+y);
+	System sys(fac);
+
+	BxpSystemCache cache(sys,0.1);
+	IntervalVector box(sys.nb_var,Interval(0,100));
+	BoxProperties prop(box);
+
+	cache.update(BoxEvent(box,BoxEvent::CONTRACT),prop);
+	CPPUNIT_ASSERT(cache.goal_eval()==Interval(0,200));
+
+	// y is significantly contracted but the impact
+	// only contains x: the cache is not checked on y
+	box[1]=Interval(0,50);
+	cache.update(BoxEvent(box,BoxEvent::CONTRACT,BitSet::singleton(2,0)),prop);
+	CPPUNIT_ASSERT(cache.goal_eval()==Interval(0,200));
+
+	cache.update(BoxEvent(box,BoxEvent::CONTRACT,BitSet::singleton(2,1)),prop);
+	CPPUNIT_ASSERT(cache.goal_eval()==Interval(0,150));
+}
+
+void TestBxpSystemCache::sync() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_goal(x);
+	System sys(fac);
+
+	IntervalVector box(sys.nb_var,Interval(0,100));
+	BoxProperties prop(box);
+	CPPUNIT_ASSERT(BxpSystemCache::get(sys,prop,box)==NULL);
+
+	BxpSystemCache::add_property(sys,prop);
+	prop.update(BoxEvent(box,BoxEvent::CONTRACT));
+	CPPUNIT_ASSERT(BxpSystemCache::get(sys,prop,box)->goal_eval()==Interval(0,100));
+
+	// slightly contracted box: the cache is kept
+	box[0]=Interval(0,99);
+	CPPUNIT_ASSERT(BxpSystemCache::get(sys,prop,box)->goal_eval()==Interval(0,100));
+
+	// box not included in the cache: the cache is updated,
+	// even if no event has been notified.
+	box[0]=Interval(-1,99);
+	CPPUNIT_ASSERT(BxpSystemCache::get(sys,prop,box)->goal_eval()==Interval(-1,99));
+}
+
+void TestBxpSystemCache::statistics() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_goal(x);
+	fac.add_ctr(x<=0);
+	System sys(fac);
+
+	Statistics stats;
+	StsSystemCache* sts=BxpSystemCache::enable_statistics(sys,stats);
+	CPPUNIT_ASSERT(BxpSystemCache::enable_statistics(sys,stats)==sts);
+
+	IntervalVector box(sys.nb_var,Interval(0,100));
+	BxpSystemCache cache(sys,0.1,sts);
+	BoxProperties prop(box);
+	cache.update(BoxEvent(box,BoxEvent::CONTRACT),prop);
+
+	cache.goal_eval();
+	cache.goal_eval();
+	cache.ctrs_eval();
+	CPPUNIT_ASSERT(sts->nb_misses(StsSystemCache::GOAL_EVAL)==1);
+	CPPUNIT_ASSERT(sts->nb_hits(StsSystemCache::GOAL_EVAL)==1);
+	CPPUNIT_ASSERT(sts->nb_misses(StsSystemCache::CTRS_EVAL)==1);
+	CPPUNIT_ASSERT(sts->nb_hits(StsSystemCache::CTRS_EVAL)==0);
+}
+
+void TestBxpSystemCache::linearizer_duality() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	SystemFactory fac;
+	fac.add_var(x,Interval(-10,10));
+	fac.add_var(y,Interval(-10,10));
+	fac.add_goal(sqr(x)+sqr(y));
+	fac.add_ctr(x+y>=1);
+	fac.add_ctr(x-y<=5);
+	System sys(fac);
+	NormalizedSystem nsys(sys);
+
+	LinearizerDuality lr(nsys);
+	Statistics stats;
+	lr.enable_statistics(stats,"");
+	StsSystemCache* sts=BxpSystemCache::enable_statistics(nsys,stats);
+
+	IntervalVector box(2,Interval(0,1));
+	BoxProperties prop(box);
+	lr.add_property(box,prop);
+	CPPUNIT_ASSERT(prop[BxpSystemCache::get_id(nsys)]!=NULL);
+
+	LPSolver lp_solver(nsys.nb_var*(1+nsys.f_ctrs.image_dim()));
+	CPPUNIT_ASSERT(lr.linearize(box,lp_solver,prop)>0);
+	lp_solver.clear_constraints();
+	CPPUNIT_ASSERT(lr.linearize(box,lp_solver,prop)>0);
+	CPPUNIT_ASSERT(sts->nb_misses(StsSystemCache::ACTIVE_CTRS)==1);
+	CPPUNIT_ASSERT(sts->nb_hits(StsSystemCache::ACTIVE_CTRS)==1);
+}
+
 } // end namespace
 
@@ -16,6 +16,7 @@
 #include <cppunit/extensions/HelperMacros.h>
 
 #include "utils.h"
+#include "ibex_LPSolver.h"
 
 namespace ibex {
 
@@ -32,6 +33,12 @@ public:
 	CPPUNIT_TEST(is_inner);
 	CPPUNIT_TEST(active_ctrs_eval);
 	CPPUNIT_TEST(active_ctrs_jacobian);
+	CPPUNIT_TEST(impact);
+	CPPUNIT_TEST(sync);
+	CPPUNIT_TEST(statistics);
+#ifndef __IBEX_NO_LP_SOLVER__
+	CPPUNIT_TEST(linearizer_duality);
+#endif
 	CPPUNIT_TEST_SUITE_END();
 
 	void goal_eval01();
@@ -42,6 +49,11 @@ public:
 	void is_inner();
 	void active_ctrs_eval();
 	void active_ctrs_jacobian();
+	void impact();
+	void sync();
+	void statistics();
+	// the active constraints are read from the cache
+	void linearizer_duality();
 
 };
 
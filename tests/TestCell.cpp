@@ -5,7 +5,7 @@
 // Copyright   : ENSTA Bretagne (France)
 // License     : See the LICENSE file
 // Created     : Oct 10, 2016
-// Last Update : Oct 10, 2016
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "TestCell.h"
@@ -15,7 +15,7 @@
 #include "ibex_LargestFirst.h"
 #include "ibex_SystemFactory.h"
 #include "ibex_NormalizedSystem.h"
-#include "ibex_Cell.h"
+#include "ibex_Pool.h"
 
 //using namespace std;
 
@@ -116,6 +116,41 @@ void TestCell::test02() {
 
 }
 
+void TestCell::pool01() {
+	IntervalVector box(2, Interval(-1,1));
+	Cell* outside=new Cell(box);
+
+	Cell* last;
+	{
+		Pool::Scope pool(true);
+		CPPUNIT_ASSERT(Pool::enabled());
+
+		Cell* root=new Cell(box);
+		root->prop.add(new BxpTest());
+
+		LargestFirst bsc;
+		std::pair<Cell*, Cell*> new_cells = bsc.bisect(*root);
+		delete root;
+		check(new_cells.first->box | new_cells.second->box, box);
+		CPPUNIT_ASSERT(((BxpTest*) new_cells.first->prop[BxpTest::id])->n == 10);
+
+		Cell* c=new_cells.first;
+		delete c;
+		// the block is recycled
+		last=new Cell(box);
+		CPPUNIT_ASSERT(last==c);
+
+		delete new_cells.second;
+
+		// a cell created before can be released in the pool
+		delete outside;
+	}
+	CPPUNIT_ASSERT(!Pool::enabled());
+
+	// a cell created in the pool can be released after
+	check(last->box, box);
+	delete last;
+}
 
 } // end namespace
 
@@ -47,10 +47,12 @@ public:
 	CPPUNIT_TEST_SUITE(TestCell);
 	CPPUNIT_TEST(test01);
 	CPPUNIT_TEST(test02);
+	CPPUNIT_TEST(pool01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
 	void test02();
+	void pool01();
 
 };
 
@@ -1057,3 +1057,82 @@ void TestCov::write_covSolverDatafile(ScenarioType scenario) {
 
 	remove_file(tmpname);
 }
+
+void TestCov::stream_covSolverDatafile(ScenarioType scenario) {
+	char *tmpname = (char*) malloc(L_tmpnam);
+	char* ret=tmpnam(tmpname);
+	assert(ret!=NULL);
+
+	size_t nb_eq = (scenario==INEQ_EQ_ONLY || scenario==INEQ_HALF_BALL) ? 0 : m;
+
+	CovManifold::BoundaryType boundary_type = (scenario==INEQ_EQ_ONLY || scenario==EQ_ONLY) ? CovManifold::EQU_ONLY : CovManifold::HALF_BALL;
+
+	vector<string> var_names;
+	for (size_t i=0; i<n; i++)
+		var_names.push_back(solver_var_names[i]);
+
+	vector<IntervalVector> b=boxes();
+
+	// same boxes as build_covSolverData, but written on the fly
+	CovSolverData::Writer* writer = new CovSolverData::Writer(tmpname, n, nb_eq, nb_ineq, boundary_type, var_names);
+
+	int isol=0;
+	int ibnd=0;
+	for (size_t i=0; i<N; i++) {
+		if (is_sol[i]) {
+			if (nb_eq==0)
+				writer->add_inner(b[i]);
+			else {
+				BitSet bitset(n);
+				IntervalVector unicity=b[sol[isol]];
+				unicity.inflate(unicity_infl);
+
+				for (size_t j=0; j<n-m; j++)
+					bitset.add(varset_sol[isol][j]);
+				writer->add_solution(b[i], unicity, VarSet(n,bitset,false));
+				isol++;
+			}
+		} else if (is_bnd[i]) {
+			if (nb_eq>0 && m<n) {
+				BitSet bitset(n);
+				for (size_t j=0; j<n-m; j++)
+					bitset.add(varset_bnd[ibnd][j]);
+				writer->add_boundary(b[i], VarSet(n,bitset,false));
+				ibnd++;
+			} else
+				writer->add_boundary(b[i]);
+		} else if (is_pen[i]) {
+			writer->add_pending(b[i]);
+		} else
+			writer->add_unknown(b[i]);
+	}
+
+	writer->set_time(solver_time);
+	writer->set_solver_status(solver_status);
+	writer->set_nb_cells(solver_nb_cells);
+
+	CPPUNIT_ASSERT(writer->size()==N);
+	CPPUNIT_ASSERT(writer->nb_solution()==nsol);
+	CPPUNIT_ASSERT(writer->nb_pending()==npen);
+	delete writer; // closes the file
+
+	CovSolverData cov(tmpname);
+	test_covSolverData(scenario, cov);
+
+	CovSolverData::Reader reader(tmpname);
+	CPPUNIT_ASSERT(reader.size()==N);
+	CPPUNIT_ASSERT(reader.nb_pending()==npen);
+	CPPUNIT_ASSERT(reader.nb_unknown()==nunk);
+
+	IntervalVector box(n);
+	CovSolverData::BoxStatus status;
+	size_t i=0;
+	while (reader.next(box, status)) {
+		CPPUNIT_ASSERT(box==b[i]);
+		CPPUNIT_ASSERT(status==cov.status(i));
+		i++;
+	}
+	CPPUNIT_ASSERT(i==N);
+
+	remove_file(tmpname);
+}
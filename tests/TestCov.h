@@ -63,6 +63,7 @@ public:
 	CPPUNIT_TEST(read_covSolverDatafile1_scenario1);
 	CPPUNIT_TEST(read_covSolverDatafile2_scenario1);
 	CPPUNIT_TEST(write_covSolverDatafile_scenario1);
+	CPPUNIT_TEST(stream_covSolverDatafile_scenario1);
 
 	CPPUNIT_TEST(covfac_scenario2);
 	CPPUNIT_TEST(read_covfile_scenario2);
@@ -92,6 +93,7 @@ public:
 	CPPUNIT_TEST(read_covSolverDatafile1_scenario2);
 	CPPUNIT_TEST(read_covSolverDatafile2_scenario2);
 	CPPUNIT_TEST(write_covSolverDatafile_scenario2);
+	CPPUNIT_TEST(stream_covSolverDatafile_scenario2);
 
 	CPPUNIT_TEST(covfac_scenario3);
 	CPPUNIT_TEST(read_covfile_scenario3);
@@ -121,6 +123,7 @@ public:
 	CPPUNIT_TEST(read_covSolverDatafile1_scenario3);
 	CPPUNIT_TEST(read_covSolverDatafile2_scenario3);
 	CPPUNIT_TEST(write_covSolverDatafile_scenario3);
+	CPPUNIT_TEST(stream_covSolverDatafile_scenario3);
 
 	CPPUNIT_TEST(covfac_scenario4);
 	CPPUNIT_TEST(read_covfile_scenario4);
@@ -150,6 +153,7 @@ public:
 	CPPUNIT_TEST(read_covSolverDatafile1_scenario4);
 	CPPUNIT_TEST(read_covSolverDatafile2_scenario4);
 	CPPUNIT_TEST(write_covSolverDatafile_scenario4);
+	CPPUNIT_TEST(stream_covSolverDatafile_scenario4);
 
 	CPPUNIT_TEST_SUITE_END();
 
@@ -211,6 +215,7 @@ private:
 	void read_covSolverDatafile1(ScenarioType scenario);
 	void read_covSolverDatafile2(ScenarioType scenario);
 	void write_covSolverDatafile(ScenarioType scenario);
+	void stream_covSolverDatafile(ScenarioType scenario);
 
 	void covfac_scenario1()                  { covfac(INEQ_EQ_ONLY); }
 	void read_covfile_scenario1()            { read_covfile(INEQ_EQ_ONLY); }
@@ -241,6 +246,7 @@ private:
 	void read_covSolverDatafile1_scenario1() { read_covSolverDatafile1(INEQ_EQ_ONLY); }
 	void read_covSolverDatafile2_scenario1() { read_covSolverDatafile2(INEQ_EQ_ONLY); }
 	void write_covSolverDatafile_scenario1() { write_covSolverDatafile(INEQ_EQ_ONLY); }
+	void stream_covSolverDatafile_scenario1() { stream_covSolverDatafile(INEQ_EQ_ONLY); }
 
 	void covfac_scenario2()                  { covfac(INEQ_HALF_BALL); }
 	void read_covfile_scenario2()            { read_covfile(INEQ_HALF_BALL); }
@@ -271,6 +277,7 @@ private:
 	void read_covSolverDatafile1_scenario2() { read_covSolverDatafile1(INEQ_HALF_BALL); }
 	void read_covSolverDatafile2_scenario2() { read_covSolverDatafile2(INEQ_HALF_BALL); }
 	void write_covSolverDatafile_scenario2() { write_covSolverDatafile(INEQ_HALF_BALL); }
+	void stream_covSolverDatafile_scenario2() { stream_covSolverDatafile(INEQ_HALF_BALL); }
 
 	void covfac_scenario3()                  { covfac(EQ_ONLY); }
 	void read_covfile_scenario3()            { read_covfile(EQ_ONLY); }
@@ -301,6 +308,7 @@ private:
 	void read_covSolverDatafile1_scenario3() { read_covSolverDatafile1(EQ_ONLY); }
 	void read_covSolverDatafile2_scenario3() { read_covSolverDatafile2(EQ_ONLY); }
 	void write_covSolverDatafile_scenario3() { write_covSolverDatafile(EQ_ONLY); }
+	void stream_covSolverDatafile_scenario3() { stream_covSolverDatafile(EQ_ONLY); }
 
 	void covfac_scenario4()                  { covfac(HALF_BALL); }
 	void read_covfile_scenario4()            { read_covfile(HALF_BALL); }
@@ -331,6 +339,7 @@ private:
 	void read_covSolverDatafile1_scenario4() { read_covSolverDatafile1(HALF_BALL); }
 	void read_covSolverDatafile2_scenario4() { read_covSolverDatafile2(HALF_BALL); }
 	void write_covSolverDatafile_scenario4() { write_covSolverDatafile(HALF_BALL); }
+	void stream_covSolverDatafile_scenario4() { stream_covSolverDatafile(HALF_BALL); }
 
 	static const size_t n = 3;
 	static const size_t m = 1;
@@ -0,0 +1,94 @@
+/* ============================================================================
+ * I B E X - CtcKuhnTuckerLP Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcKuhnTuckerLP.h"
+#include "ibex_CtcKuhnTuckerLP.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// extended box (the last variable is the goal)
+IntervalVector ext_box(double x1, double x2, double y1, double y2) {
+	IntervalVector box(3);
+	box[0]=Interval(x1,x2);
+	box[1]=Interval(y1,y2);
+	box[2]=Interval(-1e6,1e6);
+	return box;
+}
+
+}
+
+// min (x-1)^2+(y-2)^2 (nothing active inside the system box)
+void TestCtcKuhnTuckerLP::unconstrained() {
+	Variable x,y;
+	SystemFactory fac;
+	fac.add_var(x,Interval(-10,10));
+	fac.add_var(y,Interval(-10,10));
+	fac.add_goal(sqr(x-1)+sqr(y-2));
+	System sys(fac);
+	NormalizedSystem nsys(sys);
+
+	CtcKuhnTuckerLP kkt(nsys);
+
+	IntervalVector box=ext_box(3,4,3,4);
+	kkt.contract(box);
+	CPPUNIT_ASSERT(box.is_empty());
+
+	box=ext_box(0,2,1,3);
+	kkt.contract(box);
+	CPPUNIT_ASSERT(!box.is_empty());
+	CPPUNIT_ASSERT(box[0].contains(1) && box[1].contains(2));
+	CPPUNIT_ASSERT(box[0].diam()<1e-10 && box[1].diam()<1e-10);
+}
+
+// min (x-1)^2+(y-2)^2 s.t. x+y<=2 and x^2-y<=1.
+// The minimizer is (0.5,1.5).
+void TestCtcKuhnTuckerLP::grid() {
+	Variable x,y;
+	SystemFactory fac;
+	fac.add_var(x,Interval(-10,10));
+	fac.add_var(y,Interval(-10,10));
+	fac.add_goal(sqr(x-1)+sqr(y-2));
+	fac.add_ctr(x+y<=2);
+	fac.add_ctr(sqr(x)-y<=1);
+	System sys(fac);
+	NormalizedSystem nsys(sys);
+
+	CtcKuhnTuckerLP kkt(nsys);
+
+	Vector sol(2);
+	sol[0]=0.5;
+	sol[1]=1.5;
+
+	// 10x10 boxes of [-2,3]x[-1,4]. The 4 boxes that have the minimizer
+	// as a corner must keep it, all the others are rejected.
+	// (Note: the linearization with symbolic derivatives of the Hessian
+	// matrices used before left one more box).
+	int nb_empty=0;
+	for (int i=0; i<10; i++) {
+		for (int j=0; j<10; j++) {
+			IntervalVector box=ext_box(-2+0.5*i, -1.5+0.5*i, -1+0.5*j, -0.5+0.5*j);
+			bool with_sol=box.subvector(0,1).contains(sol);
+			kkt.contract(box);
+			if (box.is_empty())
+				nb_empty++;
+			if (with_sol)
+				CPPUNIT_ASSERT(!box.is_empty() && box.subvector(0,1).contains(sol));
+		}
+	}
+	CPPUNIT_ASSERT(nb_empty==96);
+}
+
+} // end namespace
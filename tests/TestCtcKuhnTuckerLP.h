@@ -0,0 +1,41 @@
+/* ============================================================================
+ * I B E X - CtcKuhnTuckerLP Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_KUHN_TUCKER_LP_H__
+#define __TEST_CTC_KUHN_TUCKER_LP_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+#include "ibex_LPSolver.h"
+
+namespace ibex {
+
+class TestCtcKuhnTuckerLP : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcKuhnTuckerLP);
+#ifndef __IBEX_NO_LP_SOLVER__
+	CPPUNIT_TEST(unconstrained);
+	CPPUNIT_TEST(grid);
+#endif
+	CPPUNIT_TEST_SUITE_END();
+
+	void unconstrained();
+	void grid();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcKuhnTuckerLP);
+
+} // namespace ibex
+
+#endif // __TEST_CTC_KUHN_TUCKER_LP_H__
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 10, 2012
-// Last Update : Apr 10, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "TestCtcPolytopeHull.h"
@@ -17,6 +17,7 @@
 #include "ibex_CtcPolytopeHull.h"
 #include "ibex_LinearizerXTaylor.h"
 #include "ibex_Array.h"
+#include "ibex_StsLPSolver.h"
 
 using namespace std;
 
@@ -67,5 +68,49 @@ void TestCtcPolytopeHull::fixbug01() {
 	check(box,box2);
 }
 
+void TestCtcPolytopeHull::warm_start01() {
+	int n=4;
+	Variable x(n);
+	SystemFactory f;
+	f.add_var(x);
+	for (int i=0; i<n; i++)
+		f.add_ctr(sqr(x[i])-0.5*x[(i+1)%n]*x[(i+2)%n]+0.3*x[(i+3)%n]=0.2);
+	System sys(f);
+
+	LinearizerXTaylor lr(sys,LinearizerXTaylor::RELAX,LinearizerXTaylor::INF);
+	CtcPolytopeHull ctc(lr);
+	Statistics stats;
+	ctc.enable_statistics(stats,"");
+
+	IntervalVector box(n,Interval(-2,2));
+	BoxProperties prop(box);
+	ctc.add_property(box,prop);
+	ContractContext context(prop);
+	ctc.contract(box,context);
+	CPPUNIT_ASSERT(!box.is_empty());
+
+	for (int k=0; k<2; k++) {
+		IntervalVector sub=k==0? box.bisect(0).first : box.bisect(0).second;
+		IntervalVector sub_cold(sub);
+
+		// the child inherits the bases of the parent
+		BoxProperties sub_prop(sub,prop);
+		ContractContext sub_context(sub_prop);
+		ctc.contract(sub,sub_context);
+
+		// same result as without warm start
+		LinearizerXTaylor lr2(sys,LinearizerXTaylor::RELAX,LinearizerXTaylor::INF);
+		CtcPolytopeHull ctc2(lr2);
+		ctc2.contract(sub_cold);
+		CPPUNIT_ASSERT(sub.is_empty() == sub_cold.is_empty());
+		if (!sub.is_empty()) CPPUNIT_ASSERT(almost_eq(sub,sub_cold,1e-8));
+	}
+
+	// the LP of each bound starts from the basis of the parent
+	// (not only the first LP of each child)
+	StsLPSolver* sts=(StsLPSolver*) stats.find("/PolytopeHull/LP Solver");
+	CPPUNIT_ASSERT(sts && sts->nb_warm_starts()>2);
+}
+
 
 } // end namespace ibex
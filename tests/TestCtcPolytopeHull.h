@@ -27,6 +27,7 @@ public:
 
 		CPPUNIT_TEST(lp01);
 		CPPUNIT_TEST(fixbug01);
+		CPPUNIT_TEST(warm_start01);
 
 #endif //__IBEX_NO_LP_SOLVER__
 
@@ -35,6 +36,8 @@ public:
 	void lp01();
 
 	void fixbug01();
+
+	void warm_start01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcPolytopeHull);
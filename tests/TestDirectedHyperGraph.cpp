@@ -0,0 +1,88 @@
+/* ============================================================================
+ * I B E X - TestDirectedHyperGraph
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestDirectedHyperGraph.h"
+#include "ibex_DirectedHyperGraph.h"
+
+using namespace std;
+
+namespace {
+
+bool same(const DirectedHyperGraph::Adj& a, const vector<int>& v) {
+	if (a.size()!=(int) v.size()) return false;
+	int i=0;
+	for (int x : a)
+		if (x!=v[i++]) return false;
+	return true;
+}
+
+}
+
+void TestDirectedHyperGraph::test01() {
+	// 3 constraints, 4 variables
+	DirectedHyperGraph g(3,4);
+	g.add_arc(2,3,true);
+	g.add_arc(0,1,true);
+	g.add_arc(0,0,true);
+	g.add_arc(0,0,false);
+	g.add_arc(1,3,false);
+	g.add_arc(2,1,true);
+	g.add_arc(2,1,false);
+	CPPUNIT_ASSERT(!g.frozen());
+	g.freeze();
+	CPPUNIT_ASSERT(g.frozen());
+
+	CPPUNIT_ASSERT(same(g.input_vars(0),  {0,1}));
+	CPPUNIT_ASSERT(same(g.output_vars(0), {0}));
+	CPPUNIT_ASSERT(same(g.input_vars(1),  {}));
+	CPPUNIT_ASSERT(same(g.output_vars(1), {3}));
+	CPPUNIT_ASSERT(same(g.input_vars(2),  {1,3}));
+	CPPUNIT_ASSERT(same(g.output_vars(2), {1}));
+
+	CPPUNIT_ASSERT(same(g.output_ctrs(0), {0}));
+	CPPUNIT_ASSERT(same(g.input_ctrs(0),  {0}));
+	CPPUNIT_ASSERT(same(g.output_ctrs(1), {0,2}));
+	CPPUNIT_ASSERT(same(g.input_ctrs(1),  {2}));
+	CPPUNIT_ASSERT(same(g.output_ctrs(2), {}));
+	CPPUNIT_ASSERT(same(g.input_ctrs(2),  {}));
+	CPPUNIT_ASSERT(same(g.output_ctrs(3), {2}));
+	CPPUNIT_ASSERT(same(g.input_ctrs(3),  {1}));
+
+	CPPUNIT_ASSERT(g.input_vars(2)[1]==3);
+	CPPUNIT_ASSERT(g.input_vars(1).empty());
+}
+
+void TestDirectedHyperGraph::duplicate01() {
+	DirectedHyperGraph g(2,2);
+	g.add_arc(1,0,true);
+	g.add_arc(0,0,true);
+	g.add_arc(1,0,true);
+	g.add_arc(1,1,false);
+	g.add_arc(1,1,false);
+	g.freeze();
+	CPPUNIT_ASSERT(same(g.input_vars(1),  {0}));
+	CPPUNIT_ASSERT(same(g.output_vars(1), {1}));
+	CPPUNIT_ASSERT(same(g.output_ctrs(0), {0,1}));
+	CPPUNIT_ASSERT(same(g.input_ctrs(1),  {1}));
+}
+
+void TestDirectedHyperGraph::empty01() {
+	DirectedHyperGraph g(2,3);
+	g.freeze();
+	for (int c=0; c<2; c++) {
+		CPPUNIT_ASSERT(g.input_vars(c).empty());
+		CPPUNIT_ASSERT(g.output_vars(c).empty());
+	}
+	for (int v=0; v<3; v++) {
+		CPPUNIT_ASSERT(g.input_ctrs(v).empty());
+		CPPUNIT_ASSERT(g.output_ctrs(v).empty());
+	}
+}
@@ -245,5 +245,49 @@ void TestDoubleHeap::test05() {
 
 }
 
+// many elements (several levels in the heaps) and mixed
+// push/pop/contract: the popped data must be in the right order.
+void TestDoubleHeap::test06() {
+    TestCostFunc2 costf2;
+    TestCostFunc3 costf3;
+    costf3.set_loup(1);
+
+    DoubleHeap<Interval> h(costf2,false,costf3,true,50);
+
+    for (int i=0; i<1000; i++) {
+        double lb=(i*7919)%1000;
+        h.push(new Interval(lb,lb+(i*104729)%97));
+    }
+
+    int nb_left=500; // number of data with lb<=499
+    for (int i=0; i<100; i++) {
+        double min1=h.minimum1();
+        Interval* x=h.pop1();
+        CPPUNIT_ASSERT(x->lb()==min1);
+        CPPUNIT_ASSERT(h.minimum1()>=min1);
+        if (x->lb()<=499) nb_left--;
+        delete x;
+
+        double min2=h.minimum2();
+        x=h.pop2();
+        CPPUNIT_ASSERT(x->ub()==min2);
+        CPPUNIT_ASSERT(h.minimum2()>=min2);
+        if (x->lb()<=499) nb_left--;
+        delete x;
+    }
+    CPPUNIT_ASSERT(h.size()==800);
+
+    h.contract(499);
+    CPPUNIT_ASSERT((int) h.size()==nb_left);
+
+    double last1=NEG_INFINITY;
+    while (!h.empty()) {
+        Interval* x=h.pop1();
+        CPPUNIT_ASSERT(x->lb()<=499);
+        CPPUNIT_ASSERT(x->lb()>=last1);
+        last1=x->lb();
+        delete x;
+    }
+}
 
 } // end namespace
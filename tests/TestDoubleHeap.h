@@ -30,6 +30,7 @@ public:
 	CPPUNIT_TEST(test03);
 	CPPUNIT_TEST(test04);
 	CPPUNIT_TEST(test05);
+	CPPUNIT_TEST(test06);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
@@ -37,6 +38,7 @@ public:
 	void test03();
 	void test04();
 	void test05();
+	void test06();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestDoubleHeap);
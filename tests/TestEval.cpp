@@ -7,13 +7,18 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Apr 02, 2012
- * Last update : Jul 10, 2019
+ * Last update : Oct 17, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "TestEval.h"
 #include "ibex_Function.h"
 #include "ibex_Expr.h"
 #include "ibex_Eval.h"
+#include "ibex_EvalContext.h"
+
+#ifndef _WIN32
+#include <thread>
+#endif
 
 using namespace std;
 
@@ -301,4 +306,226 @@ void TestEval::matrix_components() {
 	CPPUNIT_ASSERT(f.basic_evaluator().d[rank_row_1].v()==row1);
 }
 
+void TestEval::context01() {
+	const ExprSymbol& x = ExprSymbol::new_();
+	Function f(x,Return(x,x+1,ExprVector::COL));
+
+	f.eval_vector(IntervalVector(1,Interval(1,1)));
+
+	EvalContext c(f);
+	double _v2[]={2,3};
+	CPPUNIT_ASSERT(c.eval_vector(IntervalVector(1,Interval(2,2)))==Vector(2,_v2));
+
+	// the domains of the default evaluator are unchanged
+	double _v1[]={1,2};
+	CPPUNIT_ASSERT(f.basic_evaluator().d.top->v()==Vector(2,_v1));
+
+	IntervalVector box(1,Interval(0,10));
+	c.backward(IntervalVector(2,Interval(2,3)),box);
+	CPPUNIT_ASSERT(box[0]==Interval(2,2));
+}
+
+void TestEval::context02() {
+	const ExprSymbol& x1 = ExprSymbol::new_("x1");
+	const ExprSymbol& x2 = ExprSymbol::new_("x2");
+	const ExprSymbol& x3 = ExprSymbol::new_("x3");
+
+	Function f1(x1,sqr(x1));
+	Function f2(x2,x2+Interval(1,1));
+	Function f3(x3,Return(f2(f1(x3)),x3-1));
+
+	EvalContext c(f3);
+	IntervalVector _x3(1,Interval(3,3));
+	CPPUNIT_ASSERT(c.eval_vector(_x3)==f3.eval_vector(_x3));
+
+	BitSet components=BitSet::singleton(2,0);
+	CPPUNIT_ASSERT(c.basic_evaluator().eval(_x3,components).i()==Interval(10,10));
+
+	IntervalMatrix J(2,1);
+	c.jacobian(_x3,J);
+	CPPUNIT_ASSERT(J[0][0]==Interval(6,6));
+	CPPUNIT_ASSERT(J[1][0]==Interval(1,1));
+}
+
+void TestEval::context_threads() {
+#ifndef _WIN32
+	const ExprSymbol& x1 = ExprSymbol::new_("x1");
+	const ExprSymbol& y1 = ExprSymbol::new_("y1");
+	const ExprSymbol& x2 = ExprSymbol::new_("x2");
+	const ExprSymbol& y2 = ExprSymbol::new_("y2");
+	Function g(x1,y1,sqr(x1)+sqr(y1));
+	Function f(x2,y2,g(x2,y2)-sin(x2*y2));
+
+	const int nb_threads=4;
+	const int nb_boxes=1000;
+
+	// reference results (sequential evaluation)
+	Array<IntervalVector> boxes(nb_boxes);
+	Interval z[nb_boxes];
+	Array<IntervalVector> gr(nb_boxes);
+	for (int i=0; i<nb_boxes; i++) {
+		boxes.set_ref(i,*new IntervalVector(2,Interval(0,i)*0.01));
+		z[i]=f.eval(boxes[i]);
+		gr.set_ref(i,*new IntervalVector(f.gradient(boxes[i])));
+	}
+
+	bool ok[nb_threads];
+
+	vector<thread> threads;
+	for (int t=0; t<nb_threads; t++) {
+		threads.push_back(thread([&,t]() {
+			EvalContext c(f);
+			ok[t]=true;
+			IntervalVector g(2);
+			for (int i=0; i<nb_boxes; i++) {
+				ok[t] &= c.eval(boxes[i])==z[i];
+				c.gradient(boxes[i],g);
+				ok[t] &= g==gr[i];
+			}
+		}));
+	}
+
+	for (int t=0; t<nb_threads; t++) threads[t].join();
+
+	for (int t=0; t<nb_threads; t++)
+		CPPUNIT_ASSERT(ok[t]);
+
+	for (int i=0; i<nb_boxes; i++) {
+		delete &boxes[i];
+		delete &gr[i];
+	}
+#endif
+}
+
+void TestEval::context_comp_threads() {
+#ifndef _WIN32
+	// the Jacobian of M*x is calculated component by component:
+	// the default context and the other contexts generate the
+	// components of f at the same time.
+	double _M[][3]={{1,2,3},{-1,0,2},{4,1,-1}};
+	Matrix M(3,3,(double*) _M);
+	IntervalMatrix J_ref(M);
+	IntervalVector box(3,Interval(-1,1));
+
+	const int nb_threads=4;
+
+	for (int k=0; k<20; k++) {
+		const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+		Function f(x,M*x);
+
+		bool ok[nb_threads];
+
+		vector<thread> threads;
+		for (int t=0; t<nb_threads; t++) {
+			threads.push_back(thread([&,t]() {
+				IntervalMatrix J(3,3);
+				if (t==0)
+					f.jacobian(box,J);
+				else {
+					EvalContext c(f);
+					c.jacobian(box,J);
+				}
+				ok[t] = J==J_ref;
+			}));
+		}
+
+		for (int t=0; t<nb_threads; t++) threads[t].join();
+
+		for (int t=0; t<nb_threads; t++)
+			CPPUNIT_ASSERT(ok[t]);
+	}
+#endif
+}
+
+void TestEval::eval_batch01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	Function f(x,sqrt(x[0])*x[1]+log(x[1]+x[0])-2);
+
+	vector<IntervalVector> boxes;
+	double _b[][2][2]={ {{1,2},{3,4}}, {{-2,-1},{0,1}}, {{0,4},{-1,1}}, {{-1,1},{2,3}} };
+	for (int k=0; k<4; k++)
+		boxes.push_back(IntervalVector(2,_b[k]));
+	boxes.push_back(IntervalVector::empty(2));
+
+	vector<Interval> y=f.eval_batch(boxes);
+	CPPUNIT_ASSERT(y.size()==boxes.size());
+	for (size_t k=0; k<boxes.size(); k++)
+		CPPUNIT_ASSERT(y[k]==f.eval(boxes[k]));
+
+	CPPUNIT_ASSERT(y[1].is_empty());
+	CPPUNIT_ASSERT(y[4].is_empty());
+}
+
+void TestEval::eval_batch02() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,Return(x*y,sqr(x)-y,exp(x)*cos(y)));
+
+	vector<Vector> points;
+	for (int k=0; k<10; k++) {
+		double _p[]={k-5.0,0.1*k};
+		points.push_back(Vector(2,_p));
+	}
+
+	vector<IntervalVector> z=f.eval_vector_batch(points);
+	CPPUNIT_ASSERT(z.size()==points.size());
+	for (size_t k=0; k<points.size(); k++)
+		CPPUNIT_ASSERT(z[k]==f.eval_vector(points[k]));
+
+	// a second call with less points reuses the buffer
+	points.erase(points.begin()+3,points.end());
+	z=f.eval_vector_batch(points);
+	CPPUNIT_ASSERT(z.size()==3);
+	CPPUNIT_ASSERT(z[2]==f.eval_vector(points[2]));
+}
+
+void TestEval::eval_batch03() {
+	const ExprSymbol& x1 = ExprSymbol::new_("x1");
+	const ExprSymbol& x2 = ExprSymbol::new_("x2");
+	Function f1(x1,sqr(x1)+1);
+	Function f2(x2,f1(x2)*x2);
+
+	vector<IntervalVector> boxes;
+	boxes.push_back(IntervalVector(1,Interval(1,2)));
+	boxes.push_back(IntervalVector(1,Interval(-1,0)));
+
+	vector<Interval> y=f2.eval_batch(boxes);
+	CPPUNIT_ASSERT(y[0]==Interval(2,10));
+	CPPUNIT_ASSERT(y[1]==f2.eval(boxes[1]));
+}
+
+void TestEval::domain_slab() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,sqr(x)*y+sin(x-y));
+
+	// scalar domains are stored from the last node to the root
+	ExprDomain d(f);
+	int n=f.nb_nodes();
+	for (int i=0; i<n; i++)
+		CPPUNIT_ASSERT(&d[i].i()==&d[n-1].i()+(n-1-i));
+
+	const ExprSymbol& A = ExprSymbol::new_("A",Dim::matrix(2,3));
+	const ExprSymbol& v = ExprSymbol::new_("v",Dim::col_vec(3));
+	Function g(A,v,transpose(A)*(A*v)+v[1]*transpose(A[0]));
+
+	// rows of a matrix are contiguous
+	ExprDomain dg(g);
+	CPPUNIT_ASSERT(&dg.args[0].m()[1][0]==&dg.args[0].m()[0][2]+1);
+
+	// indexing and transpose do not break evaluation
+	double _A[][2] = {{1,1},{2,2},{3,3},{4,4},{5,5},{6,6}};
+	double _v[][2] = {{1,1},{0,0},{2,2}};
+	IntervalMatrix M(2,3,_A);
+	IntervalVector w(3,_v);
+	IntervalVector box(9);
+	box.put(0,M.row(0));
+	box.put(3,M.row(1));
+	box.put(6,w);
+	CPPUNIT_ASSERT(g.eval_vector(box)==M.transpose()*(M*w));
+	box[7]=1;
+	w[1]=1;
+	CPPUNIT_ASSERT(g.eval_vector(box)==M.transpose()*(M*w)+M.row(0));
+}
+
 } // end namespace
@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Apr 02, 2012
- * Last update : Jul 10, 2019
+ * Last update : Oct 17, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __TEST_EVAL_H__
@@ -37,6 +37,16 @@ public:
 	CPPUNIT_TEST(eval_components01);
 	CPPUNIT_TEST(eval_components02);
 	CPPUNIT_TEST(matrix_components);
+	CPPUNIT_TEST(context01);
+	CPPUNIT_TEST(context02);
+#ifndef _WIN32
+	CPPUNIT_TEST(context_threads);
+	CPPUNIT_TEST(context_comp_threads);
+#endif
+	CPPUNIT_TEST(eval_batch01);
+	CPPUNIT_TEST(eval_batch02);
+	CPPUNIT_TEST(eval_batch03);
+	CPPUNIT_TEST(domain_slab);
 
 	CPPUNIT_TEST_SUITE_END();
 
@@ -57,6 +67,24 @@ public:
 	// check in particular that the components that are not selected are not computed uselessly
 	void matrix_components();
 
+	// evaluation in a separate context does not modify the default one
+	void context01();
+	// contexts with apply nodes and heterogeneous components
+	void context02();
+	// same function evaluated concurrently in several threads
+	void context_threads();
+	void context_comp_threads();
+
+	// batch evaluation of a scalar function (with domain errors)
+	void eval_batch01();
+	// batch evaluation of a vector-valued function on points
+	void eval_batch02();
+	// fallback to box-by-box evaluation (apply node)
+	void eval_batch03();
+
+	// node domains are stored contiguously (see ExprDomainSlab)
+	void domain_slab();
+
 private:
 	void check_deco(Function& f, const ExprNode& e);
 };
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 17, 2019
-// Last Update : Jun 05, 2019
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "TestFncKuhnTucker.h"
@@ -25,8 +25,6 @@ void TestFncKuhnTucker::one_var() {
 	System sys(fac);
 	sys.box[0]=Interval(-10,10);
 
-	Function df(*sys.goal, Function::DIFF);
-
 	NormalizedSystem nsys(sys);
 
 	// --------------------------------------------------------------------
@@ -35,7 +33,7 @@ void TestFncKuhnTucker::one_var() {
 
 	int m=1; // number of multipliers
 
-	FncKuhnTucker fkt(nsys,df,NULL,x,BitSet::empty(1));
+	FncKuhnTucker fkt(nsys,x,BitSet::empty(1));
 
 	CPPUNIT_ASSERT(fkt.n == n);
 	CPPUNIT_ASSERT(fkt.nb_mult==m);
@@ -78,8 +76,6 @@ void TestFncKuhnTucker::one_var_1_bound() {
 	System sys(fac);
 	sys.box[0]=Interval(-10,10);
 
-	Function df(*sys.goal, Function::DIFF);
-
 	NormalizedSystem nsys(sys);
 
 	// --------------------------------------------------------------------
@@ -87,7 +83,7 @@ void TestFncKuhnTucker::one_var_1_bound() {
 	x[0]=Interval(9,10);
 
 	int m=2; // number of multipliers
-	FncKuhnTucker fkt(nsys,df,NULL,x,BitSet::empty(1));
+	FncKuhnTucker fkt(nsys,x,BitSet::empty(1));
 
 	CPPUNIT_ASSERT(fkt.n == n);
 	CPPUNIT_ASSERT(fkt.nb_mult==m);
@@ -135,11 +131,6 @@ void TestFncKuhnTucker::one_var_1_ineq_1_rbound() {
 	System sys(fac);
 	sys.box[0]=Interval(-10,10);
 
-	Function df(*sys.goal, Function::DIFF);
-	Function dg0(sys.f_ctrs[0], Function::DIFF);
-	Function** dg = new Function*[1];
-	dg[0]=&dg0;
-
 	NormalizedSystem nsys(sys);
 
 	// --------------------------------------------------------------------
@@ -147,7 +138,7 @@ void TestFncKuhnTucker::one_var_1_ineq_1_rbound() {
 	x[0]=Interval(9,10);
 
 	int m=3; // number of multipliers
-	FncKuhnTucker fkt(nsys,df,dg,x,BitSet::singleton(1,0));
+	FncKuhnTucker fkt(nsys,x,BitSet::singleton(1,0));
 
 	CPPUNIT_ASSERT(fkt.n == n);
 	CPPUNIT_ASSERT(fkt.nb_mult==m);
@@ -187,11 +178,6 @@ void TestFncKuhnTucker::one_var_1_eq_1_lbound() {
 	System sys(fac);
 	sys.box[0]=Interval(-10,10);
 
-	Function df(*sys.goal, Function::DIFF);
-	Function dg0(sys.f_ctrs[0], Function::DIFF);
-	Function** dg = new Function*[1];
-	dg[0]=&dg0;
-
 	NormalizedSystem nsys(sys);
 
 	// --------------------------------------------------------------------
@@ -199,7 +185,7 @@ void TestFncKuhnTucker::one_var_1_eq_1_lbound() {
 	x[0]=Interval(-11,-9);
 
 	int m=3; // number of multipliers
-	FncKuhnTucker fkt(nsys,df,dg,x,BitSet::singleton(1,0));
+	FncKuhnTucker fkt(nsys,x,BitSet::singleton(1,0));
 
 	CPPUNIT_ASSERT(fkt.n == n);
 	CPPUNIT_ASSERT(fkt.nb_mult==m);
@@ -251,15 +237,6 @@ void TestFncKuhnTucker::two_vars_1_eq_1_ineq_2bounds() {
 	sys.box[0]=Interval(3,4);
 	sys.box[1]=Interval(1,2);
 
-	Function df(*sys.goal, Function::DIFF);
-	Function dg0(sys.f_ctrs[0], Function::DIFF);
-	Function dg1(sys.f_ctrs[1], Function::DIFF);
-	Function dg2(sys.f_ctrs[2], Function::DIFF);
-	Function** dg = new Function*[3];
-	dg[0]=&dg0;
-	dg[1]=&dg1;
-	dg[2]=&dg2;
-
 	NormalizedSystem nsys(sys);
 
 	// --------------------------------------------------------------------
@@ -268,7 +245,7 @@ void TestFncKuhnTucker::two_vars_1_eq_1_ineq_2bounds() {
 	x[1]=Interval(1.5,2);
 
 	int m=6; // number of multipliers
-	FncKuhnTucker fkt(nsys,df,dg,x,BitSet::all(3));
+	FncKuhnTucker fkt(nsys,x,BitSet::all(3));
 
 	CPPUNIT_ASSERT(fkt.n == n);
 	CPPUNIT_ASSERT(fkt.nb_mult==m);
@@ -308,14 +285,16 @@ void TestFncKuhnTucker::two_vars_1_eq_1_ineq_2bounds() {
 	IntervalMatrix J1=((Fnc&) fkt).jacobian(xlambda);
 	IntervalMatrix J2=kkt_expected.jacobian(xlambda);
 
-	CPPUNIT_ASSERT(J1==J2);
+	// note: the Hessian block is calculated by automatic differentiation
+	// (not with the same sequence of operations as kkt_expected)
+	CPPUNIT_ASSERT(almost_eq(J1,J2,1e-10));
 
 	/** check selecting just one column of the jacobian (useful for Newton) ***/
 	for (int i=0; i<n+m; i++) {
 		J1=((Fnc&) fkt).jacobian(xlambda,i);
 		for (int j=0; j<n+m; j++) {
 			if (j==i)
-				CPPUNIT_ASSERT(J1.col(j)==J2.col(j));
+				CPPUNIT_ASSERT(almost_eq(J1.col(j),J2.col(j),1e-10));
 			else
 				// check that other columns are not
 				// uselessly computed:
@@ -325,3 +304,58 @@ void TestFncKuhnTucker::two_vars_1_eq_1_ineq_2bounds() {
 	// test selecting specific rows
 
 }
+
+// Test n°6
+// An inactive constraint which is not differentiable on the box
+// (must not appear in the Hessian matrices)
+void TestFncKuhnTucker::singular_inactive_ctr() {
+	int n=2;
+
+	const ExprSymbol& _x=ExprSymbol::new_("x");
+	const ExprSymbol& _y=ExprSymbol::new_("y");
+	SystemFactory fac;
+	fac.add_var(_x);
+	fac.add_var(_y);
+	fac.add_ctr(_x+_y<=1);
+	fac.add_ctr(sqrt(_x)+_y<=10);
+	fac.add_goal(sqr(_x)+sqr(_y));
+
+	System sys(fac);
+	sys.box[0]=Interval(-10,10);
+	sys.box[1]=Interval(-10,10);
+
+	NormalizedSystem nsys(sys);
+
+	// --------------------------------------------------------------------
+	IntervalVector x(n);
+	x[0]=Interval::zero(); // sqrt is not differentiable at 0
+	x[1]=Interval(0.9,1.1);
+
+	int m=2; // number of multipliers
+	FncKuhnTucker fkt(nsys,x);
+
+	CPPUNIT_ASSERT(fkt.nb_mult==m);
+	CPPUNIT_ASSERT(fkt.ineq().size()==1);
+	CPPUNIT_ASSERT(fkt.active().size()==1 && fkt.active()[0]);
+
+	IntervalVector lambda(m);
+	lambda[0]=Interval(0.2,0.3);
+	lambda[1]=Interval(0.4,0.5);
+
+	IntervalVector xlambda(n+m);
+	xlambda.put(0,x);
+	xlambda.put(n,lambda);
+
+	IntervalMatrix J=((Fnc&) fkt).jacobian(xlambda);
+
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			CPPUNIT_ASSERT(J[i][j]==(i==j? 2*lambda[0] : Interval::zero()));
+
+	// column by column
+	for (int j=0; j<n; j++) {
+		J=((Fnc&) fkt).jacobian(xlambda,j);
+		for (int i=0; i<n; i++)
+			CPPUNIT_ASSERT(J[i][j]==(i==j? 2*lambda[0] : Interval::zero()));
+	}
+}
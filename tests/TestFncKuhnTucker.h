@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : May 17, 2019
- * Last Update : Jun 05, 2019
+ * Last Update : Oct 18, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __TEST_FNC_KUHN_TUCKER_H__
@@ -38,6 +38,7 @@ public:
 	CPPUNIT_TEST(one_var_1_ineq_1_rbound);
 	CPPUNIT_TEST(one_var_1_eq_1_lbound);
 	CPPUNIT_TEST(two_vars_1_eq_1_ineq_2bounds);
+	CPPUNIT_TEST(singular_inactive_ctr);
 	CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -46,6 +47,7 @@ private:
 	void one_var_1_ineq_1_rbound();
 	void one_var_1_eq_1_lbound();
 	void two_vars_1_eq_1_ineq_2bounds();
+	void singular_inactive_ctr();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestFncKuhnTucker);
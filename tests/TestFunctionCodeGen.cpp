@@ -0,0 +1,179 @@
+/* ============================================================================
+ * I B E X - Function code generation Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestFunctionCodeGen.h"
+#include "ibex_Function.h"
+#include "ibex_FunctionCodeGen.h"
+#include "ibex_NativeCode.h"
+#include "ibex_Expr.h"
+#include "ibex_Random.h"
+
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+bool contains(const string& s, const char* str) {
+	return s.find(str)!=string::npos;
+}
+
+}
+
+void TestFunctionCodeGen::source01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,Return(sqrt(x[0])*y,x[1]+1),"f");
+
+	FunctionCodeGen gen(f);
+	CPPUNIT_ASSERT(gen.supported());
+
+	stringstream s;
+	gen.generate(s);
+	string code=s.str();
+
+	CPPUNIT_ASSERT(contains(code,"int ibex_f_abi()"));
+	CPPUNIT_ASSERT(contains(code,"uint64_t ibex_f_hash()"));
+	CPPUNIT_ASSERT(contains(code,"int ibex_f_nb_var() { return 3; }"));
+	CPPUNIT_ASSERT(contains(code,"int ibex_f_image_dim() { return 2; }"));
+	CPPUNIT_ASSERT(contains(code,"int ibex_f_eval(const Interval* x, Interval* y)"));
+	CPPUNIT_ASSERT(contains(code,"int ibex_f_proj(const Interval* y, Interval* x)"));
+	CPPUNIT_ASSERT(contains(code,"int ibex_f_jacobian(const Interval* x, Interval* J)"));
+	// y is the third variable
+	CPPUNIT_ASSERT(contains(code,"*x[2]"));
+	// definition domain of sqrt
+	CPPUNIT_ASSERT(contains(code,".is_empty()) return 0;"));
+
+	stringstream s2;
+	gen.generate(s2,"myf");
+	CPPUNIT_ASSERT(contains(s2.str(),"int myf_eval("));
+}
+
+void TestFunctionCodeGen::unsupported01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& A = ExprSymbol::new_("A",Dim::matrix(2,2));
+
+	Function f1(x,A,A*x);
+	CPPUNIT_ASSERT(!FunctionCodeGen(f1).supported());
+
+	const ExprSymbol& z = ExprSymbol::new_("z");
+	Function f2(z,chi(z,sqr(z),-z)+1);
+	CPPUNIT_ASSERT(!FunctionCodeGen(f2).supported());
+
+	// a call to another function is inlined
+	const ExprSymbol& z2 = ExprSymbol::new_("z2");
+	const ExprSymbol& z3 = ExprSymbol::new_("z3");
+	Function g(z2,sqr(z2));
+	Function f3(z3,g(z3)+1);
+	CPPUNIT_ASSERT(FunctionCodeGen(f3).supported());
+}
+
+void TestFunctionCodeGen::prefix01() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	Function f(x,x+1,"f.1");
+	CPPUNIT_ASSERT(FunctionCodeGen::default_prefix(f)=="ibex_f_1");
+}
+
+void TestFunctionCodeGen::load_fail01() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	Function f(x,sqr(x),"f");
+	CPPUNIT_ASSERT(!f.load_native("__no_such_file__.so"));
+	CPPUNIT_ASSERT(!f.is_native());
+	CPPUNIT_ASSERT(f.eval(IntervalVector(1,Interval(1,2)))==Interval(1,4));
+
+	// the interval libraries with 16-byte intervals have different signatures
+	CPPUNIT_ASSERT(native_code_lib_hash("gaol")!=native_code_lib_hash("filib"));
+	CPPUNIT_ASSERT(native_code_lib_hash("gaol")!=native_code_lib_hash("simd"));
+	CPPUNIT_ASSERT(native_code_lib_hash("filib")!=native_code_lib_hash("simd"));
+	CPPUNIT_ASSERT(native_code_abi()%1000==(int) sizeof(Interval));
+	CPPUNIT_ASSERT(native_code_abi()/1000%1000==native_code_lib_hash(_IBEX_INTERVAL_LIB_));
+
+	// the hash of the expression does not depend on the name of the function
+	const ExprSymbol& y = ExprSymbol::new_("x");
+	Function g(y,sqr(y),"g");
+	CPPUNIT_ASSERT(NativeCode::expr_hash(f)==NativeCode::expr_hash(g));
+	const ExprSymbol& z = ExprSymbol::new_("x");
+	Function h(z,sqr(z)+1e-300,"f");
+	CPPUNIT_ASSERT(NativeCode::expr_hash(f)!=NativeCode::expr_hash(h));
+}
+
+#ifdef NATIVE_TEST_LIB
+void TestFunctionCodeGen::native01() {
+	// see minibex/codegen01.mbx and tests/CMakeLists.txt
+	Function f(SRCDIR_TESTS "/minibex/codegen01.mbx");
+	Function g(SRCDIR_TESTS "/minibex/codegen01.mbx");
+
+	CPPUNIT_ASSERT(f.load_native(NATIVE_TEST_LIB));
+	CPPUNIT_ASSERT(f.is_native());
+
+	RNG::srand(1);
+
+	for (int k=0; k<100; k++) {
+		IntervalVector box(3);
+		for (int i=0; i<3; i++) {
+			double a=RNG::rand(-2,2), b=RNG::rand(-2,2);
+			box[i]=a<b ? Interval(a,b) : Interval(b,a);
+		}
+
+		CPPUNIT_ASSERT(f.eval_vector(box)==g.eval_vector(box));
+
+		IntervalMatrix J1(3,3), J2(3,3);
+		f.jacobian(box,J1);
+		g.jacobian(box,J2);
+		CPPUNIT_ASSERT(J1==J2);
+
+		IntervalVector y(3,Interval(-1,1));
+		IntervalVector x1(box), x2(box);
+		f.backward(y,x1);
+		g.backward(y,x2);
+		CPPUNIT_ASSERT(x1==x2);
+	}
+
+	// outside the definition domain (sqrt)
+	IntervalVector box(3,Interval(-2,-1));
+	CPPUNIT_ASSERT(f.eval_vector(box).is_empty());
+	IntervalVector x(box);
+	f.backward(IntervalVector(3,Interval::all_reals()),x);
+	CPPUNIT_ASSERT(x.is_empty());
+
+	// the native code is shared by all the contexts
+	EvalContext c(f);
+	box=IntervalVector(3,Interval(1,2));
+	CPPUNIT_ASSERT(c.eval_vector(box)==g.eval_vector(box));
+}
+
+void TestFunctionCodeGen::native02() {
+	Function f(SRCDIR_TESTS "/minibex/codegen01.mbx");
+	CPPUNIT_ASSERT(!f.load_native(NATIVE_TEST_LIB,"wrong_prefix"));
+	CPPUNIT_ASSERT(!f.is_native());
+
+	// dimensions do not match
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	Function g(x,sqr(x));
+	CPPUNIT_ASSERT(!g.load_native(NATIVE_TEST_LIB,FunctionCodeGen::default_prefix(f).c_str()));
+
+	// same dimensions but another expression (stale shared object)
+	const ExprSymbol& x2 = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y2 = ExprSymbol::new_("y");
+	Function h(x2,y2,Return(x2[0]+y2,x2[1],y2),"codegen01");
+	CPPUNIT_ASSERT(!h.load_native(NATIVE_TEST_LIB));
+	CPPUNIT_ASSERT(!h.is_native());
+
+	CPPUNIT_ASSERT(f.load_native(NATIVE_TEST_LIB));
+	f.unload_native();
+	CPPUNIT_ASSERT(!f.is_native());
+	CPPUNIT_ASSERT(f.eval_vector(IntervalVector(3,Interval(-2,-1))).is_empty());
+}
+#endif
+
+} // end namespace
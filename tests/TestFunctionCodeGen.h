@@ -0,0 +1,55 @@
+/* ============================================================================
+ * I B E X - Function code generation Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_FUNCTION_CODE_GEN_H__
+#define __TEST_FUNCTION_CODE_GEN_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestFunctionCodeGen : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestFunctionCodeGen);
+
+	CPPUNIT_TEST(source01);
+	CPPUNIT_TEST(unsupported01);
+	CPPUNIT_TEST(prefix01);
+	CPPUNIT_TEST(load_fail01);
+#ifdef NATIVE_TEST_LIB
+	CPPUNIT_TEST(native01);
+	CPPUNIT_TEST(native02);
+#endif
+
+	CPPUNIT_TEST_SUITE_END();
+
+	// entry points of the generated code
+	void source01();
+	// functions with vector/matrix operations, apply nodes
+	void unsupported01();
+	void prefix01();
+	// loading a missing shared object: fallback to the interpreter
+	void load_fail01();
+	// native code vs interpreter (eval, backward, jacobian)
+	void native01();
+	// wrong prefix/dimension/expression, unload
+	void native02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestFunctionCodeGen);
+
+} // end namespace
+
+#endif // __TEST_FUNCTION_CODE_GEN_H__
@@ -12,8 +12,11 @@
 #include "ibex_Function.h"
 #include "ibex_Expr.h"
 #include "ibex_Eval.h"
+#include "ibex_CompressedJacobian.h"
 #include "Ponts30.h"
 
+#include <algorithm>
+
 using namespace std;
 
 namespace ibex {
@@ -662,5 +665,128 @@ void TestGradient::jacobian_components02() {
 
 }
 
+void TestGradient::sparse_jacobian01() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+	IntervalMatrix J=p30.f->jacobian(box);
+
+	SparseIntervalMatrix SJ=p30.f->jacobian_pattern();
+	CPPUNIT_ASSERT(SJ.nnz()<30*30);
+
+	// the pattern contains all the non-zero entries
+	for (int i=0; i<30; i++)
+		for (int j=0; j<30; j++)
+			CPPUNIT_ASSERT(J[i][j]==Interval::zero() || SJ.find(i,j)!=-1);
+
+	p30.f->jacobian(box,SJ);
+	CPPUNIT_ASSERT(!SJ.is_empty());
+	CPPUNIT_ASSERT(almost_eq(SJ.dense(),J,1e-10));
+}
+
+void TestGradient::sparse_hansen01() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+	IntervalMatrix H(30,30);
+	p30.f->hansen_matrix(box,H);
+
+	SparseIntervalMatrix SH=p30.f->jacobian_pattern();
+	p30.f->hansen_matrix(box,box.mid(),SH);
+	CPPUNIT_ASSERT(!SH.is_empty());
+	CPPUNIT_ASSERT(almost_eq(SH.dense(),H,1e-10));
+}
+
+void TestGradient::compressed_jacobian01() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+	Gradient& g=p30.f->deriv_calculator();
+
+	g.jacobian_mode=Gradient::REVERSE_MODE;
+	IntervalMatrix J=p30.f->jacobian(box);
+
+	CompressedJacobian cj(p30.f->basic_evaluator());
+	CPPUNIT_ASSERT(cj.is_supported());
+	CPPUNIT_ASSERT(cj.nb_colors()<30);
+
+	for (int i=0; i<30; i++) {
+		const vector<int>& row=cj.pattern()[i];
+		// the pattern contains all the non-zero entries
+		for (int j=0; j<30; j++)
+			CPPUNIT_ASSERT(J[i][j]==Interval::zero() || binary_search(row.begin(),row.end(),j));
+		// the columns of a row have different colors
+		for (size_t k=0; k<row.size(); k++)
+			for (size_t k2=k+1; k2<row.size(); k2++)
+				CPPUNIT_ASSERT(cj.color(row[k])!=cj.color(row[k2]));
+	}
+
+	g.jacobian_mode=Gradient::FORWARD_MODE;
+
+	CPPUNIT_ASSERT(almost_eq(p30.f->jacobian(box),J,1e-10));
+
+	for (int j=0; j<30; j++) {
+		IntervalMatrix J2(30,30);
+		p30.f->jacobian(box,J2,j);
+		CPPUNIT_ASSERT(almost_eq(J2.col(j),J.col(j),1e-10));
+	}
+
+	SparseIntervalMatrix SJ=p30.f->jacobian_pattern();
+	p30.f->jacobian(box,SJ);
+	CPPUNIT_ASSERT(!SJ.is_empty());
+	CPPUNIT_ASSERT(almost_eq(SJ.dense(),J,1e-10));
+}
+
+void TestGradient::compressed_jacobian02() {
+	const ExprSymbol& A=ExprSymbol::new_("A",Dim::matrix(3,3));
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(3));
+	Function f(A,x,A*x+sqr(x[0])*transpose(A[1])-x);
+
+	IntervalVector box(12);
+	for (int i=0; i<12; i++) box[i]=Interval(i-6,i+2);
+
+	CompressedJacobian cj(f.basic_evaluator());
+	CPPUNIT_ASSERT(cj.is_supported());
+
+	// row i depends on A[i] (variables 3i..3i+2), A[1][i] (3+i) and x (9..11)
+	for (int i=0; i<3; i++) {
+		vector<int> row;
+		for (int j=3*i; j<3*i+3; j++) row.push_back(j);
+		if (i!=1) row.push_back(3+i);
+		sort(row.begin(),row.end());
+		for (int j=9; j<12; j++) row.push_back(j);
+		CPPUNIT_ASSERT(cj.pattern()[i]==row);
+	}
+	// the rows 0 and 2 have 7 entries
+	CPPUNIT_ASSERT(cj.nb_colors()==7);
+
+	f.deriv_calculator().jacobian_mode=Gradient::REVERSE_MODE;
+	IntervalMatrix J=f.jacobian(box);
+
+	f.deriv_calculator().jacobian_mode=Gradient::FORWARD_MODE;
+	CPPUNIT_ASSERT(almost_eq(f.jacobian(box),J,1e-10));
+}
+
+void TestGradient::compressed_jacobian03() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,Return(sqrt(x),x*y));
+
+	// the first component is not defined on this box
+	IntervalVector box(2);
+	box[0]=Interval(-2,-1);
+	box[1]=Interval(1,2);
+
+	IntervalMatrix J(1,2);
+	double _J[][2]={{1,2},{-2,-1}};
+
+	// only the second row is evaluated
+	f.deriv_calculator().jacobian_mode=Gradient::REVERSE_MODE;
+	f.deriv_calculator().jacobian(box,J,BitSet::singleton(2,1));
+	CPPUNIT_ASSERT(J==IntervalMatrix(1,2,_J));
+
+	f.deriv_calculator().jacobian_mode=Gradient::FORWARD_MODE;
+	J.init(Interval::all_reals());
+	f.deriv_calculator().jacobian(box,J,BitSet::singleton(2,1));
+	CPPUNIT_ASSERT(J==IntervalMatrix(1,2,_J));
+}
+
 } // end namespace
 
@@ -38,6 +38,11 @@ public:
 	CPPUNIT_TEST(jac02);
 	CPPUNIT_TEST(jac03);
 	CPPUNIT_TEST(hansen01);
+	CPPUNIT_TEST(sparse_jacobian01);
+	CPPUNIT_TEST(sparse_hansen01);
+	CPPUNIT_TEST(compressed_jacobian01);
+	CPPUNIT_TEST(compressed_jacobian02);
+	CPPUNIT_TEST(compressed_jacobian03);
 	CPPUNIT_TEST(mulVV);
 	CPPUNIT_TEST(transpose01);
 	CPPUNIT_TEST(mulMV01);
@@ -59,6 +64,11 @@ public:
 	void jac02();
 	void jac03();
 	void hansen01();
+	void sparse_jacobian01();
+	void sparse_hansen01();
+	void compressed_jacobian01();
+	void compressed_jacobian02();
+	void compressed_jacobian03();
 
 	void mulVV();
 	// for vectors
@@ -0,0 +1,119 @@
+//============================================================================
+//                                  I B E X
+// File        : TestHessian.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "TestHessian.h"
+#include "ibex_Function.h"
+#include "ibex_Expr.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestHessian::scalar01() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,sqr(x)*y + exp(x*y) + sin(x)/(1+sqr(y)) + atan2(y,x) + sqrt(x) + log(y)*pow(x,3) + tanh(x-y));
+	Function df(f,Function::DIFF);
+
+	IntervalVector pt(2);
+	pt[0]=0.7;
+	pt[1]=1.3;
+	CPPUNIT_ASSERT(almost_eq(f.hessian(pt), df.jacobian(pt), 1e-10));
+
+	// on a box
+	IntervalVector box(2,Interval(1,1.01));
+	IntervalMatrix H=f.hessian(box);
+	CPPUNIT_ASSERT(H[0][1]==H[1][0]); // symmetry
+	CPPUNIT_ASSERT(H.is_superset(df.jacobian(IntervalVector(2,1.005))));
+}
+
+void TestHessian::vector01() {
+	const ExprSymbol& z = ExprSymbol::new_("z",Dim::col_vec(3));
+	Matrix A(3,3);
+	for (int i=0; i<3; i++)
+		for (int j=0; j<3; j++)
+			A[i][j]=i+2*j-1;
+
+	Function f(z, transpose(z)*(A*z) + sqr(z[0])*z[1]*z[2] + cos(z[1]));
+
+	IntervalVector pt(3);
+	pt[0]=0.5; pt[1]=-0.2; pt[2]=1.5;
+
+	// exact Hessian
+	Matrix H=A+A.transpose();
+	H[0][0]+=2*pt[1].mid()*pt[2].mid();
+	H[0][1]+=2*pt[0].mid()*pt[2].mid();  H[1][0]=H[0][1];
+	H[0][2]+=2*pt[0].mid()*pt[1].mid();  H[2][0]=H[0][2];
+	H[1][2]+=::pow(pt[0].mid(),2);       H[2][1]=H[1][2];
+	H[1][1]+=-::cos(pt[1].mid());
+
+	CPPUNIT_ASSERT(almost_eq(f.hessian(pt), IntervalMatrix(H), 1e-10));
+
+	// only one column
+	IntervalMatrix H1(3,3,Interval::zero());
+	f.hessian(pt,H1,2);
+	CPPUNIT_ASSERT(almost_eq(H1.col(2), IntervalVector(H.col(2)), 1e-10));
+	CPPUNIT_ASSERT(H1.col(0)==IntervalVector(3,Interval::zero()));
+}
+
+void TestHessian::weighted01() {
+	const ExprSymbol& z = ExprSymbol::new_("z",Dim::col_vec(3));
+	Function f(z, Return(sqr(z[0])*z[1], sin(z[1]*z[2]), z[0]+z[2]));
+
+	const ExprSymbol& z0 = ExprSymbol::new_("z",Dim::col_vec(3));
+	Function f0(z0, sqr(z0[0])*z0[1]);
+	const ExprSymbol& z1 = ExprSymbol::new_("z",Dim::col_vec(3));
+	Function f1(z1, sin(z1[1]*z1[2]));
+
+	IntervalVector pt(3);
+	pt[0]=0.5; pt[1]=-0.2; pt[2]=1.5;
+
+	IntervalVector w(3);
+	w[0]=2; w[1]=-3; w[2]=5;
+
+	IntervalMatrix H(3,3);
+	f.hessian(pt,w,H);
+	CPPUNIT_ASSERT(almost_eq(H, 2.0*f0.hessian(pt)-3.0*f1.hessian(pt), 1e-10));
+}
+
+void TestHessian::hessian_vector01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(4));
+	Function f(x, sqr(x[0]-x[1]) + x[1]*x[2]*x[3] + exp(x[3])*x[0]);
+
+	IntervalVector pt(4);
+	pt[0]=0.1; pt[1]=0.2; pt[2]=-0.3; pt[3]=0.4;
+
+	IntervalVector u(4);
+	u[0]=1; u[1]=-2; u[2]=0.5; u[3]=3;
+
+	IntervalVector Hu(4);
+	f.hessian_vector(pt,u,Hu);
+	CPPUNIT_ASSERT(almost_eq(Hu, f.hessian(pt)*u, 1e-10));
+}
+
+void TestHessian::nonsmooth01() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,abs(x)*y + max(x,y));
+
+	// smooth on this box
+	IntervalVector box(2);
+	box[0]=Interval(2,3);
+	box[1]=Interval(5,6);
+	IntervalMatrix H(2,2);
+	H[0][0]=0; H[0][1]=1;
+	H[1][0]=1; H[1][1]=0;
+	CPPUNIT_ASSERT(f.hessian(box)==H);
+
+	// x=0 is a kink of abs
+	box[0]=Interval(-1,1);
+	CPPUNIT_ASSERT(f.hessian(box)[0][0].is_unbounded());
+}
+
+} // end namespace
@@ -0,0 +1,44 @@
+/* ============================================================================
+ * I B E X - Hessian Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_HESSIAN_H__
+#define __TEST_HESSIAN_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestHessian : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestHessian);
+	CPPUNIT_TEST(scalar01);
+	CPPUNIT_TEST(vector01);
+	CPPUNIT_TEST(weighted01);
+	CPPUNIT_TEST(hessian_vector01);
+	CPPUNIT_TEST(nonsmooth01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void scalar01();
+	void vector01();
+	void weighted01();
+	void hessian_vector01();
+	void nonsmooth01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestHessian);
+
+} // end namespace
+
+#endif // __TEST_HESSIAN_H__
@@ -176,6 +176,42 @@ void TestLinearSolver::reset() {
 	delete lp;
 }
 
+void TestLinearSolver::warm_start() {
+	int n=8;
+	Statistics stats;
+	LPSolver* lp = create_kleemin(n);
+	lp->enable_statistics(stats,"cold");
+	CPPUNIT_ASSERT(lp->minimize()==LPSolver::Status::OptimalProved);
+
+	LPSolver::Basis basis;
+	CPPUNIT_ASSERT(lp->get_basis(basis));
+	CPPUNIT_ASSERT((int) basis.col_status.size()==n);
+	CPPUNIT_ASSERT((int) basis.row_status.size()==lp->nb_rows());
+
+	// same problem, starting from the optimal basis
+	LPSolver* lp2 = create_kleemin(n);
+	lp2->enable_statistics(stats,"warm");
+	CPPUNIT_ASSERT(lp2->set_basis(basis));
+	CPPUNIT_ASSERT(lp2->minimize()==LPSolver::Status::OptimalProved);
+	Vector vrai(n);
+	vrai[n-1] = ::pow(10,n-1);
+	check_relatif(vrai,lp2->not_proved_primal_sol(),1.e-9);
+
+	StsLPSolver* cold=(StsLPSolver*) stats.find("cold/LP Solver");
+	StsLPSolver* warm=(StsLPSolver*) stats.find("warm/LP Solver");
+	CPPUNIT_ASSERT(cold->nb_warm_starts()==0);
+	CPPUNIT_ASSERT(warm->nb_warm_starts()==1);
+	CPPUNIT_ASSERT(warm->nb_iterations()<cold->nb_iterations());
+
+	// dimensions do not match: basis ignored
+	LPSolver* lp3 = create_kleemin(n-2);
+	CPPUNIT_ASSERT(!lp3->set_basis(basis));
+
+	delete lp;
+	delete lp2;
+	delete lp3;
+}
+
 void TestLinearSolver::test_known_problem(std::string filename, double optimal) {
 	LPSolver lp_ref(filename);
 	LPSolver lp(lp_ref.nb_vars(), LPSolver::Mode::NotCertified);
@@ -31,6 +31,7 @@ public:
 	CPPUNIT_TEST(kleemin8);
 	CPPUNIT_TEST(kleemin30);
 	CPPUNIT_TEST(reset);
+	CPPUNIT_TEST(warm_start);
 	CPPUNIT_TEST(afiro);
 	CPPUNIT_TEST(adlittle);
 	CPPUNIT_TEST(p25fv47);
@@ -57,6 +58,7 @@ public:
 	void kleemin8() {kleemin(8);};
 	void kleemin30();
 	void reset();
+	void warm_start();
 
 	void nearly_parallel_constraints();
 	void cost_parallel_to_constraint();
@@ -207,6 +207,89 @@ void TestLinear::inflating_gauss_seidel03() {
 	CPPUNIT_ASSERT(!ret);
 }
 
+namespace {
+
+// tridiagonal matrix with [-eps,eps] perturbations
+IntervalMatrix tridiag(int n, double eps) {
+	IntervalMatrix A(n,n,Interval::zero());
+	for (int i=0; i<n; i++) {
+		A[i][i]=4+Interval(-eps,eps);
+		if (i>0) A[i][i-1]=-1+Interval(-eps,eps);
+		if (i<n-1) A[i][i+1]=-1+Interval(-eps,eps);
+	}
+	return A;
+}
+
+}
+
+void TestLinear::sparse_gauss_seidel01() {
+	int n=10;
+	IntervalMatrix A=tridiag(n,0.01);
+	SparseIntervalMatrix SA(A);
+	CPPUNIT_ASSERT(SA.nnz()==3*n-2);
+
+	IntervalVector b(n,Interval(1,2));
+	IntervalVector x(n,Interval(-10,10));
+	IntervalVector sx=x;
+
+	gauss_seidel(A,b,x,0.001);
+	gauss_seidel(SA,b,sx,0.001);
+
+	CPPUNIT_ASSERT(x.is_strict_subset(IntervalVector(n,Interval(-10,10))));
+	CPPUNIT_ASSERT(sx==x);
+}
+
+void TestLinear::sparse_inflating_gauss_seidel01() {
+	int n=4;
+	Matrix A=(n+1)*Matrix::eye(n)-Matrix::ones(n); // diagonally dominant matrix
+	Vector b(n);
+	for (int i=1; i<=n; i++) b[i-1]=::pow(-1.0,i)*i; // just an arbitrary example
+
+	Matrix invA(n,n);
+	real_inverse(A,invA);
+	IntervalVector sol=invA*b;
+
+	IntervalVector x=Vector::zeros(n);
+
+	bool ret=inflating_gauss_seidel(SparseIntervalMatrix(IntervalMatrix(A)),b,x);
+	CPPUNIT_ASSERT(ret);
+	CPPUNIT_ASSERT(sol.rel_distance(x)<0.01);
+}
+
+void TestLinear::sparse_precond01() {
+	int n=10;
+	IntervalMatrix A=tridiag(n,0.0);
+	IntervalVector b(n,1.0);
+
+	// one block: same as the midpoint inverse
+	SparseIntervalMatrix SA(A);
+	IntervalVector sb=b;
+	precond(SA,sb,n);
+	IntervalMatrix A2=A;
+	IntervalVector b2=b;
+	precond(A2,b2);
+	CPPUNIT_ASSERT(almost_eq(SA.dense(),A2,1e-12));
+	CPPUNIT_ASSERT(almost_eq(sb,b2,1e-12));
+
+	// blocks of size 3: the diagonal blocks become identity
+	// and the fill-in is limited to the union of the rows
+	SA=SparseIntervalMatrix(A);
+	sb=b;
+	precond(SA,sb,3);
+	CPPUNIT_ASSERT(SA.nnz()==3*4+3*5+3*5+1*2);
+	for (int i=0; i<n; i++) {
+		for (int j=(i/3)*3; j<std::min((i/3)*3+3,n); j++) {
+			CPPUNIT_ASSERT(almost_eq(SA(i,j),Interval(i==j? 1 : 0),1e-12));
+		}
+	}
+
+	// singular block
+	A[0][0]=Interval::zero();
+	A[0][1]=Interval::zero();
+	SA=SparseIntervalMatrix(A);
+	CPPUNIT_ASSERT_THROW(precond(SA,sb,1), SingularMatrixException);
+}
+
 void TestLinear::det01() {
     double _tab[] = { 1, 3, 2, 9, 4, 5, 6, 8, 7 };
     Matrix M1(3,3,_tab);
@@ -31,6 +31,9 @@ public:
 	CPPUNIT_TEST(inflating_gauss_seidel01);
 	CPPUNIT_TEST(inflating_gauss_seidel02);
 	CPPUNIT_TEST(inflating_gauss_seidel03);
+	CPPUNIT_TEST(sparse_gauss_seidel01);
+	CPPUNIT_TEST(sparse_inflating_gauss_seidel01);
+	CPPUNIT_TEST(sparse_precond01);
 	CPPUNIT_TEST(det01);
 	CPPUNIT_TEST(det02);
 	CPPUNIT_TEST(is_posdef_sylvester01);
@@ -54,6 +57,12 @@ public:
 	void inflating_gauss_seidel02();
 	// divergence, start with thick vector
 	void inflating_gauss_seidel03();
+	// same as the dense version (tridiagonal matrix)
+	void sparse_gauss_seidel01();
+	// same as inflating_gauss_seidel01 with a sparse matrix
+	void sparse_inflating_gauss_seidel01();
+	// block-diagonal preconditioning
+	void sparse_precond01();
 
 	void det01();
 	void det02();
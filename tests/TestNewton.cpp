@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Jun 10, 2012
-// Last Update : Jun 10, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include "TestNewton.h"
@@ -18,6 +18,23 @@ using namespace std;
 
 namespace ibex {
 
+namespace {
+
+// Broyden tridiagonal function (the Jacobian matrix is tridiagonal)
+Function* broyden(int n) {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(n));
+	Array<const ExprNode> c(n);
+	for (int i=0; i<n; i++) {
+		const ExprNode* e=&((3-2*x[i])*x[i]+1);
+		if (i>0) e=&(*e-x[i-1]);
+		if (i<n-1) e=&(*e-2*x[i+1]);
+		c.set_ref(i,*e);
+	}
+	return new Function(x,ExprVector::new_col(c));
+}
+
+}
+
 static double BOX1[30][2]={
 		{3.4826061062102722232,3.4846061062102768879} ,
 		{3.5744039600153962866,3.5764039600154005072} ,
@@ -157,4 +174,57 @@ void TestNewton::ctc_parameter01() {
 	CPPUNIT_ASSERT(box[0].diam()<=0.1);
 	CPPUNIT_ASSERT(box[1].diam()<=0.1);
 }
+void TestNewton::sparse_newton01() {
+	int n=100;
+	Function* f=broyden(n);
+	CPPUNIT_ASSERT(f->jacobian_pattern().density()<default_newton_sparse_density);
+
+	IntervalVector box(n,Interval(-0.7,-0.3));
+	IntervalVector existence(n), unicity(n);
+	CPPUNIT_ASSERT(inflating_newton(*f,box,existence,unicity));
+
+	IntervalVector sparse_box=existence.mid();
+	sparse_box.inflate(0.01);
+	IntervalVector dense_box=sparse_box;
+
+	CPPUNIT_ASSERT(newton(*f,sparse_box));
+
+	double save=default_newton_sparse_density;
+	default_newton_sparse_density=0;
+	CPPUNIT_ASSERT(newton(*f,dense_box));
+	default_newton_sparse_density=save;
+
+	CPPUNIT_ASSERT(sparse_box.intersects(existence));
+	CPPUNIT_ASSERT(almost_eq(sparse_box,dense_box,1e-10));
+
+	// the pattern is calculated once (by the first call)
+	const SparseIntervalMatrix& pattern=f->cached_jacobian_pattern();
+	CPPUNIT_ASSERT(&f->cached_jacobian_pattern()==&pattern);
+	CPPUNIT_ASSERT(pattern.nnz()==f->jacobian_pattern().nnz());
+	delete f;
+}
+
+void TestNewton::sparse_inflating_newton01() {
+	int n=100;
+	Function* f=broyden(n);
+
+	IntervalVector box(n,Interval(-0.7,-0.3));
+	IntervalVector sparse_existence(n), sparse_unicity(n);
+	IntervalVector dense_existence(n), dense_unicity(n);
+
+	CPPUNIT_ASSERT(inflating_newton(*f,box,sparse_existence,sparse_unicity));
+
+	double save=default_newton_sparse_density;
+	default_newton_sparse_density=0;
+	CPPUNIT_ASSERT(inflating_newton(*f,box,dense_existence,dense_unicity));
+	default_newton_sparse_density=save;
+
+	CPPUNIT_ASSERT(sparse_unicity.is_superset(sparse_existence));
+	CPPUNIT_ASSERT(sparse_existence.intersects(dense_existence));
+	CPPUNIT_ASSERT(almost_eq(sparse_existence,dense_existence,1e-10));
+	// the solution is symmetric: x_{n/2}=-sqrt(2)/2
+	CPPUNIT_ASSERT(sparse_existence[n/2].contains(-::sqrt(2)/2));
+	delete f;
+}
+
 } // end namespace ibex
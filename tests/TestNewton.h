@@ -28,6 +28,8 @@ public:
 	CPPUNIT_TEST(inflating_newton01);
 	CPPUNIT_TEST(inflating_newton02);
 	CPPUNIT_TEST(ctc_parameter01);
+	CPPUNIT_TEST(sparse_newton01);
+	CPPUNIT_TEST(sparse_inflating_newton01);
 
 	CPPUNIT_TEST_SUITE_END();
 
@@ -35,6 +37,8 @@ public:
 	void inflating_newton01();
 	void inflating_newton02();
 	void ctc_parameter01();
+	void sparse_newton01();
+	void sparse_inflating_newton01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestNewton);
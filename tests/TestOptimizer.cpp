@@ -7,12 +7,13 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Mar 2, 2012
- * Last update : Oct 17, 2017
+ * Last update : Oct 18, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "TestOptimizer.h"
 #include "ibex_Optimizer.h"
 #include "ibex_DefaultOptimizer.h"
+#include "ibex_ParallelOptimizer.h"
 #include "ibex_SystemFactory.h"
 
 using namespace std;
@@ -116,4 +117,45 @@ void TestOptimizer::unconstrained() {
 	CPPUNIT_ASSERT(o.get_loup()>=0 && o.get_uplo()<=0);
 }
 
+void TestOptimizer::parallel() {
+
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(3));
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_ctr(x[0]*x[1]*x[2]>=1);
+	f.add_goal(x*x);
+	System sys(f);
+
+	int nb_threads=4;
+	Array<System> sys_copies(nb_threads);
+	Array<OptimizerConfig> configs(nb_threads);
+
+	for (int i=0; i<nb_threads; i++) {
+		sys_copies.set_ref(i, *new System(sys, System::COPY));
+		configs.set_ref(i, *new DefaultOptimizerConfig(sys_copies[i]));
+	}
+
+	ParallelOptimizer o(configs);
+	Optimizer::Status status=o.optimize(IntervalVector(3,Interval(0,10)));
+
+	CPPUNIT_ASSERT(status==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_loup()>=3 && o.get_uplo()<=3);
+	CPPUNIT_ASSERT(almost_eq(o.get_loup_point(),Vector::ones(3),0.1));
+
+	// same enclosure of the minimum as the sequential optimizer
+	DefaultOptimizerConfig config(sys);
+	Optimizer seq(config);
+	CPPUNIT_ASSERT(seq.optimize(IntervalVector(3,Interval(0,10)))==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_uplo()<=seq.get_loup() && seq.get_uplo()<=o.get_loup());
+	double eps=OptimizerConfig::default_rel_eps_f*seq.get_loup();
+	CPPUNIT_ASSERT(fabs(o.get_loup()-seq.get_loup())<=eps);
+	CPPUNIT_ASSERT(fabs(o.get_uplo()-seq.get_uplo())<=eps);
+
+	for (int i=0; i<nb_threads; i++) {
+		delete &configs[i];
+		delete &sys_copies[i];
+	}
+}
+
 } // end namespace
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jun 22, 2012
-// Last Update : May 22, 2019
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #include <sstream>
@@ -20,6 +20,9 @@
 #include "Ponts30.h"
 
 #include <cstdio>
+#ifndef _WIN32
+#include <thread>
+#endif
 
 using namespace std;
 
@@ -421,4 +424,41 @@ void TestParser::mutable_cst_2() {
 	CPPUNIT_ASSERT(f.jacobian(IntervalVector(1,1))[0][0]==3);
 }
 
+void TestParser::threads01() {
+#ifndef _WIN32
+	System ref(SRCDIR_TESTS "/quimper/ponts.qpr");
+
+	const int nb_threads=4;
+	const int nb_loads=10;
+
+	bool ok[nb_threads];
+
+	vector<thread> threads;
+	for (int t=0; t<nb_threads; t++) {
+		threads.push_back(thread([&,t]() {
+			ok[t]=true;
+			for (int i=0; i<nb_loads; i++) {
+				System sys(SRCDIR_TESTS "/quimper/ponts.qpr");
+				ok[t] &= sys.nb_var==30 && sys.nb_ctr==30;
+				ok[t] &= almost_eq(sys.box, ref.box, 1e-12);
+				ok[t] &= sameExpr(sys.f_ctrs.expr(),ref.f_ctrs.expr());
+
+				// a syntax error in a thread must not disturb the others
+				try {
+					Function f("x","x+");
+					ok[t]=false;
+				} catch(SyntaxError& e) {
+					ok[t] &= e.line==2;
+				}
+			}
+		}));
+	}
+
+	for (int t=0; t<nb_threads; t++) threads[t].join();
+
+	for (int t=0; t<nb_threads; t++)
+		CPPUNIT_ASSERT(ok[t]);
+#endif
+}
+
 } // end namespace
@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Apr 02, 2012
- * Last update : May 22, 2019
+ * Last update : Oct 18, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __TEST_PARSER_H__
@@ -54,6 +54,7 @@ public:
 	//CPPUNIT_TEST(issue365);
 	CPPUNIT_TEST(mutable_cst_1);
 	CPPUNIT_TEST(mutable_cst_2);
+	CPPUNIT_TEST(threads01);
 
 	//		CPPUNIT_TEST(error01);
 	CPPUNIT_TEST_SUITE_END();
@@ -86,6 +87,7 @@ public:
 
 	void temp_in_loop(); // issue #380
 	void diff_lock();    // see issue #365
+	void threads01();    // parsing in parallel
 	void issue365();
 	void issue474();
 };
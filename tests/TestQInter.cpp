@@ -0,0 +1,220 @@
+//============================================================================
+//                                  I B E X
+// File        : TestQInter.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "TestQInter.h"
+#include "ibex_QInter.h"
+#include "ibex_CtcQInter.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_BxpQInter.h"
+#include "ibex_Random.h"
+
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+IntervalVector rand_box(int n, double lb, double ub, double w) {
+	IntervalVector b(n);
+	for (int i=0; i<n; i++) {
+		double c=RNG::rand(lb,ub);
+		b[i]=Interval(c,c+RNG::rand(0,w));
+	}
+	return b;
+}
+
+// Q-intersection in 2D by enumeration of all the cells
+// (the bounds of the boxes are assumed to be distinct)
+IntervalVector qinter_ref(const Array<IntervalVector>& boxes, int q) {
+	vector<double> x[2];
+	for (int d=0; d<2; d++) {
+		for (int j=0; j<boxes.size(); j++) {
+			x[d].push_back(boxes[j][d].lb());
+			x[d].push_back(boxes[j][d].ub());
+		}
+		sort(x[d].begin(),x[d].end());
+	}
+	IntervalVector res=IntervalVector::empty(2);
+	IntervalVector cell(2);
+	for (unsigned int i=0; i+1<x[0].size(); i++) {
+		for (unsigned int k=0; k+1<x[1].size(); k++) {
+			cell[0]=Interval(x[0][i],x[0][i+1]);
+			cell[1]=Interval(x[1][k],x[1][k+1]);
+			int count=0;
+			for (int j=0; j<boxes.size(); j++)
+				if (boxes[j].contains(cell.mid())) count++;
+			if (count>=q) res |= cell;
+		}
+	}
+	return res;
+}
+
+}
+
+void TestQInter::projf01() {
+	double _b[][2]= { {0,2}, {1,3}, {1.5,4}, {5,6}, {5.5,7} };
+	Array<IntervalVector> boxes(5);
+	for (int j=0; j<5; j++)
+		boxes.set_ref(j,*new IntervalVector(1,Interval(_b[j][0],_b[j][1])));
+
+	CPPUNIT_ASSERT(qinter_projf(boxes,1)==IntervalVector(1,Interval(0,7)));
+	CPPUNIT_ASSERT(qinter_projf(boxes,2)==IntervalVector(1,Interval(1,6)));
+	CPPUNIT_ASSERT(qinter_projf(boxes,3)==IntervalVector(1,Interval(1.5,2)));
+	CPPUNIT_ASSERT(qinter_projf(boxes,4).is_empty());
+
+	for (int j=0; j<5; j++)
+		delete &boxes[j];
+
+	// in 2D: the 2-intersection of the projections is first [0,3]x[0,1]
+	// and the boxes that are not around (0,0) are removed one after the other.
+	double _c[][2][2]= { {{0,1},{0,1}}, {{0,1},{0,1}}, {{2,3},{-5,-4}}, {{-5,-4},{2,3}}, {{2,3},{2,3}} };
+	Array<IntervalVector> boxes2(5);
+	for (int j=0; j<5; j++)
+		boxes2.set_ref(j,*new IntervalVector(2,_c[j]));
+
+	double _res[][2]= { {0,1}, {0,1} };
+	CPPUNIT_ASSERT(qinter_projf(boxes2,2)==IntervalVector(2,_res));
+	CPPUNIT_ASSERT(qinter(boxes2,2)==IntervalVector(2,_res));
+
+	for (int j=0; j<5; j++)
+		delete &boxes2[j];
+}
+
+void TestQInter::grid01() {
+	RNG::srand(1);
+
+	for (int t=0; t<20; t++) {
+		int p=30;
+		Array<IntervalVector> boxes(p);
+		for (int j=0; j<p; j++)
+			boxes.set_ref(j,*new IntervalVector(rand_box(2,0,10,4)));
+
+		for (int q=1; q<=6; q++) {
+			IntervalVector ref=qinter_ref(boxes,q);
+			IntervalVector res=qinter(boxes,q);
+			CPPUNIT_ASSERT(res==ref);
+			CPPUNIT_ASSERT(qinter_projf(boxes,q).is_superset(res));
+			// projection only
+			CPPUNIT_ASSERT(qinter(boxes,q,0)==qinter_projf(boxes,q));
+		}
+
+		for (int j=0; j<p; j++)
+			delete &boxes[j];
+	}
+}
+
+void TestQInter::ctc01() {
+	// x=0 (twice), x=5, x=10
+	double a[]={0,0,5,10};
+	Variable x;
+	Array<Function> f(4);
+	Array<Ctc> c(4);
+	for (int i=0; i<4; i++) {
+		f.set_ref(i,*new Function(x,x-a[i]));
+		c.set_ref(i,*new CtcFwdBwd(f[i]));
+	}
+
+	CtcQInter qinter(c,2);
+
+	IntervalVector box(1,Interval(-10,10));
+	BoxProperties prop(box);
+	qinter.add_property(box,prop);
+	ContractContext context(prop);
+
+	qinter.contract(box,context);
+	CPPUNIT_ASSERT(box==IntervalVector(1,Interval::zero()));
+
+	// the constraints x=5 and x=10 are discarded
+	BxpQInter* bxp=(BxpQInter*) prop[qinter.discarded_prop_id];
+	CPPUNIT_ASSERT(bxp);
+	CPPUNIT_ASSERT(bxp->nb_discarded()==2);
+	CPPUNIT_ASSERT(bxp->is_discarded(2) && bxp->is_discarded(3));
+
+	// only x=0 (twice) can be satisfied
+	box=IntervalVector(1,Interval(-1,1));
+	qinter.contract(box,context);
+	CPPUNIT_ASSERT(box==IntervalVector(1,Interval::zero()));
+
+	qinter.q=3;
+	box=IntervalVector(1,Interval(-1,1));
+	qinter.contract(box,context);
+	CPPUNIT_ASSERT(box.is_empty());
+
+	for (int i=0; i<4; i++) {
+		delete &c[i];
+		delete &f[i];
+	}
+}
+
+void TestQInter::ctc_exact01() {
+	RNG::srand(1);
+
+	// x in b_i, with 12 boxes in 3D: the grid has more than 1e4 cells
+	int p=12;
+	Variable x(3);
+	Function id(x,x);
+	Array<IntervalVector> boxes(p);
+	Array<Ctc> c(p);
+	for (int j=0; j<p; j++) {
+		boxes.set_ref(j,*new IntervalVector(rand_box(3,0,10,6)));
+		c.set_ref(j,*new CtcFwdBwd(id,boxes[j]));
+	}
+
+	for (int q=2; q<=4; q++) {
+		CtcQInter ctc(c,q);
+		IntervalVector box(3,Interval(-1,11));
+		ctc.contract(box);
+		CPPUNIT_ASSERT(box==qinter(boxes,q));
+	}
+
+	for (int j=0; j<p; j++) {
+		delete &c[j];
+		delete &boxes[j];
+	}
+}
+
+void TestQInter::ctc_threads01() {
+	RNG::srand(1);
+
+	// points at distance d_i from the ith beacon
+	int p=100;
+	Variable x(2);
+	Array<Function> f(p);
+	Array<Ctc> c(p);
+	for (int i=0; i<p; i++) {
+		double bx=RNG::rand(0,10);
+		double by=RNG::rand(0,10);
+		double d=std::sqrt(::pow(bx-3,2)+::pow(by-4,2));
+		if (i%5==0) d+=RNG::rand(1,3); // outlier
+		f.set_ref(i,*new Function(x,sqrt(sqr(x[0]-bx)+sqr(x[1]-by))-(d+Interval(-0.1,0.1))));
+		c.set_ref(i,*new CtcFwdBwd(f[i]));
+	}
+
+	CtcQInter qinter1(c,70);
+	CtcQInter qinter4(c,70,4);
+
+	IntervalVector box1(2,Interval(0,10));
+	IntervalVector box4(box1);
+	qinter1.contract(box1);
+	qinter4.contract(box4);
+
+	CPPUNIT_ASSERT(!box1.is_empty());
+	CPPUNIT_ASSERT(box1.is_strict_subset(IntervalVector(2,Interval(0,10))));
+	CPPUNIT_ASSERT(box1==box4);
+
+	for (int i=0; i<p; i++) {
+		delete &c[i];
+		delete &f[i];
+	}
+}
+
+} // end namespace ibex
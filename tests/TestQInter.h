@@ -0,0 +1,44 @@
+/* ============================================================================
+ * I B E X - Q-intersection Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_QINTER_H__
+#define __TEST_QINTER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestQInter : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestQInter);
+	CPPUNIT_TEST(projf01);
+	CPPUNIT_TEST(grid01);
+	CPPUNIT_TEST(ctc01);
+	CPPUNIT_TEST(ctc_exact01);
+	CPPUNIT_TEST(ctc_threads01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void projf01();
+	void grid01();
+	void ctc01();
+	void ctc_exact01();
+	void ctc_threads01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestQInter);
+
+} // end namespace
+
+#endif // __TEST_QINTER_H__
@@ -11,6 +11,9 @@
 #include "ibex_Set.h"
 #include "ibex_SetLeaf.h"
 #include "ibex_SetBisect.h"
+#include "ibex_SetFlat.h"
+#include "ibex_ParallelSep.h"
+#include "ibex_SepFwdBwd.h"
 
 using namespace std;
 
@@ -420,4 +423,114 @@ void TestSet::diff15() {
 	CPPUNIT_ASSERT(leaf->status==MAYBE);
 
 }
+void TestSet::is_superset01() {
+	IntervalVector R(1);
+	IntervalVector box(1,Interval(1,2));
+
+	// the left child does not intersect the box: the
+	// answer is given by the right child only
+	SetBisect* node=new SetBisect(0,0,new SetLeaf(YES),new SetLeaf(MAYBE));
+	CPPUNIT_ASSERT(node->is_superset(R,box)==MAYBE);
+	delete node;
+
+	node=new SetBisect(0,0,new SetLeaf(YES),new SetLeaf(NO));
+	CPPUNIT_ASSERT(node->is_superset(R,box)==NO);
+	delete node;
+
+	node=new SetBisect(0,0,new SetLeaf(NO),new SetLeaf(YES));
+	CPPUNIT_ASSERT(node->is_superset(R,box)==YES);
+	CPPUNIT_ASSERT(node->is_superset(R,IntervalVector(1,Interval(-1,1)))==NO);
+	delete node;
+}
+
+void TestSet::flat() {
+	Set set(IntervalVector(2,Interval(-1,1)));
+	double _b1[][2]={{0.5,2},{-0.5,0.5}};
+	Set set1(IntervalVector(2,_b1));
+	set |= set1;
+	double _b2[][2]={{-0.3,0.3},{-0.2,0.2}};
+	Set set2(IntervalVector(2,_b2),NO);
+	set &= set2;
+
+	SetFlat flat(set);
+	CPPUNIT_ASSERT(flat.nb_var()==2);
+
+	// points (not on the boundary of a leaf)
+	int N=40;
+	Matrix points(N*N,2);
+	for (int i=0; i<N; i++)
+		for (int j=0; j<N; j++) {
+			points[i*N+j][0]=-2+4.0*(i+0.3183)/N;
+			points[i*N+j][1]=-2+4.0*(j+0.7071)/N;
+		}
+
+	BoolInterval* res=new BoolInterval[N*N];
+	flat.contains(points,res);
+	for (int k=0; k<N*N; k++) {
+		CPPUNIT_ASSERT(flat.contains(points[k])==set.is_superset(IntervalVector(points[k])));
+		CPPUNIT_ASSERT(res[k]==flat.contains(points[k]));
+	}
+	delete[] res;
+
+	CPPUNIT_ASSERT(flat.is_superset(IntervalVector(2,Interval(-0.1,0.1)))==MAYBE);
+	CPPUNIT_ASSERT(flat.is_superset(IntervalVector(2,Interval(2.5,3)))==NO);
+	CPPUNIT_ASSERT(flat.is_superset(IntervalVector(2,Interval(-2,2)))==NO);
+
+	IntervalMatrix boxes(2,2);
+	boxes[0]=IntervalVector(2,Interval(-0.1,0.1));
+	boxes[1]=IntervalVector(2,Interval(2.5,3));
+	BoolInterval res2[2];
+	flat.is_superset(boxes,res2);
+	CPPUNIT_ASSERT(res2[0]==MAYBE && res2[1]==NO);
+
+	// save and map
+	flat.save("set.flat");
+	SetFlat flat2("set.flat");
+	CPPUNIT_ASSERT(flat2.nb_var()==2);
+	CPPUNIT_ASSERT(flat2.nb_nodes()==flat.nb_nodes());
+	for (size_t i=0; i<flat.nb_nodes(); i++) {
+		CPPUNIT_ASSERT(flat2.nodes()[i].var==flat.nodes()[i].var);
+		CPPUNIT_ASSERT(flat2.nodes()[i].pt==flat.nodes()[i].pt);
+		CPPUNIT_ASSERT(flat2.nodes()[i].right==flat.nodes()[i].right);
+	}
+	remove("set.flat");
+}
+
+void TestSet::parallel() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+2*sqr(y)+sqr(x-y));
+
+	Set set1(2);
+	SepFwdBwd sep(f,Interval(0,1));
+	sep.contract(set1,0.01);
+
+	int nb_threads=4;
+	Array<Function> fs(nb_threads);
+	Array<Sep> seps(nb_threads);
+	for (int w=0; w<nb_threads; w++) {
+		fs.set_ref(w,*new Function(f,Function::COPY));
+		seps.set_ref(w,*new SepFwdBwd(fs[w],Interval(0,1)));
+	}
+
+	Set set2(2);
+	ParallelSep psep(seps);
+	psep.contract(set2,0.01);
+
+	// the trees must be identical
+	SetFlat flat1(set1);
+	SetFlat flat2(set2);
+	CPPUNIT_ASSERT(flat1.nb_nodes()>1);
+	CPPUNIT_ASSERT(flat2.nb_nodes()==flat1.nb_nodes());
+	for (size_t i=0; i<flat1.nb_nodes(); i++) {
+		CPPUNIT_ASSERT(flat2.nodes()[i].var==flat1.nodes()[i].var);
+		CPPUNIT_ASSERT(flat2.nodes()[i].pt==flat1.nodes()[i].pt);
+		CPPUNIT_ASSERT(flat2.nodes()[i].right==flat1.nodes()[i].right);
+	}
+
+	for (int w=0; w<nb_threads; w++) {
+		delete &seps[w];
+		delete &fs[w];
+	}
+}
+
 } // end namespace ibex
@@ -36,6 +36,9 @@ public:
 //		CPPUNIT_TEST(diff13);
 //		CPPUNIT_TEST(diff14);
 		CPPUNIT_TEST(diff15);
+		CPPUNIT_TEST(is_superset01);
+		CPPUNIT_TEST(flat);
+		CPPUNIT_TEST(parallel);
 	CPPUNIT_TEST_SUITE_END();
 
 	void diff01();
@@ -53,6 +56,9 @@ public:
 	void diff13();
 	void diff14();
 	void diff15();
+	void is_superset01();
+	void flat();
+	void parallel();
 
 };
 
@@ -12,6 +12,7 @@
 #include "TestSolver.h"
 #include "ibex_SystemFactory.h"
 #include "ibex_DefaultSolver.h"
+#include "ibex_ParallelSolver.h"
 #include "ibex_RoundRobin.h"
 #include "ibex_CellStack.h"
 #include "ibex_CtcHC4.h"
@@ -205,4 +206,139 @@ void TestSolver::circle4() {
 }
 
 
+void TestSolver::parallel() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	System sys(f);
+
+	IntervalVector box(2,Interval(-10,10));
+	Vector prec(2,1e-2);
+	Vector prec_max(2,1e-1);
+
+	// sequential search
+	RoundRobin rr(1e-2);
+	CellStack stack;
+	CtcHC4 hc4(sys);
+	Solver seq(sys,hc4,rr,stack,prec,prec_max);
+	Solver::Status seq_status=seq.solve(box);
+	const CovSolverData& seq_data=seq.get_data();
+
+	// parallel search
+	int nb_threads=4;
+	Array<System> sys_copies(nb_threads);
+	Array<Ctc> ctcs(nb_threads);
+	Array<Bsc> bscs(nb_threads);
+	Array<CellBuffer> buffers(nb_threads);
+	Array<Solver> solvers(nb_threads);
+
+	for (int i=0; i<nb_threads; i++) {
+		sys_copies.set_ref(i, *new System(sys, System::COPY));
+		ctcs.set_ref(i, *new CtcHC4(sys_copies[i]));
+		bscs.set_ref(i, *new RoundRobin(1e-2));
+		buffers.set_ref(i, *new CellStack());
+		solvers.set_ref(i, *new Solver(i==0? sys : sys_copies[i],ctcs[i],bscs[i],buffers[i],prec,prec_max));
+	}
+
+	ParallelSolver par(sys,solvers);
+	Solver::Status par_status=par.solve(box);
+	const CovSolverData& par_data=par.get_data();
+
+	CPPUNIT_ASSERT(par_status==seq_status);
+	CPPUNIT_ASSERT(par_data.nb_solution()==seq_data.nb_solution());
+	CPPUNIT_ASSERT(par_data.nb_boundary()==seq_data.nb_boundary());
+	CPPUNIT_ASSERT(par_data.nb_unknown()==seq_data.nb_unknown());
+	CPPUNIT_ASSERT(par_data.nb_pending()==0);
+	CPPUNIT_ASSERT(par.get_nb_cells()==seq.get_nb_cells());
+
+	// same boxes, up to ordering
+	for (size_t i=0; i<par_data.nb_solution(); i++) {
+		bool found=false;
+		for (size_t j=0; !found && j<seq_data.nb_solution(); j++)
+			found = par_data.solution(i)==seq_data.solution(j);
+		CPPUNIT_ASSERT(found);
+	}
+
+	// the cell limit is global
+	par.cell_limit=100;
+	CPPUNIT_ASSERT(par.solve(box)==Solver::CELL_OVERFLOW);
+	CPPUNIT_ASSERT(par.get_nb_cells()>=100);
+	CPPUNIT_ASSERT(par.get_data().nb_pending()>0);
+
+	for (int i=0; i<nb_threads; i++) {
+		delete &solvers[i];
+		delete &buffers[i];
+		delete &bscs[i];
+		delete &ctcs[i];
+		delete &sys_copies[i];
+	}
+}
+
+void TestSolver::parallel_ineq() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)<=1);
+	System sys(f);
+
+	IntervalVector box(2,Interval(-2,2));
+	Vector prec(2,1e-1);
+
+	RoundRobin rr(1e-1);
+	CellStack stack;
+	CtcHC4 hc4(sys);
+	Solver seq(sys,hc4,rr,stack,prec,prec);
+	Solver::Status seq_status=seq.solve(box);
+	const CovSolverData& seq_data=seq.get_data();
+
+	int nb_threads=4;
+	Array<System> sys_copies(nb_threads);
+	Array<Ctc> ctcs(nb_threads);
+	Array<Bsc> bscs(nb_threads);
+	Array<CellBuffer> buffers(nb_threads);
+	Array<Solver> solvers(nb_threads);
+
+	for (int i=0; i<nb_threads; i++) {
+		sys_copies.set_ref(i, *new System(sys, System::COPY));
+		ctcs.set_ref(i, *new CtcHC4(sys_copies[i]));
+		bscs.set_ref(i, *new RoundRobin(1e-1));
+		buffers.set_ref(i, *new CellStack());
+		solvers.set_ref(i, *new Solver(i==0? sys : sys_copies[i],ctcs[i],bscs[i],buffers[i],prec,prec));
+	}
+
+	ParallelSolver par(sys,solvers);
+	Solver::Status par_status=par.solve(box);
+	const CovSolverData& par_data=par.get_data();
+
+	// inner boxes are also solutions (without unicity box)
+	CPPUNIT_ASSERT(seq_data.nb_inner()>0);
+	CPPUNIT_ASSERT(par_status==seq_status);
+	CPPUNIT_ASSERT(par_data.nb_inner()==seq_data.nb_inner());
+	CPPUNIT_ASSERT(par_data.nb_solution()==seq_data.nb_solution());
+	CPPUNIT_ASSERT(par_data.nb_boundary()==seq_data.nb_boundary());
+	CPPUNIT_ASSERT(par_data.nb_unknown()==seq_data.nb_unknown());
+
+	for (size_t i=0; i<par_data.nb_inner(); i++) {
+		bool found=false;
+		for (size_t j=0; !found && j<seq_data.nb_inner(); j++)
+			found = par_data.inner(i)==seq_data.inner(j);
+		CPPUNIT_ASSERT(found);
+	}
+
+	for (int i=0; i<nb_threads; i++) {
+		delete &solvers[i];
+		delete &buffers[i];
+		delete &bscs[i];
+		delete &ctcs[i];
+		delete &sys_copies[i];
+	}
+}
+
 } // end namespace
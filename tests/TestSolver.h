@@ -33,6 +33,8 @@ public:
 	CPPUNIT_TEST(circle2);
 	CPPUNIT_TEST(circle3);
 	CPPUNIT_TEST(circle4);
+	CPPUNIT_TEST(parallel);
+	CPPUNIT_TEST(parallel_ineq);
 	CPPUNIT_TEST_SUITE_END();
 
 	void empty();
@@ -40,6 +42,8 @@ public:
 	void circle2();
 	void circle3();
 	void circle4();
+	void parallel();
+	void parallel_ineq();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestSolver);
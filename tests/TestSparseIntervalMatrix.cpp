@@ -0,0 +1,104 @@
+/* ============================================================================
+ * I B E X - TestSparseIntervalMatrix
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestSparseIntervalMatrix.h"
+#include "ibex_SparseIntervalMatrix.h"
+
+using namespace std;
+
+void TestSparseIntervalMatrix::pattern01() {
+	vector<vector<int> > pattern(3);
+	pattern[0] = { 3, 1, 3 }; // unsorted, duplicate
+	pattern[2] = { 0 };
+
+	SparseIntervalMatrix A(3,4,pattern);
+	CPPUNIT_ASSERT(A.nb_rows()==3);
+	CPPUNIT_ASSERT(A.nb_cols()==4);
+	CPPUNIT_ASSERT(A.nnz()==3);
+	CPPUNIT_ASSERT(A.density()==0.25);
+
+	CPPUNIT_ASSERT(A.row_begin(0)==0 && A.row_end(0)==2);
+	CPPUNIT_ASSERT(A.col(0)==1 && A.col(1)==3);
+	CPPUNIT_ASSERT(A.row_begin(1)==A.row_end(1));
+	CPPUNIT_ASSERT(A.row_begin(2)==2 && A.row_end(2)==3);
+
+	CPPUNIT_ASSERT(A.find(0,3)==1);
+	CPPUNIT_ASSERT(A.find(0,2)==-1);
+	CPPUNIT_ASSERT(A.find(1,0)==-1);
+	CPPUNIT_ASSERT(A.find(2,0)==2);
+
+	A[A.find(0,3)]=Interval(1,2);
+	CPPUNIT_ASSERT(A(0,3)==Interval(1,2));
+	CPPUNIT_ASSERT(A(0,1)==Interval::zero());
+	CPPUNIT_ASSERT(A(1,1)==Interval::zero());
+
+	A.clear();
+	CPPUNIT_ASSERT(A(0,3)==Interval::zero());
+}
+
+void TestSparseIntervalMatrix::dense01() {
+	double _M[][2] = { {0,0}, {1,2}, {0,0},
+	                   {0,0}, {0,0}, {0,0},
+	                   {-1,1}, {0,0}, {3,3} };
+	IntervalMatrix M(3,3,_M);
+
+	SparseIntervalMatrix A(M);
+	CPPUNIT_ASSERT(A.nnz()==3);
+	CPPUNIT_ASSERT(A(0,1)==Interval(1,2));
+	CPPUNIT_ASSERT(A(2,0)==Interval(-1,1));
+	CPPUNIT_ASSERT(A(2,2)==Interval(3,3));
+	CPPUNIT_ASSERT(A.dense()==M);
+
+	IntervalMatrix M2(3,3,Interval(5,6));
+	A.gather(M2);
+	CPPUNIT_ASSERT(A(0,1)==Interval(5,6));
+	CPPUNIT_ASSERT(A(0,0)==Interval::zero());
+}
+
+void TestSparseIntervalMatrix::mul01() {
+	vector<vector<int> > pattern(2);
+	pattern[0] = { 0, 2 };
+	pattern[1] = { 1 };
+
+	SparseIntervalMatrix A(2,3,pattern);
+	A[0]=Interval(1,2);
+	A[1]=Interval(-1);
+	A[2]=Interval(2);
+
+	double _x[][2] = { {1,1}, {0,1}, {2,3} };
+	IntervalVector x(3,_x);
+
+	IntervalVector y=A*x;
+	CPPUNIT_ASSERT(y==A.dense()*x);
+	CPPUNIT_ASSERT(y[0]==Interval(-2,0));
+	CPPUNIT_ASSERT(y[1]==Interval(0,2));
+}
+
+void TestSparseIntervalMatrix::empty01() {
+	vector<vector<int> > pattern(2);
+	pattern[0] = { 0 };
+	pattern[1] = { 1 };
+
+	SparseIntervalMatrix A(2,2,pattern);
+	CPPUNIT_ASSERT(!A.is_empty());
+	A.set_empty();
+	CPPUNIT_ASSERT(A.is_empty());
+	CPPUNIT_ASSERT(A.dense().is_empty());
+	CPPUNIT_ASSERT((A*IntervalVector(2)).is_empty());
+
+	IntervalMatrix M(2,2);
+	M.set_empty();
+	SparseIntervalMatrix B(M);
+	CPPUNIT_ASSERT(B.is_empty());
+
+	A.clear();
+	CPPUNIT_ASSERT(!A.is_empty());
+}
@@ -0,0 +1,40 @@
+/* ============================================================================
+ * I B E X - TestSparseIntervalMatrix
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_SPARSE_INTERVAL_MATRIX_H__
+#define __TEST_SPARSE_INTERVAL_MATRIX_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestSparseIntervalMatrix : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestSparseIntervalMatrix);
+	CPPUNIT_TEST(pattern01);
+	CPPUNIT_TEST(dense01);
+	CPPUNIT_TEST(mul01);
+	CPPUNIT_TEST(empty01);
+	CPPUNIT_TEST_SUITE_END();
+private:
+
+	void pattern01();
+	void dense01();
+	void mul01();
+	void empty01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSparseIntervalMatrix);
+
+#endif // __TEST_SPARSE_INTERVAL_MATRIX_H__
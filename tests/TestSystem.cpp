@@ -16,6 +16,10 @@
 #include "ibex_SyntaxError.h"
 #include "ibex_NormalizedSystem.h"
 #include "ibex_DefaultSolver.h"
+#include "ibex_SystemCache.h"
+
+#include <fstream>
+#include <cstdio>
 
 #include <sstream>
 
@@ -434,4 +438,162 @@ void TestSystem::mutable_cst() {
 	CPPUNIT_ASSERT(solver.get_data().solution(1)[0]==Interval(8));
 	CPPUNIT_ASSERT(solver.get_data().solution(2)[0]==Interval(9));
 }
+
+namespace {
+
+// copy a source file in the current directory (so that the cache
+// is not created in the source tree) and remove its cache, if any.
+void copy_source(const char* src, const char* dest) {
+	std::ifstream in(src);
+	std::ofstream out(dest);
+	out << in.rdbuf();
+	remove(SystemCache::filename(dest).c_str());
+}
+
+}
+
+void TestSystem::cache01() {
+	const char* filename="TestSystem_cache01.bch";
+	copy_source(SRCDIR_TESTS "/minibex/alkyl.bch", filename);
+
+	System sys1(filename, simpl);
+	System sys0(filename, simpl, true, false); // does not create the cache
+	CPPUNIT_ASSERT(!std::ifstream(SystemCache::filename(filename).c_str()).good());
+	System sys2(filename, simpl, true); // creates the cache
+	CPPUNIT_ASSERT(std::ifstream(SystemCache::filename(filename).c_str()).good());
+	System sys3(filename, simpl, true, false); // loaded from the cache
+
+	CPPUNIT_ASSERT(sys3.nb_var==sys1.nb_var);
+	CPPUNIT_ASSERT(sys3.nb_ctr==sys1.nb_ctr);
+	CPPUNIT_ASSERT(sys3.box==sys1.box);
+	CPPUNIT_ASSERT(sys3.goal!=NULL);
+	CPPUNIT_ASSERT(sameExpr(sys3.goal->expr(),sys1.goal->expr()));
+	for (int i=0; i<sys1.nb_ctr; i++) {
+		CPPUNIT_ASSERT(sys3.ops[i]==sys1.ops[i]);
+		CPPUNIT_ASSERT(sameExpr(sys3.ctrs[i].f.expr(),sys1.ctrs[i].f.expr()));
+	}
+
+	IntervalVector box=sys1.box.mid();
+	CPPUNIT_ASSERT(sys3.f_ctrs.eval_vector(box)==sys1.f_ctrs.eval_vector(box));
+	CPPUNIT_ASSERT(sys3.goal->eval(box)==sys1.goal->eval(box));
+
+	remove(SystemCache::filename(filename).c_str());
+	remove(filename);
+}
+
+void TestSystem::cache02() {
+	const char* filename="TestSystem_cache02.mbx";
+	copy_source(SRCDIR_TESTS "/minibex/mutable_cst.mbx", filename);
+
+	{
+		System sys(filename, simpl, true); // creates the cache
+	}
+	{
+		System sys(filename, simpl, true); // loaded from the cache
+		CPPUNIT_ASSERT(sys.constant("a").i()==Interval(1));
+		sys.constant("a").i()=4;
+		CPPUNIT_ASSERT(sys.f_ctrs.eval(IntervalVector(1,4.0))==Interval::zero());
+	}
+
+	// the source is modified: the cache must be ignored
+	std::ofstream(filename) << "variables x in [1,2]; constraints x=0; end";
+	System sys(filename, simpl, true);
+	CPPUNIT_ASSERT(sys.box==IntervalVector(1,Interval(1,2)));
+
+	remove(SystemCache::filename(filename).c_str());
+	remove(filename);
+}
+
+namespace {
+
+// offset of the payload size in the header of a cache file
+// (see ibex_SystemCache.cpp) followed by the payload checksum.
+const size_t PAYLOAD_SIZE_OFFSET = SystemCache::SIGNATURE_LENGTH + 2*sizeof(uint32_t) + sizeof(uint64_t) + sizeof(int32_t);
+
+const size_t HEADER_SIZE = PAYLOAD_SIZE_OFFSET + 2*sizeof(uint64_t);
+
+std::string read_cache(const char* filename) {
+	std::ifstream in(SystemCache::filename(filename).c_str(), std::ios::binary);
+	std::stringstream s;
+	s << in.rdbuf();
+	return s.str();
+}
+
+// write a modified payload, with a valid size and checksum
+void write_cache(const char* filename, const std::string& header, const std::string& payload) {
+	uint64_t size=payload.size();
+	uint64_t sum=14695981039346656037ULL; // FNV-1a
+	for (size_t i=0; i<payload.size(); i++) {
+		sum ^= (unsigned char) payload[i];
+		sum *= 1099511628211ULL;
+	}
+	std::string h(header);
+	h.replace(PAYLOAD_SIZE_OFFSET, sizeof(uint64_t), (const char*) &size, sizeof(uint64_t));
+	h.replace(PAYLOAD_SIZE_OFFSET+sizeof(uint64_t), sizeof(uint64_t), (const char*) &sum, sizeof(uint64_t));
+	std::ofstream out(SystemCache::filename(filename).c_str(), std::ios::binary);
+	out << h << payload;
+}
+
+}
+
+void TestSystem::cache03() {
+	const char* filename="TestSystem_cache03.mbx";
+	copy_source(SRCDIR_TESTS "/minibex/mutable_cst.mbx", filename);
+
+	// note: with simplification level 2, the indexed mutable
+	// constants (b(1), b(2)) prevent the cache from being written.
+	int level=1;
+
+	{
+		System sys(filename, level, true); // creates the cache
+	}
+
+	std::string cache=read_cache(filename);
+	CPPUNIT_ASSERT(cache.size()>HEADER_SIZE);
+	std::string header=cache.substr(0,HEADER_SIZE);
+	std::string payload=cache.substr(HEADER_SIZE);
+
+	// The payload ends with the number of constraints of the main function
+	// and their operators. A wrong number is detected at the very end,
+	// once all the rest (mutable constants, variables, etc.) has been read.
+	int32_t m=2;
+	payload.replace(payload.size()-2*sizeof(int32_t), sizeof(int32_t), (const char*) &m, sizeof(int32_t));
+	write_cache(filename, header, payload);
+
+	{
+		System sys(filename, level, true, false); // loaded from the source
+		CPPUNIT_ASSERT(sys.nb_var==1);
+		CPPUNIT_ASSERT(sys.args.size()==1);
+		CPPUNIT_ASSERT(sys.nb_ctr==1);
+		CPPUNIT_ASSERT(sys.constant("a").i()==Interval(1));
+		CPPUNIT_ASSERT(sys.f_ctrs.eval(IntervalVector(1,1.0))==Interval::zero());
+	}
+
+	// An unknown generic operator instead of sqr.
+	std::ofstream(filename) << "variables x in [0,1]; constraints sqr(x)<=0; end";
+	{
+		System sys(filename, level, true); // creates the cache
+	}
+	cache=read_cache(filename);
+	CPPUNIT_ASSERT(cache.size()>HEADER_SIZE);
+	header=cache.substr(0,HEADER_SIZE);
+	payload=cache.substr(HEADER_SIZE);
+
+	int32_t type=ExprNode::NumExprSqr;
+	size_t pos=payload.find(std::string((const char*) &type, sizeof(int32_t)));
+	CPPUNIT_ASSERT(pos!=std::string::npos);
+	int32_t generic[2] = { ExprNode::NumExprGenericUnaryOp, 7 };
+	payload.replace(pos, sizeof(int32_t), std::string((const char*) generic, 2*sizeof(int32_t))+"unknown");
+	write_cache(filename, header, payload);
+
+	{
+		System sys(filename, level, true, false); // loaded from the source
+		CPPUNIT_ASSERT(sys.nb_var==1);
+		CPPUNIT_ASSERT(sys.f_ctrs.eval(IntervalVector(1,0.5))==Interval(0.25));
+	}
+
+	remove(SystemCache::filename(filename).c_str());
+	remove(filename);
+}
+
 } // end namespace
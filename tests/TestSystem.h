@@ -43,6 +43,9 @@ public:
 	CPPUNIT_TEST(merge03);
 	CPPUNIT_TEST(merge04);
 	CPPUNIT_TEST(mutable_cst);
+	CPPUNIT_TEST(cache01);
+	CPPUNIT_TEST(cache02);
+	CPPUNIT_TEST(cache03);
 	CPPUNIT_TEST_SUITE_END();
 
 	void empty();
@@ -62,6 +65,10 @@ public:
 	void merge03();
 	void merge04();
 	void mutable_cst();
+	void cache01();
+	void cache02();
+	// corrupted content with valid checksums
+	void cache03();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestSystem);
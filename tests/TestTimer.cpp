@@ -134,4 +134,71 @@ void TestTimer::test03() {
 
 }
 
+void TestTimer::real_time01() {
+	Timer t(Timer::REAL_TIME);
+	CPPUNIT_ASSERT(t.get_time()==0);
+	t.start();
+	while (t.get_time()<0.02) { }
+	t.stop();
+	CPPUNIT_ASSERT(t.get_time()>=0.02);
+	CPPUNIT_ASSERT(t.get_time()<1);
+}
+
+namespace {
+
+// call check_amortized until the time is out and
+// return the time at which it happened.
+double time_out(Timer::clock_type clock, double timeout) {
+	Timer t(clock);
+	t.start();
+	volatile int x=0;
+	try {
+		while (true) {
+			x=x+1; // a very cheap iteration
+			t.check_amortized(timeout);
+		}
+	} catch(TimeOutException&) {
+		t.stop();
+		return t.get_time();
+	}
+}
+
+}
+
+void TestTimer::amortized01() {
+	double t=time_out(Timer::REAL_TIME, 0.05);
+	CPPUNIT_ASSERT(t>=0.05);
+	CPPUNIT_ASSERT(t<0.5);
+}
+
+void TestTimer::amortized02() {
+	double t=time_out(Timer::CPU_TIME, 0.05);
+	CPPUNIT_ASSERT(t>=0.05);
+	CPPUNIT_ASSERT(t<0.5);
+}
+
+void TestTimer::amortized03() {
+	// the iterations become 10000 times more expensive after 0.05s:
+	// the timeout must not be overshot by the number of cheap
+	// iterations between two readings of the clock.
+	Timer t(Timer::REAL_TIME);
+	Timer clock(Timer::REAL_TIME);
+	t.start();
+	clock.start();
+	volatile int x=0;
+	try {
+		while (true) {
+			if (clock.get_time()<0.05)
+				x=x+1;
+			else
+				for (int i=0; i<10000; i++) x=x+1;
+			t.check_amortized(0.1);
+		}
+	} catch(TimeOutException&) {
+		t.stop();
+	}
+	CPPUNIT_ASSERT(t.get_time()>=0.1);
+	CPPUNIT_ASSERT(t.get_time()<0.5);
+}
+
 } // end namespace